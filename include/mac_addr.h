@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,6 +30,17 @@ typedef struct mac_address_str_t
 
 #define MAC_ADDR_STR_BYTE_OFFSET(idx_) ((idx_)*3)
 
+#define MAC_ADDR_STR_LEN        ((MAC_ADDRESS_NUM_BYTES * 2) + (MAC_ADDRESS_NUM_BYTES - 1)) // "XX:XX:XX:XX:XX:XX"
+#define MAC_ADDR_STR_NO_SEP_LEN (MAC_ADDRESS_NUM_BYTES * 2)                                 // "XXXXXXXXXXXX"
+
+typedef enum mac_addr_str_fmt_e
+{
+    MAC_ADDR_STR_FMT_COLON_UPPER,  //!< "AA:BB:CC:DD:EE:FF"
+    MAC_ADDR_STR_FMT_COLON_LOWER,  //!< "aa:bb:cc:dd:ee:ff"
+    MAC_ADDR_STR_FMT_NO_SEP_UPPER, //!< "AABBCCDDEEFF"
+    MAC_ADDR_STR_FMT_NO_SEP_LOWER, //!< "aabbccddeeff"
+} mac_addr_str_fmt_e;
+
 #define MAC_ADDR_INIT(mac1, mac2, mac3, mac4, mac5, mac6) \
     (mac_address_bin_t) \
     { \
@@ -40,11 +52,80 @@ typedef struct mac_address_str_t
 void
 mac_address_bin_init(mac_address_bin_t* p_mac, const uint8_t mac[MAC_ADDRESS_NUM_BYTES]);
 
+/**
+ * @brief Convert MAC address to a string in format "AA:BB:CC:DD:EE:FF".
+ * @param p_mac - pointer to the MAC address.
+ * @return the string with MAC address.
+ */
 mac_address_str_t
 mac_address_to_str(const mac_address_bin_t* p_mac);
 
 /**
- * @brief Convert a string in format "AA:BB:CC:DD:EE:FF" to binary format
+ * @brief Convert MAC address to a string in format "aa:bb:cc:dd:ee:ff".
+ * @param p_mac - pointer to the MAC address.
+ * @return the string with MAC address.
+ */
+mac_address_str_t
+mac_address_to_str_lower(const mac_address_bin_t* p_mac);
+
+/**
+ * @brief Convert MAC address to a string in format "AABBCCDDEEFF".
+ * @param p_mac - pointer to the MAC address.
+ * @return the string with MAC address.
+ */
+mac_address_str_t
+mac_address_to_str_no_sep(const mac_address_bin_t* p_mac);
+
+/**
+ * @brief Convert MAC address to a string in the specified format.
+ * @param p_mac - pointer to the MAC address.
+ * @param fmt - the format of the output string.
+ * @return the string with MAC address.
+ */
+mac_address_str_t
+mac_address_to_str_with_fmt(const mac_address_bin_t* p_mac, const mac_addr_str_fmt_e fmt);
+
+/**
+ * @brief Get the length of MAC address string (without the null terminator) in the specified format.
+ * @param fmt - the format of the string.
+ * @return MAC_ADDR_STR_LEN or MAC_ADDR_STR_NO_SEP_LEN.
+ */
+size_t
+mac_addr_str_fmt_get_len(const mac_addr_str_fmt_e fmt);
+
+/**
+ * @brief Write MAC address in the specified format to the buffer.
+ * @param p_mac - pointer to the MAC address.
+ * @param fmt - the format of the output string.
+ * @param[out] p_buf - pointer to the output buffer of at least mac_addr_str_fmt_get_len(fmt) + 1 bytes,
+ *                     the string is null-terminated.
+ * @return the length of the string.
+ */
+size_t
+mac_addr_to_str_buf(const mac_address_bin_t* p_mac, const mac_addr_str_fmt_e fmt, char* const p_buf);
+
+/**
+ * @brief Format an array of MAC addresses into one contiguous buffer.
+ * @note Every string is null-terminated and the strings are placed with a fixed stride
+ *       of mac_addr_str_fmt_get_len(fmt) + 1 bytes, so the i-th string starts at p_buf[i * stride].
+ * @param p_arr_of_mac - pointer to the array of MAC addresses.
+ * @param num_mac - the number of MAC addresses in the array.
+ * @param fmt - the format of the output strings.
+ * @param[out] p_buf - pointer to the output buffer.
+ * @param buf_size - the size of the output buffer, it must be at least num_mac * stride.
+ * @return true if successful, false if the buffer is too small.
+ */
+bool
+mac_addr_to_str_batch(
+    const mac_address_bin_t* const p_arr_of_mac,
+    const size_t                   num_mac,
+    const mac_addr_str_fmt_e       fmt,
+    char* const                    p_buf,
+    const size_t                   buf_size);
+
+/**
+ * @brief Convert a string in format "AA:BB:CC:DD:EE:FF", "AA-BB-CC-DD-EE-FF" or "AABBCCDDEEFF" to binary format
+ * @note Hex digits can be in upper or lower case, the separators must be the same across the whole string.
  * @param[IN] p_mac_addr_str - input string with MAC address
  * @param[OUT] p_mac_addr_bin  - pointer to output @def mac_address_bin_t where the converted value will be saved
  * @return true if input string contains valid MAC address
@@ -52,6 +133,18 @@ mac_address_to_str(const mac_address_bin_t* p_mac);
 bool
 mac_addr_from_str(const char* const p_mac_addr_str, mac_address_bin_t* p_mac_addr_bin);
 
+/**
+ * @brief Convert a MAC address which is not null-terminated (e.g. a JSON token) to binary format.
+ * @note The same formats as in @ref mac_addr_from_str are accepted,
+ *       the length must be MAC_ADDR_STR_LEN or MAC_ADDR_STR_NO_SEP_LEN.
+ * @param[IN] p_mac_addr_str - input buffer with MAC address
+ * @param[IN] len - the number of characters in the input buffer
+ * @param[OUT] p_mac_addr_bin  - pointer to output @def mac_address_bin_t where the converted value will be saved
+ * @return true if input buffer contains valid MAC address
+ */
+bool
+mac_addr_from_str_with_len(const char* const p_mac_addr_str, const size_t len, mac_address_bin_t* p_mac_addr_bin);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,246 @@
+/**
+ * @file mac_addr_map.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef MAC_ADDR_MAP_H
+#define MAC_ADDR_MAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "mac_addr.h"
+#include "attribs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The max number of entries in mac_addr_map_t.
+ */
+#define MAC_ADDR_MAP_MAX_CAPACITY (0xFFFEU)
+
+/**
+ * @brief The alignment of the values and of the buffer for mac_addr_map_create_static.
+ */
+#define MAC_ADDR_MAP_ALIGNMENT (8U)
+
+/**
+ * @brief The size of the service header of every entry (MAC address, timestamp and LRU links).
+ */
+#define MAC_ADDR_MAP_ENTRY_HDR_SIZE (16U)
+
+/**
+ * @brief The size of an entry with the value of value_size bytes.
+ */
+#define MAC_ADDR_MAP_ENTRY_SIZE(value_size) \
+    (((MAC_ADDR_MAP_ENTRY_HDR_SIZE + (value_size) + MAC_ADDR_MAP_ALIGNMENT - 1U) / MAC_ADDR_MAP_ALIGNMENT) \
+     * MAC_ADDR_MAP_ALIGNMENT)
+
+/**
+ * @brief The number of slots in the hash table (the load factor never exceeds 0.5).
+ */
+#define MAC_ADDR_MAP_TABLE_SIZE(capacity) (2U * (capacity))
+
+/**
+ * @brief The size of the buffer (in bytes) which is required for mac_addr_map_create_static,
+ * the buffer must be aligned to MAC_ADDR_MAP_ALIGNMENT bytes.
+ */
+#define MAC_ADDR_MAP_BUF_SIZE(value_size, capacity) \
+    ((MAC_ADDR_MAP_ENTRY_SIZE(value_size) * (capacity)) + (sizeof(uint16_t) * MAC_ADDR_MAP_TABLE_SIZE(capacity)))
+
+typedef struct mac_addr_map_t mac_addr_map_t;
+
+typedef struct mac_addr_map_static_t
+{
+    void*    stub1;
+    void*    stub2;
+    uint32_t stub3;
+    uint32_t stub4;
+    uint32_t stub5;
+    uint32_t stub6;
+    uint16_t stub7;
+    uint16_t stub8;
+    uint16_t stub9;
+    bool     stub10;
+} mac_addr_map_static_t;
+
+/**
+ * @brief Callback for mac_addr_map_foreach.
+ * @param p_mac - pointer to the MAC address of the entry.
+ * @param timestamp - the timestamp of the entry.
+ * @param p_value - pointer to the value of the entry.
+ * @param p_ctx - pointer to the user context.
+ * @return true to continue iterating, false to stop.
+ */
+typedef bool (*mac_addr_map_cb_t)(
+    const mac_address_bin_t* const p_mac,
+    const uint32_t                 timestamp,
+    void* const                    p_value,
+    void* const                    p_ctx);
+
+/**
+ * @brief Create a fixed-capacity hash map with MAC address as a key.
+ * @note The map uses open addressing with linear probing, so no memory is allocated after creation.
+ *       When the map is full, inserting a new MAC address evicts the least recently used entry.
+ *       If value_size is 0, then the map works as a set of MAC addresses.
+ * @param capacity - the max number of entries, it must be in range [1, MAC_ADDR_MAP_MAX_CAPACITY].
+ * @param value_size - the size of the value in bytes.
+ * @return ptr to the instance of mac_addr_map_t object or NULL if there is not enough memory
+ *         or the capacity is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+mac_addr_map_t*
+mac_addr_map_create(const uint32_t capacity, const uint32_t value_size);
+
+/**
+ * @brief Create a fixed-capacity hash map with MAC address as a key using pre-allocated memory.
+ * @param p_mem - pointer to the pre-allocated memory for the object.
+ * @param p_buf - pointer to the buffer of MAC_ADDR_MAP_BUF_SIZE(value_size, capacity) bytes,
+ *                it must be aligned to MAC_ADDR_MAP_ALIGNMENT bytes.
+ * @param capacity - the max number of entries, it must be in range [1, MAC_ADDR_MAP_MAX_CAPACITY].
+ * @param value_size - the size of the value in bytes.
+ * @return ptr to the instance of mac_addr_map_t object or NULL if the capacity is out of range
+ *         or the buffer is not aligned.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+mac_addr_map_t*
+mac_addr_map_create_static(
+    mac_addr_map_static_t* const p_mem,
+    void* const                  p_buf,
+    const uint32_t               capacity,
+    const uint32_t               value_size);
+
+/**
+ * @brief Delete the mac_addr_map_t object.
+ * @param[in,out] pp_map - pointer to the variable which contains pointer to the mac_addr_map_t object,
+ * it will be cleared after deleting.
+ */
+ATTR_NONNULL(1)
+void
+mac_addr_map_delete(mac_addr_map_t** const pp_map);
+
+/**
+ * @brief Remove all the entries.
+ * @param p_map - pointer to the mac_addr_map_t object.
+ */
+ATTR_NONNULL(1)
+void
+mac_addr_map_clear(mac_addr_map_t* const p_map);
+
+/**
+ * @brief Get the max number of entries.
+ * @param p_map - pointer to the mac_addr_map_t object.
+ * @return the capacity of the map.
+ */
+ATTR_NONNULL(1)
+uint32_t
+mac_addr_map_get_capacity(const mac_addr_map_t* const p_map);
+
+/**
+ * @brief Get the current number of entries.
+ * @param p_map - pointer to the mac_addr_map_t object.
+ * @return the number of entries.
+ */
+ATTR_NONNULL(1)
+uint32_t
+mac_addr_map_get_num_items(const mac_addr_map_t* const p_map);
+
+/**
+ * @brief Insert the MAC address or update the existing entry.
+ * @note The entry becomes the most recently used one and its timestamp is updated.
+ *       The value of a new entry is filled with zeros.
+ *       If the map is full, the least recently used entry is evicted.
+ * @param p_map - pointer to the mac_addr_map_t object.
+ * @param p_mac - pointer to the MAC address.
+ * @param timestamp - the timestamp of the entry (e.g. in ticks or seconds), it is used for aging.
+ * @param[out] p_is_new - pointer to the variable which is set to true if a new entry was created, or NULL.
+ * @return pointer to the value of the entry (it must not be dereferenced if value_size is 0).
+ */
+ATTR_RETURNS_NONNULL
+ATTR_NONNULL(1, 2)
+void*
+mac_addr_map_insert(
+    mac_addr_map_t* const          p_map,
+    const mac_address_bin_t* const p_mac,
+    const uint32_t                 timestamp,
+    bool* const                    p_is_new);
+
+/**
+ * @brief Find the entry for the MAC address and mark it as the most recently used one.
+ * @param p_map - pointer to the mac_addr_map_t object.
+ * @param p_mac - pointer to the MAC address.
+ * @return pointer to the value of the entry (it must not be dereferenced if value_size is 0)
+ *         or NULL if the MAC address is not found.
+ */
+ATTR_NONNULL(1, 2)
+void*
+mac_addr_map_find(mac_addr_map_t* const p_map, const mac_address_bin_t* const p_mac);
+
+/**
+ * @brief Check if the MAC address is in the map (the LRU order is not changed).
+ * @param p_map - pointer to the mac_addr_map_t object.
+ * @param p_mac - pointer to the MAC address.
+ * @return true if the MAC address is found.
+ */
+ATTR_NONNULL(1, 2)
+bool
+mac_addr_map_contains(const mac_addr_map_t* const p_map, const mac_address_bin_t* const p_mac);
+
+/**
+ * @brief Get the timestamp of the entry.
+ * @param p_map - pointer to the mac_addr_map_t object.
+ * @param p_mac - pointer to the MAC address.
+ * @param[out] p_timestamp - pointer to the output variable.
+ * @return true if the MAC address is found.
+ */
+ATTR_NONNULL(1, 2, 3)
+bool
+mac_addr_map_get_timestamp(
+    const mac_addr_map_t* const    p_map,
+    const mac_address_bin_t* const p_mac,
+    uint32_t* const                p_timestamp);
+
+/**
+ * @brief Remove the entry for the MAC address.
+ * @param p_map - pointer to the mac_addr_map_t object.
+ * @param p_mac - pointer to the MAC address.
+ * @return true if the MAC address was found and removed.
+ */
+ATTR_NONNULL(1, 2)
+bool
+mac_addr_map_erase(mac_addr_map_t* const p_map, const mac_address_bin_t* const p_mac);
+
+/**
+ * @brief Remove the entries which were not updated for more than max_age.
+ * @note The age is calculated as (cur_timestamp - timestamp) in unsigned arithmetic,
+ *       so the wrap-around of the timestamp counter is handled correctly.
+ * @param p_map - pointer to the mac_addr_map_t object.
+ * @param cur_timestamp - the current timestamp.
+ * @param max_age - the max age of the entries which should be kept.
+ * @return the number of removed entries.
+ */
+ATTR_NONNULL(1)
+uint32_t
+mac_addr_map_erase_expired(mac_addr_map_t* const p_map, const uint32_t cur_timestamp, const uint32_t max_age);
+
+/**
+ * @brief Call the callback for every entry from the most recently used to the least recently used one.
+ * @note The map must not be modified from the callback.
+ * @param p_map - pointer to the mac_addr_map_t object.
+ * @param p_cb - pointer to the callback.
+ * @param p_ctx - pointer to the user context which is passed to the callback.
+ */
+ATTR_NONNULL(1, 2)
+void
+mac_addr_map_foreach(mac_addr_map_t* const p_map, mac_addr_map_cb_t p_cb, void* const p_ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MAC_ADDR_MAP_H
@@ -0,0 +1,147 @@
+/**
+ * @file os_lock_prof.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef OS_LOCK_PROF_H
+#define OS_LOCK_PROF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "os_wrapper_types.h"
+#include "attribs.h"
+
+#if !defined(OS_LOCK_PROF)
+#define OS_LOCK_PROF 0
+#endif
+
+#if !defined(OS_LOCK_PROF_MAX_NUM_LOCKS)
+#define OS_LOCK_PROF_MAX_NUM_LOCKS (32U)
+#endif
+
+#if !defined(OS_LOCK_PROF_MAX_NAME_LEN)
+#define OS_LOCK_PROF_MAX_NAME_LEN (16U)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if OS_LOCK_PROF
+
+typedef enum os_lock_prof_type_e
+{
+    OS_LOCK_PROF_TYPE_MUTEX           = 0,
+    OS_LOCK_PROF_TYPE_MUTEX_RECURSIVE = 1,
+    OS_LOCK_PROF_TYPE_SEMA            = 2,
+} os_lock_prof_type_e;
+
+/**
+ * @brief Statistics of a lock created by os_mutex_create*, os_mutex_recursive_create* or os_sema_create*.
+ * @note The wait time of a failed acquisition is also accounted in total_wait_ticks and max_wait_ticks.
+ */
+typedef struct os_lock_prof_info_t
+{
+    const void*         h_lock;
+    char                name[OS_LOCK_PROF_MAX_NAME_LEN];
+    os_lock_prof_type_e type;
+    uint32_t            num_acquisitions; //!< number of successful acquisitions
+    uint32_t            num_contentions;  //!< number of acquisitions for which the lock was not available immediately
+    uint32_t            num_timeouts;     //!< number of failed acquisitions (including failed try_lock)
+    uint32_t            total_wait_ticks; //!< total time spent waiting for the lock
+    uint32_t            max_wait_ticks;   //!< max time spent waiting for the lock
+    uint32_t            max_hold_ticks;   //!< max time between acquisition and release (not used for os_sema)
+} os_lock_prof_info_t;
+
+/**
+ * @brief Callback which tries to acquire the lock, it is used by the lock wrappers.
+ */
+typedef bool (*os_lock_prof_cb_take_t)(void* const h_lock, const os_delta_ticks_t ticks_to_wait);
+
+/**
+ * @brief Initialize the lock profiler.
+ * @note Only the locks created after the initialization are profiled.
+ */
+void
+os_lock_prof_init(void);
+
+/**
+ * @brief Deinitialize the lock profiler and forget all the registered locks.
+ */
+void
+os_lock_prof_deinit(void);
+
+/**
+ * @brief Reset the statistics of all the registered locks (the locks remain registered).
+ */
+void
+os_lock_prof_reset(void);
+
+/**
+ * @brief Register a new lock, it is called by the lock wrappers on creation.
+ * @note The index of the lock statistics is saved in the queue number of the FreeRTOS semaphore
+ *       (see vQueueSetQueueNumber), so the lock wrappers update the statistics without a search.
+ * @param h_lock - the lock handle.
+ * @param p_name - the name of the lock or NULL.
+ * @param type - the type of the lock.
+ */
+void
+os_lock_prof_register(const void* const h_lock, const char* const p_name, const os_lock_prof_type_e type);
+
+/**
+ * @brief Unregister the lock, it is called by the lock wrappers on deletion.
+ * @param h_lock - the lock handle.
+ */
+void
+os_lock_prof_unregister(const void* const h_lock);
+
+/**
+ * @brief Acquire the lock using the callback and update the statistics, it is called by the lock wrappers.
+ * @param h_lock - the lock handle.
+ * @param ticks_to_wait - timeout in system ticks.
+ * @param cb_take - the callback which acquires the lock.
+ * @return true if the lock was acquired, false if timeout occurred.
+ */
+ATTR_NONNULL(3)
+bool
+os_lock_prof_take(void* const h_lock, const os_delta_ticks_t ticks_to_wait, os_lock_prof_cb_take_t cb_take);
+
+/**
+ * @brief Update the hold time statistics, it is called by the mutex wrappers before releasing the lock.
+ * @param h_lock - the lock handle.
+ */
+void
+os_lock_prof_on_release(const void* const h_lock);
+
+/**
+ * @brief Get a snapshot of the table of registered locks.
+ * @param[out] p_arr_of_info - pointer to the output array.
+ * @param max_num_locks - the max number of items in the output array.
+ * @return the number of items copied to the output array.
+ */
+ATTR_NONNULL(1)
+uint32_t
+os_lock_prof_get_snapshot(os_lock_prof_info_t* const p_arr_of_info, const uint32_t max_num_locks);
+
+/**
+ * @brief Get the number of locks which were not registered because the table was full.
+ * @return the number of locks which were not registered.
+ */
+uint32_t
+os_lock_prof_get_num_overflows(void);
+
+/**
+ * @brief Print the statistics of the registered locks to the log, sorted by total wait time (descending).
+ */
+void
+os_lock_prof_log_dump(void);
+
+#endif // OS_LOCK_PROF
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OS_LOCK_PROF_H
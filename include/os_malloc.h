@@ -25,6 +25,50 @@ extern "C" {
 #define OS_MALLOC_TRACE_DISABLE_TIMESTAMP 0
 #endif
 
+#if !defined(OS_MALLOC_TRACE_MAX_NUM_SITES)
+#define OS_MALLOC_TRACE_MAX_NUM_SITES (32U)
+#endif
+
+/**
+ * OS_MALLOC_GUARD extends OS_MALLOC_TRACE: every block is surrounded by canary bytes which are checked on free,
+ * the freed blocks are filled with the poison pattern and kept in the quarantine ring,
+ * the pattern is verified before the block is returned to the heap.
+ */
+#if !defined(OS_MALLOC_GUARD)
+#define OS_MALLOC_GUARD 0
+#endif
+
+#if OS_MALLOC_GUARD && !OS_MALLOC_TRACE
+#error OS_MALLOC_GUARD requires OS_MALLOC_TRACE to be enabled
+#endif
+
+#if !defined(OS_MALLOC_GUARD_SIZE)
+#define OS_MALLOC_GUARD_SIZE (8U)
+#endif
+
+#if !defined(OS_MALLOC_GUARD_QUARANTINE_LEN)
+#define OS_MALLOC_GUARD_QUARANTINE_LEN (16U)
+#endif
+
+#define OS_MALLOC_GUARD_CANARY_BYTE (0xFDU)
+#define OS_MALLOC_GUARD_POISON_BYTE (0xDDU)
+
+/**
+ * @brief The type of memory to allocate the block from.
+ * @note On ESP-IDF the capabilities are mapped to heap_caps_malloc,
+ *       on other platforms (e.g. the POSIX simulator) all the blocks are allocated with malloc.
+ */
+typedef enum os_malloc_caps_e
+{
+    OS_MALLOC_CAPS_DEFAULT  = 0, //!< the same memory as for @ref os_malloc
+    OS_MALLOC_CAPS_INTERNAL = 1, //!< internal RAM only
+    OS_MALLOC_CAPS_SPIRAM   = 2, //!< external PSRAM, falls back to the default memory if PSRAM is not available
+    OS_MALLOC_CAPS_DMA      = 3, //!< DMA-capable internal RAM only
+    OS_MALLOC_CAPS_FAST     = 4, //!< internal RAM, falls back to the default memory if the internal RAM is exhausted
+} os_malloc_caps_e;
+
+#define OS_MALLOC_CAPS_NUM (5U)
+
 /**
  * This is a wrap for malloc - it allocates a block of memory of size 'size' bytes.
  * @param size  - the size the memory block
@@ -59,6 +103,48 @@ void*
 os_calloc(const size_t nmemb, const size_t size);
 #endif
 
+/**
+ * This is a wrap for heap_caps_malloc - it allocates a block of memory of size 'size' bytes
+ * from the memory with the specified capabilities.
+ * @param size  - the size the memory block
+ * @param caps  - the type of memory, see @ref os_malloc_caps_e
+ * @return pointer to the allocated memory block or NULL.
+ */
+ATTR_MALLOC
+ATTR_MALLOC_SIZE(1)
+#if OS_MALLOC_TRACE
+void*
+os_malloc_caps_internal(const size_t size, const os_malloc_caps_e caps, const char* const p_file, const int32_t line);
+#define os_malloc_caps(size, caps) os_malloc_caps_internal(size, caps, __FILE__, __LINE__)
+#else
+void*
+os_malloc_caps(const size_t size, const os_malloc_caps_e caps);
+#endif
+
+/**
+ * This is a wrap for heap_caps_calloc - it allocates memory block for an array of 'nmemb' elements,
+ * each 'size' bytes from the memory with the specified capabilities and fills the array with zeroes.
+ * @param nmemb - the number of elements in the array.
+ * @param size  - the size of one array element.
+ * @param caps  - the type of memory, see @ref os_malloc_caps_e
+ * @return pointer to the allocated memory block or NULL.
+ */
+ATTR_MALLOC
+ATTR_CALLOC_SIZE(1, 2)
+#if OS_MALLOC_TRACE
+void*
+os_calloc_caps_internal(
+    const size_t           nmemb,
+    const size_t           size,
+    const os_malloc_caps_e caps,
+    const char* const      p_file,
+    const int32_t          line);
+#define os_calloc_caps(nmemb, size, caps) os_calloc_caps_internal(nmemb, size, caps, __FILE__, __LINE__)
+#else
+void*
+os_calloc_caps(const size_t nmemb, const size_t size, const os_malloc_caps_e caps);
+#endif
+
 /**
  * @brief This is a safer wrap for realloc,
  *        it changes the size of the memory block and checks the result of the reallocation.
@@ -66,6 +152,10 @@ os_calloc(const size_t nmemb, const size_t size);
  * @param[IN,OUT] p_ptr - ptr to a variable which points to the memory block,
  * the pointer to the new memory block will be saved to p_ptr.
  * In case if the reallocation failed, then the value in p_ptr will not be changed.
+ * @note With OS_MALLOC_TRACE the block is resized in place when possible (like with the plain realloc),
+ *       and it is reported as a new block allocated at the call site of this function.
+ *       The capabilities of the block allocated by @ref os_malloc_caps are kept only with OS_MALLOC_TRACE,
+ *       otherwise the reallocated block may be moved to the default memory, use @ref os_realloc_caps_safe to keep them.
  * @param size - new size of the memory block.
  * @return true if the reallocation was successful.
  */
@@ -79,6 +169,33 @@ bool
 os_realloc_safe(void** const p_ptr, const size_t size);
 #endif
 
+/**
+ * @brief This is a safer wrap for heap_caps_realloc,
+ *        it changes the size of the memory block and moves it to the memory with the specified capabilities if needed.
+ * @note This function checks if realloc returns NULL and overwrites value in p_ptr if a new memory block was allocated.
+ * @param[IN,OUT] p_ptr - ptr to a variable which points to the memory block,
+ * the pointer to the new memory block will be saved to p_ptr.
+ * In case if the reallocation failed or the capabilities are invalid, then the value in p_ptr will not be changed.
+ * @param size - new size of the memory block.
+ * @param caps - the type of memory, see @ref os_malloc_caps_e
+ * @return true if the reallocation was successful.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+#if OS_MALLOC_TRACE
+bool
+os_realloc_caps_safe_internal(
+    void** const           p_ptr,
+    const size_t           size,
+    const os_malloc_caps_e caps,
+    const char* const      p_file,
+    const int32_t          line);
+#define os_realloc_caps_safe(p_ptr, size, caps) os_realloc_caps_safe_internal(p_ptr, size, caps, __FILE__, __LINE__)
+#else
+bool
+os_realloc_caps_safe(void** const p_ptr, const size_t size, const os_malloc_caps_e caps);
+#endif
+
 /**
  * @brief This is a safer wrap for realloc,
  *        it changes the size of the memory block and checks the result of the reallocation,
@@ -86,7 +203,7 @@ os_realloc_safe(void** const p_ptr, const size_t size);
  * @note This function checks if realloc returns NULL and overwrites value in p_ptr if a new memory block was allocated.
  * @param[IN,OUT] p_ptr - ptr to a variable which points to the memory block,
  * the pointer to the new memory block will be saved to p_ptr.
- * In case if the reallocation failed, then the value in p_ptr will not be changed.
+ * In case if the reallocation failed, then the original memory block is freed and p_ptr is set to NULL.
  * @param size - new size of the memory block.
  * @return true if the reallocation was successful.
  */
@@ -145,8 +262,98 @@ os_malloc_trace_dump(void);
 
 void
 os_malloc_trace_clear(void);
+
+int32_t
+os_malloc_trace_get_num_blocks(void);
+
+typedef uint32_t os_malloc_trace_generation_t;
+
+/**
+ * @brief Statistics of the live memory blocks allocated at the same call site.
+ */
+typedef struct os_malloc_trace_site_t
+{
+    const char* p_file;
+    int32_t     line;
+    uint32_t    num_blocks;
+    size_t      num_bytes;
+} os_malloc_trace_site_t;
+
+/**
+ * @brief Statistics of the live memory blocks allocated from the memory with the same capabilities.
+ */
+typedef struct os_malloc_trace_caps_stat_t
+{
+    uint32_t num_blocks;
+    size_t   num_bytes;
+    size_t   max_num_bytes; //!< the peak value of num_bytes since the trace was initialized
+} os_malloc_trace_caps_stat_t;
+
+/**
+ * @brief Get the statistics of the live memory blocks allocated from the memory with the specified capabilities.
+ * @param caps - the type of memory, see @ref os_malloc_caps_e
+ * @param[out] p_stat - pointer to the output statistics.
+ * @return true if successful, false if the trace is not initialized or caps is invalid.
+ */
+ATTR_NONNULL(2)
+bool
+os_malloc_trace_get_caps_stat(const os_malloc_caps_e caps, os_malloc_trace_caps_stat_t* const p_stat);
+
+/**
+ * @brief Start a new generation of the memory blocks (take a snapshot).
+ * @note Every allocated block is tagged with the current generation,
+ *       so marking does not walk the list of the allocated blocks.
+ * @return the new generation, pass it to @ref os_malloc_trace_get_sites_since or @ref os_malloc_trace_dump_since
+ *         to get the blocks allocated after this call which are still alive.
+ */
+os_malloc_trace_generation_t
+os_malloc_trace_mark(void);
+
+/**
+ * @brief Get the live memory blocks allocated since the generation was marked, grouped by the call site.
+ * @note The blocks are appended to the tail of the list on allocation,
+ *       so only the blocks allocated since the mark are walked.
+ * @param generation - the generation returned by @ref os_malloc_trace_mark.
+ * @param[out] p_arr_of_sites - pointer to the output array, the sites are ordered from the most recent allocation.
+ * @param max_num_sites - the max number of items in the output array.
+ * @param[out] p_num_blocks_skipped - the number of blocks of the call sites which did not fit into the output array
+ *                                    (can be NULL).
+ * @return the number of items copied to the output array.
+ */
+ATTR_NONNULL(2)
+uint32_t
+os_malloc_trace_get_sites_since(
+    const os_malloc_trace_generation_t generation,
+    os_malloc_trace_site_t* const      p_arr_of_sites,
+    const uint32_t                     max_num_sites,
+    uint32_t* const                    p_num_blocks_skipped);
+
+/**
+ * @brief Print the live memory blocks allocated since the generation was marked to the log,
+ *        grouped by the call site and sorted by the number of bytes (descending).
+ * @param generation - the generation returned by @ref os_malloc_trace_mark.
+ */
+void
+os_malloc_trace_dump_since(const os_malloc_trace_generation_t generation);
 #endif // OS_MALLOC_TRACE
 
+#if OS_MALLOC_GUARD
+/**
+ * @brief Check the canaries of all the live blocks and the poison pattern of the freed blocks in the quarantine.
+ * @note Every corrupted block is reported to the log with the call site where it was allocated.
+ * @return the number of corrupted blocks.
+ */
+uint32_t
+os_malloc_check_all(void);
+
+/**
+ * @brief Check and release all the freed blocks which are kept in the quarantine.
+ * @return the number of corrupted blocks.
+ */
+uint32_t
+os_malloc_guard_flush_quarantine(void);
+#endif // OS_MALLOC_GUARD
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,153 @@
+/**
+ * @file os_malloc_monitor.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef OS_MALLOC_MONITOR_H
+#define OS_MALLOC_MONITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "os_wrapper_types.h"
+#include "os_signal.h"
+#include "attribs.h"
+
+#if !defined(OS_MALLOC_MONITOR)
+#define OS_MALLOC_MONITOR 0
+#endif
+
+#if !defined(OS_MALLOC_MONITOR_HISTORY_LEN)
+#define OS_MALLOC_MONITOR_HISTORY_LEN (32U)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if OS_MALLOC_MONITOR
+
+/**
+ * @brief The state of the heap returned by the heap info provider.
+ */
+typedef struct os_malloc_monitor_heap_info_t
+{
+    uint32_t free_size;          //!< the current size of free heap
+    uint32_t min_free_size;      //!< the minimum size of free heap since the boot
+    uint32_t largest_free_block; //!< the size of the largest block which can be allocated
+} os_malloc_monitor_heap_info_t;
+
+/**
+ * @brief One sample of the heap state.
+ */
+typedef struct os_malloc_monitor_sample_t
+{
+    os_malloc_monitor_heap_info_t heap_info;
+    uint32_t                      timestamp;             //!< the tick count when the sample was taken
+    uint32_t                      fragmentation_percent; //!< see @ref os_malloc_monitor_calc_fragmentation_percent
+} os_malloc_monitor_sample_t;
+
+/**
+ * @brief Callback which fills the current state of the heap.
+ * @note On ESP-IDF the heap_caps API for the internal RAM (MALLOC_CAP_INTERNAL) is used by default,
+ *       on other platforms (e.g. the POSIX simulator) the callback must be provided by the application
+ *       (a stand-in for the heap allocator).
+ * @return true if successful.
+ */
+typedef bool (*os_malloc_monitor_cb_get_heap_info_t)(os_malloc_monitor_heap_info_t* const p_heap_info);
+
+/**
+ * @brief Callback which is called when the fragmentation reaches the threshold.
+ * @note It is called in the context of the task which took the sample (the timer service task for periodic sampling).
+ */
+typedef void (*os_malloc_monitor_cb_threshold_t)(const os_malloc_monitor_sample_t* const p_sample, void* const p_arg);
+
+typedef struct os_malloc_monitor_cfg_t
+{
+    os_malloc_monitor_cb_get_heap_info_t cb_get_heap_info;                //!< NULL - the default (ESP-IDF only)
+    uint32_t                             fragmentation_threshold_percent; //!< 0 - the threshold is disabled
+    os_malloc_monitor_cb_threshold_t     cb_threshold;                    //!< optional threshold callback
+    void*                                p_cb_threshold_arg;              //!< the argument for cb_threshold
+    os_signal_t*                         p_signal;                        //!< optional threshold signal
+    os_signal_num_e                      sig_num;                         //!< the signal number for p_signal
+} os_malloc_monitor_cfg_t;
+
+/**
+ * @brief Initialize the heap monitor and clear the history.
+ * @param p_cfg - pointer to the configuration (it is copied).
+ * @return true if successful, false if the heap info provider is not available.
+ */
+ATTR_NONNULL(1)
+bool
+os_malloc_monitor_init(const os_malloc_monitor_cfg_t* const p_cfg);
+
+/**
+ * @brief Stop the periodic sampling and deinitialize the heap monitor.
+ * @note The internal mutex and the static timer are kept for the lifetime of the program,
+ *       so a timer callback which is still running after the stop does nothing.
+ */
+void
+os_malloc_monitor_deinit(void);
+
+/**
+ * @brief Start sampling of the heap state with the specified period.
+ * @note The samples are taken in the timer service task, so no extra task and stack are needed.
+ *       The default heap info provider calls heap_caps_get_largest_free_block, which walks the heap
+ *       and delays all other software timers while it runs. If the application has timers which are sensitive
+ *       to the latency, then call @ref os_malloc_monitor_sample periodically from its own low-priority task instead.
+ * @param period_ticks - the sampling period in system ticks.
+ * @return true if successful.
+ */
+bool
+os_malloc_monitor_start(const os_delta_ticks_t period_ticks);
+
+/**
+ * @brief Stop the periodic sampling.
+ */
+void
+os_malloc_monitor_stop(void);
+
+/**
+ * @brief Take a sample of the heap state immediately and add it to the history.
+ * @note The threshold notification is edge-triggered: the callback and the signal are emitted
+ *       when the fragmentation reaches the threshold and then again only after it has dropped below the threshold.
+ * @param[out] p_sample - pointer to the output sample or NULL.
+ * @return true if successful.
+ */
+bool
+os_malloc_monitor_sample(os_malloc_monitor_sample_t* const p_sample);
+
+/**
+ * @brief Get a copy of the history of the samples.
+ * @param[out] p_arr_of_samples - pointer to the output array, the samples are ordered from the oldest to the newest.
+ * @param max_num_samples - the max number of items in the output array (the newest samples are copied).
+ * @return the number of items copied to the output array.
+ */
+ATTR_NONNULL(1)
+uint32_t
+os_malloc_monitor_get_history(os_malloc_monitor_sample_t* const p_arr_of_samples, const uint32_t max_num_samples);
+
+/**
+ * @brief Print the history of the samples to the log.
+ */
+void
+os_malloc_monitor_log_dump(void);
+
+/**
+ * @brief Calculate the heap fragmentation as the share of free memory which is not in the largest free block.
+ * @param p_heap_info - pointer to the heap state.
+ * @return fragmentation in percent (0 - the free memory is contiguous or there is no free memory).
+ */
+ATTR_NONNULL(1)
+ATTR_PURE
+uint32_t
+os_malloc_monitor_calc_fragmentation_percent(const os_malloc_monitor_heap_info_t* const p_heap_info);
+
+#endif // OS_MALLOC_MONITOR
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OS_MALLOC_MONITOR_H
@@ -9,6 +9,8 @@
 #define RUUVI_OS_MKGMTIME_H
 
 #include <time.h>
+#include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -31,6 +33,30 @@ extern "C" {
 time_t
 os_mkgmtime(struct tm* const p_tm_time_utc);
 
+/**
+ * @brief Convert a broken-down time structure (struct tm), expressed as UTC time,
+ *        to 64-bit Unix-time (seconds since the Epoch 1970), the year 2038 limit does not apply.
+ * @note The fields of the tm structure are normalized in the same way as by os_mkgmtime,
+ *       but without calling gmtime_r. The dates before 1970 are supported (the result is negative).
+ * @note If the normalized year cannot be represented in tm_year, the function returns false
+ *       and does not alter the members of the broken-down time structure.
+ * @param[in,out] p_tm_time_utc - pointer to 'struct tm' with a broken-down time, expressed as UTC.
+ * @param[out] p_unix_time - pointer to the output variable.
+ * @return true if successful.
+ */
+bool
+os_mkgmtime64(struct tm* const p_tm_time_utc, int64_t* const p_unix_time);
+
+/**
+ * @brief Convert 64-bit Unix-time to a broken-down time structure (struct tm) expressed as UTC time,
+ *        this is a replacement for gmtime_r which is not limited by the size of time_t.
+ * @param unix_time - seconds since the Epoch 1970 (can be negative).
+ * @param[out] p_tm_time_utc - pointer to the output 'struct tm', tm_isdst is set to 0.
+ * @return p_tm_time_utc or NULL if the year cannot be represented in tm_year.
+ */
+struct tm*
+os_gmtime64_r(const int64_t unix_time, struct tm* const p_tm_time_utc);
+
 #ifdef __cplusplus
 }
 #endif
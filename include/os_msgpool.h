@@ -0,0 +1,135 @@
+/**
+ * @file os_msgpool.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef OS_MSGPOOL_H
+#define OS_MSGPOOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "os_signal.h"
+#include "os_wrapper_types.h"
+#include "attribs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct os_msgpool_t os_msgpool_t;
+
+typedef struct os_msgpool_stat_t
+{
+    uint32_t num_acquired;        //!< number of buffers acquired from the pool
+    uint32_t num_exhausted;       //!< number of failed attempts to acquire a buffer because the pool was empty
+    uint32_t num_posted;          //!< number of buffers posted to the consumer
+    uint32_t num_received;        //!< number of buffers received by the consumer
+    uint32_t num_in_use;          //!< number of buffers which are currently acquired and not yet released
+    uint32_t max_in_use;          //!< max number of buffers which were in use simultaneously
+    uint32_t total_latency_ticks; //!< sum of delays between posting and receiving of buffers (in ticks)
+    uint32_t max_latency_ticks;   //!< max delay between posting and receiving of a buffer (in ticks)
+} os_msgpool_stat_t;
+
+/**
+ * @brief Create a pool of fixed-size message buffers for zero-copy message passing.
+ * @note The typical flow is: a producer (task or ISR) acquires a buffer with os_msgpool_acquire, fills it
+ *       and passes it to the consumer with os_msgpool_post, then the consumer gets it with os_msgpool_receive
+ *       and returns it to the pool with os_msgpool_release.
+ *       The consumer is notified with the signal sig_num when the queue of posted buffers becomes non-empty,
+ *       so it must receive all the posted buffers before waiting for the signal again.
+ * @param block_size - the size of every buffer in bytes.
+ * @param num_blocks - the number of buffers in the pool.
+ * @param p_signal - pointer to the os_signal_t object which is used to wake up the consumer or NULL.
+ * @param sig_num - the signal number which is sent to the consumer.
+ * @return ptr to the instance of os_msgpool_t object or NULL if there is not enough memory.
+ */
+ATTR_WARN_UNUSED_RESULT
+os_msgpool_t*
+os_msgpool_create(
+    const uint32_t        block_size,
+    const uint32_t        num_blocks,
+    os_signal_t* const    p_signal,
+    const os_signal_num_e sig_num);
+
+/**
+ * @brief Delete the os_msgpool_t object.
+ * @note All the buffers must be released before deleting.
+ * @param[in,out] pp_msgpool - pointer to the variable which contains pointer to the os_msgpool_t object,
+ * it will be cleared after deleting.
+ */
+ATTR_NONNULL(1)
+void
+os_msgpool_delete(os_msgpool_t** const pp_msgpool);
+
+/**
+ * @brief Get the size of the buffers in the pool.
+ * @param p_msgpool - pointer to the os_msgpool_t object.
+ * @return the size of a buffer in bytes.
+ */
+ATTR_NONNULL(1)
+uint32_t
+os_msgpool_get_block_size(const os_msgpool_t* const p_msgpool);
+
+/**
+ * @brief Acquire a free buffer from the pool (can be called from ISR).
+ * @param p_msgpool - pointer to the os_msgpool_t object.
+ * @return pointer to the buffer or NULL if the pool is exhausted.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+void*
+os_msgpool_acquire(os_msgpool_t* const p_msgpool);
+
+/**
+ * @brief Post the buffer to the consumer (can be called from ISR).
+ * @param p_msgpool - pointer to the os_msgpool_t object.
+ * @param p_msg - pointer to the buffer which was acquired by os_msgpool_acquire.
+ * @return true if successful.
+ */
+ATTR_NONNULL(1, 2)
+bool
+os_msgpool_post(os_msgpool_t* const p_msgpool, void* const p_msg);
+
+/**
+ * @brief Receive the next posted buffer (must be called only by the consumer).
+ * @param p_msgpool - pointer to the os_msgpool_t object.
+ * @return pointer to the buffer or NULL if there are no posted buffers.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+void*
+os_msgpool_receive(os_msgpool_t* const p_msgpool);
+
+/**
+ * @brief Return the buffer to the pool (can be called from ISR).
+ * @param p_msgpool - pointer to the os_msgpool_t object.
+ * @param p_msg - pointer to the buffer.
+ */
+ATTR_NONNULL(1, 2)
+void
+os_msgpool_release(os_msgpool_t* const p_msgpool, void* const p_msg);
+
+/**
+ * @brief Get the counters of the pool.
+ * @param p_msgpool - pointer to the os_msgpool_t object.
+ * @param[out] p_stat - pointer to the output buffer.
+ */
+ATTR_NONNULL(1, 2)
+void
+os_msgpool_get_stat(os_msgpool_t* const p_msgpool, os_msgpool_stat_t* const p_stat);
+
+/**
+ * @brief Reset the counters of the pool (num_in_use is not changed, max_in_use is set to num_in_use).
+ * @param p_msgpool - pointer to the os_msgpool_t object.
+ */
+ATTR_NONNULL(1)
+void
+os_msgpool_reset_stat(os_msgpool_t* const p_msgpool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OS_MSGPOOL_H
@@ -0,0 +1,151 @@
+/**
+ * @file os_mutex_adaptive.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef OS_MUTEX_ADAPTIVE_H
+#define OS_MUTEX_ADAPTIVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "os_mutex.h"
+#include "os_wrapper_types.h"
+#include "attribs.h"
+
+#if !defined(OS_MUTEX_ADAPTIVE_SPIN)
+#if defined(portNUM_PROCESSORS) && (portNUM_PROCESSORS > 1)
+#define OS_MUTEX_ADAPTIVE_SPIN 1
+#else
+#define OS_MUTEX_ADAPTIVE_SPIN 0
+#endif
+#endif
+
+#if !defined(OS_MUTEX_ADAPTIVE_MIN_SPINS)
+#define OS_MUTEX_ADAPTIVE_MIN_SPINS (16U)
+#endif
+
+#if !defined(OS_MUTEX_ADAPTIVE_MAX_SPINS)
+#define OS_MUTEX_ADAPTIVE_MAX_SPINS (1000U)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct os_mutex_adaptive_t os_mutex_adaptive_t;
+
+typedef struct os_mutex_adaptive_stat_t
+{
+    uint32_t num_locks;                //!< number of successful locks
+    uint32_t num_acquired_immediately; //!< number of locks acquired without spinning or blocking
+    uint32_t num_spin_successes;       //!< number of locks acquired while spinning
+    uint32_t num_blocks;               //!< number of locks acquired after blocking in the kernel
+    uint32_t spin_limit;               //!< current spin budget (in iterations)
+} os_mutex_adaptive_stat_t;
+
+typedef struct os_mutex_adaptive_static_t
+{
+    os_mutex_static_t        stub1;
+    void*                    stub2;
+    void*                    stub3;
+    uint32_t                 stub4;
+    uint32_t                 stub5;
+    bool                     stub6;
+    os_mutex_adaptive_stat_t stub7;
+    BaseType_t               stub8;
+} os_mutex_adaptive_static_t;
+
+/**
+ * @brief Create a new adaptive mutex object.
+ * @note When the mutex is held by a task which is running on another core,
+ *       the lock spins for a while before blocking in the kernel.
+ *       The spin budget adapts to the number of iterations which were needed to acquire the mutex in the past,
+ *       which reflects the typical hold time of the mutex.
+ *       On single-core targets (OS_MUTEX_ADAPTIVE_SPIN is 0) it behaves like os_mutex.
+ * @return ptr to the instance of os_mutex_adaptive_t object or NULL if there is not enough memory.
+ */
+ATTR_WARN_UNUSED_RESULT
+os_mutex_adaptive_t*
+os_mutex_adaptive_create(void);
+
+/**
+ * @brief Create a new adaptive mutex object using pre-allocated memory.
+ * @param p_mutex_mem - pointer to the pre-allocated memory.
+ * @return ptr to the instance of os_mutex_adaptive_t object.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+os_mutex_adaptive_t*
+os_mutex_adaptive_create_static(os_mutex_adaptive_static_t* const p_mutex_mem);
+
+/**
+ * @brief Delete the os_mutex_adaptive_t object.
+ * @note Do no delete mutex if it is locked by some thread.
+ * @param[in,out] pp_mutex - pointer to the variable which contains pointer to the os_mutex_adaptive_t object,
+ * it will be cleared after deleting.
+ */
+ATTR_NONNULL(1)
+void
+os_mutex_adaptive_delete(os_mutex_adaptive_t** const pp_mutex);
+
+/**
+ * @brief Wait for the specified timeout until the mutex is available and then lock it.
+ * @param p_mutex - pointer to the os_mutex_adaptive_t object.
+ * @param ticks_to_wait - timeout in system ticks.
+ * @return true if the mutex was locked, false if timeout occurred.
+ */
+ATTR_NONNULL(1)
+bool
+os_mutex_adaptive_lock_with_timeout(os_mutex_adaptive_t* const p_mutex, const os_delta_ticks_t ticks_to_wait);
+
+/**
+ * @brief Lock the mutex (wait until it will be locked).
+ * @param p_mutex - pointer to the os_mutex_adaptive_t object.
+ */
+ATTR_NONNULL(1)
+void
+os_mutex_adaptive_lock(os_mutex_adaptive_t* const p_mutex);
+
+/**
+ * @brief Try to lock the mutex (do not spin and do not wait until it will be locked).
+ * @param p_mutex - pointer to the os_mutex_adaptive_t object.
+ * @return true if the mutex was locked.
+ */
+ATTR_NONNULL(1)
+bool
+os_mutex_adaptive_try_lock(os_mutex_adaptive_t* const p_mutex);
+
+/**
+ * @brief Unlock the mutex.
+ * @param p_mutex - pointer to the os_mutex_adaptive_t object.
+ */
+ATTR_NONNULL(1)
+void
+os_mutex_adaptive_unlock(os_mutex_adaptive_t* const p_mutex);
+
+/**
+ * @brief Get the counters of the mutex.
+ * @param p_mutex - pointer to the os_mutex_adaptive_t object.
+ * @param[out] p_stat - pointer to the output buffer.
+ */
+ATTR_NONNULL(1, 2)
+void
+os_mutex_adaptive_get_stat(os_mutex_adaptive_t* const p_mutex, os_mutex_adaptive_stat_t* const p_stat);
+
+/**
+ * @brief Reset the counters of the mutex (the spin budget is not changed).
+ * @param p_mutex - pointer to the os_mutex_adaptive_t object.
+ */
+ATTR_NONNULL(1)
+void
+os_mutex_adaptive_reset_stat(os_mutex_adaptive_t* const p_mutex);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OS_MUTEX_ADAPTIVE_H
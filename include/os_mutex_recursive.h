@@ -29,6 +29,15 @@ ATTR_WARN_UNUSED_RESULT
 os_mutex_recursive_t
 os_mutex_recursive_create(void);
 
+/**
+ * @brief Create a new mutex object with the name which is used by the lock profiler (see os_lock_prof.h).
+ * @param p_name - the name of the mutex or NULL.
+ * @return ptr to the instance of os_mutex_recursive_t object.
+ */
+ATTR_WARN_UNUSED_RESULT
+os_mutex_recursive_t
+os_mutex_recursive_create_named(const char* const p_name);
+
 /**
  * @brief Create a new mutex object using pre-allocated memory.
  * @param p_mutex_static - pointer to the pre-allocated memory.
@@ -42,6 +51,20 @@ os_mutex_recursive_t
 os_mutex_recursive_create_static(os_mutex_recursive_static_t* const p_mutex_static);
 #endif
 
+/**
+ * @brief Create a new mutex object with the name using pre-allocated memory.
+ * @param p_mutex_static - pointer to the pre-allocated memory.
+ * @param p_name - the name of the mutex or NULL.
+ * @return ptr to the instance of os_mutex_recursive_t object.
+ */
+#if configSUPPORT_STATIC_ALLOCATION
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+os_mutex_recursive_t
+os_mutex_recursive_create_static_named(os_mutex_recursive_static_t* const p_mutex_static, const char* const p_name);
+#endif
+
 /**
  * @brief Delete the os_mutex_recursive_t object.
  * @note Do no delete mutex if it is locked by some thread.
@@ -0,0 +1,213 @@
+/**
+ * @file os_ringbuf.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef OS_RINGBUF_H
+#define OS_RINGBUF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "os_signal.h"
+#include "attribs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The size of the buffer (in bytes) which is required for os_ringbuf_spsc_create_static.
+ */
+#define OS_RINGBUF_SPSC_BUF_SIZE(item_size, capacity) ((item_size) * (capacity))
+
+/**
+ * @brief The size of the buffer (in bytes) which is required for os_ringbuf_mpsc_create_static,
+ * the buffer must be aligned to 4 bytes.
+ */
+#define OS_RINGBUF_MPSC_BUF_SIZE(item_size, capacity) ((sizeof(uint32_t) + (item_size)) * (capacity))
+
+typedef struct os_ringbuf_spsc_t os_ringbuf_spsc_t;
+typedef struct os_ringbuf_mpsc_t os_ringbuf_mpsc_t;
+
+typedef struct os_ringbuf_spsc_static_t
+{
+    void*           stub1;
+    uint32_t        stub2;
+    uint32_t        stub3;
+    void*           stub4;
+    os_signal_num_e stub5;
+    uint32_t        stub6;
+    uint32_t        stub7;
+} os_ringbuf_spsc_static_t;
+
+typedef struct os_ringbuf_mpsc_static_t
+{
+    void*           stub1;
+    void*           stub2;
+    uint32_t        stub3;
+    uint32_t        stub4;
+    void*           stub5;
+    os_signal_num_e stub6;
+    uint32_t        stub7;
+    uint32_t        stub8;
+} os_ringbuf_mpsc_static_t;
+
+/**
+ * @brief Create a lock-free ring buffer for a single producer and a single consumer.
+ * @note The consumer is woken up with os_signal_send only when the ring buffer becomes non-empty,
+ *       so the consumer must pop all the items before waiting for the signal again.
+ * @param p_mem - pointer to the pre-allocated memory for the object.
+ * @param p_buf - pointer to the buffer of OS_RINGBUF_SPSC_BUF_SIZE(item_size, capacity) bytes.
+ * @param item_size - the size of an item in bytes.
+ * @param capacity - the max number of items in the ring buffer, it must be a power of two.
+ * @param p_signal - pointer to the os_signal_t object which is used to wake up the consumer or NULL.
+ * @param sig_num - the signal number which is sent to the consumer.
+ * @return ptr to the instance of os_ringbuf_spsc_t object or NULL if the capacity is not a power of two.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+os_ringbuf_spsc_t*
+os_ringbuf_spsc_create_static(
+    os_ringbuf_spsc_static_t* const p_mem,
+    void* const                     p_buf,
+    const uint32_t                  item_size,
+    const uint32_t                  capacity,
+    os_signal_t* const              p_signal,
+    const os_signal_num_e           sig_num);
+
+/**
+ * @brief Push one item to the ring buffer (must be called only by the producer).
+ * @param p_ringbuf - pointer to the os_ringbuf_spsc_t object.
+ * @param p_item - pointer to the item.
+ * @return true if the item was pushed, false if the ring buffer is full.
+ */
+ATTR_NONNULL(1, 2)
+bool
+os_ringbuf_spsc_push(os_ringbuf_spsc_t* const p_ringbuf, const void* const p_item);
+
+/**
+ * @brief Push several items to the ring buffer (must be called only by the producer).
+ * @param p_ringbuf - pointer to the os_ringbuf_spsc_t object.
+ * @param p_items - pointer to the array of items.
+ * @param num_items - the number of items in the array.
+ * @return the number of items which were pushed (less than num_items if the ring buffer is full).
+ */
+ATTR_NONNULL(1, 2)
+uint32_t
+os_ringbuf_spsc_push_batch(os_ringbuf_spsc_t* const p_ringbuf, const void* const p_items, const uint32_t num_items);
+
+/**
+ * @brief Pop one item from the ring buffer (must be called only by the consumer).
+ * @param p_ringbuf - pointer to the os_ringbuf_spsc_t object.
+ * @param[out] p_item - pointer to the output buffer for the item.
+ * @return true if the item was popped, false if the ring buffer is empty.
+ */
+ATTR_NONNULL(1, 2)
+bool
+os_ringbuf_spsc_pop(os_ringbuf_spsc_t* const p_ringbuf, void* const p_item);
+
+/**
+ * @brief Pop several items from the ring buffer (must be called only by the consumer).
+ * @param p_ringbuf - pointer to the os_ringbuf_spsc_t object.
+ * @param[out] p_items - pointer to the output array.
+ * @param max_num_items - the max number of items in the output array.
+ * @return the number of items which were popped.
+ */
+ATTR_NONNULL(1, 2)
+uint32_t
+os_ringbuf_spsc_pop_batch(os_ringbuf_spsc_t* const p_ringbuf, void* const p_items, const uint32_t max_num_items);
+
+/**
+ * @brief Get the number of items in the ring buffer.
+ * @param p_ringbuf - pointer to the os_ringbuf_spsc_t object.
+ * @return the number of items.
+ */
+ATTR_NONNULL(1)
+uint32_t
+os_ringbuf_spsc_get_num_items(os_ringbuf_spsc_t* const p_ringbuf);
+
+/**
+ * @brief Create a lock-free ring buffer for multiple producers and a single consumer.
+ * @note Producers can be called from ISR. The consumer is woken up with os_signal_send
+ *       only when the ring buffer becomes non-empty, so the consumer must pop all the items
+ *       before waiting for the signal again.
+ * @param p_mem - pointer to the pre-allocated memory for the object.
+ * @param p_buf - pointer to the 4-byte aligned buffer of OS_RINGBUF_MPSC_BUF_SIZE(item_size, capacity) bytes.
+ * @param item_size - the size of an item in bytes.
+ * @param capacity - the max number of items in the ring buffer, it must be a power of two.
+ * @param p_signal - pointer to the os_signal_t object which is used to wake up the consumer or NULL.
+ * @param sig_num - the signal number which is sent to the consumer.
+ * @return ptr to the instance of os_ringbuf_mpsc_t object
+ *         or NULL if the capacity is not a power of two or the buffer is not aligned.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+os_ringbuf_mpsc_t*
+os_ringbuf_mpsc_create_static(
+    os_ringbuf_mpsc_static_t* const p_mem,
+    void* const                     p_buf,
+    const uint32_t                  item_size,
+    const uint32_t                  capacity,
+    os_signal_t* const              p_signal,
+    const os_signal_num_e           sig_num);
+
+/**
+ * @brief Push one item to the ring buffer (can be called by any producer).
+ * @param p_ringbuf - pointer to the os_ringbuf_mpsc_t object.
+ * @param p_item - pointer to the item.
+ * @return true if the item was pushed, false if the ring buffer is full.
+ */
+ATTR_NONNULL(1, 2)
+bool
+os_ringbuf_mpsc_push(os_ringbuf_mpsc_t* const p_ringbuf, const void* const p_item);
+
+/**
+ * @brief Push several items to the ring buffer (can be called by any producer).
+ * @note The items pushed by one call occupy consecutive positions in the ring buffer.
+ * @param p_ringbuf - pointer to the os_ringbuf_mpsc_t object.
+ * @param p_items - pointer to the array of items.
+ * @param num_items - the number of items in the array.
+ * @return the number of items which were pushed (less than num_items if the ring buffer is full).
+ */
+ATTR_NONNULL(1, 2)
+uint32_t
+os_ringbuf_mpsc_push_batch(os_ringbuf_mpsc_t* const p_ringbuf, const void* const p_items, const uint32_t num_items);
+
+/**
+ * @brief Pop one item from the ring buffer (must be called only by the consumer).
+ * @param p_ringbuf - pointer to the os_ringbuf_mpsc_t object.
+ * @param[out] p_item - pointer to the output buffer for the item.
+ * @return true if the item was popped, false if the ring buffer is empty.
+ */
+ATTR_NONNULL(1, 2)
+bool
+os_ringbuf_mpsc_pop(os_ringbuf_mpsc_t* const p_ringbuf, void* const p_item);
+
+/**
+ * @brief Pop several items from the ring buffer (must be called only by the consumer).
+ * @note The items which are still being written by producers are not popped.
+ * @param p_ringbuf - pointer to the os_ringbuf_mpsc_t object.
+ * @param[out] p_items - pointer to the output array.
+ * @param max_num_items - the max number of items in the output array.
+ * @return the number of items which were popped.
+ */
+ATTR_NONNULL(1, 2)
+uint32_t
+os_ringbuf_mpsc_pop_batch(os_ringbuf_mpsc_t* const p_ringbuf, void* const p_items, const uint32_t max_num_items);
+
+/**
+ * @brief Get the number of items in the ring buffer (including the items which are still being written).
+ * @param p_ringbuf - pointer to the os_ringbuf_mpsc_t object.
+ * @return the number of items.
+ */
+ATTR_NONNULL(1)
+uint32_t
+os_ringbuf_mpsc_get_num_items(os_ringbuf_mpsc_t* const p_ringbuf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OS_RINGBUF_H
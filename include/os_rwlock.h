@@ -0,0 +1,171 @@
+/**
+ * @file os_rwlock.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef OS_RWLOCK_H
+#define OS_RWLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "os_mutex.h"
+#include "os_sema.h"
+#include "os_wrapper_types.h"
+#include "attribs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct os_rwlock_t os_rwlock_t;
+
+typedef struct os_rwlock_stat_t
+{
+    uint32_t num_read_locks;        //!< number of successful read locks
+    uint32_t num_write_locks;       //!< number of successful write locks
+    uint32_t num_read_contentions;  //!< number of read locks which had to wait
+    uint32_t num_write_contentions; //!< number of write locks which had to wait
+    uint32_t num_read_timeouts;     //!< number of read locks failed by timeout
+    uint32_t num_write_timeouts;    //!< number of write locks failed by timeout
+} os_rwlock_stat_t;
+
+typedef struct os_rwlock_static_t
+{
+    os_mutex_static_t stub1;
+    os_sema_static_t  stub2;
+    os_sema_static_t  stub3;
+    void*             stub4;
+    void*             stub5;
+    void*             stub6;
+    uint32_t          stub7;
+    uint32_t          stub8;
+    uint32_t          stub9;
+    bool              stub10;
+    bool              stub11;
+    os_rwlock_stat_t  stub12;
+} os_rwlock_static_t;
+
+/**
+ * @brief Create a new reader-writer lock object.
+ * @note The lock prefers writers: when a writer is waiting, new readers are blocked until it has finished.
+ * @return ptr to the instance of os_rwlock_t object or NULL if there is not enough memory.
+ */
+ATTR_WARN_UNUSED_RESULT
+os_rwlock_t*
+os_rwlock_create(void);
+
+/**
+ * @brief Create a new reader-writer lock object using pre-allocated memory.
+ * @param p_rwlock_mem - pointer to the pre-allocated memory.
+ * @return ptr to the instance of os_rwlock_t object.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+os_rwlock_t*
+os_rwlock_create_static(os_rwlock_static_t* const p_rwlock_mem);
+
+/**
+ * @brief Delete the os_rwlock_t object.
+ * @note Do no delete the lock if it is locked by some thread.
+ * @param[in,out] pp_rwlock - pointer to the variable which contains pointer to the os_rwlock_t object,
+ * it will be cleared after deleting.
+ */
+ATTR_NONNULL(1)
+void
+os_rwlock_delete(os_rwlock_t** const pp_rwlock);
+
+/**
+ * @brief Wait for the specified timeout until the lock is available for reading and then lock it for reading.
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ * @param ticks_to_wait - timeout in system ticks.
+ * @return true if the lock was acquired, false if timeout occurred.
+ */
+ATTR_NONNULL(1)
+bool
+os_rwlock_read_lock_with_timeout(os_rwlock_t* const p_rwlock, const os_delta_ticks_t ticks_to_wait);
+
+/**
+ * @brief Lock for reading (wait until it will be locked).
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ */
+ATTR_NONNULL(1)
+void
+os_rwlock_read_lock(os_rwlock_t* const p_rwlock);
+
+/**
+ * @brief Try to lock for reading (do not wait until it will be locked).
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ * @return true if the lock was acquired.
+ */
+ATTR_NONNULL(1)
+bool
+os_rwlock_read_try_lock(os_rwlock_t* const p_rwlock);
+
+/**
+ * @brief Release the lock acquired for reading.
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ */
+ATTR_NONNULL(1)
+void
+os_rwlock_read_unlock(os_rwlock_t* const p_rwlock);
+
+/**
+ * @brief Wait for the specified timeout until the lock is available for writing and then lock it for writing.
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ * @param ticks_to_wait - timeout in system ticks.
+ * @return true if the lock was acquired, false if timeout occurred.
+ */
+ATTR_NONNULL(1)
+bool
+os_rwlock_write_lock_with_timeout(os_rwlock_t* const p_rwlock, const os_delta_ticks_t ticks_to_wait);
+
+/**
+ * @brief Lock for writing (wait until it will be locked).
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ */
+ATTR_NONNULL(1)
+void
+os_rwlock_write_lock(os_rwlock_t* const p_rwlock);
+
+/**
+ * @brief Try to lock for writing (do not wait until it will be locked).
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ * @return true if the lock was acquired.
+ */
+ATTR_NONNULL(1)
+bool
+os_rwlock_write_try_lock(os_rwlock_t* const p_rwlock);
+
+/**
+ * @brief Release the lock acquired for writing.
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ */
+ATTR_NONNULL(1)
+void
+os_rwlock_write_unlock(os_rwlock_t* const p_rwlock);
+
+/**
+ * @brief Get the contention counters of the lock.
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ * @param[out] p_stat - pointer to the output buffer.
+ */
+ATTR_NONNULL(1, 2)
+void
+os_rwlock_get_stat(os_rwlock_t* const p_rwlock, os_rwlock_stat_t* const p_stat);
+
+/**
+ * @brief Reset the contention counters of the lock.
+ * @param p_rwlock - pointer to the os_rwlock_t object.
+ */
+ATTR_NONNULL(1)
+void
+os_rwlock_reset_stat(os_rwlock_t* const p_rwlock);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OS_RWLOCK_H
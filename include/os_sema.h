@@ -29,6 +29,15 @@ ATTR_WARN_UNUSED_RESULT
 os_sema_t
 os_sema_create(void);
 
+/**
+ * @brief Create a new binary semaphore object with the name which is used by the lock profiler (see os_lock_prof.h).
+ * @param p_name - the name of the semaphore or NULL.
+ * @return ptr to the instance of os_sema_t object.
+ */
+ATTR_WARN_UNUSED_RESULT
+os_sema_t
+os_sema_create_named(const char* const p_name);
+
 /**
  * @brief Create a new binary semaphore object using pre-allocated memory.
  * @param p_sema_static - pointer to the pre-allocated memory.
@@ -42,6 +51,20 @@ os_sema_t
 os_sema_create_static(os_sema_static_t* const p_sema_static);
 #endif
 
+/**
+ * @brief Create a new binary semaphore object with the name using pre-allocated memory.
+ * @param p_sema_static - pointer to the pre-allocated memory.
+ * @param p_name - the name of the semaphore or NULL.
+ * @return ptr to the instance of os_sema_t object.
+ */
+#if configSUPPORT_STATIC_ALLOCATION
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+os_sema_t
+os_sema_create_static_named(os_sema_static_t* const p_sema_static, const char* const p_name);
+#endif
+
 /**
  * @brief Delete the os_sema_t object.
  * @param[in,out] ph_sema - pointer to the variable which contains the semaphore handle,
@@ -13,17 +13,56 @@
 #include "os_wrapper_types.h"
 #include "attribs.h"
 
+#if !defined(OS_SIGNAL_LATENCY)
+#define OS_SIGNAL_LATENCY 0
+#endif
+
+#if !defined(OS_SIGNAL_LATENCY_NUM_BUCKETS)
+#define OS_SIGNAL_LATENCY_NUM_BUCKETS (24U)
+#endif
+
+#ifndef __cplusplus
+// The upper bound of the histogram bucket is calculated as (2U << i) - 1U, so i must be less than 31.
+_Static_assert(OS_SIGNAL_LATENCY_NUM_BUCKETS <= 32U, "OS_SIGNAL_LATENCY_NUM_BUCKETS <= 32U");
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef struct os_signal_t os_signal_t;
 
+#if OS_SIGNAL_LATENCY
+/**
+ * @brief Statistics of the latency between os_signal_send and the return from os_signal_wait* in the waiting task.
+ * @note hist[i] counts the latencies in range [2^i, 2^(i+1)) microseconds (hist[0] also counts 0 us),
+ *       the last bucket counts all the latencies above its lower bound.
+ */
+typedef struct os_signal_latency_stat_t
+{
+    uint32_t num_samples;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t hist[OS_SIGNAL_LATENCY_NUM_BUCKETS];
+} os_signal_latency_stat_t;
+
+/**
+ * @brief Callback which returns the current time in microseconds (it is allowed to wrap around).
+ * @note It must be callable from ISR if os_signal_send is called from ISR.
+ */
+typedef uint32_t (*os_signal_latency_clock_us_t)(void);
+#endif
+
 typedef struct os_signal_static_t
 {
     void*    stub1;
     uint32_t stub2;
     bool     stub3;
+#if OS_SIGNAL_LATENCY
+    uint32_t                 stub4;
+    os_signal_latency_stat_t stub5;
+#endif
 } os_signal_static_t;
 
 typedef enum os_signal_num_e
@@ -184,6 +223,51 @@ ATTR_NONNULL(1)
 os_signal_num_e
 os_signal_num_get_next(os_signal_events_t* const p_sig_events);
 
+#if OS_SIGNAL_LATENCY
+
+/**
+ * @brief Set the clock used to timestamp os_signal_send and the wake-up of the waiting task.
+ * @note By default esp_timer is used if it is available, otherwise the tick counter.
+ * @param p_clock_us - ptr to the clock callback or NULL to restore the default clock.
+ */
+void
+os_signal_latency_set_clock(const os_signal_latency_clock_us_t p_clock_us);
+
+/**
+ * @brief Get a copy of the latency statistics of the signal.
+ * @note The latency is measured from the first os_signal_send which has not been received yet
+ *       to the return from os_signal_wait* in the registered task.
+ *       The statistics are updated by the waiting task without locking,
+ *       so a copy taken concurrently with an update may be slightly inconsistent.
+ * @param p_signal - ptr to @ref os_signal_t
+ * @param[out] p_stat - ptr to the output statistics.
+ */
+ATTR_NONNULL(1, 2)
+void
+os_signal_latency_get_stat(const os_signal_t* const p_signal, os_signal_latency_stat_t* const p_stat);
+
+/**
+ * @brief Reset the latency statistics of the signal.
+ * @param p_signal - ptr to @ref os_signal_t
+ */
+ATTR_NONNULL(1)
+void
+os_signal_latency_reset(os_signal_t* const p_signal);
+
+/**
+ * @brief Estimate the percentile of the latency from the histogram.
+ * @param p_stat - ptr to the statistics.
+ * @param percent - the percentile (0..100).
+ * @return the upper bound of the histogram bucket which contains the percentile (limited by max_us)
+ *         or 0 if there are no samples.
+ */
+ATTR_NONNULL(1)
+ATTR_PURE
+uint32_t
+os_signal_latency_get_percentile_us(const os_signal_latency_stat_t* const p_stat, const uint32_t percent);
+
+#endif // OS_SIGNAL_LATENCY
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,6 +9,8 @@
 #define RUUVI_ESP_WRAPPERS_OS_STR_H
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include "attribs.h"
 
 #ifdef __cplusplus
@@ -17,6 +19,36 @@ extern "C" {
 
 typedef int os_str2num_base_t;
 
+/**
+ * @brief Pass this value as the length of the input string to the os_str_parse_* functions
+ * if the string is null-terminated.
+ */
+#define OS_STR_PARSE_LEN_UNLIMITED (SIZE_MAX)
+
+/**
+ * @brief The value returned by os_str_get_hex_digit for a character which is not a hex digit.
+ */
+#define OS_STR_HEX_DIGIT_INVALID (0xFFU)
+
+/**
+ * @brief Decode a hex digit ('0'..'9', 'a'..'f' or 'A'..'F') without ctype and without a lookup table.
+ * @param ch - the character to decode.
+ * @return the value of the digit (0..15) or OS_STR_HEX_DIGIT_INVALID.
+ */
+static inline uint32_t
+os_str_get_hex_digit(const char ch)
+{
+    // The unsigned subtraction maps all non-digit characters to values greater than 9
+    const uint32_t dec_digit = (uint32_t)(uint8_t)ch - (uint32_t)'0';
+    if (dec_digit <= 9U)
+    {
+        return dec_digit;
+    }
+    // Converting to lower case by setting bit 0x20 does not map any non-letter character to 'a'..'f'
+    const uint32_t alpha_idx = ((uint32_t)(uint8_t)ch | 0x20U) - (uint32_t)'a';
+    return (alpha_idx < 6U) ? (alpha_idx + 10U) : OS_STR_HEX_DIGIT_INVALID;
+}
+
 /**
  * @brief This is a wrapper for stdlib strtoul which implements const-correctness and fixes portability issues (MISRA)
  * @param p_str - ptr to a const string
@@ -67,6 +99,140 @@ ATTR_NONNULL(1)
 int32_t
 os_str_to_int32(char* __restrict const p_str, char** __restrict const pp_end, const os_str2num_base_t base);
 
+/**
+ * @note The os_str_parse_* functions below do not depend on the locale and do not skip leading whitespaces.
+ *       They parse at most len characters, so they can be used for zero-copy parsing of a non null-terminated
+ *       buffer, or with len=OS_STR_PARSE_LEN_UNLIMITED for a null-terminated string.
+ *       On success, the result is stored to *p_val and the pointer to the first character after the number
+ *       is stored to *pp_end (if pp_end is not NULL).
+ *       On failure (no digits or the value is out of range), *p_val is not changed and *pp_end is set to p_str.
+ */
+
+/**
+ * @brief Parse decimal unsigned 32-bit integer.
+ * @param p_str - ptr to the input string.
+ * @param len - the max number of characters to parse.
+ * @param pp_end - if pp_end is not NULL, it stores the address of the first character after the number.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_uint32_dec(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    uint32_t* __restrict const    p_val);
+
+/**
+ * @brief Parse hexadecimal unsigned 32-bit integer (an optional "0x" or "0X" prefix is accepted).
+ * @param p_str - ptr to the input string.
+ * @param len - the max number of characters to parse.
+ * @param pp_end - if pp_end is not NULL, it stores the address of the first character after the number.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_uint32_hex(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    uint32_t* __restrict const    p_val);
+
+/**
+ * @brief Parse decimal signed 32-bit integer with an optional sign.
+ * @param p_str - ptr to the input string.
+ * @param len - the max number of characters to parse.
+ * @param pp_end - if pp_end is not NULL, it stores the address of the first character after the number.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_int32_dec(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    int32_t* __restrict const     p_val);
+
+/**
+ * @brief Parse decimal unsigned 64-bit integer.
+ * @param p_str - ptr to the input string.
+ * @param len - the max number of characters to parse.
+ * @param pp_end - if pp_end is not NULL, it stores the address of the first character after the number.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_uint64_dec(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    uint64_t* __restrict const    p_val);
+
+/**
+ * @brief Parse hexadecimal unsigned 64-bit integer (an optional "0x" or "0X" prefix is accepted).
+ * @param p_str - ptr to the input string.
+ * @param len - the max number of characters to parse.
+ * @param pp_end - if pp_end is not NULL, it stores the address of the first character after the number.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_uint64_hex(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    uint64_t* __restrict const    p_val);
+
+/**
+ * @brief Parse decimal signed 64-bit integer with an optional sign.
+ * @param p_str - ptr to the input string.
+ * @param len - the max number of characters to parse.
+ * @param pp_end - if pp_end is not NULL, it stores the address of the first character after the number.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_int64_dec(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    int64_t* __restrict const     p_val);
+
+/**
+ * @brief Parse floating point number in format [+-]digits[.digits][(e|E)[+-]digits], the decimal separator is
+ * always '.' regardless of the locale, "inf" and "nan" are not supported.
+ * @note The function is not branchless: the digit loop branches on the decimal point and on the mantissa limit.
+ * @note Numbers with up to 7 significant digits and a decimal exponent within +-10 (typical sensor values)
+ *       are calculated in single precision and they are correctly rounded. Other numbers are calculated
+ *       with a single double precision operation, so in rare cases the result may differ from strtof
+ *       in the last bit because of the double rounding.
+ * @param p_str - ptr to the input string.
+ * @param len - the max number of characters to parse.
+ * @param pp_end - if pp_end is not NULL, it stores the address of the first character after the number.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range of float.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_float(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    float* __restrict const       p_val);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,206 @@
+/**
+ * @file os_str_view.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_ESP_WRAPPERS_OS_STR_VIEW_H
+#define RUUVI_ESP_WRAPPERS_OS_STR_VIEW_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "mac_addr.h"
+#include "attribs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief A non-owning view of a string which is not required to be null-terminated.
+ * @note The os_str_view_parse_* functions consume the parsed value from the beginning of the view,
+ *       so a whole record can be parsed in place without copying. On failure the view is not changed.
+ */
+typedef struct os_str_view_t
+{
+    const char* p_str;
+    size_t      len;
+} os_str_view_t;
+
+#define OS_STR_VIEW_INIT(p_str_, len_) \
+    (os_str_view_t) \
+    { \
+        .p_str = (p_str_), .len = (len_), \
+    }
+
+/**
+ * @brief Create a view of a null-terminated string.
+ * @param p_str - ptr to the null-terminated string.
+ * @return the view of the string.
+ */
+ATTR_NONNULL(1)
+os_str_view_t
+os_str_view_from_cstr(const char* const p_str);
+
+/**
+ * @brief Check if the view is empty.
+ * @param p_view - ptr to the view.
+ * @return true if the view is empty.
+ */
+ATTR_NONNULL(1)
+bool
+os_str_view_is_empty(const os_str_view_t* const p_view);
+
+/**
+ * @brief Check if the view is equal to the null-terminated string.
+ * @param p_view - ptr to the view.
+ * @param p_str - ptr to the null-terminated string.
+ * @return true if the view and the string are equal.
+ */
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_is_equal_cstr(const os_str_view_t* const p_view, const char* const p_str);
+
+/**
+ * @brief Skip the specified number of characters (or all the characters if there are not enough of them).
+ * @param p_view - ptr to the view.
+ * @param num_chars - the number of characters to skip.
+ */
+ATTR_NONNULL(1)
+void
+os_str_view_skip(os_str_view_t* const p_view, const size_t num_chars);
+
+/**
+ * @brief Skip the leading spaces and tabs.
+ * @param p_view - ptr to the view.
+ */
+ATTR_NONNULL(1)
+void
+os_str_view_skip_spaces(os_str_view_t* const p_view);
+
+/**
+ * @brief Consume the character if it is the first character of the view.
+ * @param p_view - ptr to the view.
+ * @param ch - the expected character.
+ * @return true if the character was consumed.
+ */
+ATTR_NONNULL(1)
+bool
+os_str_view_consume_char(os_str_view_t* const p_view, const char ch);
+
+/**
+ * @brief Consume the token before the delimiter and the delimiter itself.
+ * @note If there is no delimiter, then the whole view is consumed as the token.
+ * @param p_view - ptr to the view.
+ * @param delimiter - the delimiter character.
+ * @param[out] p_token - ptr to the output view of the token.
+ * @return false if the view is empty.
+ */
+ATTR_NONNULL(1, 3)
+bool
+os_str_view_split(os_str_view_t* const p_view, const char delimiter, os_str_view_t* const p_token);
+
+/**
+ * @brief Consume decimal unsigned 32-bit integer.
+ * @param p_view - ptr to the view.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_uint32(os_str_view_t* const p_view, uint32_t* const p_val);
+
+/**
+ * @brief Consume hexadecimal unsigned 32-bit integer (an optional "0x" or "0X" prefix is accepted).
+ * @param p_view - ptr to the view.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_uint32_hex(os_str_view_t* const p_view, uint32_t* const p_val);
+
+/**
+ * @brief Consume decimal signed 32-bit integer with an optional sign.
+ * @param p_view - ptr to the view.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_int32(os_str_view_t* const p_view, int32_t* const p_val);
+
+/**
+ * @brief Consume decimal unsigned 64-bit integer.
+ * @param p_view - ptr to the view.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_uint64(os_str_view_t* const p_view, uint64_t* const p_val);
+
+/**
+ * @brief Consume floating point number (see os_str_parse_float for the format).
+ * @param p_view - ptr to the view.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is out of range.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_float(os_str_view_t* const p_view, float* const p_val);
+
+/**
+ * @brief Consume boolean value: "true", "false", "1" or "0".
+ * The value must be followed by the end of the view or by a delimiter (any character except letters, digits,
+ * '_' and '.'), so "trueish" and "10" are rejected and the view is not modified.
+ * @param p_view - ptr to the view.
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_bool(os_str_view_t* const p_view, bool* const p_val);
+
+/**
+ * @brief Consume MAC address in format "XX:XX:XX:XX:XX:XX", "XX-XX-XX-XX-XX-XX" or "XXXXXXXXXXXX".
+ * @param p_view - ptr to the view.
+ * @param[out] p_mac - ptr to the output variable.
+ * @return true if successful.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_mac(os_str_view_t* const p_view, mac_address_bin_t* const p_mac);
+
+/**
+ * @brief Consume a sequence of hex bytes without separators (e.g. "0201061BFF").
+ * @param p_view - ptr to the view.
+ * @param[out] p_buf - ptr to the output buffer.
+ * @param buf_size - the size of the output buffer.
+ * @param[out] p_num_bytes - ptr to the variable which receives the number of bytes.
+ * @return true if successful, false if there are no hex digits, the number of hex digits is odd
+ *         or the bytes do not fit into the buffer.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2, 4)
+bool
+os_str_view_parse_hex_bytes(
+    os_str_view_t* const p_view,
+    uint8_t* const       p_buf,
+    const size_t         buf_size,
+    size_t* const        p_num_bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_ESP_WRAPPERS_OS_STR_VIEW_H
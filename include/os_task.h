@@ -18,6 +18,31 @@
 extern "C" {
 #endif
 
+#if !defined(OS_TASK_REGISTRY)
+#define OS_TASK_REGISTRY 0
+#endif
+
+#if !defined(OS_TASK_REGISTRY_MAX_NUM_TASKS)
+#define OS_TASK_REGISTRY_MAX_NUM_TASKS (24U)
+#endif
+
+/**
+ * The size of the static buffer for uxTaskGetSystemState used by @ref os_task_registry_sample,
+ * it must be not less than the total number of tasks in the system including the idle tasks
+ * and the tasks not created by os_task_create_*.
+ */
+#if !defined(OS_TASK_REGISTRY_MAX_NUM_TASK_STATUSES)
+#define OS_TASK_REGISTRY_MAX_NUM_TASK_STATUSES (OS_TASK_REGISTRY_MAX_NUM_TASKS + 8U)
+#endif
+
+#if !defined(OS_TASK_LOG_CTX_CACHE)
+#define OS_TASK_LOG_CTX_CACHE 0
+#endif
+
+#if !defined(OS_TASK_LOG_CTX_TLS_IDX_NAME)
+#define OS_TASK_LOG_CTX_TLS_IDX_NAME (1)
+#endif
+
 typedef ATTR_NORETURN void (*os_task_func_t)(void* p_param);
 typedef ATTR_NORETURN void (*os_task_func_const_param_t)(const void* p_param);
 typedef ATTR_NORETURN void (*os_task_func_without_param_t)(void);
@@ -29,6 +54,51 @@ typedef TaskHandle_t os_task_handle_t;
 typedef StackType_t  os_task_stack_type_t;
 typedef StaticTask_t os_task_static_t;
 
+typedef struct os_task_arg_finite_with_param_t
+{
+    os_task_finite_func_with_param_t p_func;
+    void*                            p_arg;
+} os_task_arg_finite_with_param_t;
+
+typedef struct os_task_arg_finite_with_const_param_t
+{
+    os_task_finite_func_with_const_param_t p_func;
+    const void*                            p_arg;
+} os_task_arg_finite_with_const_param_t;
+
+/**
+ * @brief Statically allocated control block for a finite task: FreeRTOS TCB and the argument block for the wrapper
+ * which calls the task function and deletes the task when it returns.
+ * @note It must remain valid until the task function returns.
+ */
+typedef struct os_task_static_finite_t
+{
+    os_task_static_t task_mem;
+    union
+    {
+        os_task_arg_finite_with_param_t       with_param;
+        os_task_arg_finite_with_const_param_t with_const_param;
+    } arg;
+} os_task_static_finite_t;
+
+#if OS_TASK_REGISTRY
+/**
+ * @brief Information about a task created by os_task_create_* which is kept in the task registry.
+ */
+typedef struct os_task_registry_info_t
+{
+    os_task_handle_t   h_task;
+    char               task_name[configMAX_TASK_NAME_LEN];
+    os_task_priority_t priority;
+    bool               is_static;
+    uint32_t           stack_depth;         //!< the size of the task stack as passed to os_task_create_*
+    uint32_t           stack_min_free;      //!< stack high-water mark (in the same units as stack_depth)
+    uint32_t           run_time_counter;    //!< value of the task run time counter at the last sampling
+    uint32_t           cpu_usage_permille;  //!< CPU share (in 0.1%) between the last two samplings
+    uint32_t           num_samples;         //!< number of samplings since the task was registered
+} os_task_registry_info_t;
+#endif // OS_TASK_REGISTRY
+
 /**
  * Create a new task thread.
  * @param p_func - pointer to the task function which never returns.
@@ -219,7 +289,9 @@ os_task_create_static_without_param(
     os_task_handle_t* const            ph_task);
 
 /**
- * Create a new task thread without using memory allocation from the heap.
+ * Create a new task thread with statically allocated stack and TCB.
+ * @note A small argument block for the task wrapper is still allocated from the heap,
+ *       use @ref os_task_create_static_finite_no_alloc to avoid it.
  * @param p_func - pointer to the task function which may return.
  * @param p_name - pointer to the task name
  * @param p_stack_mem - pointer to the statically allocated buffer for stack
@@ -242,7 +314,9 @@ os_task_create_static_finite(
     os_task_static_t* const                p_task_mem);
 
 /**
- * Create a new task thread without using memory allocation from the heap.
+ * Create a new task thread with statically allocated stack and TCB.
+ * @note A small argument block for the task wrapper is still allocated from the heap,
+ *       use @ref os_task_create_static_finite_with_const_param_no_alloc to avoid it.
  * @param p_func - pointer to the task function which may return and takes pointer to 'const' as an argument.
  * @param p_name - pointer to the task name
  * @param p_stack_mem - pointer to the statically allocated buffer for stack
@@ -285,6 +359,52 @@ os_task_create_static_finite_without_param(
     const os_task_priority_t                  priority,
     os_task_static_t* const                   p_task_mem);
 
+/**
+ * Create a new task thread without using memory allocation from the heap.
+ * @param p_func - pointer to the task function which may return.
+ * @param p_name - pointer to the task name
+ * @param p_stack_mem - pointer to the statically allocated buffer for stack
+ * @param stack_depth - the size of the task stack (in bytes)
+ * @param p_param - pointer that will be passed as the parameter to the task function
+ * @param priority - task priority
+ * @param p_task_mem - pointer to the statically allocated buffer for @ref os_task_static_finite_t
+ * @return true if successful
+ */
+ATTR_NONNULL(1, 3, 7)
+ATTR_WARN_UNUSED_RESULT
+bool
+os_task_create_static_finite_no_alloc(
+    const os_task_finite_func_with_param_t p_func,
+    const char* const                      p_name,
+    os_task_stack_type_t* const            p_stack_mem,
+    const uint32_t                         stack_depth,
+    void* const                            p_param,
+    const os_task_priority_t               priority,
+    os_task_static_finite_t* const         p_task_mem);
+
+/**
+ * Create a new task thread without using memory allocation from the heap.
+ * @param p_func - pointer to the task function which may return and takes pointer to 'const' as an argument.
+ * @param p_name - pointer to the task name
+ * @param p_stack_mem - pointer to the statically allocated buffer for stack
+ * @param stack_depth - the size of the task stack (in bytes)
+ * @param p_param - pointer that will be passed as the parameter to the task function
+ * @param priority - task priority
+ * @param p_task_mem - pointer to the statically allocated buffer for @ref os_task_static_finite_t
+ * @return true if successful
+ */
+ATTR_NONNULL(1, 3, 7)
+ATTR_WARN_UNUSED_RESULT
+bool
+os_task_create_static_finite_with_const_param_no_alloc(
+    const os_task_finite_func_with_const_param_t p_func,
+    const char* const                            p_name,
+    os_task_stack_type_t* const                  p_stack_mem,
+    const uint32_t                               stack_depth,
+    const void* const                            p_param,
+    const os_task_priority_t                     priority,
+    os_task_static_finite_t* const               p_task_mem);
+
 /**
  * Remove the task from the RTOS kernel's scheduler.
  * @note All resources (dynamic memory, sockets, file descriptors, ...) allocated by the task will remain allocated.
@@ -296,6 +416,9 @@ os_task_delete(os_task_handle_t* const ph_task);
 
 /**
  * Get task name for the current thread.
+ * @note If OS_TASK_LOG_CTX_CACHE is enabled, the name is cached in the thread-local storage pointer
+ *       OS_TASK_LOG_CTX_TLS_IDX_NAME of the current task on the first call,
+ *       so that LOG_* macros can take it without entering the kernel.
  * @return pointer to the string with the current task name.
  */
 ATTR_WARN_UNUSED_RESULT
@@ -325,6 +448,60 @@ ATTR_WARN_UNUSED_RESULT
 os_task_handle_t
 os_task_get_cur_task_handle(void);
 
+#if OS_TASK_REGISTRY
+/**
+ * @brief Initialize the registry of tasks created by os_task_create_*.
+ * @note Tasks which were created before the initialization are not tracked.
+ */
+void
+os_task_registry_init(void);
+
+/**
+ * @brief Deinitialize the registry of tasks and forget all the registered tasks.
+ */
+void
+os_task_registry_deinit(void);
+
+/**
+ * @brief Forget all the registered tasks.
+ */
+void
+os_task_registry_clear(void);
+
+/**
+ * @brief Sample the stack high-water marks and run time counters of all the registered tasks.
+ * @note This function should be called periodically (for example, from a periodic os_timer),
+ *       CPU usage is calculated as a share of the run time between two consecutive samplings.
+ *       Tasks which have been deleted since the previous sampling are removed from the registry.
+ * @return true if successful.
+ */
+bool
+os_task_registry_sample(void);
+
+/**
+ * @brief Get a snapshot of the registry of tasks.
+ * @param[out] p_arr_of_info - pointer to the array where to copy the information about the registered tasks.
+ * @param max_num_tasks - the number of elements in the array p_arr_of_info.
+ * @return the number of tasks copied to p_arr_of_info.
+ */
+ATTR_NONNULL(1)
+uint32_t
+os_task_registry_get_snapshot(os_task_registry_info_t* const p_arr_of_info, const uint32_t max_num_tasks);
+
+/**
+ * @brief Get the number of tasks which were not registered because the registry was full.
+ * @return the number of tasks which were not registered.
+ */
+uint32_t
+os_task_registry_get_num_overflows(void);
+
+/**
+ * @brief Print stack usage and CPU share of every registered task to the log.
+ */
+void
+os_task_registry_log_dump(void);
+#endif // OS_TASK_REGISTRY
+
 #ifdef __cplusplus
 }
 #endif
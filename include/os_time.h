@@ -9,12 +9,20 @@
 #define OS_TIME_H
 
 #include <time.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include "freertos/FreeRTOS.h"
+#include "attribs.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define OS_TIME_RFC3339_STR_LEN    (20) // "2024-02-29T12:30:15Z"
+#define OS_TIME_RFC3339_MS_STR_LEN (24) // "2024-02-29T12:30:15.123Z"
+#define OS_TIME_RFC7231_STR_LEN    (29) // "Thu, 29 Feb 2024 12:30:15 GMT"
+
 typedef enum os_time_month_e
 {
     OS_TIME_MONTH_JAN = 0,
@@ -133,6 +141,76 @@ os_time_wday_name_mid(const os_time_wday_e day_of_the_week);
 const char*
 os_time_wday_name_long(const os_time_wday_e day_of_the_week);
 
+/**
+ * @brief Format UTC time as RFC 3339 (ISO 8601) string "YYYY-MM-DDTHH:MM:SSZ".
+ * @param p_tm_time_utc - pointer to the normalized 'struct tm' expressed as UTC, the year must be in [0, 9999].
+ * @param[out] p_buf - ptr to the output buffer.
+ * @param buf_size - the size of the output buffer, it must be at least OS_TIME_RFC3339_STR_LEN + 1.
+ * @return the length of the string or 0 if the buffer is too small or the time is out of range.
+ */
+ATTR_NONNULL(1, 2)
+size_t
+os_time_fmt_rfc3339(const struct tm* const p_tm_time_utc, char* const p_buf, const size_t buf_size);
+
+/**
+ * @brief Format UTC time with milliseconds as RFC 3339 (ISO 8601) string "YYYY-MM-DDTHH:MM:SS.sssZ".
+ * @param p_tm_time_utc - pointer to the normalized 'struct tm' expressed as UTC, the year must be in [0, 9999].
+ * @param milliseconds - milliseconds in the range [0, 999].
+ * @param[out] p_buf - ptr to the output buffer.
+ * @param buf_size - the size of the output buffer, it must be at least OS_TIME_RFC3339_MS_STR_LEN + 1.
+ * @return the length of the string or 0 if the buffer is too small or the time is out of range.
+ */
+ATTR_NONNULL(1, 3)
+size_t
+os_time_fmt_rfc3339_ms(
+    const struct tm* const p_tm_time_utc,
+    const uint32_t         milliseconds,
+    char* const            p_buf,
+    const size_t           buf_size);
+
+/**
+ * @brief Format UTC time as RFC 7231 (HTTP-date, IMF-fixdate) string "Sun, 06 Nov 1994 08:49:37 GMT".
+ * @param p_tm_time_utc - pointer to the normalized 'struct tm' expressed as UTC, the year must be in [0, 9999].
+ * @param[out] p_buf - ptr to the output buffer.
+ * @param buf_size - the size of the output buffer, it must be at least OS_TIME_RFC7231_STR_LEN + 1.
+ * @return the length of the string or 0 if the buffer is too small or the time is out of range.
+ */
+ATTR_NONNULL(1, 2)
+size_t
+os_time_fmt_rfc7231(const struct tm* const p_tm_time_utc, char* const p_buf, const size_t buf_size);
+
+/**
+ * @brief Parse RFC 3339 date-time "YYYY-MM-DDTHH:MM:SS[.frac](Z|+HH:MM|-HH:MM)".
+ * @note 't' and ' ' are accepted instead of 'T', 'z' is accepted instead of 'Z',
+ *       the time with the offset is converted to UTC, the fraction of a second is truncated to milliseconds.
+ * @param p_str - ptr to the string (it is not required to be null-terminated).
+ * @param len - the length of the string, the whole string must be the date-time.
+ * @param[out] p_tm_time_utc - pointer to the output 'struct tm' expressed as UTC (all the fields are filled).
+ * @param[out] p_milliseconds - ptr to the output variable for milliseconds, can be NULL.
+ * @return true if successful, on failure the output variables are not changed.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 3)
+bool
+os_time_parse_rfc3339(
+    const char* const p_str,
+    const size_t      len,
+    struct tm* const  p_tm_time_utc,
+    uint32_t* const   p_milliseconds);
+
+/**
+ * @brief Parse RFC 7231 HTTP-date in the preferred format (IMF-fixdate) "Sun, 06 Nov 1994 08:49:37 GMT".
+ * @note The obsolete RFC 850 and asctime formats are not supported.
+ * @param p_str - ptr to the string (it is not required to be null-terminated).
+ * @param len - the length of the string, the whole string must be the date.
+ * @param[out] p_tm_time_utc - pointer to the output 'struct tm' expressed as UTC (all the fields are filled).
+ * @return true if successful, on failure the output variable is not changed.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 3)
+bool
+os_time_parse_rfc7231(const char* const p_str, const size_t len, struct tm* const p_tm_time_utc);
+
 #ifdef __cplusplus
 }
 #endif
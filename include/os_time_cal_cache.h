@@ -0,0 +1,100 @@
+/**
+ * @file os_time_cal_cache.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef OS_TIME_CAL_CACHE_H
+#define OS_TIME_CAL_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "attribs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief UTC calendar cache, it remembers the start of the day and the date fields of the last converted timestamp,
+ * so converting another timestamp within the same day requires only a subtraction and a few divisions.
+ * @note The cache is not thread-safe, each task should use its own instance
+ *       (or use os_time_cal_cache_shared_* functions which use the global lock-free cache).
+ */
+typedef struct os_time_cal_cache_t
+{
+    int64_t day_start; ///< Unix time of 00:00:00 of the cached day
+    int32_t tm_year;
+    int32_t tm_mon;
+    int32_t tm_mday;
+    int32_t tm_wday;
+    int32_t tm_yday;
+    bool    is_valid;
+} os_time_cal_cache_t;
+
+/**
+ * @brief Initialize (invalidate) the calendar cache.
+ * @param p_cache - ptr to the calendar cache.
+ */
+ATTR_NONNULL(1)
+void
+os_time_cal_cache_init(os_time_cal_cache_t* const p_cache);
+
+/**
+ * @brief Convert Unix-time to 'struct tm' expressed as UTC, it is equivalent to gmtime_r.
+ * @note The cache is refreshed if the day has changed.
+ * @param p_cache - ptr to the calendar cache.
+ * @param unix_time - Unix-time (seconds since the Epoch 1970).
+ * @param[out] p_tm_time_utc - ptr to the output 'struct tm'.
+ * @return p_tm_time_utc or NULL if the year cannot be represented in tm_year.
+ */
+ATTR_NONNULL(1, 3)
+struct tm*
+os_time_cal_cache_gmtime_r(os_time_cal_cache_t* const p_cache, const time_t unix_time, struct tm* const p_tm_time_utc);
+
+/**
+ * @brief Convert 'struct tm' expressed as UTC to Unix-time, it is equivalent to os_mkgmtime.
+ * @note If the date matches the cached day and the time fields are normalized, then the result is calculated
+ *       from the cache, otherwise os_mkgmtime is called and the cache is refreshed.
+ * @param p_cache - ptr to the calendar cache.
+ * @param[in,out] p_tm_time_utc - pointer to 'struct tm' with a broken-down time, expressed as UTC.
+ * @return Unix-time or -1 in case of error (see os_mkgmtime).
+ */
+ATTR_NONNULL(1, 2)
+time_t
+os_time_cal_cache_mkgmtime(os_time_cal_cache_t* const p_cache, struct tm* const p_tm_time_utc);
+
+/**
+ * @brief The same as os_time_cal_cache_gmtime_r, but uses the global cache which can be used from any task.
+ * @note The global cache is protected by a sequence lock: readers never block, and if another task is refreshing
+ *       the cache at the same moment, then the conversion is just performed without the cache.
+ * @param unix_time - Unix-time (seconds since the Epoch 1970).
+ * @param[out] p_tm_time_utc - ptr to the output 'struct tm'.
+ * @return p_tm_time_utc or NULL if the year cannot be represented in tm_year.
+ */
+ATTR_NONNULL(2)
+struct tm*
+os_time_cal_cache_shared_gmtime_r(const time_t unix_time, struct tm* const p_tm_time_utc);
+
+/**
+ * @brief The same as os_time_cal_cache_mkgmtime, but uses the global cache which can be used from any task.
+ * @param[in,out] p_tm_time_utc - pointer to 'struct tm' with a broken-down time, expressed as UTC.
+ * @return Unix-time or -1 in case of error (see os_mkgmtime).
+ */
+ATTR_NONNULL(1)
+time_t
+os_time_cal_cache_shared_mkgmtime(struct tm* const p_tm_time_utc);
+
+/**
+ * @brief Invalidate the global calendar cache.
+ */
+void
+os_time_cal_cache_shared_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OS_TIME_CAL_CACHE_H
@@ -0,0 +1,134 @@
+/**
+ * @file os_time_mono.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef OS_TIME_MONO_H
+#define OS_TIME_MONO_H
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "time_units.h"
+#include "attribs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 64-bit monotonic tick counter, it does not wrap around (at 1000 Hz it would take 584 million years).
+ */
+typedef uint64_t os_time_mono_tick64_t;
+
+#define OS_TIME_MONO_TICK_TYPE_NUM_BITS (sizeof(TickType_t) * 8U)
+
+/**
+ * @brief Combine the number of overflows of the tick counter and the tick counter into the 64-bit tick counter.
+ * @param num_overflows - the number of times the tick counter has wrapped around.
+ * @param tick - the value of the tick counter.
+ * @return 64-bit tick counter.
+ */
+ATTR_CONST
+static inline os_time_mono_tick64_t
+os_time_mono_tick64_make(const uint32_t num_overflows, const TickType_t tick)
+{
+    return ((os_time_mono_tick64_t)num_overflows << OS_TIME_MONO_TICK_TYPE_NUM_BITS) | (os_time_mono_tick64_t)tick;
+}
+
+/**
+ * @brief Extend the value of the tick counter (e.g. a timestamp saved earlier) to 64 bits.
+ * @note The result is the latest 64-bit tick which is not later than the reference tick
+ *       and which has the same lower bits as the tick counter, so the tick must not be older than
+ *       one wrap period of TickType_t (about 49 days at 1000 Hz) relative to the reference tick.
+ * @param ref_tick64 - the reference 64-bit tick (usually the current one).
+ * @param tick - the value of the tick counter which is not later than the reference tick.
+ * @return 64-bit tick counter.
+ */
+ATTR_CONST
+static inline os_time_mono_tick64_t
+os_time_mono_tick64_extend(const os_time_mono_tick64_t ref_tick64, const TickType_t tick)
+{
+    const TickType_t delta_ticks = (TickType_t)ref_tick64 - tick;
+    if (delta_ticks > ref_tick64)
+    {
+        // The tick is from the first wrap period, but it is later than the reference tick
+        return (os_time_mono_tick64_t)tick;
+    }
+    return ref_tick64 - delta_ticks;
+}
+
+/**
+ * @brief Calculate the number of ticks elapsed since the specified moment.
+ * @param tick64_start - the 64-bit tick of the start moment.
+ * @param tick64_now - the 64-bit tick of the current moment.
+ * @return the number of ticks elapsed or 0 if tick64_start is later than tick64_now.
+ */
+ATTR_CONST
+static inline os_time_mono_tick64_t
+os_time_mono_tick64_elapsed(const os_time_mono_tick64_t tick64_start, const os_time_mono_tick64_t tick64_now)
+{
+    return (tick64_now > tick64_start) ? (tick64_now - tick64_start) : 0;
+}
+
+/**
+ * @brief Convert 64-bit ticks to microseconds.
+ * @param num_ticks - the number of ticks.
+ * @return the number of microseconds.
+ */
+ATTR_CONST
+static inline TimeUnitsMicroSeconds_t
+os_time_mono_conv_ticks_to_us(const os_time_mono_tick64_t num_ticks)
+{
+    return time_units_conv_ticks_to_us(num_ticks, configTICK_RATE_HZ);
+}
+
+/**
+ * @brief Convert 64-bit ticks to milliseconds.
+ * @param num_ticks - the number of ticks.
+ * @return the number of milliseconds.
+ */
+ATTR_CONST
+static inline uint64_t
+os_time_mono_conv_ticks_to_ms(const os_time_mono_tick64_t num_ticks)
+{
+    return time_units_conv_ticks_to_ms(num_ticks, configTICK_RATE_HZ);
+}
+
+/**
+ * @brief Convert microseconds to 64-bit ticks (rounding down).
+ * @param num_us - the number of microseconds.
+ * @return the number of ticks.
+ */
+ATTR_CONST
+static inline os_time_mono_tick64_t
+os_time_mono_conv_us_to_ticks(const TimeUnitsMicroSeconds_t num_us)
+{
+    return time_units_conv_us_to_ticks(num_us, configTICK_RATE_HZ);
+}
+
+/**
+ * @brief Get the 64-bit monotonic tick counter.
+ * @note The tick counter and the number of its overflows are read atomically by vTaskSetTimeOutState,
+ *       so the result is correct after the wrap-around of TickType_t and there is no need to call this function
+ *       periodically. It must not be called from ISR.
+ * @return 64-bit tick counter.
+ */
+os_time_mono_tick64_t
+os_time_mono_get_tick64(void);
+
+/**
+ * @brief Get the monotonic time in microseconds since boot.
+ * @note If esp_timer is available, then it is used as the source of time (with microsecond resolution),
+ *       otherwise the time is calculated from the 64-bit tick counter (with the resolution of one tick).
+ * @return the number of microseconds since boot.
+ */
+TimeUnitsMicroSeconds_t
+os_time_mono_get_us(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OS_TIME_MONO_H
@@ -594,6 +594,205 @@ os_timer_one_shot_cptr_const_arg_restart(
     os_timer_one_shot_cptr_const_arg_t* const p_timer,
     const os_delta_ticks_t                    delay_ticks);
 
+/**
+ * @brief Restart the periodic timer with the period specified in milliseconds.
+ * @note The period is rounded up to system ticks, see @ref os_delta_ticks_from_ms.
+ * @param p_timer - ptr to the timer object instance.
+ * @param period_ms - the period in milliseconds.
+ */
+static inline bool
+os_timer_periodic_restart_ms(os_timer_periodic_t* const p_timer, const TimeUnitsMilliSeconds_t period_ms)
+{
+    return os_timer_periodic_restart(p_timer, os_delta_ticks_from_ms(period_ms));
+}
+
+static inline void
+os_timer_periodic_without_arg_restart_ms(
+    os_timer_periodic_without_arg_t* const p_timer,
+    const TimeUnitsMilliSeconds_t          period_ms)
+{
+    os_timer_periodic_without_arg_restart(p_timer, os_delta_ticks_from_ms(period_ms));
+}
+
+static inline void
+os_timer_periodic_const_arg_restart_ms(
+    os_timer_periodic_const_arg_t* const p_timer,
+    const TimeUnitsMilliSeconds_t        period_ms)
+{
+    os_timer_periodic_const_arg_restart(p_timer, os_delta_ticks_from_ms(period_ms));
+}
+
+static inline void
+os_timer_periodic_cptr_restart_ms(os_timer_periodic_cptr_t* const p_timer, const TimeUnitsMilliSeconds_t period_ms)
+{
+    os_timer_periodic_cptr_restart(p_timer, os_delta_ticks_from_ms(period_ms));
+}
+
+static inline void
+os_timer_periodic_cptr_without_arg_restart_ms(
+    os_timer_periodic_cptr_without_arg_t* const p_timer,
+    const TimeUnitsMilliSeconds_t               period_ms)
+{
+    os_timer_periodic_cptr_without_arg_restart(p_timer, os_delta_ticks_from_ms(period_ms));
+}
+
+static inline void
+os_timer_periodic_cptr_const_arg_restart_ms(
+    os_timer_periodic_cptr_const_arg_t* const p_timer,
+    const TimeUnitsMilliSeconds_t             period_ms)
+{
+    os_timer_periodic_cptr_const_arg_restart(p_timer, os_delta_ticks_from_ms(period_ms));
+}
+
+/**
+ * @brief Restart the periodic timer with the period specified in microseconds.
+ * @note The period is rounded up to system ticks, see @ref os_delta_ticks_from_us.
+ * @param p_timer - ptr to the timer object instance.
+ * @param period_us - the period in microseconds.
+ */
+static inline bool
+os_timer_periodic_restart_us(os_timer_periodic_t* const p_timer, const TimeUnitsMicroSeconds_t period_us)
+{
+    return os_timer_periodic_restart(p_timer, os_delta_ticks_from_us(period_us));
+}
+
+static inline void
+os_timer_periodic_without_arg_restart_us(
+    os_timer_periodic_without_arg_t* const p_timer,
+    const TimeUnitsMicroSeconds_t          period_us)
+{
+    os_timer_periodic_without_arg_restart(p_timer, os_delta_ticks_from_us(period_us));
+}
+
+static inline void
+os_timer_periodic_const_arg_restart_us(
+    os_timer_periodic_const_arg_t* const p_timer,
+    const TimeUnitsMicroSeconds_t        period_us)
+{
+    os_timer_periodic_const_arg_restart(p_timer, os_delta_ticks_from_us(period_us));
+}
+
+static inline void
+os_timer_periodic_cptr_restart_us(os_timer_periodic_cptr_t* const p_timer, const TimeUnitsMicroSeconds_t period_us)
+{
+    os_timer_periodic_cptr_restart(p_timer, os_delta_ticks_from_us(period_us));
+}
+
+static inline void
+os_timer_periodic_cptr_without_arg_restart_us(
+    os_timer_periodic_cptr_without_arg_t* const p_timer,
+    const TimeUnitsMicroSeconds_t               period_us)
+{
+    os_timer_periodic_cptr_without_arg_restart(p_timer, os_delta_ticks_from_us(period_us));
+}
+
+static inline void
+os_timer_periodic_cptr_const_arg_restart_us(
+    os_timer_periodic_cptr_const_arg_t* const p_timer,
+    const TimeUnitsMicroSeconds_t             period_us)
+{
+    os_timer_periodic_cptr_const_arg_restart(p_timer, os_delta_ticks_from_us(period_us));
+}
+
+/**
+ * @brief Restart the one-shot timer with the delay specified in milliseconds.
+ * @note The delay is rounded up to system ticks, see @ref os_delta_ticks_from_ms.
+ * @param p_timer - ptr to the timer object instance.
+ * @param delay_ms - the delay in milliseconds.
+ */
+static inline bool
+os_timer_one_shot_restart_ms(os_timer_one_shot_t* const p_timer, const TimeUnitsMilliSeconds_t delay_ms)
+{
+    return os_timer_one_shot_restart(p_timer, os_delta_ticks_from_ms(delay_ms));
+}
+
+static inline void
+os_timer_one_shot_without_arg_restart_ms(
+    os_timer_one_shot_without_arg_t* const p_timer,
+    const TimeUnitsMilliSeconds_t          delay_ms)
+{
+    os_timer_one_shot_without_arg_restart(p_timer, os_delta_ticks_from_ms(delay_ms));
+}
+
+static inline void
+os_timer_one_shot_const_arg_restart_ms(
+    os_timer_one_shot_const_arg_t* const p_timer,
+    const TimeUnitsMilliSeconds_t        delay_ms)
+{
+    os_timer_one_shot_const_arg_restart(p_timer, os_delta_ticks_from_ms(delay_ms));
+}
+
+static inline void
+os_timer_one_shot_cptr_restart_ms(os_timer_one_shot_cptr_t* const p_timer, const TimeUnitsMilliSeconds_t delay_ms)
+{
+    os_timer_one_shot_cptr_restart(p_timer, os_delta_ticks_from_ms(delay_ms));
+}
+
+static inline void
+os_timer_one_shot_cptr_without_arg_restart_ms(
+    os_timer_one_shot_cptr_without_arg_t* const p_timer,
+    const TimeUnitsMilliSeconds_t               delay_ms)
+{
+    os_timer_one_shot_cptr_without_arg_restart(p_timer, os_delta_ticks_from_ms(delay_ms));
+}
+
+static inline void
+os_timer_one_shot_cptr_const_arg_restart_ms(
+    os_timer_one_shot_cptr_const_arg_t* const p_timer,
+    const TimeUnitsMilliSeconds_t             delay_ms)
+{
+    os_timer_one_shot_cptr_const_arg_restart(p_timer, os_delta_ticks_from_ms(delay_ms));
+}
+
+/**
+ * @brief Restart the one-shot timer with the delay specified in microseconds.
+ * @note The delay is rounded up to system ticks, see @ref os_delta_ticks_from_us.
+ * @param p_timer - ptr to the timer object instance.
+ * @param delay_us - the delay in microseconds.
+ */
+static inline bool
+os_timer_one_shot_restart_us(os_timer_one_shot_t* const p_timer, const TimeUnitsMicroSeconds_t delay_us)
+{
+    return os_timer_one_shot_restart(p_timer, os_delta_ticks_from_us(delay_us));
+}
+
+static inline void
+os_timer_one_shot_without_arg_restart_us(
+    os_timer_one_shot_without_arg_t* const p_timer,
+    const TimeUnitsMicroSeconds_t          delay_us)
+{
+    os_timer_one_shot_without_arg_restart(p_timer, os_delta_ticks_from_us(delay_us));
+}
+
+static inline void
+os_timer_one_shot_const_arg_restart_us(
+    os_timer_one_shot_const_arg_t* const p_timer,
+    const TimeUnitsMicroSeconds_t        delay_us)
+{
+    os_timer_one_shot_const_arg_restart(p_timer, os_delta_ticks_from_us(delay_us));
+}
+
+static inline void
+os_timer_one_shot_cptr_restart_us(os_timer_one_shot_cptr_t* const p_timer, const TimeUnitsMicroSeconds_t delay_us)
+{
+    os_timer_one_shot_cptr_restart(p_timer, os_delta_ticks_from_us(delay_us));
+}
+
+static inline void
+os_timer_one_shot_cptr_without_arg_restart_us(
+    os_timer_one_shot_cptr_without_arg_t* const p_timer,
+    const TimeUnitsMicroSeconds_t               delay_us)
+{
+    os_timer_one_shot_cptr_without_arg_restart(p_timer, os_delta_ticks_from_us(delay_us));
+}
+
+static inline void
+os_timer_one_shot_cptr_const_arg_restart_us(
+    os_timer_one_shot_cptr_const_arg_t* const p_timer,
+    const TimeUnitsMicroSeconds_t             delay_us)
+{
+    os_timer_one_shot_cptr_const_arg_restart(p_timer, os_delta_ticks_from_us(delay_us));
+}
 /**
  * @brief Simulate the triggering of the periodic timer - call the callback function.
  * @param p_timer - ptr to the timer object instance.
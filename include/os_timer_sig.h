@@ -26,7 +26,7 @@ typedef struct os_timer_sig_periodic_static_obj_t
     void*            stub2;
     os_signal_num_e  stub3;
     os_delta_ticks_t stub4;
-    TickType_t       stub5;
+    uint64_t         stub5;
     bool             stub6;
     bool             stub7;
     bool             stub8;
@@ -44,7 +44,7 @@ typedef struct os_timer_sig_one_shot_static_obj_t
     void*            stub2;
     os_signal_num_e  stub3;
     os_delta_ticks_t stub4;
-    TickType_t       stub5;
+    uint64_t         stub5;
     bool             stub6;
     bool             stub7;
 } os_timer_sig_one_shot_static_obj_t;
@@ -232,6 +232,105 @@ os_timer_sig_one_shot_restart_with_period(
     const os_delta_ticks_t         delay_ticks,
     const bool                     flag_reset_active_timer);
 
+/**
+ * @brief Set the new period for the timer specified in milliseconds (but do not start or restart it).
+ * @note The period is rounded up to system ticks, see @ref os_delta_ticks_from_ms.
+ *
+ * @param p_obj     Pointer to the timer-sig object instance.
+ * @param delay_ms  Period for the timer, specified in milliseconds.
+ */
+static inline void
+os_timer_sig_periodic_set_period_ms(
+    os_timer_sig_periodic_t* const p_obj,
+    const TimeUnitsMilliSeconds_t  delay_ms)
+{
+    os_timer_sig_periodic_set_period(p_obj, os_delta_ticks_from_ms(delay_ms));
+}
+
+static inline void
+os_timer_sig_one_shot_set_period_ms(
+    os_timer_sig_one_shot_t* const p_obj,
+    const TimeUnitsMilliSeconds_t  delay_ms)
+{
+    os_timer_sig_one_shot_set_period(p_obj, os_delta_ticks_from_ms(delay_ms));
+}
+
+/**
+ * @brief Restarts the timer which sends the specified signal with the period specified in milliseconds.
+ * @note The period is rounded up to system ticks, see @ref os_delta_ticks_from_ms.
+ *       For details see @ref os_timer_sig_periodic_restart_with_period.
+ *
+ * @param p_obj     Pointer to the timer-sig object instance.
+ * @param delay_ms  Period for the timer, specified in milliseconds.
+ * @param flag_reset_active_timer If true, then restart an active timer from the current moment.
+ */
+static inline void
+os_timer_sig_periodic_restart_with_period_ms(
+    os_timer_sig_periodic_t* const p_obj,
+    const TimeUnitsMilliSeconds_t  delay_ms,
+    const bool                     flag_reset_active_timer)
+{
+    os_timer_sig_periodic_restart_with_period(p_obj, os_delta_ticks_from_ms(delay_ms), flag_reset_active_timer);
+}
+
+static inline void
+os_timer_sig_one_shot_restart_with_period_ms(
+    os_timer_sig_one_shot_t* const p_obj,
+    const TimeUnitsMilliSeconds_t  delay_ms,
+    const bool                     flag_reset_active_timer)
+{
+    os_timer_sig_one_shot_restart_with_period(p_obj, os_delta_ticks_from_ms(delay_ms), flag_reset_active_timer);
+}
+
+/**
+ * @brief Set the new period for the timer specified in microseconds (but do not start or restart it).
+ * @note The period is rounded up to system ticks, see @ref os_delta_ticks_from_us.
+ *
+ * @param p_obj     Pointer to the timer-sig object instance.
+ * @param delay_us  Period for the timer, specified in microseconds.
+ */
+static inline void
+os_timer_sig_periodic_set_period_us(
+    os_timer_sig_periodic_t* const p_obj,
+    const TimeUnitsMicroSeconds_t  delay_us)
+{
+    os_timer_sig_periodic_set_period(p_obj, os_delta_ticks_from_us(delay_us));
+}
+
+static inline void
+os_timer_sig_one_shot_set_period_us(
+    os_timer_sig_one_shot_t* const p_obj,
+    const TimeUnitsMicroSeconds_t  delay_us)
+{
+    os_timer_sig_one_shot_set_period(p_obj, os_delta_ticks_from_us(delay_us));
+}
+
+/**
+ * @brief Restarts the timer which sends the specified signal with the period specified in microseconds.
+ * @note The period is rounded up to system ticks, see @ref os_delta_ticks_from_us.
+ *       For details see @ref os_timer_sig_periodic_restart_with_period.
+ *
+ * @param p_obj     Pointer to the timer-sig object instance.
+ * @param delay_us  Period for the timer, specified in microseconds.
+ * @param flag_reset_active_timer If true, then restart an active timer from the current moment.
+ */
+static inline void
+os_timer_sig_periodic_restart_with_period_us(
+    os_timer_sig_periodic_t* const p_obj,
+    const TimeUnitsMicroSeconds_t  delay_us,
+    const bool                     flag_reset_active_timer)
+{
+    os_timer_sig_periodic_restart_with_period(p_obj, os_delta_ticks_from_us(delay_us), flag_reset_active_timer);
+}
+
+static inline void
+os_timer_sig_one_shot_restart_with_period_us(
+    os_timer_sig_one_shot_t* const p_obj,
+    const TimeUnitsMicroSeconds_t  delay_us,
+    const bool                     flag_reset_active_timer)
+{
+    os_timer_sig_one_shot_restart_with_period(p_obj, os_delta_ticks_from_us(delay_us), flag_reset_active_timer);
+}
 /**
  * @brief Updates the timestamp associated with a one-shot signal timer when the timer was triggered.
  *
@@ -10,6 +10,8 @@
 
 #include <stdint.h>
 #include "freertos/FreeRTOS.h"
+#include "time_units.h"
+#include "attribs.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -19,10 +21,48 @@ typedef TickType_t os_delta_ticks_t;
 
 #define OS_DELTA_TICKS_IMMEDIATE       (0U)
 #define OS_DELTA_TICKS_INFINITE        (portMAX_DELAY)
-#define OS_DELTA_MS_TO_TICKS(delay_ms) pdMS_TO_TICKS(delay_ms)
+/**
+ * @brief Convert milliseconds to ticks (rounding down) in a constant expression.
+ * @note Unlike pdMS_TO_TICKS, the intermediate product is 64-bit, so it does not overflow for delays
+ *       longer than 71 minutes at 1000 Hz.
+ */
+#define OS_DELTA_MS_TO_TICKS(delay_ms) \
+    ((os_delta_ticks_t)(((uint64_t)(delay_ms) * (uint64_t)configTICK_RATE_HZ) / TIME_UNITS_MS_PER_SECOND))
+
+#define OS_DELTA_TICKS_MAX ((os_delta_ticks_t)~(os_delta_ticks_t)0)
 
 #define OS_ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
 
+/**
+ * @brief Convert milliseconds to ticks for timeouts and timer periods.
+ * @note The result is rounded up, so that a non-zero delay is never converted to zero ticks,
+ *       and it is saturated to OS_DELTA_TICKS_MAX (which is OS_DELTA_TICKS_INFINITE for 32-bit ticks).
+ *       For timer periods OS_DELTA_TICKS_MAX is a regular period (about 49 days at 1000 Hz).
+ * @param delay_ms - the delay in milliseconds.
+ * @return the delay in system ticks.
+ */
+ATTR_CONST
+static inline os_delta_ticks_t
+os_delta_ticks_from_ms(const TimeUnitsMilliSeconds_t delay_ms)
+{
+    const uint64_t delay_ticks = time_units_conv_ms_to_ticks_ceil(delay_ms, configTICK_RATE_HZ);
+    return (delay_ticks > OS_DELTA_TICKS_MAX) ? OS_DELTA_TICKS_MAX : (os_delta_ticks_t)delay_ticks;
+}
+
+/**
+ * @brief Convert microseconds to ticks for timeouts and timer periods.
+ * @note The result is rounded up and saturated in the same way as in @ref os_delta_ticks_from_ms.
+ * @param delay_us - the delay in microseconds.
+ * @return the delay in system ticks.
+ */
+ATTR_CONST
+static inline os_delta_ticks_t
+os_delta_ticks_from_us(const TimeUnitsMicroSeconds_t delay_us)
+{
+    const uint64_t delay_ticks = time_units_conv_us_to_ticks_ceil(delay_us, configTICK_RATE_HZ);
+    return (delay_ticks > OS_DELTA_TICKS_MAX) ? OS_DELTA_TICKS_MAX : (os_delta_ticks_t)delay_ticks;
+}
+
 #ifdef __cplusplus
 }
 #endif
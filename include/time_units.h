@@ -9,6 +9,7 @@
 #define RUUVI_TIME_UNITS_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "attribs.h"
 
 #ifdef __cplusplus
@@ -17,6 +18,7 @@ extern "C" {
 
 #define TIME_UNITS_MS_PER_SECOND (1000U)
 #define TIME_UNITS_US_PER_MS     (1000U)
+#define TIME_UNITS_US_PER_SECOND (TIME_UNITS_MS_PER_SECOND * TIME_UNITS_US_PER_MS)
 
 #define TIME_UNITS_HOURS_PER_DAY      (24U)
 #define TIME_UNITS_MINUTES_PER_HOUR   (60U)
@@ -40,6 +42,268 @@ time_units_conv_ms_to_us(const TimeUnitsMilliSeconds_t num_ms)
     return (TimeUnitsMicroSeconds_t)num_ms * TIME_UNITS_US_PER_MS;
 }
 
+/**
+ * @brief Convert a value from units with rate 'from_per_second' to units with rate 'to_per_second' (rounding down).
+ * @note The intermediate products never exceed 64 bits (except when the result itself does not fit into 64 bits),
+ *       and when the rates are compile-time constants, the conversion is folded into a single multiplication
+ *       or division.
+ * @param val - the value to convert.
+ * @param from_per_second - the number of source units per second (e.g. configTICK_RATE_HZ for ticks).
+ * @param to_per_second - the number of destination units per second.
+ * @return the converted value.
+ */
+ATTR_CONST
+static inline uint64_t
+time_units_conv_scale(const uint64_t val, const uint32_t from_per_second, const uint32_t to_per_second)
+{
+    if (0 == (to_per_second % from_per_second))
+    {
+        return val * (to_per_second / from_per_second);
+    }
+    if (0 == (from_per_second % to_per_second))
+    {
+        return val / (from_per_second / to_per_second);
+    }
+    return ((val / from_per_second) * to_per_second)
+           + (((val % from_per_second) * to_per_second) / from_per_second);
+}
+
+/**
+ * @brief The same as @ref time_units_conv_scale, but rounding up.
+ */
+ATTR_CONST
+static inline uint64_t
+time_units_conv_scale_ceil(const uint64_t val, const uint32_t from_per_second, const uint32_t to_per_second)
+{
+    if (0 == (to_per_second % from_per_second))
+    {
+        return val * (to_per_second / from_per_second);
+    }
+    if (0 == (from_per_second % to_per_second))
+    {
+        const uint32_t divisor = from_per_second / to_per_second;
+        return (val / divisor) + (((val % divisor) != 0) ? 1U : 0U);
+    }
+    return ((val / from_per_second) * to_per_second)
+           + ((((val % from_per_second) * to_per_second) + from_per_second - 1U) / from_per_second);
+}
+
+/**
+ * @brief Saturate a 64-bit value to UINT32_MAX.
+ */
+ATTR_CONST
+static inline uint32_t
+time_units_sat_u32(const uint64_t val)
+{
+    return (val > UINT32_MAX) ? UINT32_MAX : (uint32_t)val;
+}
+
+/**
+ * @brief Store a 64-bit value into the 32-bit variable if it fits.
+ * @return true if the value fits into 32 bits, false otherwise (in this case *p_dst is not modified).
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(2)
+static inline bool
+time_units_checked_u32(const uint64_t val, uint32_t* const p_dst)
+{
+    if (val > UINT32_MAX)
+    {
+        return false;
+    }
+    *p_dst = (uint32_t)val;
+    return true;
+}
+
+/* Conversions which can't overflow */
+
+ATTR_CONST
+static inline TimeUnitsMicroSeconds_t
+time_units_conv_seconds_to_us(const TimeUnitsSeconds_t num_seconds)
+{
+    return (TimeUnitsMicroSeconds_t)num_seconds * TIME_UNITS_US_PER_SECOND;
+}
+
+ATTR_CONST
+static inline TimeUnitsSeconds_t
+time_units_conv_ms_to_seconds(const TimeUnitsMilliSeconds_t num_ms)
+{
+    return num_ms / TIME_UNITS_MS_PER_SECOND;
+}
+
+ATTR_CONST
+static inline uint64_t
+time_units_conv_us_to_seconds(const TimeUnitsMicroSeconds_t num_us)
+{
+    return num_us / TIME_UNITS_US_PER_SECOND;
+}
+
+ATTR_CONST
+static inline uint64_t
+time_units_conv_us_to_ms(const TimeUnitsMicroSeconds_t num_us)
+{
+    return num_us / TIME_UNITS_US_PER_MS;
+}
+
+/*
+ * Conversions to/from system ticks, tick_rate_hz is expected to be configTICK_RATE_HZ.
+ * The results are 64-bit and rounded down (the _ceil variants round up).
+ */
+
+ATTR_CONST
+static inline uint64_t
+time_units_conv_seconds_to_ticks(const TimeUnitsSeconds_t num_seconds, const uint32_t tick_rate_hz)
+{
+    return (uint64_t)num_seconds * tick_rate_hz;
+}
+
+ATTR_CONST
+static inline uint64_t
+time_units_conv_ms_to_ticks(const TimeUnitsMilliSeconds_t num_ms, const uint32_t tick_rate_hz)
+{
+    return time_units_conv_scale(num_ms, TIME_UNITS_MS_PER_SECOND, tick_rate_hz);
+}
+
+ATTR_CONST
+static inline uint64_t
+time_units_conv_ms_to_ticks_ceil(const TimeUnitsMilliSeconds_t num_ms, const uint32_t tick_rate_hz)
+{
+    return time_units_conv_scale_ceil(num_ms, TIME_UNITS_MS_PER_SECOND, tick_rate_hz);
+}
+
+ATTR_CONST
+static inline uint64_t
+time_units_conv_us_to_ticks(const TimeUnitsMicroSeconds_t num_us, const uint32_t tick_rate_hz)
+{
+    return time_units_conv_scale(num_us, TIME_UNITS_US_PER_SECOND, tick_rate_hz);
+}
+
+ATTR_CONST
+static inline uint64_t
+time_units_conv_us_to_ticks_ceil(const TimeUnitsMicroSeconds_t num_us, const uint32_t tick_rate_hz)
+{
+    return time_units_conv_scale_ceil(num_us, TIME_UNITS_US_PER_SECOND, tick_rate_hz);
+}
+
+ATTR_CONST
+static inline uint64_t
+time_units_conv_ticks_to_seconds(const uint64_t num_ticks, const uint32_t tick_rate_hz)
+{
+    return num_ticks / tick_rate_hz;
+}
+
+ATTR_CONST
+static inline uint64_t
+time_units_conv_ticks_to_ms(const uint64_t num_ticks, const uint32_t tick_rate_hz)
+{
+    return time_units_conv_scale(num_ticks, tick_rate_hz, TIME_UNITS_MS_PER_SECOND);
+}
+
+/**
+ * @note The result overflows only after 584 thousand years at 1000 Hz.
+ */
+ATTR_CONST
+static inline TimeUnitsMicroSeconds_t
+time_units_conv_ticks_to_us(const uint64_t num_ticks, const uint32_t tick_rate_hz)
+{
+    return time_units_conv_scale(num_ticks, tick_rate_hz, TIME_UNITS_US_PER_SECOND);
+}
+
+/* Saturating conversions to 32-bit values (the result is UINT32_MAX on overflow) */
+
+ATTR_CONST
+static inline TimeUnitsMilliSeconds_t
+time_units_conv_seconds_to_ms_sat(const TimeUnitsSeconds_t num_seconds)
+{
+    return time_units_sat_u32((uint64_t)num_seconds * TIME_UNITS_MS_PER_SECOND);
+}
+
+ATTR_CONST
+static inline TimeUnitsMilliSeconds_t
+time_units_conv_us_to_ms_sat(const TimeUnitsMicroSeconds_t num_us)
+{
+    return time_units_sat_u32(time_units_conv_us_to_ms(num_us));
+}
+
+ATTR_CONST
+static inline uint32_t
+time_units_conv_seconds_to_ticks_sat(const TimeUnitsSeconds_t num_seconds, const uint32_t tick_rate_hz)
+{
+    return time_units_sat_u32(time_units_conv_seconds_to_ticks(num_seconds, tick_rate_hz));
+}
+
+ATTR_CONST
+static inline uint32_t
+time_units_conv_ms_to_ticks_sat(const TimeUnitsMilliSeconds_t num_ms, const uint32_t tick_rate_hz)
+{
+    return time_units_sat_u32(time_units_conv_ms_to_ticks(num_ms, tick_rate_hz));
+}
+
+ATTR_CONST
+static inline uint32_t
+time_units_conv_us_to_ticks_sat(const TimeUnitsMicroSeconds_t num_us, const uint32_t tick_rate_hz)
+{
+    return time_units_sat_u32(time_units_conv_us_to_ticks(num_us, tick_rate_hz));
+}
+
+ATTR_CONST
+static inline TimeUnitsMilliSeconds_t
+time_units_conv_ticks_to_ms_sat(const uint64_t num_ticks, const uint32_t tick_rate_hz)
+{
+    return time_units_sat_u32(time_units_conv_ticks_to_ms(num_ticks, tick_rate_hz));
+}
+
+/* Checked conversions to 32-bit values (return false on overflow and leave the result unmodified) */
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(2)
+static inline bool
+time_units_conv_seconds_to_ms_checked(const TimeUnitsSeconds_t num_seconds, TimeUnitsMilliSeconds_t* const p_num_ms)
+{
+    return time_units_checked_u32((uint64_t)num_seconds * TIME_UNITS_MS_PER_SECOND, p_num_ms);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(2)
+static inline bool
+time_units_conv_us_to_ms_checked(const TimeUnitsMicroSeconds_t num_us, TimeUnitsMilliSeconds_t* const p_num_ms)
+{
+    return time_units_checked_u32(time_units_conv_us_to_ms(num_us), p_num_ms);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(3)
+static inline bool
+time_units_conv_ms_to_ticks_checked(
+    const TimeUnitsMilliSeconds_t num_ms,
+    const uint32_t                tick_rate_hz,
+    uint32_t* const               p_num_ticks)
+{
+    return time_units_checked_u32(time_units_conv_ms_to_ticks(num_ms, tick_rate_hz), p_num_ticks);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(3)
+static inline bool
+time_units_conv_us_to_ticks_checked(
+    const TimeUnitsMicroSeconds_t num_us,
+    const uint32_t                tick_rate_hz,
+    uint32_t* const               p_num_ticks)
+{
+    return time_units_checked_u32(time_units_conv_us_to_ticks(num_us, tick_rate_hz), p_num_ticks);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(3)
+static inline bool
+time_units_conv_ticks_to_ms_checked(
+    const uint64_t                 num_ticks,
+    const uint32_t                 tick_rate_hz,
+    TimeUnitsMilliSeconds_t* const p_num_ms)
+{
+    return time_units_checked_u32(time_units_conv_ticks_to_ms(num_ticks, tick_rate_hz), p_num_ms);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,9 +7,6 @@
 
 #include "mac_addr.h"
 #include <string.h>
-#include <ctype.h>
-#include <stdlib.h>
-#include "str_buf.h"
 
 void
 mac_address_bin_init(mac_address_bin_t* p_mac, const uint8_t mac[MAC_ADDRESS_NUM_BYTES])
@@ -20,64 +17,171 @@ mac_address_bin_init(mac_address_bin_t* p_mac, const uint8_t mac[MAC_ADDRESS_NUM
     memcpy(p_mac->mac, mac, sizeof(p_mac->mac));
 }
 
-mac_address_str_t
-mac_address_to_str(const mac_address_bin_t* p_mac)
+static const char g_mac_addr_hex_upper[16] = "0123456789ABCDEF";
+static const char g_mac_addr_hex_lower[16] = "0123456789abcdef";
+
+size_t
+mac_addr_str_fmt_get_len(const mac_addr_str_fmt_e fmt)
 {
-    mac_address_str_t mac_str = { 0 };
-    str_buf_t         str_buf = {
-                .buf  = mac_str.str_buf,
-                .size = sizeof(mac_str.str_buf),
-                .idx  = 0,
-    };
-    for (size_t i = 0; i < sizeof(p_mac->mac); ++i)
+    return ((MAC_ADDR_STR_FMT_COLON_UPPER == fmt) || (MAC_ADDR_STR_FMT_COLON_LOWER == fmt)) ? MAC_ADDR_STR_LEN
+                                                                                            : MAC_ADDR_STR_NO_SEP_LEN;
+}
+
+size_t
+mac_addr_to_str_buf(const mac_address_bin_t* p_mac, const mac_addr_str_fmt_e fmt, char* const p_buf)
+{
+    const char* const p_hex
+        = ((MAC_ADDR_STR_FMT_COLON_LOWER == fmt) || (MAC_ADDR_STR_FMT_NO_SEP_LOWER == fmt)) ? g_mac_addr_hex_lower
+                                                                                            : g_mac_addr_hex_upper;
+    const size_t len = mac_addr_str_fmt_get_len(fmt);
+    if (MAC_ADDR_STR_LEN == len)
     {
-        if (0 != i)
+        for (size_t i = 0; i < MAC_ADDRESS_NUM_BYTES; ++i)
         {
-            str_buf_printf(&str_buf, ":");
+            char* const p_dst = &p_buf[MAC_ADDR_STR_BYTE_OFFSET(i)];
+            p_dst[0]          = p_hex[p_mac->mac[i] >> 4U];
+            p_dst[1]          = p_hex[p_mac->mac[i] & 0x0FU];
+            p_dst[2]          = ':';
         }
-        str_buf_printf(&str_buf, "%02X", p_mac->mac[i]);
     }
+    else
+    {
+        for (size_t i = 0; i < MAC_ADDRESS_NUM_BYTES; ++i)
+        {
+            p_buf[(i * 2) + 0] = p_hex[p_mac->mac[i] >> 4U];
+            p_buf[(i * 2) + 1] = p_hex[p_mac->mac[i] & 0x0FU];
+        }
+    }
+    // For the colon format, this overwrites the separator after the last byte
+    p_buf[len] = '\0';
+    return len;
+}
+
+mac_address_str_t
+mac_address_to_str_with_fmt(const mac_address_bin_t* p_mac, const mac_addr_str_fmt_e fmt)
+{
+    mac_address_str_t mac_str;
+    const size_t      len = mac_addr_to_str_buf(p_mac, fmt, mac_str.str_buf);
+    // Zero-fill the unused tail (for the formats without separators) as it was before
+    memset(&mac_str.str_buf[len], 0, sizeof(mac_str.str_buf) - len);
     return mac_str;
 }
 
+mac_address_str_t
+mac_address_to_str(const mac_address_bin_t* p_mac)
+{
+    return mac_address_to_str_with_fmt(p_mac, MAC_ADDR_STR_FMT_COLON_UPPER);
+}
+
+mac_address_str_t
+mac_address_to_str_lower(const mac_address_bin_t* p_mac)
+{
+    return mac_address_to_str_with_fmt(p_mac, MAC_ADDR_STR_FMT_COLON_LOWER);
+}
+
+mac_address_str_t
+mac_address_to_str_no_sep(const mac_address_bin_t* p_mac)
+{
+    return mac_address_to_str_with_fmt(p_mac, MAC_ADDR_STR_FMT_NO_SEP_UPPER);
+}
+
 bool
-mac_addr_from_str(const char* const p_mac_addr_str, mac_address_bin_t* p_mac_addr_bin)
+mac_addr_to_str_batch(
+    const mac_address_bin_t* const p_arr_of_mac,
+    const size_t                   num_mac,
+    const mac_addr_str_fmt_e       fmt,
+    char* const                    p_buf,
+    const size_t                   buf_size)
 {
-    if ((NULL == p_mac_addr_str) || (NULL == p_mac_addr_bin))
+    const size_t stride = mac_addr_str_fmt_get_len(fmt) + 1;
+    if ((buf_size / stride) < num_mac)
     {
         return false;
     }
+    for (size_t i = 0; i < num_mac; ++i)
+    {
+        (void)mac_addr_to_str_buf(&p_arr_of_mac[i], fmt, &p_buf[i * stride]);
+    }
+    return true;
+}
 
-    mac_address_str_t mac_addr_str;
-    if (strlen(p_mac_addr_str) >= sizeof(mac_addr_str))
+/**
+ * @brief Lookup table for decoding hex digits.
+ * The valid hex digits are mapped to (MAC_ADDR_HEX_VALID | value), all other characters are mapped to 0.
+ */
+#define MAC_ADDR_HEX_VALID (0x10U)
+#define MAC_ADDR_HEX_MASK  (0x0FU)
+
+static const uint8_t g_mac_addr_hex_table[256] = {
+    ['0'] = MAC_ADDR_HEX_VALID | 0x0U, ['1'] = MAC_ADDR_HEX_VALID | 0x1U, ['2'] = MAC_ADDR_HEX_VALID | 0x2U,
+    ['3'] = MAC_ADDR_HEX_VALID | 0x3U, ['4'] = MAC_ADDR_HEX_VALID | 0x4U, ['5'] = MAC_ADDR_HEX_VALID | 0x5U,
+    ['6'] = MAC_ADDR_HEX_VALID | 0x6U, ['7'] = MAC_ADDR_HEX_VALID | 0x7U, ['8'] = MAC_ADDR_HEX_VALID | 0x8U,
+    ['9'] = MAC_ADDR_HEX_VALID | 0x9U, ['A'] = MAC_ADDR_HEX_VALID | 0xAU, ['B'] = MAC_ADDR_HEX_VALID | 0xBU,
+    ['C'] = MAC_ADDR_HEX_VALID | 0xCU, ['D'] = MAC_ADDR_HEX_VALID | 0xDU, ['E'] = MAC_ADDR_HEX_VALID | 0xEU,
+    ['F'] = MAC_ADDR_HEX_VALID | 0xFU, ['a'] = MAC_ADDR_HEX_VALID | 0xAU, ['b'] = MAC_ADDR_HEX_VALID | 0xBU,
+    ['c'] = MAC_ADDR_HEX_VALID | 0xCU, ['d'] = MAC_ADDR_HEX_VALID | 0xDU, ['e'] = MAC_ADDR_HEX_VALID | 0xEU,
+    ['f'] = MAC_ADDR_HEX_VALID | 0xFU,
+};
+
+bool
+mac_addr_from_str(const char* const p_mac_addr_str, mac_address_bin_t* p_mac_addr_bin)
+{
+    if ((NULL == p_mac_addr_str) || (NULL == p_mac_addr_bin))
     {
         return false;
     }
-    strcpy(mac_addr_str.str_buf, p_mac_addr_str);
-
-    const char* const p_delim    = ":";
-    char*             p_save_ptr = NULL;
-    char*             p_token    = strtok_r(mac_addr_str.str_buf, p_delim, &p_save_ptr);
+    // The string is never scanned beyond the longest valid MAC address
+    return mac_addr_from_str_with_len(
+        p_mac_addr_str,
+        strnlen(p_mac_addr_str, MAC_ADDR_STR_LEN + 1),
+        p_mac_addr_bin);
+}
 
-    if (NULL == p_token)
+bool
+mac_addr_from_str_with_len(const char* const p_mac_addr_str, const size_t len, mac_address_bin_t* p_mac_addr_bin)
+{
+    if ((NULL == p_mac_addr_str) || (NULL == p_mac_addr_bin))
     {
         return false;
     }
+    size_t stride    = 0;
+    char   separator = '\0';
+    switch (len)
+    {
+        case MAC_ADDR_STR_LEN:
+            separator = p_mac_addr_str[2];
+            if ((':' != separator) && ('-' != separator))
+            {
+                return false;
+            }
+            stride = 3;
+            break;
+        case MAC_ADDR_STR_NO_SEP_LEN:
+            stride = 2;
+            break;
+        default:
+            return false;
+    }
 
-    for (size_t i = 0; i < MAC_ADDRESS_NUM_BYTES && p_token != NULL; ++i)
+    mac_address_bin_t mac_addr_bin = { 0 };
+    uint32_t          valid_mask   = MAC_ADDR_HEX_VALID;
+    bool              is_sep_valid = true;
+    for (size_t i = 0; i < MAC_ADDRESS_NUM_BYTES; ++i)
     {
-        if (strlen(p_token) != 2 || !isxdigit(p_token[0]) || !isxdigit(p_token[1]))
+        const char* const p_byte = &p_mac_addr_str[i * stride];
+        const uint8_t     hi     = g_mac_addr_hex_table[(uint8_t)p_byte[0]];
+        const uint8_t     lo     = g_mac_addr_hex_table[(uint8_t)p_byte[1]];
+        valid_mask &= (uint32_t)hi & (uint32_t)lo;
+        mac_addr_bin.mac[i] = (uint8_t)(((hi & MAC_ADDR_HEX_MASK) << 4U) | (lo & MAC_ADDR_HEX_MASK));
+        if ((3 == stride) && (i < (MAC_ADDRESS_NUM_BYTES - 1)))
         {
-            return false;
+            is_sep_valid &= (separator == p_byte[2]);
         }
-        p_mac_addr_bin->mac[i] = (uint8_t)strtol(p_token, NULL, 16);
-        p_token                = strtok_r(NULL, p_delim, &p_save_ptr);
     }
-
-    if (p_token != NULL)
+    if ((0 == valid_mask) || (!is_sep_valid))
     {
         return false;
     }
-
+    *p_mac_addr_bin = mac_addr_bin;
     return true;
 }
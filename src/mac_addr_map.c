@@ -0,0 +1,448 @@
+/**
+ * @file mac_addr_map.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "mac_addr_map.h"
+#include <string.h>
+#include "os_malloc.h"
+
+#define MAC_ADDR_MAP_IDX_NONE (0xFFFFU)
+
+/**
+ * The entries are stored in an array of fixed-size elements: [mac_addr_map_entry_t][value].
+ * The hash table contains (entry index + 1) for every occupied slot or 0 for an empty slot,
+ * the collisions are resolved with linear probing and the entries are removed with backward shifting,
+ * so there are no tombstones and the lookup time does not degrade over time.
+ * The entries are linked into a doubly linked LRU list (the head is the most recently used entry),
+ * the unused entries are linked into a singly linked free list via lru_next.
+ */
+typedef struct mac_addr_map_entry_t
+{
+    uint32_t          timestamp;
+    uint16_t          lru_prev;
+    uint16_t          lru_next;
+    mac_address_bin_t mac;
+} mac_addr_map_entry_t;
+
+struct mac_addr_map_t
+{
+    uint8_t*  p_entries;
+    uint16_t* p_table;
+    uint32_t  entry_size;
+    uint32_t  capacity;
+    uint32_t  table_size;
+    uint32_t  num_items;
+    uint16_t  lru_head;
+    uint16_t  lru_tail;
+    uint16_t  free_head;
+    bool      is_static;
+};
+
+_Static_assert(sizeof(mac_addr_map_t) == sizeof(mac_addr_map_static_t), "mac_addr_map_t != mac_addr_map_static_t");
+_Static_assert(
+    sizeof(mac_addr_map_entry_t) <= MAC_ADDR_MAP_ENTRY_HDR_SIZE,
+    "sizeof(mac_addr_map_entry_t) > MAC_ADDR_MAP_ENTRY_HDR_SIZE");
+
+/**
+ * @brief Calculate the hash of MAC address.
+ * @note The last 4 bytes (the device-specific part for public addresses) are mixed with the first 2 bytes (OUI),
+ *       then the Fibonacci hashing is applied, its upper bits are well distributed and they are used to
+ *       select the slot, so the hash works well both for sequential public addresses and for random addresses.
+ */
+static uint32_t
+mac_addr_map_hash(const mac_address_bin_t* const p_mac)
+{
+    uint32_t lo = 0;
+    uint16_t hi = 0;
+    memcpy(&lo, &p_mac->mac[2], sizeof(lo));
+    memcpy(&hi, &p_mac->mac[0], sizeof(hi));
+    return (lo ^ ((uint32_t)hi * 0x85EBCA6BU)) * 0x9E3779B1U;
+}
+
+static uint32_t
+mac_addr_map_get_home_slot(const mac_addr_map_t* const p_map, const mac_address_bin_t* const p_mac)
+{
+    // Map the hash to the range [0, table_size) without division
+    return (uint32_t)(((uint64_t)mac_addr_map_hash(p_mac) * p_map->table_size) >> 32U);
+}
+
+static uint32_t
+mac_addr_map_next_slot(const mac_addr_map_t* const p_map, const uint32_t slot_idx)
+{
+    const uint32_t next_slot_idx = slot_idx + 1;
+    return (next_slot_idx == p_map->table_size) ? 0 : next_slot_idx;
+}
+
+static mac_addr_map_entry_t*
+mac_addr_map_get_entry(const mac_addr_map_t* const p_map, const uint32_t entry_idx)
+{
+    return (mac_addr_map_entry_t*)(void*)&p_map->p_entries[entry_idx * p_map->entry_size];
+}
+
+static void*
+mac_addr_map_get_value(const mac_addr_map_t* const p_map, const uint32_t entry_idx)
+{
+    return &p_map->p_entries[(entry_idx * p_map->entry_size) + MAC_ADDR_MAP_ENTRY_HDR_SIZE];
+}
+
+static bool
+mac_addr_map_is_mac_equal(const mac_address_bin_t* const p_mac1, const mac_address_bin_t* const p_mac2)
+{
+    return 0 == memcmp(p_mac1->mac, p_mac2->mac, sizeof(p_mac1->mac));
+}
+
+/**
+ * @brief Find the slot which contains the MAC address.
+ * @return the slot index or table_size if the MAC address is not found.
+ */
+static uint32_t
+mac_addr_map_find_slot(const mac_addr_map_t* const p_map, const mac_address_bin_t* const p_mac)
+{
+    uint32_t slot_idx = mac_addr_map_get_home_slot(p_map, p_mac);
+    for (;;)
+    {
+        const uint16_t slot_val = p_map->p_table[slot_idx];
+        if (0 == slot_val)
+        {
+            return p_map->table_size;
+        }
+        if (mac_addr_map_is_mac_equal(&mac_addr_map_get_entry(p_map, slot_val - 1U)->mac, p_mac))
+        {
+            return slot_idx;
+        }
+        slot_idx = mac_addr_map_next_slot(p_map, slot_idx);
+    }
+}
+
+static void
+mac_addr_map_lru_unlink(mac_addr_map_t* const p_map, const uint16_t entry_idx)
+{
+    const mac_addr_map_entry_t* const p_entry = mac_addr_map_get_entry(p_map, entry_idx);
+    if (MAC_ADDR_MAP_IDX_NONE != p_entry->lru_prev)
+    {
+        mac_addr_map_get_entry(p_map, p_entry->lru_prev)->lru_next = p_entry->lru_next;
+    }
+    else
+    {
+        p_map->lru_head = p_entry->lru_next;
+    }
+    if (MAC_ADDR_MAP_IDX_NONE != p_entry->lru_next)
+    {
+        mac_addr_map_get_entry(p_map, p_entry->lru_next)->lru_prev = p_entry->lru_prev;
+    }
+    else
+    {
+        p_map->lru_tail = p_entry->lru_prev;
+    }
+}
+
+static void
+mac_addr_map_lru_push_front(mac_addr_map_t* const p_map, const uint16_t entry_idx)
+{
+    mac_addr_map_entry_t* const p_entry = mac_addr_map_get_entry(p_map, entry_idx);
+    p_entry->lru_prev                   = MAC_ADDR_MAP_IDX_NONE;
+    p_entry->lru_next                   = p_map->lru_head;
+    if (MAC_ADDR_MAP_IDX_NONE != p_map->lru_head)
+    {
+        mac_addr_map_get_entry(p_map, p_map->lru_head)->lru_prev = entry_idx;
+    }
+    else
+    {
+        p_map->lru_tail = entry_idx;
+    }
+    p_map->lru_head = entry_idx;
+}
+
+static void
+mac_addr_map_lru_move_to_front(mac_addr_map_t* const p_map, const uint16_t entry_idx)
+{
+    if (p_map->lru_head != entry_idx)
+    {
+        mac_addr_map_lru_unlink(p_map, entry_idx);
+        mac_addr_map_lru_push_front(p_map, entry_idx);
+    }
+}
+
+/**
+ * @brief Remove the entry from the slot, shift back the following entries of the cluster
+ *        and return the entry to the free list.
+ */
+static void
+mac_addr_map_erase_slot(mac_addr_map_t* const p_map, const uint32_t slot_idx)
+{
+    const uint16_t entry_idx = (uint16_t)(p_map->p_table[slot_idx] - 1U);
+
+    uint32_t hole_idx = slot_idx;
+    uint32_t cur_idx  = mac_addr_map_next_slot(p_map, slot_idx);
+    while (0 != p_map->p_table[cur_idx])
+    {
+        const uint32_t home_idx = mac_addr_map_get_home_slot(
+            p_map,
+            &mac_addr_map_get_entry(p_map, p_map->p_table[cur_idx] - 1U)->mac);
+        // The entry can be moved to the hole if its home slot is not in the cyclic range (hole_idx, cur_idx]
+        const bool is_home_in_range = (hole_idx <= cur_idx) ? ((home_idx > hole_idx) && (home_idx <= cur_idx))
+                                                            : ((home_idx > hole_idx) || (home_idx <= cur_idx));
+        if (!is_home_in_range)
+        {
+            p_map->p_table[hole_idx] = p_map->p_table[cur_idx];
+            hole_idx                 = cur_idx;
+        }
+        cur_idx = mac_addr_map_next_slot(p_map, cur_idx);
+    }
+    p_map->p_table[hole_idx] = 0;
+
+    mac_addr_map_lru_unlink(p_map, entry_idx);
+    mac_addr_map_get_entry(p_map, entry_idx)->lru_next = p_map->free_head;
+    p_map->free_head                                   = entry_idx;
+    p_map->num_items -= 1;
+}
+
+static void
+mac_addr_map_init(mac_addr_map_t* const p_map, uint8_t* const p_buf, const uint32_t capacity, const uint32_t value_size)
+{
+    p_map->entry_size = MAC_ADDR_MAP_ENTRY_SIZE(value_size);
+    p_map->capacity   = capacity;
+    p_map->table_size = MAC_ADDR_MAP_TABLE_SIZE(capacity);
+    p_map->p_entries  = p_buf;
+    p_map->p_table    = (uint16_t*)(void*)&p_buf[p_map->entry_size * capacity];
+    mac_addr_map_clear(p_map);
+}
+
+ATTR_WARN_UNUSED_RESULT
+mac_addr_map_t*
+mac_addr_map_create(const uint32_t capacity, const uint32_t value_size)
+{
+    if ((0 == capacity) || (capacity > MAC_ADDR_MAP_MAX_CAPACITY))
+    {
+        return NULL;
+    }
+    const size_t offset_buf = ((sizeof(mac_addr_map_t) + MAC_ADDR_MAP_ALIGNMENT - 1U) / MAC_ADDR_MAP_ALIGNMENT)
+                              * MAC_ADDR_MAP_ALIGNMENT;
+    uint8_t* const p_mem = os_calloc(1, offset_buf + MAC_ADDR_MAP_BUF_SIZE(value_size, capacity));
+    if (NULL == p_mem)
+    {
+        return NULL;
+    }
+    mac_addr_map_t* const p_map = (mac_addr_map_t*)(void*)p_mem;
+    mac_addr_map_init(p_map, &p_mem[offset_buf], capacity, value_size);
+    p_map->is_static = false;
+    return p_map;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+mac_addr_map_t*
+mac_addr_map_create_static(
+    mac_addr_map_static_t* const p_mem,
+    void* const                  p_buf,
+    const uint32_t               capacity,
+    const uint32_t               value_size)
+{
+    if ((0 == capacity) || (capacity > MAC_ADDR_MAP_MAX_CAPACITY))
+    {
+        return NULL;
+    }
+    if (0 != ((uintptr_t)p_buf % MAC_ADDR_MAP_ALIGNMENT))
+    {
+        return NULL;
+    }
+    mac_addr_map_t* const p_map = (mac_addr_map_t*)p_mem;
+    mac_addr_map_init(p_map, p_buf, capacity, value_size);
+    p_map->is_static = true;
+    return p_map;
+}
+
+ATTR_NONNULL(1)
+void
+mac_addr_map_delete(mac_addr_map_t** const pp_map)
+{
+    mac_addr_map_t* p_map = *pp_map;
+    if (NULL == p_map)
+    {
+        return;
+    }
+    *pp_map = NULL;
+    if (!p_map->is_static)
+    {
+        os_free(p_map);
+    }
+}
+
+ATTR_NONNULL(1)
+void
+mac_addr_map_clear(mac_addr_map_t* const p_map)
+{
+    memset(p_map->p_table, 0, sizeof(*p_map->p_table) * p_map->table_size);
+    for (uint32_t i = 0; i < p_map->capacity; ++i)
+    {
+        mac_addr_map_get_entry(p_map, i)->lru_next = ((i + 1) < p_map->capacity) ? (uint16_t)(i + 1)
+                                                                                 : MAC_ADDR_MAP_IDX_NONE;
+    }
+    p_map->free_head = 0;
+    p_map->lru_head  = MAC_ADDR_MAP_IDX_NONE;
+    p_map->lru_tail  = MAC_ADDR_MAP_IDX_NONE;
+    p_map->num_items = 0;
+}
+
+ATTR_NONNULL(1)
+uint32_t
+mac_addr_map_get_capacity(const mac_addr_map_t* const p_map)
+{
+    return p_map->capacity;
+}
+
+ATTR_NONNULL(1)
+uint32_t
+mac_addr_map_get_num_items(const mac_addr_map_t* const p_map)
+{
+    return p_map->num_items;
+}
+
+ATTR_RETURNS_NONNULL
+ATTR_NONNULL(1, 2)
+void*
+mac_addr_map_insert(
+    mac_addr_map_t* const          p_map,
+    const mac_address_bin_t* const p_mac,
+    const uint32_t                 timestamp,
+    bool* const                    p_is_new)
+{
+    uint32_t slot_idx = mac_addr_map_get_home_slot(p_map, p_mac);
+    for (;;)
+    {
+        const uint16_t slot_val = p_map->p_table[slot_idx];
+        if (0 == slot_val)
+        {
+            break;
+        }
+        const uint16_t              entry_idx = (uint16_t)(slot_val - 1U);
+        mac_addr_map_entry_t* const p_entry   = mac_addr_map_get_entry(p_map, entry_idx);
+        if (mac_addr_map_is_mac_equal(&p_entry->mac, p_mac))
+        {
+            p_entry->timestamp = timestamp;
+            mac_addr_map_lru_move_to_front(p_map, entry_idx);
+            if (NULL != p_is_new)
+            {
+                *p_is_new = false;
+            }
+            return mac_addr_map_get_value(p_map, entry_idx);
+        }
+        slot_idx = mac_addr_map_next_slot(p_map, slot_idx);
+    }
+
+    if (MAC_ADDR_MAP_IDX_NONE == p_map->free_head)
+    {
+        // Evict the least recently used entry, this can move entries in the table, so the search must be repeated
+        const mac_addr_map_entry_t* const p_lru_entry = mac_addr_map_get_entry(p_map, p_map->lru_tail);
+        mac_addr_map_erase_slot(p_map, mac_addr_map_find_slot(p_map, &p_lru_entry->mac));
+        slot_idx = mac_addr_map_get_home_slot(p_map, p_mac);
+        while (0 != p_map->p_table[slot_idx])
+        {
+            slot_idx = mac_addr_map_next_slot(p_map, slot_idx);
+        }
+    }
+
+    const uint16_t              entry_idx = p_map->free_head;
+    mac_addr_map_entry_t* const p_entry   = mac_addr_map_get_entry(p_map, entry_idx);
+    p_map->free_head                      = p_entry->lru_next;
+    p_entry->mac                          = *p_mac;
+    p_entry->timestamp                    = timestamp;
+    void* const p_value                   = mac_addr_map_get_value(p_map, entry_idx);
+    memset(p_value, 0, p_map->entry_size - MAC_ADDR_MAP_ENTRY_HDR_SIZE);
+    mac_addr_map_lru_push_front(p_map, entry_idx);
+    p_map->p_table[slot_idx] = (uint16_t)(entry_idx + 1U);
+    p_map->num_items += 1;
+    if (NULL != p_is_new)
+    {
+        *p_is_new = true;
+    }
+    return p_value;
+}
+
+ATTR_NONNULL(1, 2)
+void*
+mac_addr_map_find(mac_addr_map_t* const p_map, const mac_address_bin_t* const p_mac)
+{
+    const uint32_t slot_idx = mac_addr_map_find_slot(p_map, p_mac);
+    if (slot_idx == p_map->table_size)
+    {
+        return NULL;
+    }
+    const uint16_t entry_idx = (uint16_t)(p_map->p_table[slot_idx] - 1U);
+    mac_addr_map_lru_move_to_front(p_map, entry_idx);
+    return mac_addr_map_get_value(p_map, entry_idx);
+}
+
+ATTR_NONNULL(1, 2)
+bool
+mac_addr_map_contains(const mac_addr_map_t* const p_map, const mac_address_bin_t* const p_mac)
+{
+    return mac_addr_map_find_slot(p_map, p_mac) != p_map->table_size;
+}
+
+ATTR_NONNULL(1, 2, 3)
+bool
+mac_addr_map_get_timestamp(
+    const mac_addr_map_t* const    p_map,
+    const mac_address_bin_t* const p_mac,
+    uint32_t* const                p_timestamp)
+{
+    const uint32_t slot_idx = mac_addr_map_find_slot(p_map, p_mac);
+    if (slot_idx == p_map->table_size)
+    {
+        return false;
+    }
+    *p_timestamp = mac_addr_map_get_entry(p_map, p_map->p_table[slot_idx] - 1U)->timestamp;
+    return true;
+}
+
+ATTR_NONNULL(1, 2)
+bool
+mac_addr_map_erase(mac_addr_map_t* const p_map, const mac_address_bin_t* const p_mac)
+{
+    const uint32_t slot_idx = mac_addr_map_find_slot(p_map, p_mac);
+    if (slot_idx == p_map->table_size)
+    {
+        return false;
+    }
+    mac_addr_map_erase_slot(p_map, slot_idx);
+    return true;
+}
+
+ATTR_NONNULL(1)
+uint32_t
+mac_addr_map_erase_expired(mac_addr_map_t* const p_map, const uint32_t cur_timestamp, const uint32_t max_age)
+{
+    uint32_t num_erased = 0;
+    uint16_t entry_idx  = p_map->lru_head;
+    while (MAC_ADDR_MAP_IDX_NONE != entry_idx)
+    {
+        const mac_addr_map_entry_t* const p_entry = mac_addr_map_get_entry(p_map, entry_idx);
+        entry_idx                                 = p_entry->lru_next;
+        if ((uint32_t)(cur_timestamp - p_entry->timestamp) > max_age)
+        {
+            mac_addr_map_erase_slot(p_map, mac_addr_map_find_slot(p_map, &p_entry->mac));
+            num_erased += 1;
+        }
+    }
+    return num_erased;
+}
+
+ATTR_NONNULL(1, 2)
+void
+mac_addr_map_foreach(mac_addr_map_t* const p_map, mac_addr_map_cb_t p_cb, void* const p_ctx)
+{
+    uint16_t entry_idx = p_map->lru_head;
+    while (MAC_ADDR_MAP_IDX_NONE != entry_idx)
+    {
+        const mac_addr_map_entry_t* const p_entry = mac_addr_map_get_entry(p_map, entry_idx);
+        if (!p_cb(&p_entry->mac, p_entry->timestamp, mac_addr_map_get_value(p_map, entry_idx), p_ctx))
+        {
+            break;
+        }
+        entry_idx = p_entry->lru_next;
+    }
+}
@@ -0,0 +1,399 @@
+/**
+ * @file os_lock_prof.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_lock_prof.h"
+
+#if OS_LOCK_PROF
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "os_malloc.h"
+
+#if !configSUPPORT_STATIC_ALLOCATION
+#error OS_LOCK_PROF requires configSUPPORT_STATIC_ALLOCATION to be enabled
+#endif
+#if configUSE_TRACE_FACILITY != 1
+#error OS_LOCK_PROF requires configUSE_TRACE_FACILITY to be enabled (for vQueueSetQueueNumber)
+#endif
+
+#define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
+#include "log.h"
+
+/**
+ * The index of the entry plus one is saved in the queue number of the FreeRTOS semaphore on registration,
+ * so the statistics are updated without a search and without the global mutex:
+ * the counters which can be updated by several tasks at once are atomic,
+ * lock_depth and tick_acquired are modified only by the task which holds the profiled mutex.
+ */
+typedef struct os_lock_prof_entry_t
+{
+    _Atomic(const void*)  h_lock; //!< NULL if the entry is free
+    char                  name[OS_LOCK_PROF_MAX_NAME_LEN];
+    os_lock_prof_type_e   type;
+    atomic_uint_least32_t num_acquisitions;
+    atomic_uint_least32_t num_contentions;
+    atomic_uint_least32_t num_timeouts;
+    atomic_uint_least32_t total_wait_ticks;
+    atomic_uint_least32_t max_wait_ticks;
+    atomic_uint_least32_t max_hold_ticks;
+    uint32_t              lock_depth;
+    TickType_t            tick_acquired;
+} os_lock_prof_entry_t;
+
+typedef struct os_lock_prof_t
+{
+    os_lock_prof_entry_t arr_of_locks[OS_LOCK_PROF_MAX_NUM_LOCKS];
+    uint32_t             num_overflows;
+} os_lock_prof_t;
+
+static const char* TAG = "os_lock_prof";
+
+static os_lock_prof_t g_os_lock_prof;
+/**
+ * Registration of the locks is protected by a raw FreeRTOS mutex,
+ * because the os_mutex wrapper would recursively call the profiler.
+ */
+static SemaphoreHandle_t g_p_os_lock_prof_mutex;
+static StaticSemaphore_t g_os_lock_prof_mutex_mem;
+
+static os_lock_prof_t*
+os_lock_prof_lock(void)
+{
+    if (NULL == g_p_os_lock_prof_mutex)
+    {
+        return NULL;
+    }
+    (void)xSemaphoreTake(g_p_os_lock_prof_mutex, portMAX_DELAY);
+    return &g_os_lock_prof;
+}
+
+static void
+os_lock_prof_unlock(os_lock_prof_t** const p_p_prof)
+{
+    (void)xSemaphoreGive(g_p_os_lock_prof_mutex);
+    *p_p_prof = NULL;
+}
+
+void
+os_lock_prof_init(void)
+{
+    if (NULL == g_p_os_lock_prof_mutex)
+    {
+        g_p_os_lock_prof_mutex = xSemaphoreCreateMutexStatic(&g_os_lock_prof_mutex_mem);
+    }
+    os_lock_prof_t* p_prof = os_lock_prof_lock();
+    memset(p_prof, 0, sizeof(*p_prof));
+    os_lock_prof_unlock(&p_prof);
+}
+
+void
+os_lock_prof_deinit(void)
+{
+    if (NULL == g_p_os_lock_prof_mutex)
+    {
+        return;
+    }
+    os_lock_prof_t* p_prof = os_lock_prof_lock();
+    memset(p_prof, 0, sizeof(*p_prof));
+    os_lock_prof_unlock(&p_prof);
+    vSemaphoreDelete(g_p_os_lock_prof_mutex);
+    g_p_os_lock_prof_mutex = NULL;
+}
+
+void
+os_lock_prof_reset(void)
+{
+    os_lock_prof_t* p_prof = os_lock_prof_lock();
+    if (NULL == p_prof)
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < OS_LOCK_PROF_MAX_NUM_LOCKS; ++i)
+    {
+        os_lock_prof_entry_t* const p_entry = &p_prof->arr_of_locks[i];
+
+        atomic_store_explicit(&p_entry->num_acquisitions, 0, memory_order_relaxed);
+        atomic_store_explicit(&p_entry->num_contentions, 0, memory_order_relaxed);
+        atomic_store_explicit(&p_entry->num_timeouts, 0, memory_order_relaxed);
+        atomic_store_explicit(&p_entry->total_wait_ticks, 0, memory_order_relaxed);
+        atomic_store_explicit(&p_entry->max_wait_ticks, 0, memory_order_relaxed);
+        atomic_store_explicit(&p_entry->max_hold_ticks, 0, memory_order_relaxed);
+    }
+    p_prof->num_overflows = 0;
+    os_lock_prof_unlock(&p_prof);
+}
+
+static os_lock_prof_entry_t*
+os_lock_prof_get_entry(const void* const h_lock)
+{
+    if (NULL == g_p_os_lock_prof_mutex)
+    {
+        return NULL;
+    }
+    const UBaseType_t entry_num = uxQueueGetQueueNumber((QueueHandle_t)h_lock);
+    if ((0 == entry_num) || (entry_num > OS_LOCK_PROF_MAX_NUM_LOCKS))
+    {
+        return NULL;
+    }
+    os_lock_prof_entry_t* const p_entry = &g_os_lock_prof.arr_of_locks[entry_num - 1];
+    // The entry could have been reused if the profiler was reinitialized after the lock had been registered
+    if (h_lock != atomic_load_explicit(&p_entry->h_lock, memory_order_acquire))
+    {
+        return NULL;
+    }
+    return p_entry;
+}
+
+static void
+os_lock_prof_update_max(atomic_uint_least32_t* const p_max, const uint32_t val)
+{
+    uint32_t cur_max = atomic_load_explicit(p_max, memory_order_relaxed);
+    while ((val > cur_max)
+           && !atomic_compare_exchange_weak_explicit(p_max, &cur_max, val, memory_order_relaxed, memory_order_relaxed))
+    {
+    }
+}
+
+void
+os_lock_prof_register(const void* const h_lock, const char* const p_name, const os_lock_prof_type_e type)
+{
+    os_lock_prof_t* p_prof = os_lock_prof_lock();
+    if (NULL == p_prof)
+    {
+        return;
+    }
+    uint32_t idx = 0;
+    while ((idx < OS_LOCK_PROF_MAX_NUM_LOCKS)
+           && (NULL != atomic_load_explicit(&p_prof->arr_of_locks[idx].h_lock, memory_order_relaxed)))
+    {
+        idx += 1;
+    }
+    if (idx >= OS_LOCK_PROF_MAX_NUM_LOCKS)
+    {
+        p_prof->num_overflows += 1;
+        vQueueSetQueueNumber((QueueHandle_t)h_lock, 0);
+    }
+    else
+    {
+        os_lock_prof_entry_t* const p_entry = &p_prof->arr_of_locks[idx];
+        memset(p_entry, 0, sizeof(*p_entry));
+        (void)snprintf(p_entry->name, sizeof(p_entry->name), "%s", (NULL != p_name) ? p_name : "");
+        p_entry->type = type;
+        atomic_store_explicit(&p_entry->h_lock, h_lock, memory_order_release);
+        vQueueSetQueueNumber((QueueHandle_t)h_lock, idx + 1);
+    }
+    os_lock_prof_unlock(&p_prof);
+}
+
+void
+os_lock_prof_unregister(const void* const h_lock)
+{
+    os_lock_prof_t* p_prof = os_lock_prof_lock();
+    if (NULL == p_prof)
+    {
+        return;
+    }
+    os_lock_prof_entry_t* const p_entry = os_lock_prof_get_entry(h_lock);
+    if (NULL != p_entry)
+    {
+        atomic_store_explicit(&p_entry->h_lock, NULL, memory_order_release);
+        vQueueSetQueueNumber((QueueHandle_t)h_lock, 0);
+    }
+    os_lock_prof_unlock(&p_prof);
+}
+
+ATTR_NONNULL(3)
+bool
+os_lock_prof_take(void* const h_lock, const os_delta_ticks_t ticks_to_wait, os_lock_prof_cb_take_t cb_take)
+{
+    bool       is_contended = false;
+    TickType_t wait_ticks   = 0;
+    bool       is_taken     = cb_take(h_lock, OS_DELTA_TICKS_IMMEDIATE);
+    if (!is_taken)
+    {
+        is_contended = true;
+        if (OS_DELTA_TICKS_IMMEDIATE != ticks_to_wait)
+        {
+            const TickType_t tick_start = xTaskGetTickCount();
+            is_taken                    = cb_take(h_lock, ticks_to_wait);
+            wait_ticks                  = xTaskGetTickCount() - tick_start;
+        }
+    }
+
+    os_lock_prof_entry_t* const p_entry = os_lock_prof_get_entry(h_lock);
+    if (NULL == p_entry)
+    {
+        return is_taken;
+    }
+    if (is_contended)
+    {
+        atomic_fetch_add_explicit(&p_entry->num_contentions, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&p_entry->total_wait_ticks, wait_ticks, memory_order_relaxed);
+        os_lock_prof_update_max(&p_entry->max_wait_ticks, wait_ticks);
+    }
+    if (!is_taken)
+    {
+        atomic_fetch_add_explicit(&p_entry->num_timeouts, 1, memory_order_relaxed);
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&p_entry->num_acquisitions, 1, memory_order_relaxed);
+        if (OS_LOCK_PROF_TYPE_SEMA != p_entry->type)
+        {
+            // The mutex is held by the current task, so nobody else modifies lock_depth and tick_acquired
+            if (0 == p_entry->lock_depth)
+            {
+                p_entry->tick_acquired = xTaskGetTickCount();
+            }
+            p_entry->lock_depth += 1;
+        }
+    }
+    return is_taken;
+}
+
+void
+os_lock_prof_on_release(const void* const h_lock)
+{
+    os_lock_prof_entry_t* const p_entry = os_lock_prof_get_entry(h_lock);
+    if ((NULL != p_entry) && (0 != p_entry->lock_depth))
+    {
+        p_entry->lock_depth -= 1;
+        if (0 == p_entry->lock_depth)
+        {
+            os_lock_prof_update_max(&p_entry->max_hold_ticks, xTaskGetTickCount() - p_entry->tick_acquired);
+        }
+    }
+}
+
+ATTR_NONNULL(1)
+uint32_t
+os_lock_prof_get_snapshot(os_lock_prof_info_t* const p_arr_of_info, const uint32_t max_num_locks)
+{
+    os_lock_prof_t* p_prof = os_lock_prof_lock();
+    if (NULL == p_prof)
+    {
+        return 0;
+    }
+    uint32_t num_locks = 0;
+    for (uint32_t i = 0; (i < OS_LOCK_PROF_MAX_NUM_LOCKS) && (num_locks < max_num_locks); ++i)
+    {
+        const os_lock_prof_entry_t* const p_entry = &p_prof->arr_of_locks[i];
+
+        const void* const h_lock = atomic_load_explicit(&p_entry->h_lock, memory_order_relaxed);
+        if (NULL == h_lock)
+        {
+            continue;
+        }
+        os_lock_prof_info_t* const p_info = &p_arr_of_info[num_locks];
+        p_info->h_lock                    = h_lock;
+        (void)snprintf(p_info->name, sizeof(p_info->name), "%s", p_entry->name);
+        p_info->type             = p_entry->type;
+        p_info->num_acquisitions = atomic_load_explicit(&p_entry->num_acquisitions, memory_order_relaxed);
+        p_info->num_contentions  = atomic_load_explicit(&p_entry->num_contentions, memory_order_relaxed);
+        p_info->num_timeouts     = atomic_load_explicit(&p_entry->num_timeouts, memory_order_relaxed);
+        p_info->total_wait_ticks = atomic_load_explicit(&p_entry->total_wait_ticks, memory_order_relaxed);
+        p_info->max_wait_ticks   = atomic_load_explicit(&p_entry->max_wait_ticks, memory_order_relaxed);
+        p_info->max_hold_ticks   = atomic_load_explicit(&p_entry->max_hold_ticks, memory_order_relaxed);
+        num_locks += 1;
+    }
+    os_lock_prof_unlock(&p_prof);
+    return num_locks;
+}
+
+uint32_t
+os_lock_prof_get_num_overflows(void)
+{
+    os_lock_prof_t* p_prof = os_lock_prof_lock();
+    if (NULL == p_prof)
+    {
+        return 0;
+    }
+    const uint32_t num_overflows = p_prof->num_overflows;
+    os_lock_prof_unlock(&p_prof);
+    return num_overflows;
+}
+
+static int
+os_lock_prof_cmp_by_total_wait(const void* p_a, const void* p_b)
+{
+    const os_lock_prof_info_t* const p_info_a = p_a;
+    const os_lock_prof_info_t* const p_info_b = p_b;
+    if (p_info_a->total_wait_ticks > p_info_b->total_wait_ticks)
+    {
+        return -1;
+    }
+    if (p_info_a->total_wait_ticks < p_info_b->total_wait_ticks)
+    {
+        return 1;
+    }
+    return 0;
+}
+
+static const char*
+os_lock_prof_type_to_str(const os_lock_prof_type_e type)
+{
+    switch (type)
+    {
+        case OS_LOCK_PROF_TYPE_MUTEX:
+            return "mutex";
+        case OS_LOCK_PROF_TYPE_MUTEX_RECURSIVE:
+            return "mutex_recursive";
+        case OS_LOCK_PROF_TYPE_SEMA:
+            return "sema";
+        default:
+            break;
+    }
+    return "unknown";
+}
+
+void
+os_lock_prof_log_dump(void)
+{
+    if (NULL == g_p_os_lock_prof_mutex)
+    {
+        LOG_INFO("os_lock_prof is not initialized");
+        return;
+    }
+    os_lock_prof_info_t* p_arr_of_info = os_calloc(OS_LOCK_PROF_MAX_NUM_LOCKS, sizeof(*p_arr_of_info));
+    if (NULL == p_arr_of_info)
+    {
+        LOG_ERR("Can't allocate memory");
+        return;
+    }
+    const uint32_t num_locks     = os_lock_prof_get_snapshot(p_arr_of_info, OS_LOCK_PROF_MAX_NUM_LOCKS);
+    const uint32_t num_overflows = os_lock_prof_get_num_overflows();
+    qsort(p_arr_of_info, num_locks, sizeof(*p_arr_of_info), &os_lock_prof_cmp_by_total_wait);
+
+    LOG_INFO(
+        "Num locks registered: %u, not registered: %u",
+        (printf_uint_t)num_locks,
+        (printf_uint_t)num_overflows);
+    for (uint32_t i = 0; i < num_locks; ++i)
+    {
+        const os_lock_prof_info_t* const p_info = &p_arr_of_info[i];
+        LOG_INFO(
+            "[%2u] '%s' (%s): acquired %u, contended %u, timeouts %u, wait total %u, wait max %u, hold max %u ticks",
+            (printf_uint_t)i,
+            p_info->name,
+            os_lock_prof_type_to_str(p_info->type),
+            (printf_uint_t)p_info->num_acquisitions,
+            (printf_uint_t)p_info->num_contentions,
+            (printf_uint_t)p_info->num_timeouts,
+            (printf_uint_t)p_info->total_wait_ticks,
+            (printf_uint_t)p_info->max_wait_ticks,
+            (printf_uint_t)p_info->max_hold_ticks);
+    }
+    os_free(p_arr_of_info);
+}
+
+#endif // OS_LOCK_PROF
@@ -8,6 +8,97 @@
 #include "os_malloc.h"
 #include <stdlib.h>
 
+#define OS_MALLOC_HAS_HEAP_CAPS 0
+
+#if defined __has_include
+#if __has_include("esp_heap_caps.h")
+#include "esp_heap_caps.h"
+#undef OS_MALLOC_HAS_HEAP_CAPS
+#define OS_MALLOC_HAS_HEAP_CAPS 1
+#endif
+#endif
+
+#if OS_MALLOC_HAS_HEAP_CAPS
+typedef struct os_malloc_heap_caps_t
+{
+    uint32_t caps;          //!< the capabilities for heap_caps_malloc
+    uint32_t fallback_caps; //!< the capabilities to try if the allocation failed (0 - no fallback)
+} os_malloc_heap_caps_t;
+
+/* OS_MALLOC_CAPS_DEFAULT is not in the table, because plain malloc is used for it. */
+static const os_malloc_heap_caps_t g_os_malloc_heap_caps[OS_MALLOC_CAPS_NUM] = {
+    [OS_MALLOC_CAPS_INTERNAL] = { MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, 0 },
+    [OS_MALLOC_CAPS_SPIRAM]   = { MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, MALLOC_CAP_DEFAULT },
+    [OS_MALLOC_CAPS_DMA]      = { MALLOC_CAP_DMA | MALLOC_CAP_8BIT, 0 },
+    [OS_MALLOC_CAPS_FAST]     = { MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, MALLOC_CAP_DEFAULT },
+};
+#endif
+
+static void*
+os_malloc_caps_calloc_raw(const size_t nmemb, const size_t size, const os_malloc_caps_e caps)
+{
+#if OS_MALLOC_HAS_HEAP_CAPS
+    if (OS_MALLOC_CAPS_DEFAULT != caps)
+    {
+        const os_malloc_heap_caps_t* const p_heap_caps = &g_os_malloc_heap_caps[caps];
+
+        void* p_mem = heap_caps_calloc(nmemb, size, p_heap_caps->caps);
+        if ((NULL == p_mem) && (0 != p_heap_caps->fallback_caps))
+        {
+            p_mem = heap_caps_calloc(nmemb, size, p_heap_caps->fallback_caps);
+        }
+        return p_mem;
+    }
+#else
+    (void)caps;
+#endif
+    return calloc(nmemb, size);
+}
+
+static void*
+os_malloc_caps_realloc_raw(void* const ptr, const size_t size, const os_malloc_caps_e caps)
+{
+#if OS_MALLOC_HAS_HEAP_CAPS
+    if (OS_MALLOC_CAPS_DEFAULT != caps)
+    {
+        const os_malloc_heap_caps_t* const p_heap_caps = &g_os_malloc_heap_caps[caps];
+
+        void* p_mem = heap_caps_realloc(ptr, size, p_heap_caps->caps);
+        if ((NULL == p_mem) && (0 != p_heap_caps->fallback_caps))
+        {
+            p_mem = heap_caps_realloc(ptr, size, p_heap_caps->fallback_caps);
+        }
+        return p_mem;
+    }
+#else
+    (void)caps;
+#endif
+    return realloc(ptr, size);
+}
+
+#if !OS_MALLOC_TRACE
+static void*
+os_malloc_caps_malloc_raw(const size_t size, const os_malloc_caps_e caps)
+{
+#if OS_MALLOC_HAS_HEAP_CAPS
+    if (OS_MALLOC_CAPS_DEFAULT != caps)
+    {
+        const os_malloc_heap_caps_t* const p_heap_caps = &g_os_malloc_heap_caps[caps];
+
+        void* p_mem = heap_caps_malloc(size, p_heap_caps->caps);
+        if ((NULL == p_mem) && (0 != p_heap_caps->fallback_caps))
+        {
+            p_mem = heap_caps_malloc(size, p_heap_caps->fallback_caps);
+        }
+        return p_mem;
+    }
+#else
+    (void)caps;
+#endif
+    return malloc(size);
+}
+#endif
+
 #if OS_MALLOC_TRACE
 #include <string.h>
 #include <assert.h>
@@ -18,24 +109,54 @@
 #include "log.h"
 static const char* TAG = "MEM_TRACE";
 
+#if OS_MALLOC_GUARD
+#define OS_MALLOC_GUARD_FRONT_SIZE      (OS_MALLOC_GUARD_SIZE)
+#define OS_MALLOC_GUARD_REAR_SIZE       (OS_MALLOC_GUARD_SIZE)
+#define OS_MALLOC_GUARD_MAGIC_ALLOCATED (0xA110CA7EU)
+#define OS_MALLOC_GUARD_MAGIC_FREED     (0xF4EEB10CU)
+
+_Static_assert(
+    0 == (OS_MALLOC_GUARD_SIZE % sizeof(void*)),
+    "OS_MALLOC_GUARD_SIZE must keep the alignment of the allocated blocks");
+#else
+#define OS_MALLOC_GUARD_FRONT_SIZE (0U)
+#define OS_MALLOC_GUARD_REAR_SIZE  (0U)
+#endif
+
+#define OS_MALLOC_TRACE_BLOCK_SIZE(size_) \
+    (sizeof(os_malloc_trace_info_t) + OS_MALLOC_GUARD_FRONT_SIZE + (size_) + OS_MALLOC_GUARD_REAR_SIZE)
+
 typedef struct os_malloc_trace_info_t
 {
     void*  p_mem;
     size_t size;
     TAILQ_ENTRY(os_malloc_trace_info_t) list;
-    const char* p_file;
-    int32_t     line;
+    const char*                  p_file;
+    int32_t                      line;
+    os_malloc_trace_generation_t generation;
+    os_malloc_caps_e             caps;
 #if !OS_MALLOC_TRACE_DISABLE_TIMESTAMP
     uint32_t timestamp;
 #endif
+#if OS_MALLOC_GUARD
+    uint32_t    magic;
+    const char* p_free_file;
+    int32_t     free_line;
+#endif
 } os_malloc_trace_info_t;
 
 typedef TAILQ_HEAD(os_malloc_trace_list_t, os_malloc_trace_info_t) os_malloc_trace_list_t;
 
-static os_malloc_trace_list_t g_os_malloc_trace_list;
-static os_mutex_t             g_p_os_malloc_trace_mutex;
-static os_mutex_static_t      g_os_malloc_trace_mutex_mem;
-static int32_t                g_os_malloc_trace_cnt;
+static os_malloc_trace_list_t       g_os_malloc_trace_list;
+static os_mutex_t                   g_p_os_malloc_trace_mutex;
+static os_mutex_static_t            g_os_malloc_trace_mutex_mem;
+static int32_t                      g_os_malloc_trace_cnt;
+static os_malloc_trace_generation_t g_os_malloc_trace_generation;
+static os_malloc_trace_caps_stat_t  g_os_malloc_trace_caps_stat[OS_MALLOC_CAPS_NUM];
+#if OS_MALLOC_GUARD
+static os_malloc_trace_info_t* g_os_malloc_guard_quarantine[OS_MALLOC_GUARD_QUARANTINE_LEN];
+static uint32_t                g_os_malloc_guard_quarantine_idx;
+#endif
 
 void
 os_malloc_trace_init(void)
@@ -46,7 +167,9 @@ os_malloc_trace_init(void)
         g_p_os_malloc_trace_mutex = os_mutex_create_static(&g_os_malloc_trace_mutex_mem);
         os_mutex_lock(g_p_os_malloc_trace_mutex);
         TAILQ_INIT(&g_os_malloc_trace_list);
-        g_os_malloc_trace_cnt = 0;
+        g_os_malloc_trace_cnt        = 0;
+        g_os_malloc_trace_generation = 0;
+        memset(g_os_malloc_trace_caps_stat, 0, sizeof(g_os_malloc_trace_caps_stat));
         os_mutex_unlock(g_p_os_malloc_trace_mutex);
     }
     else
@@ -59,6 +182,9 @@ void
 os_malloc_trace_deinit(void)
 {
     os_malloc_trace_clear();
+#if OS_MALLOC_GUARD
+    (void)os_malloc_guard_flush_quarantine();
+#endif
     os_mutex_delete(&g_p_os_malloc_trace_mutex);
 }
 
@@ -83,6 +209,183 @@ os_malloc_trace_mutex_unlock(os_malloc_trace_list_t** p_p_list)
     os_mutex_unlock(g_p_os_malloc_trace_mutex);
     *p_p_list = NULL;
 }
+
+static void*
+os_malloc_trace_info_to_ptr(os_malloc_trace_info_t* const p_info)
+{
+    return (uint8_t*)p_info + sizeof(*p_info) + OS_MALLOC_GUARD_FRONT_SIZE;
+}
+
+static os_malloc_trace_info_t*
+os_malloc_trace_ptr_to_info(void* const ptr)
+{
+    return (os_malloc_trace_info_t*)((uint8_t*)ptr - OS_MALLOC_GUARD_FRONT_SIZE - sizeof(os_malloc_trace_info_t));
+}
+
+static void
+os_malloc_trace_release(os_malloc_trace_info_t* const p_info)
+{
+    memset(p_info, 0, OS_MALLOC_TRACE_BLOCK_SIZE(p_info->size));
+    free(p_info);
+}
+
+/**
+ * @brief Update the statistics when the block is added to the list.
+ * @note The trace mutex must be locked.
+ */
+static void
+os_malloc_trace_on_block_linked(const os_malloc_trace_info_t* const p_info)
+{
+    os_malloc_trace_caps_stat_t* const p_stat = &g_os_malloc_trace_caps_stat[p_info->caps];
+
+    g_os_malloc_trace_cnt += 1;
+    p_stat->num_blocks += 1;
+    p_stat->num_bytes += p_info->size;
+    if (p_stat->num_bytes > p_stat->max_num_bytes)
+    {
+        p_stat->max_num_bytes = p_stat->num_bytes;
+    }
+}
+
+/**
+ * @brief Update the statistics when the block is removed from the list.
+ * @note The trace mutex must be locked.
+ */
+static void
+os_malloc_trace_on_block_unlinked(const os_malloc_trace_info_t* const p_info)
+{
+    os_malloc_trace_caps_stat_t* const p_stat = &g_os_malloc_trace_caps_stat[p_info->caps];
+
+    g_os_malloc_trace_cnt -= 1;
+    p_stat->num_blocks -= 1;
+    p_stat->num_bytes -= p_info->size;
+}
+#endif
+
+#if OS_MALLOC_GUARD
+static bool
+os_malloc_guard_is_filled(const uint8_t* const p_buf, const size_t len, const uint8_t pattern)
+{
+    for (size_t i = 0; i < len; ++i)
+    {
+        if (pattern != p_buf[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Check the canaries of the block and the poison pattern if the block has been freed.
+ * @return true if the block is not corrupted.
+ */
+static bool
+os_malloc_guard_check_block(os_malloc_trace_info_t* const p_info)
+{
+    const uint8_t* const p_data = os_malloc_trace_info_to_ptr(p_info);
+    const char*          p_err  = NULL;
+    if (!os_malloc_guard_is_filled(
+            p_data - OS_MALLOC_GUARD_FRONT_SIZE,
+            OS_MALLOC_GUARD_FRONT_SIZE,
+            OS_MALLOC_GUARD_CANARY_BYTE))
+    {
+        p_err = "front canary is corrupted (buffer underflow)";
+    }
+    else if (!os_malloc_guard_is_filled(&p_data[p_info->size], OS_MALLOC_GUARD_REAR_SIZE, OS_MALLOC_GUARD_CANARY_BYTE))
+    {
+        p_err = "rear canary is corrupted (buffer overflow)";
+    }
+    else if (
+        (OS_MALLOC_GUARD_MAGIC_FREED == p_info->magic)
+        && (!os_malloc_guard_is_filled(p_data, p_info->size, OS_MALLOC_GUARD_POISON_BYTE)))
+    {
+        p_err = "freed block was modified (use after free)";
+    }
+    else
+    {
+        return true;
+    }
+    if (OS_MALLOC_GUARD_MAGIC_FREED == p_info->magic)
+    {
+        LOG_ERR(
+            "Block %p (%zu bytes) allocated at %s:%d and freed at %s:%d: %s",
+            p_data,
+            p_info->size,
+            p_info->p_file,
+            (printf_int_t)p_info->line,
+            p_info->p_free_file,
+            (printf_int_t)p_info->free_line,
+            p_err);
+    }
+    else
+    {
+        LOG_ERR(
+            "Block %p (%zu bytes) allocated at %s:%d: %s",
+            p_data,
+            p_info->size,
+            p_info->p_file,
+            (printf_int_t)p_info->line,
+            p_err);
+    }
+    return false;
+}
+
+/**
+ * @brief Put the freed block to the quarantine, the oldest block is checked and released if the quarantine is full.
+ * @note The trace mutex must be locked.
+ */
+static void
+os_malloc_guard_quarantine_push(os_malloc_trace_info_t* const p_info)
+{
+    os_malloc_trace_info_t* const p_evicted = g_os_malloc_guard_quarantine[g_os_malloc_guard_quarantine_idx];
+
+    g_os_malloc_guard_quarantine[g_os_malloc_guard_quarantine_idx] = p_info;
+    g_os_malloc_guard_quarantine_idx = (g_os_malloc_guard_quarantine_idx + 1) % OS_MALLOC_GUARD_QUARANTINE_LEN;
+    if (NULL != p_evicted)
+    {
+        (void)os_malloc_guard_check_block(p_evicted);
+        os_malloc_trace_release(p_evicted);
+    }
+}
+
+/**
+ * @brief Check the block before freeing, mark it as freed and fill it with the poison pattern.
+ * @note The trace mutex must be locked, so that the block is never seen as freed while it is being poisoned.
+ * @return true if the block can be freed.
+ */
+static bool
+os_malloc_guard_on_free(
+    os_malloc_trace_info_t* const p_info,
+    void* const                   ptr,
+    const char* const             p_file,
+    const int32_t                 line)
+{
+    if (OS_MALLOC_GUARD_MAGIC_FREED == p_info->magic)
+    {
+        LOG_ERR(
+            "Double free of block %p at %s:%d, it was allocated at %s:%d and freed at %s:%d",
+            ptr,
+            p_file,
+            (printf_int_t)line,
+            p_info->p_file,
+            (printf_int_t)p_info->line,
+            p_info->p_free_file,
+            (printf_int_t)p_info->free_line);
+        return false;
+    }
+    if (OS_MALLOC_GUARD_MAGIC_ALLOCATED != p_info->magic)
+    {
+        LOG_ERR("Invalid pointer %p is freed at %s:%d", ptr, p_file, (printf_int_t)line);
+        return false;
+    }
+    (void)os_malloc_guard_check_block(p_info);
+    p_info->magic       = OS_MALLOC_GUARD_MAGIC_FREED;
+    p_info->p_free_file = p_file;
+    p_info->free_line   = line;
+    memset(ptr, OS_MALLOC_GUARD_POISON_BYTE, p_info->size);
+    return true;
+}
 #endif
 
 #if OS_MALLOC_TRACE
@@ -112,21 +415,39 @@ os_free_internal(void* ptr, const char* const p_file, const int32_t line)
         return;
     }
 
-    os_malloc_trace_info_t* const p_info = (os_malloc_trace_info_t*)((uint8_t*)ptr - sizeof(os_malloc_trace_info_t));
-    const size_t                  size   = p_info->size;
-    os_malloc_trace_list_t*       p_list = os_malloc_trace_mutex_lock();
+    os_malloc_trace_info_t* const p_info         = os_malloc_trace_ptr_to_info(ptr);
+    bool                          is_quarantined = false;
+    // The block is checked, poisoned, unlinked and quarantined in one critical section,
+    // so os_malloc_check_all and a concurrent free of the same pointer see it either allocated or freed.
+    os_malloc_trace_list_t* p_list = os_malloc_trace_mutex_lock();
+#if OS_MALLOC_GUARD
+    if (!os_malloc_guard_on_free(p_info, ptr, p_file, line))
+    {
+        os_malloc_trace_mutex_unlock(&p_list);
+        return;
+    }
+#else
+    (void)p_file;
+    (void)line;
+#endif
     if (NULL != p_list)
     {
         if (NULL != p_info->list.tqe_prev)
         {
             TAILQ_REMOVE(p_list, p_info, list);
-            g_os_malloc_trace_cnt -= 1;
+            os_malloc_trace_on_block_unlinked(p_info);
         }
+#if OS_MALLOC_GUARD
+        // The block will be released when it is evicted from the quarantine
+        os_malloc_guard_quarantine_push(p_info);
+        is_quarantined = true;
+#endif
         os_malloc_trace_mutex_unlock(&p_list);
     }
-    memset(p_info, 0, sizeof(*p_info) + size);
-
-    free(p_info);
+    if (!is_quarantined)
+    {
+        os_malloc_trace_release(p_info);
+    }
 }
 #else
 void
@@ -140,12 +461,15 @@ os_free_internal(void* ptr)
 #endif
 
 #if OS_MALLOC_TRACE
-ATTR_MALLOC
-ATTR_CALLOC_SIZE(1, 2)
-void*
-os_calloc_internal(const size_t nmemb, const size_t size, const char* const p_file, const int32_t line)
+static void*
+os_malloc_trace_alloc(
+    const size_t           nmemb,
+    const size_t           size,
+    const os_malloc_caps_e caps,
+    const char* const      p_file,
+    const int32_t          line)
 {
-    void* const p_mem = calloc(1, sizeof(os_malloc_trace_info_t) + nmemb * size);
+    void* const p_mem = os_malloc_caps_calloc_raw(1, OS_MALLOC_TRACE_BLOCK_SIZE(nmemb * size), caps);
     if (NULL == p_mem)
     {
         return NULL;
@@ -154,20 +478,65 @@ os_calloc_internal(const size_t nmemb, const size_t size, const char* const p_fi
     os_malloc_trace_info_t* const p_info = p_mem;
     p_info->p_mem                        = p_mem;
     p_info->size                         = nmemb * size;
+    p_info->caps                         = caps;
     p_info->p_file                       = p_file;
     p_info->line                         = line;
 #if !OS_MALLOC_TRACE_DISABLE_TIMESTAMP
     p_info->timestamp = xTaskGetTickCount();
 #endif
+    void* const p_data = os_malloc_trace_info_to_ptr(p_info);
+#if OS_MALLOC_GUARD
+    p_info->magic = OS_MALLOC_GUARD_MAGIC_ALLOCATED;
+    memset((uint8_t*)p_data - OS_MALLOC_GUARD_FRONT_SIZE, OS_MALLOC_GUARD_CANARY_BYTE, OS_MALLOC_GUARD_FRONT_SIZE);
+    memset((uint8_t*)p_data + p_info->size, OS_MALLOC_GUARD_CANARY_BYTE, OS_MALLOC_GUARD_REAR_SIZE);
+#endif
 
     os_malloc_trace_list_t* p_list = os_malloc_trace_mutex_lock();
     if (NULL != p_list)
     {
+        p_info->generation = g_os_malloc_trace_generation;
         TAILQ_INSERT_TAIL(p_list, p_info, list);
-        g_os_malloc_trace_cnt += 1;
+        os_malloc_trace_on_block_linked(p_info);
         os_malloc_trace_mutex_unlock(&p_list);
     }
-    return (void*)((uint8_t*)p_mem + sizeof(os_malloc_trace_info_t));
+    return p_data;
+}
+
+ATTR_MALLOC
+ATTR_CALLOC_SIZE(1, 2)
+void*
+os_calloc_internal(const size_t nmemb, const size_t size, const char* const p_file, const int32_t line)
+{
+    return os_malloc_trace_alloc(nmemb, size, OS_MALLOC_CAPS_DEFAULT, p_file, line);
+}
+
+ATTR_MALLOC
+ATTR_MALLOC_SIZE(1)
+void*
+os_malloc_caps_internal(const size_t size, const os_malloc_caps_e caps, const char* const p_file, const int32_t line)
+{
+    if ((uint32_t)caps >= OS_MALLOC_CAPS_NUM)
+    {
+        return NULL;
+    }
+    return os_malloc_trace_alloc(1, size, caps, p_file, line);
+}
+
+ATTR_MALLOC
+ATTR_CALLOC_SIZE(1, 2)
+void*
+os_calloc_caps_internal(
+    const size_t           nmemb,
+    const size_t           size,
+    const os_malloc_caps_e caps,
+    const char* const      p_file,
+    const int32_t          line)
+{
+    if ((uint32_t)caps >= OS_MALLOC_CAPS_NUM)
+    {
+        return NULL;
+    }
+    return os_malloc_trace_alloc(nmemb, size, caps, p_file, line);
 }
 #else
 ATTR_MALLOC
@@ -177,33 +546,145 @@ os_calloc(const size_t nmemb, const size_t size)
 {
     return calloc(nmemb, size);
 }
+
+ATTR_MALLOC
+ATTR_MALLOC_SIZE(1)
+void*
+os_malloc_caps(const size_t size, const os_malloc_caps_e caps)
+{
+    if ((uint32_t)caps >= OS_MALLOC_CAPS_NUM)
+    {
+        return NULL;
+    }
+    return os_malloc_caps_malloc_raw(size, caps);
+}
+
+ATTR_MALLOC
+ATTR_CALLOC_SIZE(1, 2)
+void*
+os_calloc_caps(const size_t nmemb, const size_t size, const os_malloc_caps_e caps)
+{
+    if ((uint32_t)caps >= OS_MALLOC_CAPS_NUM)
+    {
+        return NULL;
+    }
+    return os_malloc_caps_calloc_raw(nmemb, size, caps);
+}
 #endif
 
 #if OS_MALLOC_TRACE
+static bool
+os_malloc_trace_realloc(
+    void** const           p_ptr,
+    const size_t           size,
+    const os_malloc_caps_e caps,
+    const char* const      p_file,
+    const int32_t          line)
+{
+    void* ptr = *p_ptr;
+    if ((NULL == ptr) || (size > (SIZE_MAX - OS_MALLOC_TRACE_BLOCK_SIZE(0))))
+    {
+        return false;
+    }
+
+    os_malloc_trace_info_t* const p_info_old = os_malloc_trace_ptr_to_info(ptr);
+
+    // The trace info is the header of the block, so the whole block can be reallocated in place.
+    // The block is unlinked while realloc is in progress, because realloc can move it to another address.
+    os_malloc_trace_list_t* p_list = os_malloc_trace_mutex_lock();
+#if OS_MALLOC_GUARD
+    // The magic is checked under the mutex, because it is changed by os_free_internal under the mutex
+    if (OS_MALLOC_GUARD_MAGIC_ALLOCATED != p_info_old->magic)
+    {
+        os_malloc_trace_mutex_unlock(&p_list);
+        LOG_ERR("Invalid pointer %p is reallocated at %s:%d", ptr, p_file, (printf_int_t)line);
+        return false;
+    }
+    (void)os_malloc_guard_check_block(p_info_old);
+#endif
+    os_malloc_trace_info_t* p_info_next = NULL;
+    const bool              is_linked   = (NULL != p_list) && (NULL != p_info_old->list.tqe_prev);
+    if (is_linked)
+    {
+        p_info_next = TAILQ_NEXT(p_info_old, list);
+        TAILQ_REMOVE(p_list, p_info_old, list);
+        os_malloc_trace_on_block_unlinked(p_info_old);
+    }
+
+    os_malloc_trace_info_t* const p_info = os_malloc_caps_realloc_raw(
+        p_info_old,
+        OS_MALLOC_TRACE_BLOCK_SIZE(size),
+        caps);
+    if (NULL == p_info)
+    {
+        if (is_linked)
+        {
+            // Restore the original position to keep the list ordered by generations
+            if (NULL != p_info_next)
+            {
+                TAILQ_INSERT_BEFORE(p_info_next, p_info_old, list);
+            }
+            else
+            {
+                TAILQ_INSERT_TAIL(p_list, p_info_old, list);
+            }
+            os_malloc_trace_on_block_linked(p_info_old);
+        }
+        os_malloc_trace_mutex_unlock(&p_list);
+        return false;
+    }
+
+    // The reallocated block is reported as a new block allocated at the call site of realloc
+    p_info->p_mem  = p_info;
+    p_info->size   = size;
+    p_info->caps   = caps;
+    p_info->p_file = p_file;
+    p_info->line   = line;
+#if !OS_MALLOC_TRACE_DISABLE_TIMESTAMP
+    p_info->timestamp = xTaskGetTickCount();
+#endif
+    void* const p_data = os_malloc_trace_info_to_ptr(p_info);
+#if OS_MALLOC_GUARD
+    memset((uint8_t*)p_data + size, OS_MALLOC_GUARD_CANARY_BYTE, OS_MALLOC_GUARD_REAR_SIZE);
+#endif
+    if (NULL != p_list)
+    {
+        p_info->generation = g_os_malloc_trace_generation;
+        TAILQ_INSERT_TAIL(p_list, p_info, list);
+        os_malloc_trace_on_block_linked(p_info);
+        os_malloc_trace_mutex_unlock(&p_list);
+    }
+    *p_ptr = p_data;
+    return true;
+}
+
 ATTR_WARN_UNUSED_RESULT
 ATTR_NONNULL(1)
 bool
 os_realloc_safe_internal(void** const p_ptr, const size_t size, const char* const p_file, const int32_t line)
 {
-    void* ptr = *p_ptr;
-    if (NULL == ptr)
+    if (NULL == *p_ptr)
     {
         return false;
     }
+    return os_malloc_trace_realloc(p_ptr, size, os_malloc_trace_ptr_to_info(*p_ptr)->caps, p_file, line);
+}
 
-    const os_malloc_trace_info_t* const p_info_old
-        = (os_malloc_trace_info_t*)((uint8_t*)ptr - sizeof(os_malloc_trace_info_t));
-
-    void* p_new_ptr = os_malloc_internal(size, p_file, line);
-    if (NULL == p_new_ptr)
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+bool
+os_realloc_caps_safe_internal(
+    void** const           p_ptr,
+    const size_t           size,
+    const os_malloc_caps_e caps,
+    const char* const      p_file,
+    const int32_t          line)
+{
+    if ((uint32_t)caps >= OS_MALLOC_CAPS_NUM)
     {
-        *p_ptr = NULL;
         return false;
     }
-    memcpy(p_new_ptr, ptr, ((size < p_info_old->size) ? size : p_info_old->size));
-    os_free_internal(ptr, p_file, line);
-    *p_ptr = p_new_ptr;
-    return true;
+    return os_malloc_trace_realloc(p_ptr, size, caps, p_file, line);
 }
 #else
 ATTR_WARN_UNUSED_RESULT
@@ -220,6 +701,24 @@ os_realloc_safe(void** const p_ptr, const size_t size)
     *p_ptr = p_new_ptr;
     return true;
 }
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+bool
+os_realloc_caps_safe(void** const p_ptr, const size_t size, const os_malloc_caps_e caps)
+{
+    if ((uint32_t)caps >= OS_MALLOC_CAPS_NUM)
+    {
+        return false;
+    }
+    void* p_new_ptr = os_malloc_caps_realloc_raw(*p_ptr, size, caps);
+    if (NULL == p_new_ptr)
+    {
+        return false;
+    }
+    *p_ptr = p_new_ptr;
+    return true;
+}
 #endif
 
 #if OS_MALLOC_TRACE
@@ -233,6 +732,7 @@ os_realloc_safe_and_clean_internal(void** const p_ptr, const size_t size, const
     if (!res)
     {
         os_free_internal(p_old_ptr, p_file, line);
+        *p_ptr = NULL;
     }
     return res;
 }
@@ -246,7 +746,8 @@ os_realloc_safe_and_clean(void** const p_ptr, const size_t size)
     void* p_new_ptr = realloc(ptr, size);
     if (NULL == p_new_ptr)
     {
-        os_free(*p_ptr);
+        os_free_internal(ptr);
+        *p_ptr = NULL;
         return false;
     }
     *p_ptr = p_new_ptr;
@@ -255,6 +756,27 @@ os_realloc_safe_and_clean(void** const p_ptr, const size_t size)
 #endif
 
 #if OS_MALLOC_TRACE
+static const char*
+os_malloc_caps_to_str(const os_malloc_caps_e caps)
+{
+    switch (caps)
+    {
+        case OS_MALLOC_CAPS_DEFAULT:
+            return "default";
+        case OS_MALLOC_CAPS_INTERNAL:
+            return "internal";
+        case OS_MALLOC_CAPS_SPIRAM:
+            return "spiram";
+        case OS_MALLOC_CAPS_DMA:
+            return "dma";
+        case OS_MALLOC_CAPS_FAST:
+            return "fast";
+        default:
+            break;
+    }
+    return "unknown";
+}
+
 void
 os_malloc_trace_dump(void)
 {
@@ -271,25 +793,59 @@ os_malloc_trace_dump(void)
     {
 #if !OS_MALLOC_TRACE_DISABLE_TIMESTAMP
         LOG_INFO(
-            "[%4u] %p: %zu bytes (at %u), %s:%d",
+            "[%4u] %p: %zu bytes in %s (at %u), %s:%d",
             (printf_uint_t)cnt,
             p_info->p_mem,
             p_info->size,
+            os_malloc_caps_to_str(p_info->caps),
             (printf_uint_t)p_info->timestamp,
             p_info->p_file,
             p_info->line);
 #else
         LOG_INFO(
-            "[%4u] %p: %zu bytes, %s:%d",
+            "[%4u] %p: %zu bytes in %s, %s:%d",
             (printf_uint_t)cnt,
             p_info->p_mem,
             p_info->size,
+            os_malloc_caps_to_str(p_info->caps),
             p_info->p_file,
             p_info->line);
 #endif
         cnt += 1;
     }
+    for (uint32_t i = 0; i < OS_MALLOC_CAPS_NUM; ++i)
+    {
+        const os_malloc_trace_caps_stat_t* const p_stat = &g_os_malloc_trace_caps_stat[i];
+        if (0 == p_stat->max_num_bytes)
+        {
+            continue;
+        }
+        LOG_INFO(
+            "Memory %s: %u blocks, %zu bytes (max %zu bytes)",
+            os_malloc_caps_to_str((os_malloc_caps_e)i),
+            (printf_uint_t)p_stat->num_blocks,
+            p_stat->num_bytes,
+            p_stat->max_num_bytes);
+    }
+    os_malloc_trace_mutex_unlock(&p_list);
+}
+
+ATTR_NONNULL(2)
+bool
+os_malloc_trace_get_caps_stat(const os_malloc_caps_e caps, os_malloc_trace_caps_stat_t* const p_stat)
+{
+    if ((uint32_t)caps >= OS_MALLOC_CAPS_NUM)
+    {
+        return false;
+    }
+    os_malloc_trace_list_t* p_list = os_malloc_trace_mutex_lock();
+    if (NULL == p_list)
+    {
+        return false;
+    }
+    *p_stat = g_os_malloc_trace_caps_stat[caps];
     os_malloc_trace_mutex_unlock(&p_list);
+    return true;
 }
 #endif
 
@@ -309,6 +865,246 @@ os_malloc_trace_clear(void)
     }
     TAILQ_INIT(p_list);
     g_os_malloc_trace_cnt = 0;
+    for (uint32_t i = 0; i < OS_MALLOC_CAPS_NUM; ++i)
+    {
+        g_os_malloc_trace_caps_stat[i].num_blocks = 0;
+        g_os_malloc_trace_caps_stat[i].num_bytes  = 0;
+    }
+    os_malloc_trace_mutex_unlock(&p_list);
+}
+#endif
+
+#if OS_MALLOC_TRACE
+int32_t
+os_malloc_trace_get_num_blocks(void)
+{
+    os_malloc_trace_list_t* p_list = os_malloc_trace_mutex_lock();
+    if (NULL == p_list)
+    {
+        return 0;
+    }
+    const int32_t num_blocks = g_os_malloc_trace_cnt;
+    os_malloc_trace_mutex_unlock(&p_list);
+    return num_blocks;
+}
+#endif
+
+#if OS_MALLOC_TRACE
+os_malloc_trace_generation_t
+os_malloc_trace_mark(void)
+{
+    os_malloc_trace_list_t* p_list = os_malloc_trace_mutex_lock();
+    if (NULL == p_list)
+    {
+        return 0;
+    }
+    g_os_malloc_trace_generation += 1;
+    const os_malloc_trace_generation_t generation = g_os_malloc_trace_generation;
+    os_malloc_trace_mutex_unlock(&p_list);
+    return generation;
+}
+#endif
+
+#if OS_MALLOC_TRACE
+ATTR_NONNULL(1, 2)
+static os_malloc_trace_site_t*
+os_malloc_trace_find_or_add_site(
+    os_malloc_trace_site_t* const       p_arr_of_sites,
+    uint32_t* const                     p_num_sites,
+    const uint32_t                      max_num_sites,
+    const os_malloc_trace_info_t* const p_info)
+{
+    for (uint32_t i = 0; i < *p_num_sites; ++i)
+    {
+        os_malloc_trace_site_t* const p_site = &p_arr_of_sites[i];
+        if ((p_site->line == p_info->line)
+            && ((p_site->p_file == p_info->p_file) || (0 == strcmp(p_site->p_file, p_info->p_file))))
+        {
+            return p_site;
+        }
+    }
+    if (*p_num_sites >= max_num_sites)
+    {
+        return NULL;
+    }
+    os_malloc_trace_site_t* const p_site = &p_arr_of_sites[*p_num_sites];
+    *p_num_sites += 1;
+
+    p_site->p_file     = p_info->p_file;
+    p_site->line       = p_info->line;
+    p_site->num_blocks = 0;
+    p_site->num_bytes  = 0;
+    return p_site;
+}
+#endif
+
+#if OS_MALLOC_TRACE
+ATTR_NONNULL(2)
+uint32_t
+os_malloc_trace_get_sites_since(
+    const os_malloc_trace_generation_t generation,
+    os_malloc_trace_site_t* const      p_arr_of_sites,
+    const uint32_t                     max_num_sites,
+    uint32_t* const                    p_num_blocks_skipped)
+{
+    uint32_t                num_sites          = 0;
+    uint32_t                num_blocks_skipped = 0;
+    os_malloc_trace_list_t* p_list             = os_malloc_trace_mutex_lock();
+    if (NULL != p_list)
+    {
+        // The list is ordered by the allocation time, so only its tail needs to be walked.
+        os_malloc_trace_info_t* p_info;
+        TAILQ_FOREACH_REVERSE(p_info, p_list, os_malloc_trace_list_t, list)
+        {
+            if (p_info->generation < generation)
+            {
+                break;
+            }
+            os_malloc_trace_site_t* const p_site = os_malloc_trace_find_or_add_site(
+                p_arr_of_sites,
+                &num_sites,
+                max_num_sites,
+                p_info);
+            if (NULL == p_site)
+            {
+                num_blocks_skipped += 1;
+                continue;
+            }
+            p_site->num_blocks += 1;
+            p_site->num_bytes += p_info->size;
+        }
+        os_malloc_trace_mutex_unlock(&p_list);
+    }
+    if (NULL != p_num_blocks_skipped)
+    {
+        *p_num_blocks_skipped = num_blocks_skipped;
+    }
+    return num_sites;
+}
+#endif
+
+#if OS_MALLOC_TRACE
+static int
+os_malloc_trace_cmp_sites_by_num_bytes(const void* const p_a, const void* const p_b)
+{
+    const os_malloc_trace_site_t* const p_site_a = p_a;
+    const os_malloc_trace_site_t* const p_site_b = p_b;
+    if (p_site_a->num_bytes > p_site_b->num_bytes)
+    {
+        return -1;
+    }
+    if (p_site_a->num_bytes < p_site_b->num_bytes)
+    {
+        return 1;
+    }
+    return 0;
+}
+#endif
+
+#if OS_MALLOC_TRACE
+void
+os_malloc_trace_dump_since(const os_malloc_trace_generation_t generation)
+{
+    if (NULL == g_p_os_malloc_trace_mutex)
+    {
+        LOG_INFO("os_malloc trace is not initialized");
+        return;
+    }
+    // calloc is used instead of os_calloc to avoid tracing the buffer itself
+    os_malloc_trace_site_t* p_arr_of_sites = calloc(OS_MALLOC_TRACE_MAX_NUM_SITES, sizeof(*p_arr_of_sites));
+    if (NULL == p_arr_of_sites)
+    {
+        LOG_ERR("Can't allocate memory");
+        return;
+    }
+    uint32_t       num_blocks_skipped = 0;
+    const uint32_t num_sites          = os_malloc_trace_get_sites_since(
+        generation,
+        p_arr_of_sites,
+        OS_MALLOC_TRACE_MAX_NUM_SITES,
+        &num_blocks_skipped);
+    qsort(p_arr_of_sites, num_sites, sizeof(*p_arr_of_sites), &os_malloc_trace_cmp_sites_by_num_bytes);
+
+    LOG_INFO(
+        "Num call sites with blocks allocated since generation %u: %u",
+        (printf_uint_t)generation,
+        (printf_uint_t)num_sites);
+    for (uint32_t i = 0; i < num_sites; ++i)
+    {
+        const os_malloc_trace_site_t* const p_site = &p_arr_of_sites[i];
+        LOG_INFO(
+            "[%2u] %s:%d: %u blocks, %zu bytes",
+            (printf_uint_t)i,
+            p_site->p_file,
+            (printf_int_t)p_site->line,
+            (printf_uint_t)p_site->num_blocks,
+            p_site->num_bytes);
+    }
+    if (0 != num_blocks_skipped)
+    {
+        LOG_INFO("Num blocks from other call sites: %u", (printf_uint_t)num_blocks_skipped);
+    }
+    free(p_arr_of_sites);
+}
+#endif
+
+#if OS_MALLOC_GUARD
+uint32_t
+os_malloc_check_all(void)
+{
+    os_malloc_trace_list_t* p_list = os_malloc_trace_mutex_lock();
+    if (NULL == p_list)
+    {
+        return 0;
+    }
+    uint32_t                num_corrupted_blocks = 0;
+    os_malloc_trace_info_t* p_info;
+    TAILQ_FOREACH(p_info, p_list, list)
+    {
+        if (!os_malloc_guard_check_block(p_info))
+        {
+            num_corrupted_blocks += 1;
+        }
+    }
+    for (uint32_t i = 0; i < OS_MALLOC_GUARD_QUARANTINE_LEN; ++i)
+    {
+        p_info = g_os_malloc_guard_quarantine[i];
+        if ((NULL != p_info) && (!os_malloc_guard_check_block(p_info)))
+        {
+            num_corrupted_blocks += 1;
+        }
+    }
+    os_malloc_trace_mutex_unlock(&p_list);
+    return num_corrupted_blocks;
+}
+#endif
+
+#if OS_MALLOC_GUARD
+uint32_t
+os_malloc_guard_flush_quarantine(void)
+{
+    os_malloc_trace_list_t* p_list = os_malloc_trace_mutex_lock();
+    if (NULL == p_list)
+    {
+        return 0;
+    }
+    uint32_t num_corrupted_blocks = 0;
+    for (uint32_t i = 0; i < OS_MALLOC_GUARD_QUARANTINE_LEN; ++i)
+    {
+        os_malloc_trace_info_t* const p_info = g_os_malloc_guard_quarantine[i];
+        if (NULL == p_info)
+        {
+            continue;
+        }
+        g_os_malloc_guard_quarantine[i] = NULL;
+        if (!os_malloc_guard_check_block(p_info))
+        {
+            num_corrupted_blocks += 1;
+        }
+        os_malloc_trace_release(p_info);
+    }
+    g_os_malloc_guard_quarantine_idx = 0;
     os_malloc_trace_mutex_unlock(&p_list);
+    return num_corrupted_blocks;
 }
 #endif
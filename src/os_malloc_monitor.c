@@ -0,0 +1,345 @@
+/**
+ * @file os_malloc_monitor.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_malloc_monitor.h"
+
+#if OS_MALLOC_MONITOR
+
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "os_mutex.h"
+#include "os_timer.h"
+
+#define OS_MALLOC_MONITOR_HAS_HEAP_CAPS 0
+#if defined __has_include
+#if __has_include("esp_heap_caps.h")
+#include "esp_heap_caps.h"
+#undef OS_MALLOC_MONITOR_HAS_HEAP_CAPS
+#define OS_MALLOC_MONITOR_HAS_HEAP_CAPS 1
+#endif
+#endif
+
+#if !configSUPPORT_STATIC_ALLOCATION
+#error OS_MALLOC_MONITOR requires configSUPPORT_STATIC_ALLOCATION to be enabled
+#endif
+
+#define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
+#include "log.h"
+
+#define OS_MALLOC_MONITOR_PERCENT_100 (100U)
+
+typedef struct os_malloc_monitor_t
+{
+    os_malloc_monitor_cfg_t    cfg;
+    os_malloc_monitor_sample_t history[OS_MALLOC_MONITOR_HISTORY_LEN];
+    uint32_t                   history_idx; //!< the index of the next sample in the history ring buffer
+    uint32_t                   history_cnt;
+    bool                       is_threshold_reached;
+    bool                       is_initialized;
+} os_malloc_monitor_t;
+
+static const char* TAG = "os_malloc_monitor";
+
+static os_malloc_monitor_t        g_os_malloc_monitor;
+static os_mutex_t                 g_p_os_malloc_monitor_mutex;
+static os_mutex_static_t          g_os_malloc_monitor_mutex_mem;
+static os_timer_periodic_t*       g_p_os_malloc_monitor_timer;
+static os_timer_periodic_static_t g_os_malloc_monitor_timer_mem;
+
+/**
+ * @brief Lock the monitor.
+ * @return pointer to the monitor or NULL if it is not initialized.
+ */
+static os_malloc_monitor_t*
+os_malloc_monitor_lock(void)
+{
+    if (NULL == g_p_os_malloc_monitor_mutex)
+    {
+        return NULL;
+    }
+    os_mutex_lock(g_p_os_malloc_monitor_mutex);
+    if (!g_os_malloc_monitor.is_initialized)
+    {
+        os_mutex_unlock(g_p_os_malloc_monitor_mutex);
+        return NULL;
+    }
+    return &g_os_malloc_monitor;
+}
+
+static void
+os_malloc_monitor_unlock(os_malloc_monitor_t** const p_p_monitor)
+{
+    os_mutex_unlock(g_p_os_malloc_monitor_mutex);
+    *p_p_monitor = NULL;
+}
+
+#if OS_MALLOC_MONITOR_HAS_HEAP_CAPS
+static bool
+os_malloc_monitor_get_heap_info_default(os_malloc_monitor_heap_info_t* const p_heap_info)
+{
+    p_heap_info->free_size          = (uint32_t)heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    p_heap_info->min_free_size      = (uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    p_heap_info->largest_free_block = (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    return true;
+}
+#endif
+
+ATTR_NONNULL(1)
+bool
+os_malloc_monitor_init(const os_malloc_monitor_cfg_t* const p_cfg)
+{
+    os_malloc_monitor_cfg_t cfg = *p_cfg;
+    if (NULL == cfg.cb_get_heap_info)
+    {
+#if OS_MALLOC_MONITOR_HAS_HEAP_CAPS
+        cfg.cb_get_heap_info = &os_malloc_monitor_get_heap_info_default;
+#else
+        LOG_ERR("The heap info provider must be set on this platform");
+        return false;
+#endif
+    }
+    if (NULL == g_p_os_malloc_monitor_mutex)
+    {
+        g_p_os_malloc_monitor_mutex = os_mutex_create_static(&g_os_malloc_monitor_mutex_mem);
+    }
+    os_mutex_lock(g_p_os_malloc_monitor_mutex);
+    memset(&g_os_malloc_monitor, 0, sizeof(g_os_malloc_monitor));
+    g_os_malloc_monitor.cfg            = cfg;
+    g_os_malloc_monitor.is_initialized = true;
+    os_mutex_unlock(g_p_os_malloc_monitor_mutex);
+    return true;
+}
+
+void
+os_malloc_monitor_deinit(void)
+{
+    // The static timer is not deleted, it is reused by the next os_malloc_monitor_start
+    os_malloc_monitor_stop();
+    // The stop command is only queued to the timer service task, so the timer callback can still be running.
+    // That's why the mutex is never deleted, the callback does nothing after the monitor is deinitialized.
+    os_malloc_monitor_t* p_monitor = os_malloc_monitor_lock();
+    if (NULL == p_monitor)
+    {
+        return;
+    }
+    memset(p_monitor, 0, sizeof(*p_monitor));
+    os_malloc_monitor_unlock(&p_monitor);
+}
+
+static void
+os_malloc_monitor_timer_cb(os_timer_periodic_t* const p_timer, void* const p_arg)
+{
+    (void)p_timer;
+    (void)p_arg;
+    (void)os_malloc_monitor_sample(NULL);
+}
+
+bool
+os_malloc_monitor_start(const os_delta_ticks_t period_ticks)
+{
+    os_malloc_monitor_t* p_monitor = os_malloc_monitor_lock();
+    if (NULL == p_monitor)
+    {
+        LOG_ERR("os_malloc_monitor is not initialized");
+        return false;
+    }
+    os_malloc_monitor_unlock(&p_monitor);
+    if (NULL != g_p_os_malloc_monitor_timer)
+    {
+        // The static timer is created only once, because its memory can't be reused
+        // until the timer service task deletes it.
+        if (!os_timer_periodic_restart(g_p_os_malloc_monitor_timer, period_ticks))
+        {
+            LOG_ERR("Failed to restart the timer");
+            return false;
+        }
+        return true;
+    }
+    g_p_os_malloc_monitor_timer = os_timer_periodic_create_static(
+        &g_os_malloc_monitor_timer_mem,
+        "malloc_mon",
+        period_ticks,
+        &os_malloc_monitor_timer_cb,
+        NULL);
+    if (NULL == g_p_os_malloc_monitor_timer)
+    {
+        LOG_ERR("Failed to create the timer");
+        return false;
+    }
+    os_timer_periodic_start(g_p_os_malloc_monitor_timer);
+    return true;
+}
+
+void
+os_malloc_monitor_stop(void)
+{
+    if (NULL != g_p_os_malloc_monitor_timer)
+    {
+        os_timer_periodic_stop(g_p_os_malloc_monitor_timer);
+    }
+}
+
+ATTR_NONNULL(1)
+ATTR_PURE
+uint32_t
+os_malloc_monitor_calc_fragmentation_percent(const os_malloc_monitor_heap_info_t* const p_heap_info)
+{
+    if ((0 == p_heap_info->free_size) || (p_heap_info->largest_free_block >= p_heap_info->free_size))
+    {
+        return 0;
+    }
+    const uint64_t num_fragmented_bytes = p_heap_info->free_size - p_heap_info->largest_free_block;
+    return (uint32_t)((num_fragmented_bytes * OS_MALLOC_MONITOR_PERCENT_100) / p_heap_info->free_size);
+}
+
+ATTR_NONNULL(1, 2)
+static void
+os_malloc_monitor_add_to_history(
+    os_malloc_monitor_t* const              p_monitor,
+    const os_malloc_monitor_sample_t* const p_sample)
+{
+    p_monitor->history[p_monitor->history_idx] = *p_sample;
+    p_monitor->history_idx                     = (p_monitor->history_idx + 1) % OS_MALLOC_MONITOR_HISTORY_LEN;
+    if (p_monitor->history_cnt < OS_MALLOC_MONITOR_HISTORY_LEN)
+    {
+        p_monitor->history_cnt += 1;
+    }
+}
+
+/**
+ * @brief Update the threshold state and check if the notification should be emitted.
+ * @return true if the fragmentation has just reached the threshold.
+ */
+ATTR_NONNULL(1, 2)
+static bool
+os_malloc_monitor_check_threshold(
+    os_malloc_monitor_t* const              p_monitor,
+    const os_malloc_monitor_sample_t* const p_sample)
+{
+    const uint32_t threshold = p_monitor->cfg.fragmentation_threshold_percent;
+    if ((0 == threshold) || (p_sample->fragmentation_percent < threshold))
+    {
+        p_monitor->is_threshold_reached = false;
+        return false;
+    }
+    if (p_monitor->is_threshold_reached)
+    {
+        return false;
+    }
+    p_monitor->is_threshold_reached = true;
+    return true;
+}
+
+bool
+os_malloc_monitor_sample(os_malloc_monitor_sample_t* const p_sample)
+{
+    os_malloc_monitor_t* p_monitor = os_malloc_monitor_lock();
+    if (NULL == p_monitor)
+    {
+        return false;
+    }
+    os_malloc_monitor_sample_t sample = { 0 };
+    if (!p_monitor->cfg.cb_get_heap_info(&sample.heap_info))
+    {
+        os_malloc_monitor_unlock(&p_monitor);
+        return false;
+    }
+    sample.timestamp             = (uint32_t)xTaskGetTickCount();
+    sample.fragmentation_percent = os_malloc_monitor_calc_fragmentation_percent(&sample.heap_info);
+    os_malloc_monitor_add_to_history(p_monitor, &sample);
+    const bool                    is_threshold_reached = os_malloc_monitor_check_threshold(p_monitor, &sample);
+    const os_malloc_monitor_cfg_t cfg                  = p_monitor->cfg;
+    os_malloc_monitor_unlock(&p_monitor);
+
+    if (is_threshold_reached)
+    {
+        LOG_WARN(
+            "Heap fragmentation %u%% reached the threshold %u%%: free %u, min free %u, largest free block %u",
+            (printf_uint_t)sample.fragmentation_percent,
+            (printf_uint_t)cfg.fragmentation_threshold_percent,
+            (printf_uint_t)sample.heap_info.free_size,
+            (printf_uint_t)sample.heap_info.min_free_size,
+            (printf_uint_t)sample.heap_info.largest_free_block);
+        if (NULL != cfg.cb_threshold)
+        {
+            cfg.cb_threshold(&sample, cfg.p_cb_threshold_arg);
+        }
+        if (NULL != cfg.p_signal)
+        {
+            (void)os_signal_send(cfg.p_signal, cfg.sig_num);
+        }
+    }
+    if (NULL != p_sample)
+    {
+        *p_sample = sample;
+    }
+    return true;
+}
+
+ATTR_NONNULL(1)
+uint32_t
+os_malloc_monitor_get_history(os_malloc_monitor_sample_t* const p_arr_of_samples, const uint32_t max_num_samples)
+{
+    os_malloc_monitor_t* p_monitor = os_malloc_monitor_lock();
+    if (NULL == p_monitor)
+    {
+        return 0;
+    }
+    uint32_t num_samples = p_monitor->history_cnt;
+    if (num_samples > max_num_samples)
+    {
+        num_samples = max_num_samples;
+    }
+    // The oldest of the requested samples
+    uint32_t idx = p_monitor->history_idx + OS_MALLOC_MONITOR_HISTORY_LEN - num_samples;
+    idx %= OS_MALLOC_MONITOR_HISTORY_LEN;
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        p_arr_of_samples[i] = p_monitor->history[idx];
+        idx                 = (idx + 1) % OS_MALLOC_MONITOR_HISTORY_LEN;
+    }
+    os_malloc_monitor_unlock(&p_monitor);
+    return num_samples;
+}
+
+void
+os_malloc_monitor_log_dump(void)
+{
+    os_malloc_monitor_t* p_monitor = os_malloc_monitor_lock();
+    if (NULL == p_monitor)
+    {
+        LOG_INFO("os_malloc_monitor is not initialized");
+        return;
+    }
+    os_malloc_monitor_unlock(&p_monitor);
+    // The plain calloc is used, so that the dump does not show up in the os_malloc trace and guard statistics
+    os_malloc_monitor_sample_t* p_arr_of_samples = calloc(OS_MALLOC_MONITOR_HISTORY_LEN, sizeof(*p_arr_of_samples));
+    if (NULL == p_arr_of_samples)
+    {
+        LOG_ERR("Can't allocate memory");
+        return;
+    }
+    const uint32_t num_samples = os_malloc_monitor_get_history(p_arr_of_samples, OS_MALLOC_MONITOR_HISTORY_LEN);
+    LOG_INFO("Num samples: %u", (printf_uint_t)num_samples);
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        const os_malloc_monitor_sample_t* const p_sample = &p_arr_of_samples[i];
+        LOG_INFO(
+            "[%2u] at %u: free %u, min free %u, largest free block %u, fragmentation %u%%",
+            (printf_uint_t)i,
+            (printf_uint_t)p_sample->timestamp,
+            (printf_uint_t)p_sample->heap_info.free_size,
+            (printf_uint_t)p_sample->heap_info.min_free_size,
+            (printf_uint_t)p_sample->heap_info.largest_free_block,
+            (printf_uint_t)p_sample->fragmentation_percent);
+    }
+    free(p_arr_of_samples);
+}
+
+#endif // OS_MALLOC_MONITOR
@@ -8,139 +8,176 @@
 #include "os_mkgmtime.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <limits.h>
 #include <time.h>
 
 #define OS_TIME_STRUCT_TM_BASE_YEAR (1900)
-#define OS_TIME_EPOCH_START_YEAR    (1970)
-#define OS_TIME_EPOCH_REL_BASE_YEAR (OS_TIME_EPOCH_START_YEAR - OS_TIME_STRUCT_TM_BASE_YEAR)
-#define OS_TIME_EPOCH_MAX_YEAR      (2038)
-#define OS_TIME_EPOCH_REL_MAX_YEAR  (OS_TIME_EPOCH_MAX_YEAR - OS_TIME_STRUCT_TM_BASE_YEAR)
-
-#define OS_TIME_NUM_LEAP_YEARS_IN_RANGE_1900_1970 (17)
 
 #define OS_TIME_NUM_MONTHS_PER_YEAR    (12)
-#define OS_TIME_NUM_DAYS_PER_YEAR      (365)
+#define OS_TIME_NUM_DAYS_PER_WEEK      (7)
 #define OS_TIME_NUM_HOURS_PER_DAY      (24)
 #define OS_TIME_NUM_MINUTES_PER_HOURS  (60)
 #define OS_TIME_NUM_SECONDS_PER_MINUTE (60)
+#define OS_TIME_NUM_SECONDS_PER_HOUR   (OS_TIME_NUM_MINUTES_PER_HOURS * OS_TIME_NUM_SECONDS_PER_MINUTE)
+#define OS_TIME_NUM_SECONDS_PER_DAY    (OS_TIME_NUM_HOURS_PER_DAY * OS_TIME_NUM_SECONDS_PER_HOUR)
 
-static const int16_t g_os_mkgmtime_days_const[13] = { -1, 30, 58, 89, 119, 150, 180, 211, 242, 272, 303, 333, 364 };
+/**
+ * The algorithms days_from_civil and civil_from_days are taken from
+ * http://howardhinnant.github.io/date_algorithms.html
+ * The calendar is split into 400-year eras (146097 days each), and the year is shifted to start on March 1,
+ * so the leap day is the last day of the year and the day of the year is calculated without a table.
+ */
+#define OS_TIME_NUM_YEARS_PER_ERA        (400)
+#define OS_TIME_NUM_DAYS_PER_ERA         (146097)
+#define OS_TIME_NUM_DAYS_FROM_0000_03_01 (719468) // the number of days from 0000-03-01 to 1970-01-01
+#define OS_TIME_DAY_OF_YEAR_JAN_1        (306)    // the day of the year (starting from March 1) for January 1
+#define OS_TIME_NUM_DAYS_JAN_FEB         (59)     // the number of days in January and February of a non-leap year
+#define OS_TIME_WDAY_OF_1970_01_01       (4)      // Thursday
+
+static int64_t
+os_time_floor_div(const int64_t val, const int64_t divisor)
+{
+    return (val >= 0) ? (val / divisor) : (((val + 1) / divisor) - 1);
+}
 
-static inline bool
-check_is_leap_year(const uint16_t year)
+static bool
+os_time_is_leap_year(const int64_t year)
 {
-    if (0 == (year % 4))
-    {
-        if (0 == (year % 100U))
-        {
-            if (0 == (year % 400U))
-            {
-                return true;
-            }
-            return false;
-        }
-        return true;
-    }
-    return false;
+    return (0 == (year % 4)) && ((0 != (year % 100)) || (0 == (year % 400)));
 }
 
-static uint16_t
-calc_elapsed_years_since_1900(struct tm* const p_tm_time_utc)
+/**
+ * @brief Calculate the number of days since 1970-01-01.
+ * @param year - the year.
+ * @param month - the month in the range [1, 12].
+ * @param mday - the day of the month in the range [1, 31].
+ */
+static int64_t
+os_time_days_from_civil(const int64_t year, const int32_t month, const int32_t mday)
 {
-    if ((p_tm_time_utc->tm_year < (OS_TIME_EPOCH_REL_BASE_YEAR - 1))
-        || (p_tm_time_utc->tm_year > (OS_TIME_EPOCH_REL_MAX_YEAR + 1)))
-    {
-        return (uint16_t)(-1);
-    }
-    int32_t num_of_elapsed_years_since_1900 = p_tm_time_utc->tm_year;
+    const int64_t year_from_march = (month <= 2) ? (year - 1) : year;
+    const int64_t era             = os_time_floor_div(year_from_march, OS_TIME_NUM_YEARS_PER_ERA);
+    const int64_t year_of_era     = year_from_march - (era * OS_TIME_NUM_YEARS_PER_ERA); // [0, 399]
+    const int64_t day_of_year     = (((153 * ((month > 2) ? (month - 3) : (month + 9))) + 2) / 5) + mday - 1;
+    const int64_t day_of_era      = (year_of_era * 365) + (year_of_era / 4) - (year_of_era / 100) + day_of_year;
+    return (era * OS_TIME_NUM_DAYS_PER_ERA) + day_of_era - OS_TIME_NUM_DAYS_FROM_0000_03_01;
+}
 
-    // Adjust the month value so that it is between 0 and 11.
-    if ((p_tm_time_utc->tm_mon < 0) || (p_tm_time_utc->tm_mon > (OS_TIME_NUM_MONTHS_PER_YEAR - 1)))
-    {
-        num_of_elapsed_years_since_1900 += p_tm_time_utc->tm_mon / OS_TIME_NUM_MONTHS_PER_YEAR;
-        p_tm_time_utc->tm_mon %= OS_TIME_NUM_MONTHS_PER_YEAR;
-        if (p_tm_time_utc->tm_mon < 0)
-        {
-            p_tm_time_utc->tm_mon += OS_TIME_NUM_MONTHS_PER_YEAR;
-            num_of_elapsed_years_since_1900 -= 1;
-        }
-    }
-    if ((num_of_elapsed_years_since_1900 < (OS_TIME_EPOCH_REL_BASE_YEAR - 1))
-        || (num_of_elapsed_years_since_1900 > (OS_TIME_EPOCH_REL_MAX_YEAR + 1)))
-    {
-        return (uint16_t)(-1);
-    }
-    return (uint16_t)num_of_elapsed_years_since_1900;
+/**
+ * @brief Convert the number of days since 1970-01-01 to year, month, day of the month and day of the year.
+ */
+static void
+os_time_civil_from_days(
+    const int64_t  days,
+    int64_t* const p_year,
+    int32_t* const p_month,
+    int32_t* const p_mday,
+    int32_t* const p_yday)
+{
+    const int64_t days_from_0000_03_01 = days + OS_TIME_NUM_DAYS_FROM_0000_03_01;
+    const int64_t era                  = os_time_floor_div(days_from_0000_03_01, OS_TIME_NUM_DAYS_PER_ERA);
+    const int64_t day_of_era           = days_from_0000_03_01 - (era * OS_TIME_NUM_DAYS_PER_ERA); // [0, 146096]
+    const int64_t num_leap_days_adj    = (day_of_era / 1460) - (day_of_era / 36524) + (day_of_era / 146096);
+    const int64_t year_of_era          = (day_of_era - num_leap_days_adj) / 365; // [0, 399]
+    const int64_t day_of_year          = day_of_era - ((365 * year_of_era) + (year_of_era / 4) - (year_of_era / 100));
+    const int64_t month_from_march     = ((5 * day_of_year) + 2) / 153; // [0, 11], 0 is March
+    const bool    is_jan_or_feb        = month_from_march >= 10;
+    const int64_t year                 = year_of_era + (era * OS_TIME_NUM_YEARS_PER_ERA) + (is_jan_or_feb ? 1 : 0);
+
+    *p_year  = year;
+    *p_month = (int32_t)(is_jan_or_feb ? (month_from_march - 9) : (month_from_march + 3));
+    *p_mday  = (int32_t)(day_of_year - (((153 * month_from_march) + 2) / 5) + 1);
+    *p_yday  = (int32_t)(is_jan_or_feb
+                            ? (day_of_year - OS_TIME_DAY_OF_YEAR_JAN_1)
+                            : (day_of_year + OS_TIME_NUM_DAYS_JAN_FEB + (os_time_is_leap_year(year) ? 1 : 0)));
 }
 
-time_t
-os_mkgmtime(struct tm* const p_tm_time_utc)
+struct tm*
+os_gmtime64_r(const int64_t unix_time, struct tm* const p_tm_time_utc)
 {
-    const uint16_t num_of_elapsed_years_since_1900 = calc_elapsed_years_since_1900(p_tm_time_utc);
-    if ((uint16_t)(-1) == num_of_elapsed_years_since_1900)
+    const int64_t days = os_time_floor_div(unix_time, OS_TIME_NUM_SECONDS_PER_DAY);
+    // days * OS_TIME_NUM_SECONDS_PER_DAY can overflow int64_t for unix_time near INT64_MIN, so the remainder is used
+    int32_t secs_of_day = (int32_t)(unix_time % OS_TIME_NUM_SECONDS_PER_DAY);
+    if (secs_of_day < 0)
     {
-        return (time_t)(-1);
+        secs_of_day += OS_TIME_NUM_SECONDS_PER_DAY;
     }
 
-    const int32_t days_elapsed_minus_one_since_year_to_month
-        = g_os_mkgmtime_days_const[p_tm_time_utc->tm_mon]
-          + ((check_is_leap_year((uint16_t)(OS_TIME_STRUCT_TM_BASE_YEAR + num_of_elapsed_years_since_1900))
-              && (p_tm_time_utc->tm_mon > 1))
-                 ? 1
-                 : 0);
-
-    /*
-     * Calculate elapsed days since base date (midnight, 1970-01-01, UTC)
-     * 365 days for each elapsed year since 1970, plus one more day for each elapsed leap year.
-     */
-    const int32_t num_days_elapsed_since_1970_till_cur_month
-        = (int32_t)(num_of_elapsed_years_since_1900 - OS_TIME_EPOCH_REL_BASE_YEAR) * OS_TIME_NUM_DAYS_PER_YEAR
-          + ((num_of_elapsed_years_since_1900 - 1) / 4) - OS_TIME_NUM_LEAP_YEARS_IN_RANGE_1900_1970
-          + days_elapsed_minus_one_since_year_to_month;
-
-    const int32_t num_days_elapsed_since_1970 = num_days_elapsed_since_1970_till_cur_month + p_tm_time_utc->tm_mday;
-    if (num_days_elapsed_since_1970 < 0)
+    int64_t year  = 0;
+    int32_t month = 0;
+    int32_t mday  = 0;
+    int32_t yday  = 0;
+    os_time_civil_from_days(days, &year, &month, &mday, &yday);
+    if (((year - OS_TIME_STRUCT_TM_BASE_YEAR) > INT_MAX) || ((year - OS_TIME_STRUCT_TM_BASE_YEAR) < INT_MIN))
     {
-        return (time_t)(-1);
+        return NULL;
     }
 
-    const int64_t num_hours_elapsed_since_1970 = num_days_elapsed_since_1970 * OS_TIME_NUM_HOURS_PER_DAY
-                                                 + p_tm_time_utc->tm_hour;
-    if (num_hours_elapsed_since_1970 < 0)
+    const int64_t wday = (days + OS_TIME_WDAY_OF_1970_01_01) % OS_TIME_NUM_DAYS_PER_WEEK;
+
+    p_tm_time_utc->tm_year  = (int)(year - OS_TIME_STRUCT_TM_BASE_YEAR);
+    p_tm_time_utc->tm_mon   = month - 1;
+    p_tm_time_utc->tm_mday  = mday;
+    p_tm_time_utc->tm_hour  = secs_of_day / OS_TIME_NUM_SECONDS_PER_HOUR;
+    p_tm_time_utc->tm_min   = (secs_of_day % OS_TIME_NUM_SECONDS_PER_HOUR) / OS_TIME_NUM_SECONDS_PER_MINUTE;
+    p_tm_time_utc->tm_sec   = secs_of_day % OS_TIME_NUM_SECONDS_PER_MINUTE;
+    p_tm_time_utc->tm_wday  = (int)((wday < 0) ? (wday + OS_TIME_NUM_DAYS_PER_WEEK) : wday);
+    p_tm_time_utc->tm_yday  = yday;
+    p_tm_time_utc->tm_isdst = 0;
+    return p_tm_time_utc;
+}
+
+bool
+os_mkgmtime64(struct tm* const p_tm_time_utc, int64_t* const p_unix_time)
+{
+    // Adjust the month value so that it is between 0 and 11.
+    const int64_t year_offset = os_time_floor_div(p_tm_time_utc->tm_mon, OS_TIME_NUM_MONTHS_PER_YEAR);
+    const int32_t month       = (int32_t)(p_tm_time_utc->tm_mon - (year_offset * OS_TIME_NUM_MONTHS_PER_YEAR)) + 1;
+    const int64_t year        = (int64_t)p_tm_time_utc->tm_year + OS_TIME_STRUCT_TM_BASE_YEAR + year_offset;
+
+    // All the fields are int, so the intermediate results can't overflow int64_t
+    const int64_t days      = os_time_days_from_civil(year, month, 1) + p_tm_time_utc->tm_mday - 1;
+    const int64_t unix_time = (days * OS_TIME_NUM_SECONDS_PER_DAY)
+                              + ((int64_t)p_tm_time_utc->tm_hour * OS_TIME_NUM_SECONDS_PER_HOUR)
+                              + ((int64_t)p_tm_time_utc->tm_min * OS_TIME_NUM_SECONDS_PER_MINUTE)
+                              + p_tm_time_utc->tm_sec;
+
+    struct tm tm_time_normalized = { 0 };
+    if (NULL == os_gmtime64_r(unix_time, &tm_time_normalized))
     {
-        return (time_t)(-1);
+        return false;
     }
-    const int64_t num_minutes_elapsed_since_1970 = num_hours_elapsed_since_1970 * OS_TIME_NUM_MINUTES_PER_HOURS
-                                                   + p_tm_time_utc->tm_min;
-    if (num_minutes_elapsed_since_1970 < 0)
+    *p_tm_time_utc = tm_time_normalized;
+    *p_unix_time   = unix_time;
+    return true;
+}
+
+time_t
+os_mkgmtime(struct tm* const p_tm_time_utc)
+{
+    struct tm tm_time_utc = *p_tm_time_utc;
+    int64_t   unix_time   = 0;
+    if (!os_mkgmtime64(&tm_time_utc, &unix_time))
     {
         return (time_t)(-1);
     }
-    const int64_t num_seconds_elapsed_since_1970 = num_minutes_elapsed_since_1970 * OS_TIME_NUM_SECONDS_PER_MINUTE
-                                                   + p_tm_time_utc->tm_sec;
-    if (num_seconds_elapsed_since_1970 < 0)
+    if (unix_time < 0)
     {
         return (time_t)(-1);
     }
 
 #if 1
     // this check should be removed if 64-bit time_t is used.
-    if (num_seconds_elapsed_since_1970 > INT32_MAX)
+    if (unix_time > INT32_MAX)
     {
         return (time_t)(-1);
     }
 #endif
 
-    time_t unix_time = (time_t)num_seconds_elapsed_since_1970;
-    if ((int64_t)unix_time != num_seconds_elapsed_since_1970)
+    if ((int64_t)(time_t)unix_time != unix_time)
     {
         return (time_t)(-1);
     }
-
-    if (NULL == gmtime_r(&unix_time, p_tm_time_utc))
-    {
-        return (time_t)(-1);
-    }
-
-    return unix_time;
+    *p_tm_time_utc = tm_time_utc;
+    return (time_t)unix_time;
 }
@@ -0,0 +1,287 @@
+/**
+ * @file os_msgpool.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_msgpool.h"
+#include <assert.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "os_malloc.h"
+#include "os_ringbuf.h"
+
+#define OS_MSGPOOL_NUM_BITS_PER_WORD (32U)
+#define OS_MSGPOOL_ALIGN             (_Alignof(max_align_t))
+
+/**
+ * The object, the buffers and the service arrays are placed in one memory block:
+ * [os_msgpool_t][buffers][bitmap of free buffers][post timestamps][os_ringbuf_mpsc buffer].
+ * The free buffers are tracked with a bitmap (a set bit means a free buffer) which is modified with CAS,
+ * so acquire/release are lock-free and can be used from ISR.
+ * The posted buffers are passed to the consumer by their indexes through os_ringbuf_mpsc,
+ * its capacity is not less than the number of buffers, so posting never fails.
+ */
+struct os_msgpool_t
+{
+    uint8_t*                 p_blocks;
+    uint32_t                 block_size;
+    uint32_t                 num_blocks;
+    atomic_uint_least32_t*   p_free_bitmap;
+    uint32_t                 num_bitmap_words;
+    uint32_t*                p_post_ticks;
+    os_ringbuf_mpsc_static_t ringbuf_mem;
+    os_ringbuf_mpsc_t*       p_ringbuf;
+    atomic_uint_least32_t    num_acquired;
+    atomic_uint_least32_t    num_exhausted;
+    atomic_uint_least32_t    num_posted;
+    atomic_uint_least32_t    num_received;
+    atomic_uint_least32_t    num_in_use;
+    atomic_uint_least32_t    max_in_use;
+    atomic_uint_least32_t    total_latency_ticks;
+    atomic_uint_least32_t    max_latency_ticks;
+};
+
+static size_t
+os_msgpool_align_up(const size_t size)
+{
+    return (size + OS_MSGPOOL_ALIGN - 1U) & ~(OS_MSGPOOL_ALIGN - 1U);
+}
+
+static uint32_t
+os_msgpool_calc_ringbuf_capacity(const uint32_t num_blocks)
+{
+    uint32_t capacity = 1U;
+    while (capacity < num_blocks)
+    {
+        capacity <<= 1U;
+    }
+    return capacity;
+}
+
+static TickType_t
+os_msgpool_get_tick_count(void)
+{
+    return xPortInIsrContext() ? xTaskGetTickCountFromISR() : xTaskGetTickCount();
+}
+
+ATTR_NONNULL(1)
+static void
+os_msgpool_update_max(atomic_uint_least32_t* const p_max, const uint32_t val)
+{
+    uint32_t prev_max = atomic_load_explicit(p_max, memory_order_relaxed);
+    while ((val > prev_max)
+           && (!atomic_compare_exchange_weak_explicit(
+               p_max,
+               &prev_max,
+               val,
+               memory_order_relaxed,
+               memory_order_relaxed)))
+    {
+    }
+}
+
+ATTR_WARN_UNUSED_RESULT
+os_msgpool_t*
+os_msgpool_create(
+    const uint32_t        block_size,
+    const uint32_t        num_blocks,
+    os_signal_t* const    p_signal,
+    const os_signal_num_e sig_num)
+{
+    if ((0 == block_size) || (0 == num_blocks))
+    {
+        return NULL;
+    }
+    const uint32_t ringbuf_capacity  = os_msgpool_calc_ringbuf_capacity(num_blocks);
+    const uint32_t num_bitmap_words  = (num_blocks + OS_MSGPOOL_NUM_BITS_PER_WORD - 1U) / OS_MSGPOOL_NUM_BITS_PER_WORD;
+    const size_t   aligned_blk_size  = os_msgpool_align_up(block_size);
+    const size_t   offset_blocks     = os_msgpool_align_up(sizeof(os_msgpool_t));
+    const size_t   offset_bitmap     = offset_blocks + (aligned_blk_size * num_blocks);
+    const size_t   offset_post_ticks = offset_bitmap + (sizeof(atomic_uint_least32_t) * num_bitmap_words);
+    const size_t   offset_ringbuf    = offset_post_ticks + (sizeof(uint32_t) * num_blocks);
+    const size_t   ringbuf_buf_size  = OS_RINGBUF_MPSC_BUF_SIZE(sizeof(uint32_t), ringbuf_capacity);
+    const size_t   total_size        = offset_ringbuf + ringbuf_buf_size;
+
+    uint8_t* const p_mem = os_calloc(1, total_size);
+    if (NULL == p_mem)
+    {
+        return NULL;
+    }
+    os_msgpool_t* const p_msgpool = (os_msgpool_t*)p_mem;
+    p_msgpool->p_blocks           = &p_mem[offset_blocks];
+    p_msgpool->block_size         = (uint32_t)aligned_blk_size;
+    p_msgpool->num_blocks         = num_blocks;
+    p_msgpool->p_free_bitmap      = (atomic_uint_least32_t*)(void*)&p_mem[offset_bitmap];
+    p_msgpool->num_bitmap_words   = num_bitmap_words;
+    p_msgpool->p_post_ticks       = (uint32_t*)(void*)&p_mem[offset_post_ticks];
+    p_msgpool->p_ringbuf          = os_ringbuf_mpsc_create_static(
+        &p_msgpool->ringbuf_mem,
+        &p_mem[offset_ringbuf],
+        sizeof(uint32_t),
+        ringbuf_capacity,
+        p_signal,
+        sig_num);
+    assert(NULL != p_msgpool->p_ringbuf);
+
+    for (uint32_t i = 0; i < num_bitmap_words; ++i)
+    {
+        const uint32_t num_bits = num_blocks - (i * OS_MSGPOOL_NUM_BITS_PER_WORD);
+        atomic_init(
+            &p_msgpool->p_free_bitmap[i],
+            (num_bits >= OS_MSGPOOL_NUM_BITS_PER_WORD) ? UINT32_MAX : ((1U << num_bits) - 1U));
+    }
+    atomic_init(&p_msgpool->num_acquired, 0);
+    atomic_init(&p_msgpool->num_exhausted, 0);
+    atomic_init(&p_msgpool->num_posted, 0);
+    atomic_init(&p_msgpool->num_received, 0);
+    atomic_init(&p_msgpool->num_in_use, 0);
+    atomic_init(&p_msgpool->max_in_use, 0);
+    atomic_init(&p_msgpool->total_latency_ticks, 0);
+    atomic_init(&p_msgpool->max_latency_ticks, 0);
+    return p_msgpool;
+}
+
+ATTR_NONNULL(1)
+void
+os_msgpool_delete(os_msgpool_t** const pp_msgpool)
+{
+    os_msgpool_t* p_msgpool = *pp_msgpool;
+    if (NULL == p_msgpool)
+    {
+        return;
+    }
+    *pp_msgpool = NULL;
+    os_free(p_msgpool);
+}
+
+ATTR_NONNULL(1)
+uint32_t
+os_msgpool_get_block_size(const os_msgpool_t* const p_msgpool)
+{
+    return p_msgpool->block_size;
+}
+
+ATTR_NONNULL(1, 2)
+static uint32_t
+os_msgpool_get_block_idx(const os_msgpool_t* const p_msgpool, const void* const p_msg)
+{
+    const uint8_t* const p_msg_u8 = p_msg;
+    assert(p_msg_u8 >= p_msgpool->p_blocks);
+    const size_t offset = (size_t)(p_msg_u8 - p_msgpool->p_blocks);
+    assert(0 == (offset % p_msgpool->block_size));
+    const uint32_t idx = (uint32_t)(offset / p_msgpool->block_size);
+    assert(idx < p_msgpool->num_blocks);
+    return idx;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+void*
+os_msgpool_acquire(os_msgpool_t* const p_msgpool)
+{
+    for (uint32_t word_idx = 0; word_idx < p_msgpool->num_bitmap_words; ++word_idx)
+    {
+        atomic_uint_least32_t* const p_word = &p_msgpool->p_free_bitmap[word_idx];
+        uint32_t                     bits   = atomic_load_explicit(p_word, memory_order_relaxed);
+        while (0 != bits)
+        {
+            const uint32_t bit_idx = (uint32_t)__builtin_ctz(bits);
+            if (atomic_compare_exchange_weak_explicit(
+                    p_word,
+                    &bits,
+                    bits & ~(1U << bit_idx),
+                    memory_order_acquire,
+                    memory_order_relaxed))
+            {
+                const uint32_t num_in_use = atomic_fetch_add(&p_msgpool->num_in_use, 1) + 1U;
+                atomic_fetch_add_explicit(&p_msgpool->num_acquired, 1, memory_order_relaxed);
+                os_msgpool_update_max(&p_msgpool->max_in_use, num_in_use);
+                const uint32_t block_idx = (word_idx * OS_MSGPOOL_NUM_BITS_PER_WORD) + bit_idx;
+                return &p_msgpool->p_blocks[(size_t)block_idx * p_msgpool->block_size];
+            }
+        }
+    }
+    atomic_fetch_add_explicit(&p_msgpool->num_exhausted, 1, memory_order_relaxed);
+    return NULL;
+}
+
+ATTR_NONNULL(1, 2)
+bool
+os_msgpool_post(os_msgpool_t* const p_msgpool, void* const p_msg)
+{
+    const uint32_t block_idx           = os_msgpool_get_block_idx(p_msgpool, p_msg);
+    p_msgpool->p_post_ticks[block_idx] = (uint32_t)os_msgpool_get_tick_count();
+    // The timestamp is published to the consumer together with the index by os_ringbuf_mpsc_push.
+    if (!os_ringbuf_mpsc_push(p_msgpool->p_ringbuf, &block_idx))
+    {
+        return false;
+    }
+    atomic_fetch_add_explicit(&p_msgpool->num_posted, 1, memory_order_relaxed);
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+void*
+os_msgpool_receive(os_msgpool_t* const p_msgpool)
+{
+    uint32_t block_idx = 0;
+    if (!os_ringbuf_mpsc_pop(p_msgpool->p_ringbuf, &block_idx))
+    {
+        return NULL;
+    }
+    const uint32_t latency_ticks = (uint32_t)os_msgpool_get_tick_count() - p_msgpool->p_post_ticks[block_idx];
+    atomic_fetch_add_explicit(&p_msgpool->num_received, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&p_msgpool->total_latency_ticks, latency_ticks, memory_order_relaxed);
+    os_msgpool_update_max(&p_msgpool->max_latency_ticks, latency_ticks);
+    return &p_msgpool->p_blocks[(size_t)block_idx * p_msgpool->block_size];
+}
+
+ATTR_NONNULL(1, 2)
+void
+os_msgpool_release(os_msgpool_t* const p_msgpool, void* const p_msg)
+{
+    const uint32_t block_idx = os_msgpool_get_block_idx(p_msgpool, p_msg);
+    const uint32_t word_idx  = block_idx / OS_MSGPOOL_NUM_BITS_PER_WORD;
+    const uint32_t bit_mask  = 1U << (block_idx % OS_MSGPOOL_NUM_BITS_PER_WORD);
+
+    atomic_fetch_sub(&p_msgpool->num_in_use, 1);
+    const uint32_t prev_bits = atomic_fetch_or_explicit(
+        &p_msgpool->p_free_bitmap[word_idx],
+        bit_mask,
+        memory_order_release);
+    assert(0 == (prev_bits & bit_mask)); // double release
+    (void)prev_bits;
+}
+
+ATTR_NONNULL(1, 2)
+void
+os_msgpool_get_stat(os_msgpool_t* const p_msgpool, os_msgpool_stat_t* const p_stat)
+{
+    p_stat->num_acquired        = atomic_load(&p_msgpool->num_acquired);
+    p_stat->num_exhausted       = atomic_load(&p_msgpool->num_exhausted);
+    p_stat->num_posted          = atomic_load(&p_msgpool->num_posted);
+    p_stat->num_received        = atomic_load(&p_msgpool->num_received);
+    p_stat->num_in_use          = atomic_load(&p_msgpool->num_in_use);
+    p_stat->max_in_use          = atomic_load(&p_msgpool->max_in_use);
+    p_stat->total_latency_ticks = atomic_load(&p_msgpool->total_latency_ticks);
+    p_stat->max_latency_ticks   = atomic_load(&p_msgpool->max_latency_ticks);
+}
+
+ATTR_NONNULL(1)
+void
+os_msgpool_reset_stat(os_msgpool_t* const p_msgpool)
+{
+    atomic_store(&p_msgpool->num_acquired, 0);
+    atomic_store(&p_msgpool->num_exhausted, 0);
+    atomic_store(&p_msgpool->num_posted, 0);
+    atomic_store(&p_msgpool->num_received, 0);
+    atomic_store(&p_msgpool->max_in_use, atomic_load(&p_msgpool->num_in_use));
+    atomic_store(&p_msgpool->total_latency_ticks, 0);
+    atomic_store(&p_msgpool->max_latency_ticks, 0);
+}
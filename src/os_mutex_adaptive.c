@@ -0,0 +1,321 @@
+/**
+ * @file os_mutex_adaptive.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_mutex_adaptive.h"
+#include <assert.h>
+#include <stdatomic.h>
+#include <string.h>
+#include "freertos/task.h"
+#include "os_malloc.h"
+
+#if !configSUPPORT_STATIC_ALLOCATION
+#error os_mutex_adaptive requires configSUPPORT_STATIC_ALLOCATION to be enabled
+#endif
+
+#if OS_MUTEX_ADAPTIVE_SPIN \
+    && ((defined(RUUVI_TESTS) && RUUVI_TESTS) || (defined(RUUVI_ESP_WRAPPERS_TESTS) && RUUVI_ESP_WRAPPERS_TESTS))
+/* The POSIX simulator is single-core, so the multi-core port functions are provided by the unit-tests */
+BaseType_t
+xPortGetCoreID(void);
+
+TaskHandle_t
+xTaskGetCurrentTaskHandleForCPU(BaseType_t cpuid);
+#endif
+
+/**
+ * The weight of the last sample in the moving average of the number of spins is 1/2^OS_MUTEX_ADAPTIVE_AVG_SHIFT.
+ * The average is kept multiplied by 2^OS_MUTEX_ADAPTIVE_AVG_SHIFT, so that small deltas are not rounded to zero.
+ */
+#define OS_MUTEX_ADAPTIVE_AVG_SHIFT (3U)
+
+typedef enum os_mutex_adaptive_acquired_e
+{
+    OS_MUTEX_ADAPTIVE_ACQUIRED_IMMEDIATELY,
+    OS_MUTEX_ADAPTIVE_ACQUIRED_BY_SPINNING,
+    OS_MUTEX_ADAPTIVE_ACQUIRED_AFTER_SPINNING_AND_BLOCKING,
+    OS_MUTEX_ADAPTIVE_ACQUIRED_AFTER_BLOCKING,
+} os_mutex_adaptive_acquired_e;
+
+/**
+ * All the fields are modified only by the task which holds h_mutex,
+ * h_owner, owner_core_id and spin_limit are also read by the spinning tasks.
+ */
+struct os_mutex_adaptive_t
+{
+    os_mutex_static_t        mutex_mem;
+    os_mutex_t               h_mutex;
+    TaskHandle_t volatile    h_owner;
+    uint32_t                 spin_avg_scaled; //!< the average number of spins multiplied by 2^AVG_SHIFT
+    atomic_uint_least32_t    spin_limit;      //!< the spin budget, it is copied to stat by get_stat
+    bool                     is_static;
+    os_mutex_adaptive_stat_t stat; //!< the counters, stat.spin_limit is not used
+    volatile BaseType_t      owner_core_id;
+};
+
+_Static_assert(
+    sizeof(os_mutex_adaptive_t) == sizeof(os_mutex_adaptive_static_t),
+    "os_mutex_adaptive_t != os_mutex_adaptive_static_t");
+
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+static os_mutex_adaptive_t*
+os_mutex_adaptive_init(os_mutex_adaptive_t* const p_mutex, const bool is_static)
+{
+    memset(p_mutex, 0, sizeof(*p_mutex));
+    p_mutex->h_mutex   = os_mutex_create_static(&p_mutex->mutex_mem);
+    p_mutex->is_static = is_static;
+    atomic_init(&p_mutex->spin_limit, OS_MUTEX_ADAPTIVE_MIN_SPINS);
+    return p_mutex;
+}
+
+ATTR_WARN_UNUSED_RESULT
+os_mutex_adaptive_t*
+os_mutex_adaptive_create(void)
+{
+    os_mutex_adaptive_t* const p_mutex = os_calloc(1, sizeof(*p_mutex));
+    if (NULL == p_mutex)
+    {
+        return NULL;
+    }
+    const bool is_static = false;
+    return os_mutex_adaptive_init(p_mutex, is_static);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+os_mutex_adaptive_t*
+os_mutex_adaptive_create_static(os_mutex_adaptive_static_t* const p_mutex_mem)
+{
+    os_mutex_adaptive_t* const p_mutex   = (os_mutex_adaptive_t*)p_mutex_mem;
+    const bool                 is_static = true;
+    return os_mutex_adaptive_init(p_mutex, is_static);
+}
+
+ATTR_NONNULL(1)
+void
+os_mutex_adaptive_delete(os_mutex_adaptive_t** const pp_mutex)
+{
+    os_mutex_adaptive_t* p_mutex = *pp_mutex;
+    if (NULL == p_mutex)
+    {
+        return;
+    }
+    *pp_mutex = NULL;
+    os_mutex_delete(&p_mutex->h_mutex);
+    if (!p_mutex->is_static)
+    {
+        os_free(p_mutex);
+    }
+}
+
+ATTR_NONNULL(1)
+static void
+os_mutex_adaptive_update_spin_limit(os_mutex_adaptive_t* const p_mutex)
+{
+    const uint32_t spin_avg   = p_mutex->spin_avg_scaled >> OS_MUTEX_ADAPTIVE_AVG_SHIFT;
+    const uint32_t spin_limit = (2U * spin_avg) + OS_MUTEX_ADAPTIVE_MIN_SPINS;
+
+    atomic_store_explicit(
+        &p_mutex->spin_limit,
+        (spin_limit < OS_MUTEX_ADAPTIVE_MAX_SPINS) ? spin_limit : OS_MUTEX_ADAPTIVE_MAX_SPINS,
+        memory_order_relaxed);
+}
+
+ATTR_NONNULL(1)
+static void
+os_mutex_adaptive_on_acquired(
+    os_mutex_adaptive_t* const         p_mutex,
+    const os_mutex_adaptive_acquired_e acquired,
+    const uint32_t                     num_spins)
+{
+#if OS_MUTEX_ADAPTIVE_SPIN
+    p_mutex->owner_core_id = xPortGetCoreID();
+#endif
+    p_mutex->h_owner = xTaskGetCurrentTaskHandle();
+    p_mutex->stat.num_locks += 1;
+    switch (acquired)
+    {
+        case OS_MUTEX_ADAPTIVE_ACQUIRED_IMMEDIATELY:
+            p_mutex->stat.num_acquired_immediately += 1;
+            break;
+        case OS_MUTEX_ADAPTIVE_ACQUIRED_BY_SPINNING:
+            p_mutex->stat.num_spin_successes += 1;
+            // Move the average towards the number of spins which were needed to acquire the mutex
+            p_mutex->spin_avg_scaled += num_spins;
+            p_mutex->spin_avg_scaled -= p_mutex->spin_avg_scaled >> OS_MUTEX_ADAPTIVE_AVG_SHIFT;
+            os_mutex_adaptive_update_spin_limit(p_mutex);
+            break;
+        case OS_MUTEX_ADAPTIVE_ACQUIRED_AFTER_SPINNING_AND_BLOCKING:
+            p_mutex->stat.num_blocks += 1;
+            // The whole spin budget was wasted, so the mutex is held for too long to spin on it
+            p_mutex->spin_avg_scaled -= p_mutex->spin_avg_scaled >> OS_MUTEX_ADAPTIVE_AVG_SHIFT;
+            os_mutex_adaptive_update_spin_limit(p_mutex);
+            break;
+        case OS_MUTEX_ADAPTIVE_ACQUIRED_AFTER_BLOCKING:
+            p_mutex->stat.num_blocks += 1;
+            break;
+        default:
+            assert(0);
+            break;
+    }
+}
+
+#if OS_MUTEX_ADAPTIVE_SPIN
+/**
+ * @brief Check if the owner of the mutex is the current task on its core.
+ * @note It reads the current task of the core without entering a critical section (unlike eTaskGetState),
+ *       if the owner has migrated to another core, then it is considered as not running.
+ */
+ATTR_NONNULL(1)
+static bool
+os_mutex_adaptive_is_owner_running(const os_mutex_adaptive_t* const p_mutex, const TaskHandle_t h_owner)
+{
+    const BaseType_t owner_core_id = p_mutex->owner_core_id;
+    if (h_owner != p_mutex->h_owner)
+    {
+        // The mutex has been released (or re-acquired) while owner_core_id was read
+        return true;
+    }
+    return h_owner == xTaskGetCurrentTaskHandleForCPU(owner_core_id);
+}
+
+/**
+ * @brief Spin while the owner of the mutex is running on another core.
+ * @param p_mutex - pointer to the os_mutex_adaptive_t object.
+ * @param[out] p_num_spins - the number of spins which were done.
+ * @param[out] p_is_budget_exhausted - set to true if the whole spin budget was used.
+ * @return true if the mutex was acquired.
+ */
+ATTR_NONNULL(1, 2, 3)
+static bool
+os_mutex_adaptive_spin(
+    os_mutex_adaptive_t* const p_mutex,
+    uint32_t* const            p_num_spins,
+    bool* const                p_is_budget_exhausted)
+{
+    // The spin budget is updated by the owner of the mutex, so it is read once
+    const uint32_t spin_limit = atomic_load_explicit(&p_mutex->spin_limit, memory_order_relaxed);
+    for (uint32_t num_spins = 1; num_spins <= spin_limit; ++num_spins)
+    {
+        const TaskHandle_t h_owner = p_mutex->h_owner;
+        if (NULL != h_owner)
+        {
+            if (!os_mutex_adaptive_is_owner_running(p_mutex, h_owner))
+            {
+                // The owner is blocked or preempted, so it will not release the mutex soon
+                *p_num_spins = num_spins;
+                return false;
+            }
+            // Don't call the kernel while the mutex is held
+            continue;
+        }
+        if (os_mutex_try_lock(p_mutex->h_mutex))
+        {
+            *p_num_spins = num_spins;
+            return true;
+        }
+    }
+    *p_num_spins           = spin_limit;
+    *p_is_budget_exhausted = true;
+    return false;
+}
+#endif
+
+#if OS_MUTEX_ADAPTIVE_SPIN
+static os_delta_ticks_t
+os_mutex_adaptive_calc_remaining_ticks(const TickType_t tick_start, const os_delta_ticks_t ticks_to_wait)
+{
+    if (OS_DELTA_TICKS_INFINITE == ticks_to_wait)
+    {
+        return OS_DELTA_TICKS_INFINITE;
+    }
+    const os_delta_ticks_t delta_ticks = xTaskGetTickCount() - tick_start;
+    return (delta_ticks < ticks_to_wait) ? (ticks_to_wait - delta_ticks) : 0;
+}
+#endif
+
+ATTR_NONNULL(1)
+bool
+os_mutex_adaptive_lock_with_timeout(os_mutex_adaptive_t* const p_mutex, const os_delta_ticks_t ticks_to_wait)
+{
+    if (os_mutex_try_lock(p_mutex->h_mutex))
+    {
+        os_mutex_adaptive_on_acquired(p_mutex, OS_MUTEX_ADAPTIVE_ACQUIRED_IMMEDIATELY, 0);
+        return true;
+    }
+    if (OS_DELTA_TICKS_IMMEDIATE == ticks_to_wait)
+    {
+        return false;
+    }
+    bool             is_budget_exhausted = false;
+    os_delta_ticks_t ticks_remaining     = ticks_to_wait;
+#if OS_MUTEX_ADAPTIVE_SPIN
+    const TickType_t tick_start = xTaskGetTickCount();
+    uint32_t         num_spins  = 0;
+    if (os_mutex_adaptive_spin(p_mutex, &num_spins, &is_budget_exhausted))
+    {
+        os_mutex_adaptive_on_acquired(p_mutex, OS_MUTEX_ADAPTIVE_ACQUIRED_BY_SPINNING, num_spins);
+        return true;
+    }
+    ticks_remaining = os_mutex_adaptive_calc_remaining_ticks(tick_start, ticks_to_wait);
+#endif
+    if (!os_mutex_lock_with_timeout(p_mutex->h_mutex, ticks_remaining))
+    {
+        return false;
+    }
+    os_mutex_adaptive_on_acquired(
+        p_mutex,
+        is_budget_exhausted ? OS_MUTEX_ADAPTIVE_ACQUIRED_AFTER_SPINNING_AND_BLOCKING
+                            : OS_MUTEX_ADAPTIVE_ACQUIRED_AFTER_BLOCKING,
+        0);
+    return true;
+}
+
+ATTR_NONNULL(1)
+void
+os_mutex_adaptive_lock(os_mutex_adaptive_t* const p_mutex)
+{
+    if (!os_mutex_adaptive_lock_with_timeout(p_mutex, OS_DELTA_TICKS_INFINITE))
+    {
+        assert(0);
+    }
+}
+
+ATTR_NONNULL(1)
+bool
+os_mutex_adaptive_try_lock(os_mutex_adaptive_t* const p_mutex)
+{
+    return os_mutex_adaptive_lock_with_timeout(p_mutex, OS_DELTA_TICKS_IMMEDIATE);
+}
+
+ATTR_NONNULL(1)
+void
+os_mutex_adaptive_unlock(os_mutex_adaptive_t* const p_mutex)
+{
+    p_mutex->h_owner = NULL;
+    os_mutex_unlock(p_mutex->h_mutex);
+}
+
+ATTR_NONNULL(1, 2)
+void
+os_mutex_adaptive_get_stat(os_mutex_adaptive_t* const p_mutex, os_mutex_adaptive_stat_t* const p_stat)
+{
+    os_mutex_lock(p_mutex->h_mutex);
+    *p_stat            = p_mutex->stat;
+    p_stat->spin_limit = atomic_load_explicit(&p_mutex->spin_limit, memory_order_relaxed);
+    os_mutex_unlock(p_mutex->h_mutex);
+}
+
+ATTR_NONNULL(1)
+void
+os_mutex_adaptive_reset_stat(os_mutex_adaptive_t* const p_mutex)
+{
+    os_mutex_lock(p_mutex->h_mutex);
+    memset(&p_mutex->stat, 0, sizeof(p_mutex->stat));
+    os_mutex_unlock(p_mutex->h_mutex);
+}
@@ -7,12 +7,28 @@
 
 #include "os_mutex_recursive.h"
 #include <assert.h>
+#include "os_lock_prof.h"
 
 ATTR_WARN_UNUSED_RESULT
 os_mutex_recursive_t
 os_mutex_recursive_create(void)
+{
+    return os_mutex_recursive_create_named(NULL);
+}
+
+ATTR_WARN_UNUSED_RESULT
+os_mutex_recursive_t
+os_mutex_recursive_create_named(const char* const p_name)
 {
     SemaphoreHandle_t h_mutex = xSemaphoreCreateRecursiveMutex();
+#if OS_LOCK_PROF
+    if (NULL != h_mutex)
+    {
+        os_lock_prof_register(h_mutex, p_name, OS_LOCK_PROF_TYPE_MUTEX_RECURSIVE);
+    }
+#else
+    (void)p_name;
+#endif
     return h_mutex;
 }
 
@@ -22,8 +38,22 @@ ATTR_NONNULL(1)
 ATTR_RETURNS_NONNULL
 os_mutex_recursive_t
 os_mutex_recursive_create_static(os_mutex_recursive_static_t* const p_mutex_static)
+{
+    return os_mutex_recursive_create_static_named(p_mutex_static, NULL);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+os_mutex_recursive_t
+os_mutex_recursive_create_static_named(os_mutex_recursive_static_t* const p_mutex_static, const char* const p_name)
 {
     SemaphoreHandle_t h_mutex = xSemaphoreCreateRecursiveMutexStatic(p_mutex_static);
+#if OS_LOCK_PROF
+    os_lock_prof_register(h_mutex, p_name, OS_LOCK_PROF_TYPE_MUTEX_RECURSIVE);
+#else
+    (void)p_name;
+#endif
     return h_mutex;
 }
 #endif
@@ -34,22 +64,35 @@ os_mutex_recursive_delete(os_mutex_recursive_t* const ph_mutex)
 {
     if (NULL != *ph_mutex)
     {
+#if OS_LOCK_PROF
+        os_lock_prof_unregister(*ph_mutex);
+#endif
         vSemaphoreDelete(*ph_mutex);
         *ph_mutex = NULL;
     }
 }
 
-bool
-os_mutex_recursive_lock_with_timeout(os_mutex_recursive_t const h_mutex, const os_delta_ticks_t ticks_to_wait)
+static bool
+os_mutex_recursive_take(void* const h_mutex, const os_delta_ticks_t ticks_to_wait)
 {
-    assert(NULL != h_mutex);
-    if (pdTRUE != xSemaphoreTakeRecursive(h_mutex, ticks_to_wait))
+    if (pdTRUE != xSemaphoreTakeRecursive((os_mutex_recursive_t)h_mutex, ticks_to_wait))
     {
         return false;
     }
     return true;
 }
 
+bool
+os_mutex_recursive_lock_with_timeout(os_mutex_recursive_t const h_mutex, const os_delta_ticks_t ticks_to_wait)
+{
+    assert(NULL != h_mutex);
+#if OS_LOCK_PROF
+    return os_lock_prof_take(h_mutex, ticks_to_wait, &os_mutex_recursive_take);
+#else
+    return os_mutex_recursive_take(h_mutex, ticks_to_wait);
+#endif
+}
+
 void
 os_mutex_recursive_lock(os_mutex_recursive_t const h_mutex)
 {
@@ -71,5 +114,8 @@ void
 os_mutex_recursive_unlock(os_mutex_recursive_t const h_mutex)
 {
     assert(NULL != h_mutex);
+#if OS_LOCK_PROF
+    os_lock_prof_on_release(h_mutex);
+#endif
     xSemaphoreGiveRecursive(h_mutex);
 }
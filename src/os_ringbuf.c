@@ -0,0 +1,328 @@
+/**
+ * @file os_ringbuf.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_ringbuf.h"
+#include <stdatomic.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * Positions are free-running 32-bit counters, the slot index is (position & mask).
+ * Since the capacity is a power of two, the counters wrap around without breaking the slot indexes.
+ */
+struct os_ringbuf_spsc_t
+{
+    uint8_t*              p_buf;
+    uint32_t              item_size;
+    uint32_t              mask;
+    os_signal_t*          p_signal;
+    os_signal_num_e       sig_num;
+    atomic_uint_least32_t head; //!< modified only by the producer
+    atomic_uint_least32_t tail; //!< modified only by the consumer
+};
+
+/**
+ * Producers reserve positions by advancing 'head' with CAS, then copy the items and publish them
+ * by writing (position + 1) to the sequence number of the slot, so the consumer never reads
+ * an item which is still being written by another producer.
+ */
+struct os_ringbuf_mpsc_t
+{
+    atomic_uint_least32_t* p_seq;
+    uint8_t*               p_buf;
+    uint32_t               item_size;
+    uint32_t               mask;
+    os_signal_t*           p_signal;
+    os_signal_num_e        sig_num;
+    atomic_uint_least32_t  head; //!< modified by producers
+    atomic_uint_least32_t  tail; //!< modified only by the consumer
+};
+
+_Static_assert(
+    sizeof(os_ringbuf_spsc_t) == sizeof(os_ringbuf_spsc_static_t),
+    "os_ringbuf_spsc_t != os_ringbuf_spsc_static_t");
+_Static_assert(
+    sizeof(os_ringbuf_mpsc_t) == sizeof(os_ringbuf_mpsc_static_t),
+    "os_ringbuf_mpsc_t != os_ringbuf_mpsc_static_t");
+_Static_assert(sizeof(atomic_uint_least32_t) == sizeof(uint32_t), "sizeof(atomic_uint_least32_t) != 4");
+
+static bool
+os_ringbuf_is_power_of_two(const uint32_t val)
+{
+    return (0 != val) && (0 == (val & (val - 1U)));
+}
+
+static uint32_t
+os_ringbuf_min(const uint32_t val1, const uint32_t val2)
+{
+    return (val1 < val2) ? val1 : val2;
+}
+
+/**
+ * @brief Copy items to the ring buffer storage starting from the given position (with wrap-around).
+ */
+ATTR_NONNULL(1, 4)
+static void
+os_ringbuf_copy_in(
+    uint8_t* const    p_buf,
+    const uint32_t    item_size,
+    const uint32_t    mask,
+    const void* const p_items,
+    const uint32_t    pos,
+    const uint32_t    num_items)
+{
+    const uint32_t idx         = pos & mask;
+    const uint32_t num_to_end  = os_ringbuf_min(num_items, (mask + 1U) - idx);
+    const uint8_t* p_items_u8  = p_items;
+    const size_t   len_to_end  = (size_t)num_to_end * item_size;
+    const size_t   len_wrapped = (size_t)(num_items - num_to_end) * item_size;
+
+    memcpy(&p_buf[(size_t)idx * item_size], p_items_u8, len_to_end);
+    if (0 != len_wrapped)
+    {
+        memcpy(&p_buf[0], &p_items_u8[len_to_end], len_wrapped);
+    }
+}
+
+/**
+ * @brief Copy items from the ring buffer storage starting from the given position (with wrap-around).
+ */
+ATTR_NONNULL(1, 4)
+static void
+os_ringbuf_copy_out(
+    const uint8_t* const p_buf,
+    const uint32_t       item_size,
+    const uint32_t       mask,
+    void* const          p_items,
+    const uint32_t       pos,
+    const uint32_t       num_items)
+{
+    const uint32_t idx         = pos & mask;
+    const uint32_t num_to_end  = os_ringbuf_min(num_items, (mask + 1U) - idx);
+    uint8_t*       p_items_u8  = p_items;
+    const size_t   len_to_end  = (size_t)num_to_end * item_size;
+    const size_t   len_wrapped = (size_t)(num_items - num_to_end) * item_size;
+
+    memcpy(p_items_u8, &p_buf[(size_t)idx * item_size], len_to_end);
+    if (0 != len_wrapped)
+    {
+        memcpy(&p_items_u8[len_to_end], &p_buf[0], len_wrapped);
+    }
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+os_ringbuf_spsc_t*
+os_ringbuf_spsc_create_static(
+    os_ringbuf_spsc_static_t* const p_mem,
+    void* const                     p_buf,
+    const uint32_t                  item_size,
+    const uint32_t                  capacity,
+    os_signal_t* const              p_signal,
+    const os_signal_num_e           sig_num)
+{
+    if ((0 == item_size) || (!os_ringbuf_is_power_of_two(capacity)))
+    {
+        return NULL;
+    }
+    os_ringbuf_spsc_t* const p_ringbuf = (os_ringbuf_spsc_t*)p_mem;
+    memset(p_ringbuf, 0, sizeof(*p_ringbuf));
+    p_ringbuf->p_buf     = p_buf;
+    p_ringbuf->item_size = item_size;
+    p_ringbuf->mask      = capacity - 1U;
+    p_ringbuf->p_signal  = p_signal;
+    p_ringbuf->sig_num   = sig_num;
+    atomic_init(&p_ringbuf->head, 0);
+    atomic_init(&p_ringbuf->tail, 0);
+    return p_ringbuf;
+}
+
+ATTR_NONNULL(1, 2)
+bool
+os_ringbuf_spsc_push(os_ringbuf_spsc_t* const p_ringbuf, const void* const p_item)
+{
+    return 0 != os_ringbuf_spsc_push_batch(p_ringbuf, p_item, 1);
+}
+
+ATTR_NONNULL(1, 2)
+uint32_t
+os_ringbuf_spsc_push_batch(os_ringbuf_spsc_t* const p_ringbuf, const void* const p_items, const uint32_t num_items)
+{
+    const uint32_t head     = atomic_load_explicit(&p_ringbuf->head, memory_order_relaxed);
+    const uint32_t tail     = atomic_load_explicit(&p_ringbuf->tail, memory_order_acquire);
+    const uint32_t num_free = (p_ringbuf->mask + 1U) - (head - tail);
+    const uint32_t num_push = os_ringbuf_min(num_items, num_free);
+    if (0 == num_push)
+    {
+        return 0;
+    }
+    os_ringbuf_copy_in(p_ringbuf->p_buf, p_ringbuf->item_size, p_ringbuf->mask, p_items, head, num_push);
+    atomic_store(&p_ringbuf->head, head + num_push);
+
+    // The tail is re-read after publishing the items: if the consumer has consumed everything up to 'head',
+    // then it could have already decided to wait, so it must be woken up.
+    if ((NULL != p_ringbuf->p_signal) && (head == atomic_load(&p_ringbuf->tail)))
+    {
+        (void)os_signal_send(p_ringbuf->p_signal, p_ringbuf->sig_num);
+    }
+    return num_push;
+}
+
+ATTR_NONNULL(1, 2)
+bool
+os_ringbuf_spsc_pop(os_ringbuf_spsc_t* const p_ringbuf, void* const p_item)
+{
+    return 0 != os_ringbuf_spsc_pop_batch(p_ringbuf, p_item, 1);
+}
+
+ATTR_NONNULL(1, 2)
+uint32_t
+os_ringbuf_spsc_pop_batch(os_ringbuf_spsc_t* const p_ringbuf, void* const p_items, const uint32_t max_num_items)
+{
+    const uint32_t tail    = atomic_load_explicit(&p_ringbuf->tail, memory_order_relaxed);
+    const uint32_t head    = atomic_load(&p_ringbuf->head);
+    const uint32_t num_pop = os_ringbuf_min(max_num_items, head - tail);
+    if (0 == num_pop)
+    {
+        return 0;
+    }
+    os_ringbuf_copy_out(p_ringbuf->p_buf, p_ringbuf->item_size, p_ringbuf->mask, p_items, tail, num_pop);
+    atomic_store(&p_ringbuf->tail, tail + num_pop);
+    return num_pop;
+}
+
+ATTR_NONNULL(1)
+uint32_t
+os_ringbuf_spsc_get_num_items(os_ringbuf_spsc_t* const p_ringbuf)
+{
+    const uint32_t tail = atomic_load(&p_ringbuf->tail);
+    const uint32_t head = atomic_load(&p_ringbuf->head);
+    return head - tail;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+os_ringbuf_mpsc_t*
+os_ringbuf_mpsc_create_static(
+    os_ringbuf_mpsc_static_t* const p_mem,
+    void* const                     p_buf,
+    const uint32_t                  item_size,
+    const uint32_t                  capacity,
+    os_signal_t* const              p_signal,
+    const os_signal_num_e           sig_num)
+{
+    if ((0 == item_size) || (!os_ringbuf_is_power_of_two(capacity)))
+    {
+        return NULL;
+    }
+    if (0 != ((uintptr_t)p_buf % sizeof(uint32_t)))
+    {
+        return NULL;
+    }
+    os_ringbuf_mpsc_t* const p_ringbuf = (os_ringbuf_mpsc_t*)p_mem;
+    memset(p_ringbuf, 0, sizeof(*p_ringbuf));
+    p_ringbuf->p_seq     = p_buf;
+    p_ringbuf->p_buf     = &((uint8_t*)p_buf)[sizeof(uint32_t) * capacity];
+    p_ringbuf->item_size = item_size;
+    p_ringbuf->mask      = capacity - 1U;
+    p_ringbuf->p_signal  = p_signal;
+    p_ringbuf->sig_num   = sig_num;
+    for (uint32_t i = 0; i < capacity; ++i)
+    {
+        // The slot is ready for reading when its sequence number is (position + 1),
+        // so the initial value 'i' marks the slot as not yet written for position 'i'.
+        atomic_init(&p_ringbuf->p_seq[i], i);
+    }
+    atomic_init(&p_ringbuf->head, 0);
+    atomic_init(&p_ringbuf->tail, 0);
+    return p_ringbuf;
+}
+
+ATTR_NONNULL(1, 2)
+bool
+os_ringbuf_mpsc_push(os_ringbuf_mpsc_t* const p_ringbuf, const void* const p_item)
+{
+    return 0 != os_ringbuf_mpsc_push_batch(p_ringbuf, p_item, 1);
+}
+
+ATTR_NONNULL(1, 2)
+uint32_t
+os_ringbuf_mpsc_push_batch(os_ringbuf_mpsc_t* const p_ringbuf, const void* const p_items, const uint32_t num_items)
+{
+    uint32_t head     = atomic_load_explicit(&p_ringbuf->head, memory_order_relaxed);
+    uint32_t num_push = 0;
+    do
+    {
+        // The tail is loaded after the head, so (head - tail) never exceeds the capacity.
+        const uint32_t tail     = atomic_load_explicit(&p_ringbuf->tail, memory_order_acquire);
+        const uint32_t num_free = (p_ringbuf->mask + 1U) - (head - tail);
+        num_push                = os_ringbuf_min(num_items, num_free);
+        if (0 == num_push)
+        {
+            return 0;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(
+        &p_ringbuf->head,
+        &head,
+        head + num_push,
+        memory_order_relaxed,
+        memory_order_relaxed));
+
+    os_ringbuf_copy_in(p_ringbuf->p_buf, p_ringbuf->item_size, p_ringbuf->mask, p_items, head, num_push);
+    for (uint32_t i = 0; i < num_push; ++i)
+    {
+        const uint32_t pos = head + i;
+        atomic_store(&p_ringbuf->p_seq[pos & p_ringbuf->mask], pos + 1U);
+    }
+
+    // Only the producer which owns the position the consumer is waiting for wakes it up.
+    if ((NULL != p_ringbuf->p_signal) && (head == atomic_load(&p_ringbuf->tail)))
+    {
+        (void)os_signal_send(p_ringbuf->p_signal, p_ringbuf->sig_num);
+    }
+    return num_push;
+}
+
+ATTR_NONNULL(1, 2)
+bool
+os_ringbuf_mpsc_pop(os_ringbuf_mpsc_t* const p_ringbuf, void* const p_item)
+{
+    return 0 != os_ringbuf_mpsc_pop_batch(p_ringbuf, p_item, 1);
+}
+
+ATTR_NONNULL(1, 2)
+uint32_t
+os_ringbuf_mpsc_pop_batch(os_ringbuf_mpsc_t* const p_ringbuf, void* const p_items, const uint32_t max_num_items)
+{
+    const uint32_t tail    = atomic_load_explicit(&p_ringbuf->tail, memory_order_relaxed);
+    uint32_t       num_pop = 0;
+    while (num_pop < max_num_items)
+    {
+        const uint32_t pos = tail + num_pop;
+        if ((pos + 1U) != atomic_load(&p_ringbuf->p_seq[pos & p_ringbuf->mask]))
+        {
+            break;
+        }
+        num_pop += 1;
+    }
+    if (0 == num_pop)
+    {
+        return 0;
+    }
+    os_ringbuf_copy_out(p_ringbuf->p_buf, p_ringbuf->item_size, p_ringbuf->mask, p_items, tail, num_pop);
+    atomic_store(&p_ringbuf->tail, tail + num_pop);
+    return num_pop;
+}
+
+ATTR_NONNULL(1)
+uint32_t
+os_ringbuf_mpsc_get_num_items(os_ringbuf_mpsc_t* const p_ringbuf)
+{
+    const uint32_t tail = atomic_load(&p_ringbuf->tail);
+    const uint32_t head = atomic_load(&p_ringbuf->head);
+    return head - tail;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file os_rwlock.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_rwlock.h"
+#include <assert.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "os_malloc.h"
+
+#if !configSUPPORT_STATIC_ALLOCATION
+#error os_rwlock requires configSUPPORT_STATIC_ALLOCATION to be enabled
+#endif
+
+/**
+ * The state of the lock is protected by h_mutex, which is held only for short periods of time.
+ * Binary semaphores h_sema_readers and h_sema_writers are used as wake-up events for the waiting tasks,
+ * after each wake-up the state is re-checked, so a stale event only causes an extra check.
+ */
+struct os_rwlock_t
+{
+    os_mutex_static_t mutex_mem;
+    os_sema_static_t  sema_readers_mem;
+    os_sema_static_t  sema_writers_mem;
+    os_mutex_t        h_mutex;
+    os_sema_t         h_sema_readers;
+    os_sema_t         h_sema_writers;
+    uint32_t          num_active_readers;
+    uint32_t          num_waiting_readers;
+    uint32_t          num_waiting_writers;
+    bool              is_writer_active;
+    bool              is_static;
+    os_rwlock_stat_t  stat;
+};
+
+_Static_assert(sizeof(os_rwlock_t) == sizeof(os_rwlock_static_t), "os_rwlock_t != os_rwlock_static_t");
+
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+static os_rwlock_t*
+os_rwlock_init(os_rwlock_t* const p_rwlock, const bool is_static)
+{
+    memset(p_rwlock, 0, sizeof(*p_rwlock));
+    p_rwlock->h_mutex        = os_mutex_create_static(&p_rwlock->mutex_mem);
+    p_rwlock->h_sema_readers = os_sema_create_static(&p_rwlock->sema_readers_mem);
+    p_rwlock->h_sema_writers = os_sema_create_static(&p_rwlock->sema_writers_mem);
+    p_rwlock->is_static      = is_static;
+    return p_rwlock;
+}
+
+ATTR_WARN_UNUSED_RESULT
+os_rwlock_t*
+os_rwlock_create(void)
+{
+    os_rwlock_t* const p_rwlock = os_calloc(1, sizeof(*p_rwlock));
+    if (NULL == p_rwlock)
+    {
+        return NULL;
+    }
+    const bool is_static = false;
+    return os_rwlock_init(p_rwlock, is_static);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+os_rwlock_t*
+os_rwlock_create_static(os_rwlock_static_t* const p_rwlock_mem)
+{
+    os_rwlock_t* const p_rwlock  = (os_rwlock_t*)p_rwlock_mem;
+    const bool         is_static = true;
+    return os_rwlock_init(p_rwlock, is_static);
+}
+
+ATTR_NONNULL(1)
+void
+os_rwlock_delete(os_rwlock_t** const pp_rwlock)
+{
+    os_rwlock_t* p_rwlock = *pp_rwlock;
+    if (NULL == p_rwlock)
+    {
+        return;
+    }
+    *pp_rwlock = NULL;
+    os_sema_delete(&p_rwlock->h_sema_writers);
+    os_sema_delete(&p_rwlock->h_sema_readers);
+    os_mutex_delete(&p_rwlock->h_mutex);
+    if (!p_rwlock->is_static)
+    {
+        os_free(p_rwlock);
+    }
+}
+
+static os_delta_ticks_t
+os_rwlock_calc_remaining_ticks(const TickType_t tick_start, const os_delta_ticks_t ticks_to_wait)
+{
+    if (OS_DELTA_TICKS_INFINITE == ticks_to_wait)
+    {
+        return OS_DELTA_TICKS_INFINITE;
+    }
+    const os_delta_ticks_t delta_ticks = xTaskGetTickCount() - tick_start;
+    return (delta_ticks < ticks_to_wait) ? (ticks_to_wait - delta_ticks) : 0;
+}
+
+ATTR_NONNULL(1)
+static bool
+os_rwlock_is_read_blocked(const os_rwlock_t* const p_rwlock)
+{
+    return p_rwlock->is_writer_active || (0 != p_rwlock->num_waiting_writers);
+}
+
+ATTR_NONNULL(1)
+static bool
+os_rwlock_is_write_blocked(const os_rwlock_t* const p_rwlock)
+{
+    return p_rwlock->is_writer_active || (0 != p_rwlock->num_active_readers);
+}
+
+ATTR_NONNULL(1)
+bool
+os_rwlock_read_lock_with_timeout(os_rwlock_t* const p_rwlock, const os_delta_ticks_t ticks_to_wait)
+{
+    const TickType_t tick_start = xTaskGetTickCount();
+    os_mutex_lock(p_rwlock->h_mutex);
+    if (os_rwlock_is_read_blocked(p_rwlock))
+    {
+        p_rwlock->stat.num_read_contentions += 1;
+    }
+    while (os_rwlock_is_read_blocked(p_rwlock))
+    {
+        p_rwlock->num_waiting_readers += 1;
+        os_mutex_unlock(p_rwlock->h_mutex);
+        const bool is_signaled = os_sema_wait_with_timeout(
+            p_rwlock->h_sema_readers,
+            os_rwlock_calc_remaining_ticks(tick_start, ticks_to_wait));
+        os_mutex_lock(p_rwlock->h_mutex);
+        p_rwlock->num_waiting_readers -= 1;
+        if (!is_signaled)
+        {
+            p_rwlock->stat.num_read_timeouts += 1;
+            os_mutex_unlock(p_rwlock->h_mutex);
+            return false;
+        }
+    }
+    p_rwlock->num_active_readers += 1;
+    p_rwlock->stat.num_read_locks += 1;
+    if (0 != p_rwlock->num_waiting_readers)
+    {
+        // Wake up the next waiting reader, it will wake up the following one and so on.
+        os_sema_signal(p_rwlock->h_sema_readers);
+    }
+    os_mutex_unlock(p_rwlock->h_mutex);
+    return true;
+}
+
+ATTR_NONNULL(1)
+void
+os_rwlock_read_lock(os_rwlock_t* const p_rwlock)
+{
+    if (!os_rwlock_read_lock_with_timeout(p_rwlock, OS_DELTA_TICKS_INFINITE))
+    {
+        assert(0);
+    }
+}
+
+ATTR_NONNULL(1)
+bool
+os_rwlock_read_try_lock(os_rwlock_t* const p_rwlock)
+{
+    return os_rwlock_read_lock_with_timeout(p_rwlock, OS_DELTA_TICKS_IMMEDIATE);
+}
+
+ATTR_NONNULL(1)
+void
+os_rwlock_read_unlock(os_rwlock_t* const p_rwlock)
+{
+    os_mutex_lock(p_rwlock->h_mutex);
+    assert(0 != p_rwlock->num_active_readers);
+    p_rwlock->num_active_readers -= 1;
+    if ((0 == p_rwlock->num_active_readers) && (0 != p_rwlock->num_waiting_writers))
+    {
+        os_sema_signal(p_rwlock->h_sema_writers);
+    }
+    os_mutex_unlock(p_rwlock->h_mutex);
+}
+
+ATTR_NONNULL(1)
+bool
+os_rwlock_write_lock_with_timeout(os_rwlock_t* const p_rwlock, const os_delta_ticks_t ticks_to_wait)
+{
+    const TickType_t tick_start = xTaskGetTickCount();
+    os_mutex_lock(p_rwlock->h_mutex);
+    if (os_rwlock_is_write_blocked(p_rwlock))
+    {
+        p_rwlock->stat.num_write_contentions += 1;
+    }
+    while (os_rwlock_is_write_blocked(p_rwlock))
+    {
+        p_rwlock->num_waiting_writers += 1;
+        os_mutex_unlock(p_rwlock->h_mutex);
+        const bool is_signaled = os_sema_wait_with_timeout(
+            p_rwlock->h_sema_writers,
+            os_rwlock_calc_remaining_ticks(tick_start, ticks_to_wait));
+        os_mutex_lock(p_rwlock->h_mutex);
+        p_rwlock->num_waiting_writers -= 1;
+        if (!is_signaled)
+        {
+            p_rwlock->stat.num_write_timeouts += 1;
+            if (!os_rwlock_is_read_blocked(p_rwlock) && (0 != p_rwlock->num_waiting_readers))
+            {
+                // The readers were blocked only because of this writer
+                os_sema_signal(p_rwlock->h_sema_readers);
+            }
+            os_mutex_unlock(p_rwlock->h_mutex);
+            return false;
+        }
+    }
+    p_rwlock->is_writer_active = true;
+    p_rwlock->stat.num_write_locks += 1;
+    os_mutex_unlock(p_rwlock->h_mutex);
+    return true;
+}
+
+ATTR_NONNULL(1)
+void
+os_rwlock_write_lock(os_rwlock_t* const p_rwlock)
+{
+    if (!os_rwlock_write_lock_with_timeout(p_rwlock, OS_DELTA_TICKS_INFINITE))
+    {
+        assert(0);
+    }
+}
+
+ATTR_NONNULL(1)
+bool
+os_rwlock_write_try_lock(os_rwlock_t* const p_rwlock)
+{
+    return os_rwlock_write_lock_with_timeout(p_rwlock, OS_DELTA_TICKS_IMMEDIATE);
+}
+
+ATTR_NONNULL(1)
+void
+os_rwlock_write_unlock(os_rwlock_t* const p_rwlock)
+{
+    os_mutex_lock(p_rwlock->h_mutex);
+    assert(p_rwlock->is_writer_active);
+    p_rwlock->is_writer_active = false;
+    if (0 != p_rwlock->num_waiting_writers)
+    {
+        os_sema_signal(p_rwlock->h_sema_writers);
+    }
+    else if (0 != p_rwlock->num_waiting_readers)
+    {
+        os_sema_signal(p_rwlock->h_sema_readers);
+    }
+    os_mutex_unlock(p_rwlock->h_mutex);
+}
+
+ATTR_NONNULL(1, 2)
+void
+os_rwlock_get_stat(os_rwlock_t* const p_rwlock, os_rwlock_stat_t* const p_stat)
+{
+    os_mutex_lock(p_rwlock->h_mutex);
+    *p_stat = p_rwlock->stat;
+    os_mutex_unlock(p_rwlock->h_mutex);
+}
+
+ATTR_NONNULL(1)
+void
+os_rwlock_reset_stat(os_rwlock_t* const p_rwlock)
+{
+    os_mutex_lock(p_rwlock->h_mutex);
+    memset(&p_rwlock->stat, 0, sizeof(p_rwlock->stat));
+    os_mutex_unlock(p_rwlock->h_mutex);
+}
@@ -7,12 +7,28 @@
 
 #include "os_sema.h"
 #include <assert.h>
+#include "os_lock_prof.h"
 
 ATTR_WARN_UNUSED_RESULT
 os_sema_t
 os_sema_create(void)
+{
+    return os_sema_create_named(NULL);
+}
+
+ATTR_WARN_UNUSED_RESULT
+os_sema_t
+os_sema_create_named(const char* const p_name)
 {
     SemaphoreHandle_t h_sema = xSemaphoreCreateBinary();
+#if OS_LOCK_PROF
+    if (NULL != h_sema)
+    {
+        os_lock_prof_register(h_sema, p_name, OS_LOCK_PROF_TYPE_SEMA);
+    }
+#else
+    (void)p_name;
+#endif
     return h_sema;
 }
 
@@ -22,8 +38,22 @@ ATTR_NONNULL(1)
 ATTR_RETURNS_NONNULL
 os_sema_t
 os_sema_create_static(os_sema_static_t* const p_sema_static)
+{
+    return os_sema_create_static_named(p_sema_static, NULL);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1)
+ATTR_RETURNS_NONNULL
+os_sema_t
+os_sema_create_static_named(os_sema_static_t* const p_sema_static, const char* const p_name)
 {
     SemaphoreHandle_t h_sema = xSemaphoreCreateBinaryStatic(p_sema_static);
+#if OS_LOCK_PROF
+    os_lock_prof_register(h_sema, p_name, OS_LOCK_PROF_TYPE_SEMA);
+#else
+    (void)p_name;
+#endif
     return h_sema;
 }
 #endif
@@ -34,22 +64,35 @@ os_sema_delete(os_sema_t* const ph_sema)
 {
     if (NULL != *ph_sema)
     {
+#if OS_LOCK_PROF
+        os_lock_prof_unregister(*ph_sema);
+#endif
         vSemaphoreDelete(*ph_sema);
         *ph_sema = NULL;
     }
 }
 
-bool
-os_sema_wait_with_timeout(os_sema_t const h_sema, const os_delta_ticks_t ticks_to_wait)
+static bool
+os_sema_take(void* const h_sema, const os_delta_ticks_t ticks_to_wait)
 {
-    assert(NULL != h_sema);
-    if (pdTRUE != xSemaphoreTake(h_sema, ticks_to_wait))
+    if (pdTRUE != xSemaphoreTake((os_sema_t)h_sema, ticks_to_wait))
     {
         return false;
     }
     return true;
 }
 
+bool
+os_sema_wait_with_timeout(os_sema_t const h_sema, const os_delta_ticks_t ticks_to_wait)
+{
+    assert(NULL != h_sema);
+#if OS_LOCK_PROF
+    return os_lock_prof_take(h_sema, ticks_to_wait, &os_sema_take);
+#else
+    return os_sema_take(h_sema, ticks_to_wait);
+#endif
+}
+
 void
 os_sema_wait_infinite(os_sema_t const h_sema)
 {
@@ -12,11 +12,35 @@
 #include "freertos/task.h"
 #include "os_malloc.h"
 
+#if OS_SIGNAL_LATENCY
+#include <string.h>
+#include "time_units.h"
+
+#define OS_SIGNAL_HAS_ESP_TIMER 0
+
+#if defined __has_include
+#if __has_include("esp_timer.h")
+#undef OS_SIGNAL_HAS_ESP_TIMER
+#define OS_SIGNAL_HAS_ESP_TIMER 1
+#endif
+#endif
+
+#if OS_SIGNAL_HAS_ESP_TIMER
+#include "esp_timer.h"
+#endif
+
+#define OS_SIGNAL_LATENCY_PERCENT_MAX (100U)
+#endif
+
 struct os_signal_t
 {
     os_task_handle_t task_handle;
     uint32_t         sig_mask;
     bool             is_static;
+#if OS_SIGNAL_LATENCY
+    uint32_t                 send_timestamp_us; //!< timestamp of the first send which is not received yet or 0
+    os_signal_latency_stat_t latency;
+#endif
 };
 
 _Static_assert(sizeof(os_signal_t) == sizeof(os_signal_static_t), "os_signal_t != os_signal_static_t");
@@ -28,9 +52,136 @@ os_signal_init(os_signal_t* const p_signal, const bool is_static)
     p_signal->task_handle = NULL;
     p_signal->sig_mask    = 0x0U;
     p_signal->is_static   = is_static;
+#if OS_SIGNAL_LATENCY
+    p_signal->send_timestamp_us = 0;
+    memset(&p_signal->latency, 0, sizeof(p_signal->latency));
+#endif
     return p_signal;
 }
 
+#if OS_SIGNAL_LATENCY
+
+static uint32_t
+os_signal_latency_default_clock_us(void)
+{
+#if OS_SIGNAL_HAS_ESP_TIMER
+    return (uint32_t)esp_timer_get_time();
+#else
+    const TickType_t tick = xPortInIsrContext() ? xTaskGetTickCountFromISR() : xTaskGetTickCount();
+    return (uint32_t)time_units_conv_ticks_to_us(tick, configTICK_RATE_HZ);
+#endif
+}
+
+static os_signal_latency_clock_us_t g_p_os_signal_latency_clock_us = &os_signal_latency_default_clock_us;
+
+void
+os_signal_latency_set_clock(const os_signal_latency_clock_us_t p_clock_us)
+{
+    g_p_os_signal_latency_clock_us = (NULL != p_clock_us) ? p_clock_us : &os_signal_latency_default_clock_us;
+}
+
+ATTR_NONNULL(1)
+static void
+os_signal_latency_on_send(os_signal_t* const p_signal)
+{
+    uint32_t timestamp_us = g_p_os_signal_latency_clock_us();
+    if (0 == timestamp_us)
+    {
+        timestamp_us = 1; // 0 is reserved for "no pending send"
+    }
+    // Only the first send is timestamped until the waiting task receives the signal
+    uint32_t expected_timestamp_us = 0;
+    (void)__atomic_compare_exchange_n(
+        &p_signal->send_timestamp_us,
+        &expected_timestamp_us,
+        timestamp_us,
+        false,
+        __ATOMIC_RELEASE,
+        __ATOMIC_RELAXED);
+}
+
+ATTR_CONST
+static uint32_t
+os_signal_latency_get_bucket_idx(const uint32_t latency_us)
+{
+    if (latency_us < 2U)
+    {
+        return 0;
+    }
+    const uint32_t bucket_idx = (uint32_t)(31 - __builtin_clz(latency_us));
+    return (bucket_idx < OS_SIGNAL_LATENCY_NUM_BUCKETS) ? bucket_idx : (OS_SIGNAL_LATENCY_NUM_BUCKETS - 1U);
+}
+
+ATTR_NONNULL(1)
+static void
+os_signal_latency_on_wake(os_signal_t* const p_signal)
+{
+    const uint32_t send_timestamp_us = __atomic_exchange_n(&p_signal->send_timestamp_us, 0, __ATOMIC_ACQUIRE);
+    if (0 == send_timestamp_us)
+    {
+        return;
+    }
+    const uint32_t            latency_us = g_p_os_signal_latency_clock_us() - send_timestamp_us;
+    os_signal_latency_stat_t* p_stat     = &p_signal->latency;
+    if ((0 == p_stat->num_samples) || (latency_us < p_stat->min_us))
+    {
+        p_stat->min_us = latency_us;
+    }
+    if (latency_us > p_stat->max_us)
+    {
+        p_stat->max_us = latency_us;
+    }
+    p_stat->num_samples += 1;
+    p_stat->total_us += latency_us;
+    p_stat->hist[os_signal_latency_get_bucket_idx(latency_us)] += 1;
+}
+
+ATTR_NONNULL(1, 2)
+void
+os_signal_latency_get_stat(const os_signal_t* const p_signal, os_signal_latency_stat_t* const p_stat)
+{
+    *p_stat = p_signal->latency;
+}
+
+ATTR_NONNULL(1)
+void
+os_signal_latency_reset(os_signal_t* const p_signal)
+{
+    memset(&p_signal->latency, 0, sizeof(p_signal->latency));
+}
+
+ATTR_NONNULL(1)
+ATTR_PURE
+uint32_t
+os_signal_latency_get_percentile_us(const os_signal_latency_stat_t* const p_stat, const uint32_t percent)
+{
+    if (0 == p_stat->num_samples)
+    {
+        return 0;
+    }
+    uint32_t percent_limited = percent;
+    if (percent_limited > OS_SIGNAL_LATENCY_PERCENT_MAX)
+    {
+        percent_limited = OS_SIGNAL_LATENCY_PERCENT_MAX;
+    }
+    const uint64_t num_scaled = (uint64_t)p_stat->num_samples * percent_limited;
+    const uint64_t rank       = (num_scaled + OS_SIGNAL_LATENCY_PERCENT_MAX - 1U) / OS_SIGNAL_LATENCY_PERCENT_MAX;
+
+    uint64_t cnt = 0;
+    for (uint32_t i = 0; i < (OS_SIGNAL_LATENCY_NUM_BUCKETS - 1U); ++i)
+    {
+        cnt += p_stat->hist[i];
+        if ((0 != cnt) && (cnt >= rank))
+        {
+            const uint32_t upper_bound_us = (2U << i) - 1U;
+            return (upper_bound_us < p_stat->max_us) ? upper_bound_us : p_stat->max_us;
+        }
+    }
+    return p_stat->max_us;
+}
+
+#endif // OS_SIGNAL_LATENCY
+
 os_signal_t*
 os_signal_create(void)
 {
@@ -174,6 +325,11 @@ os_signal_send(os_signal_t* const p_signal, const os_signal_num_e sig_num)
         return false;
     }
 
+#if OS_SIGNAL_LATENCY
+    // The timestamp is taken before the notification, because the waiting task may preempt the current one
+    os_signal_latency_on_send(p_signal);
+#endif
+
     BaseType_t flag_higher_priority_task_woken = pdFALSE;
 
     if (xPortInIsrContext())
@@ -224,6 +380,9 @@ os_signal_wait_with_sig_mask(
     {
         return false;
     }
+#if OS_SIGNAL_LATENCY
+    os_signal_latency_on_wake(p_signal);
+#endif
 
     p_sig_events->sig_mask = sig_mask & sig_mask_to_wait;
     p_sig_events->last_ofs = 0;
@@ -7,10 +7,40 @@
 
 #include "os_str.h"
 #include <stdlib.h>
+#include <float.h>
+
+#define OS_STR_BASE_DEC (10U)
+#define OS_STR_BASE_HEX (16U)
+
+#define OS_STR_FLOAT_MAX_MANTISSA (1000000000000000000ULL) // 10^18, up to 19 significant digits are used
+#define OS_STR_FLOAT_MAX_EXP10    (400)
+
+// 2^24 and 10^10 are exactly representable in float, so mantissa * 10^exp10 is rounded only once
+#define OS_STR_FLOAT_FAST_MAX_MANTISSA (1UL << (uint32_t)FLT_MANT_DIG)
+#define OS_STR_FLOAT_FAST_MAX_EXP10    (10)
+
+// mantissa < 10^19, so for exp10 < -65 the value is less than 10^-46 and it is rounded to zero
+#define OS_STR_FLOAT_POW10_MAX (65)
+// mantissa >= 1, so for exp10 > 38 the value is greater than FLT_MAX
+#define OS_STR_FLOAT_MAX_POS_EXP10 (FLT_MAX_10_EXP)
+
+// FLT_MAX + half ULP: strtof rounds the values starting from this boundary to infinity
+#define OS_STR_FLOAT_OVERFLOW_THRESHOLD ((double)FLT_MAX + 0x1p103)
 
 typedef unsigned long os_strtoul_result_t;
 typedef long          os_strtol_result_t;
 
+static const float g_os_str_pow10_flt[OS_STR_FLOAT_FAST_MAX_EXP10 + 1] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+};
+
+static const double g_os_str_pow10[OS_STR_FLOAT_POW10_MAX + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16,
+    1e17, 1e18, 1e19, 1e20, 1e21, 1e22, 1e23, 1e24, 1e25, 1e26, 1e27, 1e28, 1e29, 1e30, 1e31, 1e32, 1e33,
+    1e34, 1e35, 1e36, 1e37, 1e38, 1e39, 1e40, 1e41, 1e42, 1e43, 1e44, 1e45, 1e46, 1e47, 1e48, 1e49, 1e50,
+    1e51, 1e52, 1e53, 1e54, 1e55, 1e56, 1e57, 1e58, 1e59, 1e60, 1e61, 1e62, 1e63, 1e64, 1e65,
+};
+
 ATTR_NONNULL(1)
 uint32_t
 os_str_to_uint32_cptr(
@@ -72,3 +102,392 @@ os_str_to_int32(char* __restrict const p_str, char** __restrict const pp_end, co
     }
     return (int32_t)result;
 }
+
+static uint32_t
+os_str_get_dec_digit(const char ch)
+{
+    // The unsigned subtraction maps all non-digit characters to values greater than 9
+    return (uint32_t)(uint8_t)ch - (uint32_t)'0';
+}
+
+/**
+ * @brief Parse a sequence of digits.
+ * @param p_str - ptr to the input string.
+ * @param len - the max number of characters to parse.
+ * @param base - OS_STR_BASE_DEC or OS_STR_BASE_HEX.
+ * @param max_val - the max allowed value.
+ * @param[out] p_num_chars - the number of parsed digits (it is 0 if there are no digits).
+ * @param[out] p_val - ptr to the output variable.
+ * @return true if successful, false if there are no digits or the value is greater than max_val.
+ */
+static bool
+os_str_parse_digits(
+    const char* const p_str,
+    const size_t      len,
+    const uint32_t    base,
+    const uint64_t    max_val,
+    size_t* const     p_num_chars,
+    uint64_t* const   p_val)
+{
+    const uint64_t max_val_div_base = max_val / base;
+    const uint32_t max_last_digit   = (uint32_t)(max_val % base);
+
+    uint64_t val = 0;
+    size_t   idx = 0;
+    for (; idx < len; ++idx)
+    {
+        const uint32_t digit = (OS_STR_BASE_DEC == base) ? os_str_get_dec_digit(p_str[idx])
+                                                         : os_str_get_hex_digit(p_str[idx]);
+        if (digit >= base)
+        {
+            break;
+        }
+        if ((val > max_val_div_base) || ((val == max_val_div_base) && (digit > max_last_digit)))
+        {
+            *p_num_chars = idx + 1;
+            return false;
+        }
+        val = (val * base) + digit;
+    }
+    *p_num_chars = idx;
+    if (0 == idx)
+    {
+        return false;
+    }
+    *p_val = val;
+    return true;
+}
+
+static bool
+os_str_parse_unsigned(
+    const char* const  p_str,
+    const size_t       len,
+    const uint32_t     base,
+    const uint64_t     max_val,
+    const char** const pp_end,
+    uint64_t* const    p_val)
+{
+    size_t offset = 0;
+    if ((OS_STR_BASE_HEX == base) && (len > 2) && ('0' == p_str[0]) && ('x' == ((uint8_t)p_str[1] | 0x20U))
+        && (OS_STR_HEX_DIGIT_INVALID != os_str_get_hex_digit(p_str[2])))
+    {
+        offset = 2;
+    }
+    size_t num_chars = 0;
+    if (!os_str_parse_digits(&p_str[offset], len - offset, base, max_val, &num_chars, p_val))
+    {
+        if (NULL != pp_end)
+        {
+            *pp_end = p_str;
+        }
+        return false;
+    }
+    if (NULL != pp_end)
+    {
+        *pp_end = &p_str[offset + num_chars];
+    }
+    return true;
+}
+
+/**
+ * @brief Parse an optional sign and the absolute value of a signed decimal integer.
+ * @param max_val - the max allowed positive value, the max allowed absolute value of a negative value is max_val + 1.
+ */
+static bool
+os_str_parse_signed(
+    const char* const  p_str,
+    const size_t       len,
+    const uint64_t     max_val,
+    const char** const pp_end,
+    bool* const        p_is_negative,
+    uint64_t* const    p_abs_val)
+{
+    size_t offset = 0;
+
+    *p_is_negative = false;
+    if ((len > 0) && (('-' == p_str[0]) || ('+' == p_str[0])))
+    {
+        *p_is_negative = '-' == p_str[0];
+        offset         = 1;
+    }
+    size_t num_chars = 0;
+    if (!os_str_parse_digits(
+            &p_str[offset],
+            len - offset,
+            OS_STR_BASE_DEC,
+            *p_is_negative ? (max_val + 1U) : max_val,
+            &num_chars,
+            p_abs_val))
+    {
+        if (NULL != pp_end)
+        {
+            *pp_end = p_str;
+        }
+        return false;
+    }
+    if (NULL != pp_end)
+    {
+        *pp_end = &p_str[offset + num_chars];
+    }
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_uint32_dec(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    uint32_t* __restrict const    p_val)
+{
+    uint64_t val = 0;
+    if (!os_str_parse_unsigned(p_str, len, OS_STR_BASE_DEC, UINT32_MAX, pp_end, &val))
+    {
+        return false;
+    }
+    *p_val = (uint32_t)val;
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_uint32_hex(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    uint32_t* __restrict const    p_val)
+{
+    uint64_t val = 0;
+    if (!os_str_parse_unsigned(p_str, len, OS_STR_BASE_HEX, UINT32_MAX, pp_end, &val))
+    {
+        return false;
+    }
+    *p_val = (uint32_t)val;
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_int32_dec(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    int32_t* __restrict const     p_val)
+{
+    bool     is_negative = false;
+    uint64_t abs_val     = 0;
+    if (!os_str_parse_signed(p_str, len, INT32_MAX, pp_end, &is_negative, &abs_val))
+    {
+        return false;
+    }
+    *p_val = is_negative ? (int32_t)(-(int64_t)abs_val) : (int32_t)abs_val;
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_uint64_dec(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    uint64_t* __restrict const    p_val)
+{
+    return os_str_parse_unsigned(p_str, len, OS_STR_BASE_DEC, UINT64_MAX, pp_end, p_val);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_uint64_hex(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    uint64_t* __restrict const    p_val)
+{
+    return os_str_parse_unsigned(p_str, len, OS_STR_BASE_HEX, UINT64_MAX, pp_end, p_val);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_int64_dec(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    int64_t* __restrict const     p_val)
+{
+    bool     is_negative = false;
+    uint64_t abs_val     = 0;
+    if (!os_str_parse_signed(p_str, len, INT64_MAX, pp_end, &is_negative, &abs_val))
+    {
+        return false;
+    }
+    // abs_val can be 2^63 for a negative value, so it is negated without the overflow of int64_t
+    *p_val = is_negative ? (-(int64_t)(abs_val - 1U) - 1) : (int64_t)abs_val;
+    return true;
+}
+
+/**
+ * @brief Parse decimal exponent in format (e|E)[+-]digits.
+ * @return the number of parsed characters or 0 if there is no valid exponent.
+ */
+static size_t
+os_str_parse_float_exp(const char* const p_str, const size_t len, int32_t* const p_exp10)
+{
+    if ((0 == len) || ('e' != ((uint8_t)p_str[0] | 0x20U)))
+    {
+        return 0;
+    }
+    size_t idx         = 1;
+    bool   is_negative = false;
+    if ((idx < len) && (('-' == p_str[idx]) || ('+' == p_str[idx])))
+    {
+        is_negative = '-' == p_str[idx];
+        idx += 1;
+    }
+    const size_t idx_digits = idx;
+    int32_t      exp10      = 0;
+    for (; idx < len; ++idx)
+    {
+        const uint32_t digit = os_str_get_dec_digit(p_str[idx]);
+        if (digit >= OS_STR_BASE_DEC)
+        {
+            break;
+        }
+        if (exp10 < OS_STR_FLOAT_MAX_EXP10)
+        {
+            exp10 = (exp10 * (int32_t)OS_STR_BASE_DEC) + (int32_t)digit;
+        }
+    }
+    if (idx == idx_digits)
+    {
+        return 0;
+    }
+    *p_exp10 = is_negative ? -exp10 : exp10;
+    return idx;
+}
+
+/**
+ * @brief Calculate mantissa * 10^exp10 and round it to float.
+ * @return false if the value is out of range of float.
+ */
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(3)
+static bool
+os_str_parse_float_scale(const uint64_t mantissa, const int32_t exp10, float* const p_val)
+{
+    if ((mantissa <= OS_STR_FLOAT_FAST_MAX_MANTISSA) && (exp10 >= -OS_STR_FLOAT_FAST_MAX_EXP10)
+        && (exp10 <= OS_STR_FLOAT_FAST_MAX_EXP10))
+    {
+        // The fast path uses only single precision (it is supported by FPU on ESP32),
+        // both operands are exact, so the result is correctly rounded.
+        const float val = (float)mantissa;
+        *p_val          = (exp10 >= 0) ? (val * g_os_str_pow10_flt[exp10]) : (val / g_os_str_pow10_flt[-exp10]);
+        return true;
+    }
+    if ((0 == mantissa) || (exp10 < -OS_STR_FLOAT_POW10_MAX))
+    {
+        *p_val = 0.0f;
+        return true;
+    }
+    if (exp10 > OS_STR_FLOAT_MAX_POS_EXP10)
+    {
+        return false;
+    }
+    // A single double precision operation, the result is rounded twice (to double and then to float)
+    const double val = (exp10 >= 0) ? ((double)mantissa * g_os_str_pow10[exp10])
+                                    : ((double)mantissa / g_os_str_pow10[-exp10]);
+    if (val >= OS_STR_FLOAT_OVERFLOW_THRESHOLD)
+    {
+        return false;
+    }
+    *p_val = (float)val;
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 4)
+bool
+os_str_parse_float(
+    const char* __restrict const  p_str,
+    const size_t                  len,
+    const char** __restrict const pp_end,
+    float* __restrict const       p_val)
+{
+    size_t idx         = 0;
+    bool   is_negative = false;
+    if ((len > 0) && (('-' == p_str[0]) || ('+' == p_str[0])))
+    {
+        is_negative = '-' == p_str[0];
+        idx         = 1;
+    }
+
+    uint64_t mantissa    = 0;
+    int32_t  exp10       = 0;
+    size_t   num_digits  = 0;
+    bool     is_fraction = false;
+    for (; idx < len; ++idx)
+    {
+        if ((!is_fraction) && ('.' == p_str[idx]))
+        {
+            is_fraction = true;
+            continue;
+        }
+        const uint32_t digit = os_str_get_dec_digit(p_str[idx]);
+        if (digit >= OS_STR_BASE_DEC)
+        {
+            break;
+        }
+        num_digits += 1;
+        if (mantissa < OS_STR_FLOAT_MAX_MANTISSA)
+        {
+            mantissa = (mantissa * OS_STR_BASE_DEC) + digit;
+            exp10 -= is_fraction ? 1 : 0;
+        }
+        else
+        {
+            // The insignificant digits are dropped
+            exp10 += is_fraction ? 0 : 1;
+        }
+    }
+    if (0 == num_digits)
+    {
+        if (NULL != pp_end)
+        {
+            *pp_end = p_str;
+        }
+        return false;
+    }
+
+    int32_t exp10_suffix = 0;
+    idx += os_str_parse_float_exp(&p_str[idx], len - idx, &exp10_suffix);
+    exp10 += exp10_suffix;
+    if (exp10 > OS_STR_FLOAT_MAX_EXP10)
+    {
+        exp10 = OS_STR_FLOAT_MAX_EXP10;
+    }
+    else if (exp10 < -OS_STR_FLOAT_MAX_EXP10)
+    {
+        exp10 = -OS_STR_FLOAT_MAX_EXP10;
+    }
+
+    float val = 0.0f;
+    if (!os_str_parse_float_scale(mantissa, exp10, &val))
+    {
+        if (NULL != pp_end)
+        {
+            *pp_end = p_str;
+        }
+        return false;
+    }
+    if (NULL != pp_end)
+    {
+        *pp_end = &p_str[idx];
+    }
+    *p_val = is_negative ? -val : val;
+    return true;
+}
@@ -0,0 +1,268 @@
+/**
+ * @file os_str_view.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_str_view.h"
+#include <string.h>
+#include "os_str.h"
+
+
+ATTR_NONNULL(1)
+os_str_view_t
+os_str_view_from_cstr(const char* const p_str)
+{
+    return OS_STR_VIEW_INIT(p_str, strlen(p_str));
+}
+
+ATTR_NONNULL(1)
+bool
+os_str_view_is_empty(const os_str_view_t* const p_view)
+{
+    return 0 == p_view->len;
+}
+
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_is_equal_cstr(const os_str_view_t* const p_view, const char* const p_str)
+{
+    return (strlen(p_str) == p_view->len) && (0 == memcmp(p_view->p_str, p_str, p_view->len));
+}
+
+ATTR_NONNULL(1)
+void
+os_str_view_skip(os_str_view_t* const p_view, const size_t num_chars)
+{
+    const size_t num_skipped = (num_chars < p_view->len) ? num_chars : p_view->len;
+    p_view->p_str += num_skipped;
+    p_view->len -= num_skipped;
+}
+
+ATTR_NONNULL(1)
+void
+os_str_view_skip_spaces(os_str_view_t* const p_view)
+{
+    size_t idx = 0;
+    while ((idx < p_view->len) && ((' ' == p_view->p_str[idx]) || ('\t' == p_view->p_str[idx])))
+    {
+        idx += 1;
+    }
+    os_str_view_skip(p_view, idx);
+}
+
+ATTR_NONNULL(1)
+bool
+os_str_view_consume_char(os_str_view_t* const p_view, const char ch)
+{
+    if ((0 == p_view->len) || (ch != p_view->p_str[0]))
+    {
+        return false;
+    }
+    os_str_view_skip(p_view, 1);
+    return true;
+}
+
+ATTR_NONNULL(1, 3)
+bool
+os_str_view_split(os_str_view_t* const p_view, const char delimiter, os_str_view_t* const p_token)
+{
+    if (0 == p_view->len)
+    {
+        return false;
+    }
+    const char* const p_delimiter = memchr(p_view->p_str, delimiter, p_view->len);
+    if (NULL == p_delimiter)
+    {
+        *p_token = *p_view;
+        os_str_view_skip(p_view, p_view->len);
+        return true;
+    }
+    const size_t token_len = (size_t)(p_delimiter - p_view->p_str);
+    *p_token               = OS_STR_VIEW_INIT(p_view->p_str, token_len);
+    os_str_view_skip(p_view, token_len + 1);
+    return true;
+}
+
+/**
+ * @brief Advance the view to the position returned by os_str_parse_* function.
+ */
+static void
+os_str_view_advance_to(os_str_view_t* const p_view, const char* const p_end)
+{
+    os_str_view_skip(p_view, (size_t)(p_end - p_view->p_str));
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_uint32(os_str_view_t* const p_view, uint32_t* const p_val)
+{
+    const char* p_end = NULL;
+    if (!os_str_parse_uint32_dec(p_view->p_str, p_view->len, &p_end, p_val))
+    {
+        return false;
+    }
+    os_str_view_advance_to(p_view, p_end);
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_uint32_hex(os_str_view_t* const p_view, uint32_t* const p_val)
+{
+    const char* p_end = NULL;
+    if (!os_str_parse_uint32_hex(p_view->p_str, p_view->len, &p_end, p_val))
+    {
+        return false;
+    }
+    os_str_view_advance_to(p_view, p_end);
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_int32(os_str_view_t* const p_view, int32_t* const p_val)
+{
+    const char* p_end = NULL;
+    if (!os_str_parse_int32_dec(p_view->p_str, p_view->len, &p_end, p_val))
+    {
+        return false;
+    }
+    os_str_view_advance_to(p_view, p_end);
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_uint64(os_str_view_t* const p_view, uint64_t* const p_val)
+{
+    const char* p_end = NULL;
+    if (!os_str_parse_uint64_dec(p_view->p_str, p_view->len, &p_end, p_val))
+    {
+        return false;
+    }
+    os_str_view_advance_to(p_view, p_end);
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_float(os_str_view_t* const p_view, float* const p_val)
+{
+    const char* p_end = NULL;
+    if (!os_str_parse_float(p_view->p_str, p_view->len, &p_end, p_val))
+    {
+        return false;
+    }
+    os_str_view_advance_to(p_view, p_end);
+    return true;
+}
+
+static bool
+os_str_view_consume_prefix(os_str_view_t* const p_view, const char* const p_prefix, const size_t prefix_len)
+{
+    if ((p_view->len < prefix_len) || (0 != memcmp(p_view->p_str, p_prefix, prefix_len)))
+    {
+        return false;
+    }
+    os_str_view_skip(p_view, prefix_len);
+    return true;
+}
+
+/**
+ * @brief Check if the view is empty or it starts with a delimiter (any character except letters, digits, '_' and '.').
+ */
+static bool
+os_str_view_is_at_token_end(const os_str_view_t* const p_view)
+{
+    if (0 == p_view->len)
+    {
+        return true;
+    }
+    const char     ch        = p_view->p_str[0];
+    const uint32_t alpha_idx = ((uint32_t)(uint8_t)ch | 0x20U) - (uint32_t)'a';
+    const uint32_t dec_digit = (uint32_t)(uint8_t)ch - (uint32_t)'0';
+    return (alpha_idx >= 26U) && (dec_digit > 9U) && ('_' != ch) && ('.' != ch);
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_bool(os_str_view_t* const p_view, bool* const p_val)
+{
+    os_str_view_t view = *p_view;
+    bool          val  = false;
+    if (os_str_view_consume_prefix(&view, "true", strlen("true")) || os_str_view_consume_char(&view, '1'))
+    {
+        val = true;
+    }
+    else if (os_str_view_consume_prefix(&view, "false", strlen("false")) || os_str_view_consume_char(&view, '0'))
+    {
+        val = false;
+    }
+    else
+    {
+        return false;
+    }
+    // The token must not be a prefix of a longer word or number, e.g. "trueish" or "10"
+    if (!os_str_view_is_at_token_end(&view))
+    {
+        return false;
+    }
+    *p_view = view;
+    *p_val  = val;
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2)
+bool
+os_str_view_parse_mac(os_str_view_t* const p_view, mac_address_bin_t* const p_mac)
+{
+    const size_t mac_str_len = ((p_view->len >= MAC_ADDR_STR_LEN)
+                                && ((':' == p_view->p_str[2]) || ('-' == p_view->p_str[2])))
+                                   ? MAC_ADDR_STR_LEN
+                                   : MAC_ADDR_STR_NO_SEP_LEN;
+    if ((p_view->len < mac_str_len) || (!mac_addr_from_str_with_len(p_view->p_str, mac_str_len, p_mac)))
+    {
+        return false;
+    }
+    os_str_view_skip(p_view, mac_str_len);
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 2, 4)
+bool
+os_str_view_parse_hex_bytes(
+    os_str_view_t* const p_view,
+    uint8_t* const       p_buf,
+    const size_t         buf_size,
+    size_t* const        p_num_bytes)
+{
+    size_t num_digits = 0;
+    while ((num_digits < p_view->len)
+           && (OS_STR_HEX_DIGIT_INVALID != os_str_get_hex_digit(p_view->p_str[num_digits])))
+    {
+        num_digits += 1;
+    }
+    if ((0 == num_digits) || (0 != (num_digits % 2U)) || ((num_digits / 2U) > buf_size))
+    {
+        return false;
+    }
+    const size_t num_bytes = num_digits / 2U;
+    for (size_t i = 0; i < num_bytes; ++i)
+    {
+        p_buf[i] = (uint8_t)((os_str_get_hex_digit(p_view->p_str[i * 2U]) << 4U)
+                             | os_str_get_hex_digit(p_view->p_str[(i * 2U) + 1U]));
+    }
+    *p_num_bytes = num_bytes;
+    os_str_view_skip(p_view, num_digits);
+    return true;
+}
@@ -9,23 +9,375 @@
 #include <assert.h>
 #include "os_malloc.h"
 
+#if OS_TASK_REGISTRY
+#include <string.h>
+#include <stdio.h>
+#include "os_mutex.h"
+#if configUSE_TRACE_FACILITY != 1
+#error OS_TASK_REGISTRY requires configUSE_TRACE_FACILITY to be enabled
+#endif
+#endif
+
+#if OS_TASK_LOG_CTX_CACHE
+#if !defined(configNUM_THREAD_LOCAL_STORAGE_POINTERS)
+#error OS_TASK_LOG_CTX_CACHE requires configNUM_THREAD_LOCAL_STORAGE_POINTERS to be defined
+#endif
+#if OS_TASK_LOG_CTX_TLS_IDX_NAME >= configNUM_THREAD_LOCAL_STORAGE_POINTERS
+#error OS_TASK_LOG_CTX_CACHE requires configNUM_THREAD_LOCAL_STORAGE_POINTERS > OS_TASK_LOG_CTX_TLS_IDX_NAME
+#endif
+#endif
+
 #define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
 #include "log.h"
 
-typedef struct os_task_arg_finite_with_param_t
+#if OS_TASK_REGISTRY
+#define OS_TASK_REGISTRY_PERMILLE (1000U)
+#endif
+
+#if OS_TASK_REGISTRY
+typedef struct os_task_registry_entry_t
 {
-    os_task_finite_func_with_param_t p_func;
-    void*                            p_arg;
-} os_task_arg_finite_with_param_t;
+    os_task_registry_info_t info;
+    /**
+     * Pointer to the variable where the handle of the task is saved while the task is being created,
+     * FreeRTOS writes the handle to it before the task can run.
+     * It is NULL after os_task_create_* has returned.
+     */
+    const os_task_handle_t* ph_task_creating;
+} os_task_registry_entry_t;
 
-typedef struct os_task_arg_finite_with_const_param_t
+typedef struct os_task_registry_t
 {
-    os_task_finite_func_with_const_param_t p_func;
-    const void*                            p_arg;
-} os_task_arg_finite_with_const_param_t;
+    os_task_registry_entry_t arr_of_tasks[OS_TASK_REGISTRY_MAX_NUM_TASKS];
+    uint32_t                 num_tasks;
+    uint32_t                 num_overflows;
+    uint32_t                 total_run_time;
+} os_task_registry_t;
+#endif
 
 static const char* TAG = "os_task";
 
+#if OS_TASK_REGISTRY
+static os_task_registry_t g_os_task_registry;
+static os_mutex_t         g_p_os_task_registry_mutex;
+static os_mutex_static_t  g_os_task_registry_mutex_mem;
+static TaskStatus_t       g_os_task_registry_arr_of_status[OS_TASK_REGISTRY_MAX_NUM_TASK_STATUSES];
+
+static os_task_registry_t*
+os_task_registry_lock(void)
+{
+    if (NULL == g_p_os_task_registry_mutex)
+    {
+        return NULL;
+    }
+    os_mutex_lock(g_p_os_task_registry_mutex);
+    return &g_os_task_registry;
+}
+
+static void
+os_task_registry_unlock(os_task_registry_t** const p_p_registry)
+{
+    os_mutex_unlock(g_p_os_task_registry_mutex);
+    *p_p_registry = NULL;
+}
+
+void
+os_task_registry_init(void)
+{
+    if (NULL == g_p_os_task_registry_mutex)
+    {
+        g_p_os_task_registry_mutex = os_mutex_create_static(&g_os_task_registry_mutex_mem);
+    }
+    os_task_registry_clear();
+}
+
+void
+os_task_registry_deinit(void)
+{
+    os_task_registry_clear();
+    os_mutex_delete(&g_p_os_task_registry_mutex);
+}
+
+void
+os_task_registry_clear(void)
+{
+    os_task_registry_t* p_registry = os_task_registry_lock();
+    if (NULL == p_registry)
+    {
+        return;
+    }
+    memset(p_registry, 0, sizeof(*p_registry));
+    os_task_registry_unlock(&p_registry);
+}
+
+/**
+ * @brief Register the task before it is created, so that the task is found in the registry
+ *        even if it is deleted before os_task_create_* returns.
+ * @param ph_task - pointer to the variable where FreeRTOS saves the handle of the task being created.
+ */
+ATTR_NONNULL(1, 2)
+static void
+os_task_registry_add(
+    const os_task_handle_t* const ph_task,
+    const char* const             p_name,
+    const uint32_t                stack_depth,
+    const os_task_priority_t      priority,
+    const bool                    is_static)
+{
+    os_task_registry_t* p_registry = os_task_registry_lock();
+    if (NULL == p_registry)
+    {
+        return;
+    }
+    if (p_registry->num_tasks >= OS_TASK_REGISTRY_MAX_NUM_TASKS)
+    {
+        p_registry->num_overflows += 1;
+    }
+    else
+    {
+        os_task_registry_entry_t* const p_entry = &p_registry->arr_of_tasks[p_registry->num_tasks];
+        memset(p_entry, 0, sizeof(*p_entry));
+        p_entry->ph_task_creating = ph_task;
+
+        os_task_registry_info_t* const p_info = &p_entry->info;
+        (void)snprintf(p_info->task_name, sizeof(p_info->task_name), "%s", p_name);
+        p_info->priority       = priority;
+        p_info->is_static      = is_static;
+        p_info->stack_depth    = stack_depth;
+        p_info->stack_min_free = stack_depth;
+        p_registry->num_tasks += 1;
+    }
+    os_task_registry_unlock(&p_registry);
+}
+
+ATTR_NONNULL(1)
+static void
+os_task_registry_remove_by_idx(os_task_registry_t* const p_registry, const uint32_t idx)
+{
+    p_registry->num_tasks -= 1;
+    memmove(
+        &p_registry->arr_of_tasks[idx],
+        &p_registry->arr_of_tasks[idx + 1],
+        (p_registry->num_tasks - idx) * sizeof(p_registry->arr_of_tasks[0]));
+}
+
+/**
+ * @brief Save the handle of the created task or forget the task if it could not be created.
+ * @note If the task has already been deleted, then it is not in the registry anymore.
+ */
+ATTR_NONNULL(1)
+static void
+os_task_registry_on_created(const os_task_handle_t* const ph_task, const bool is_created)
+{
+    os_task_registry_t* p_registry = os_task_registry_lock();
+    if (NULL == p_registry)
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < p_registry->num_tasks; ++i)
+    {
+        os_task_registry_entry_t* const p_entry = &p_registry->arr_of_tasks[i];
+        if (ph_task == p_entry->ph_task_creating)
+        {
+            if (is_created)
+            {
+                p_entry->info.h_task      = *ph_task;
+                p_entry->ph_task_creating = NULL;
+            }
+            else
+            {
+                os_task_registry_remove_by_idx(p_registry, i);
+            }
+            break;
+        }
+    }
+    os_task_registry_unlock(&p_registry);
+}
+
+ATTR_NONNULL(1)
+static bool
+os_task_registry_is_entry_of_task(const os_task_registry_entry_t* const p_entry, const os_task_handle_t h_task)
+{
+    if (NULL != p_entry->ph_task_creating)
+    {
+        return h_task == *p_entry->ph_task_creating;
+    }
+    return h_task == p_entry->info.h_task;
+}
+
+static void
+os_task_registry_remove(const os_task_handle_t h_task)
+{
+    os_task_registry_t* p_registry = os_task_registry_lock();
+    if (NULL == p_registry)
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < p_registry->num_tasks; ++i)
+    {
+        if (os_task_registry_is_entry_of_task(&p_registry->arr_of_tasks[i], h_task))
+        {
+            os_task_registry_remove_by_idx(p_registry, i);
+            break;
+        }
+    }
+    os_task_registry_unlock(&p_registry);
+}
+
+ATTR_NONNULL(1)
+static const TaskStatus_t*
+os_task_registry_find_task_status(
+    const TaskStatus_t* const p_arr_of_status,
+    const UBaseType_t         num_tasks,
+    const os_task_handle_t    h_task)
+{
+    for (UBaseType_t i = 0; i < num_tasks; ++i)
+    {
+        if (h_task == p_arr_of_status[i].xHandle)
+        {
+            return &p_arr_of_status[i];
+        }
+    }
+    return NULL;
+}
+
+bool
+os_task_registry_sample(void)
+{
+    os_task_registry_t* p_registry = os_task_registry_lock();
+    if (NULL == p_registry)
+    {
+        return false;
+    }
+    // The static buffer for the task statuses is protected by the registry mutex
+    TaskStatus_t* const p_arr_of_status = g_os_task_registry_arr_of_status;
+    uint32_t            total_run_time  = 0;
+    const UBaseType_t   num_tasks       = uxTaskGetSystemState(
+        p_arr_of_status,
+        OS_TASK_REGISTRY_MAX_NUM_TASK_STATUSES,
+        &total_run_time);
+    if (0 == num_tasks)
+    {
+        os_task_registry_unlock(&p_registry);
+        LOG_ERR(
+            "The number of tasks exceeds OS_TASK_REGISTRY_MAX_NUM_TASK_STATUSES=%u",
+            (printf_uint_t)OS_TASK_REGISTRY_MAX_NUM_TASK_STATUSES);
+        return false;
+    }
+    const uint32_t delta_total_run_time = total_run_time - p_registry->total_run_time;
+    p_registry->total_run_time          = total_run_time;
+
+    uint32_t idx = 0;
+    while (idx < p_registry->num_tasks)
+    {
+        os_task_registry_entry_t* const p_entry = &p_registry->arr_of_tasks[idx];
+        if (NULL != p_entry->ph_task_creating)
+        {
+            // The task is being created right now, it will be sampled next time
+            idx += 1;
+            continue;
+        }
+        os_task_registry_info_t* const p_info = &p_entry->info;
+
+        const TaskStatus_t* const p_status = os_task_registry_find_task_status(
+            p_arr_of_status,
+            num_tasks,
+            p_info->h_task);
+        if (NULL == p_status)
+        {
+            // The task was deleted bypassing os_task_delete, so its handle is no longer valid.
+            os_task_registry_remove_by_idx(p_registry, idx);
+            continue;
+        }
+        p_info->stack_min_free = p_status->usStackHighWaterMark;
+#if configGENERATE_RUN_TIME_STATS
+        const uint32_t delta_run_time = p_status->ulRunTimeCounter - p_info->run_time_counter;
+        p_info->run_time_counter      = p_status->ulRunTimeCounter;
+        p_info->cpu_usage_permille
+            = (0 != delta_total_run_time)
+                  ? (uint32_t)(((uint64_t)delta_run_time * OS_TASK_REGISTRY_PERMILLE) / delta_total_run_time)
+                  : 0;
+#else
+        (void)delta_total_run_time;
+#endif
+        p_info->num_samples += 1;
+        idx += 1;
+    }
+    os_task_registry_unlock(&p_registry);
+    return true;
+}
+
+ATTR_NONNULL(1)
+uint32_t
+os_task_registry_get_snapshot(os_task_registry_info_t* const p_arr_of_info, const uint32_t max_num_tasks)
+{
+    os_task_registry_t* p_registry = os_task_registry_lock();
+    if (NULL == p_registry)
+    {
+        return 0;
+    }
+    uint32_t num_tasks = 0;
+    for (uint32_t i = 0; (i < p_registry->num_tasks) && (num_tasks < max_num_tasks); ++i)
+    {
+        const os_task_registry_entry_t* const p_entry = &p_registry->arr_of_tasks[i];
+        if (NULL == p_entry->ph_task_creating)
+        {
+            p_arr_of_info[num_tasks] = p_entry->info;
+            num_tasks += 1;
+        }
+    }
+    os_task_registry_unlock(&p_registry);
+    return num_tasks;
+}
+
+uint32_t
+os_task_registry_get_num_overflows(void)
+{
+    os_task_registry_t* p_registry = os_task_registry_lock();
+    if (NULL == p_registry)
+    {
+        return 0;
+    }
+    const uint32_t num_overflows = p_registry->num_overflows;
+    os_task_registry_unlock(&p_registry);
+    return num_overflows;
+}
+
+void
+os_task_registry_log_dump(void)
+{
+    os_task_registry_t* p_registry = os_task_registry_lock();
+    if (NULL == p_registry)
+    {
+        LOG_INFO("os_task registry is not initialized");
+        return;
+    }
+    LOG_INFO(
+        "Num tasks registered: %u, not registered: %u",
+        (printf_uint_t)p_registry->num_tasks,
+        (printf_uint_t)p_registry->num_overflows);
+    for (uint32_t i = 0; i < p_registry->num_tasks; ++i)
+    {
+        const os_task_registry_info_t* const p_info = &p_registry->arr_of_tasks[i].info;
+
+        const uint32_t stack_used = (p_info->stack_depth > p_info->stack_min_free)
+                                        ? (p_info->stack_depth - p_info->stack_min_free)
+                                        : 0;
+        LOG_INFO(
+            "[%2u] '%s': priority %u, stack used %u of %u (min free %u), CPU %u.%u%%",
+            (printf_uint_t)i,
+            p_info->task_name,
+            (printf_uint_t)p_info->priority,
+            (printf_uint_t)stack_used,
+            (printf_uint_t)p_info->stack_depth,
+            (printf_uint_t)p_info->stack_min_free,
+            (printf_uint_t)(p_info->cpu_usage_permille / 10U),
+            (printf_uint_t)(p_info->cpu_usage_permille % 10U));
+    }
+    os_task_registry_unlock(&p_registry);
+}
+#endif // OS_TASK_REGISTRY
+
 ATTR_NONNULL(1, 6)
 static bool
 os_task_create_internal(
@@ -37,7 +389,15 @@ os_task_create_internal(
     os_task_handle_t* const  ph_task)
 {
     LOG_INFO("Start thread '%s' with priority %d, stack size %u bytes", p_name, priority, stack_depth);
-    if (pdPASS != xTaskCreate(p_func, p_name, stack_depth, p_param, priority, ph_task))
+#if OS_TASK_REGISTRY
+    *ph_task = NULL;
+    os_task_registry_add(ph_task, p_name, stack_depth, priority, false);
+#endif
+    const bool is_created = (pdPASS == xTaskCreate(p_func, p_name, stack_depth, p_param, priority, ph_task));
+#if OS_TASK_REGISTRY
+    os_task_registry_on_created(ph_task, is_created);
+#endif
+    if (!is_created)
     {
         LOG_ERR("Failed to start thread '%s'", p_name);
         return false;
@@ -111,6 +471,9 @@ os_task_thread_func_wrapper_finite_with_param(void* p_arg)
     p_arg                                          = NULL;
     p_param->p_func(p_param->p_arg);
     os_free(p_param);
+#if OS_TASK_REGISTRY
+    os_task_registry_remove(xTaskGetCurrentTaskHandle());
+#endif
     vTaskDelete(NULL);
     assert(0);
 }
@@ -125,7 +488,7 @@ os_task_create_finite(
     void* const                            p_param,
     const os_task_priority_t               priority)
 {
-    os_task_arg_finite_with_param_t* const p_arg = os_calloc(1, sizeof(*p_arg));
+    os_task_arg_finite_with_param_t* p_arg = os_calloc(1, sizeof(*p_arg));
     if (NULL == p_arg)
     {
         return false;
@@ -134,13 +497,18 @@ os_task_create_finite(
     p_arg->p_arg  = p_param;
 
     os_task_handle_t h_task = NULL;
-    return os_task_create_internal(
-        &os_task_thread_func_wrapper_finite_with_param,
-        p_name,
-        stack_depth,
-        (void*)p_arg,
-        priority,
-        &h_task);
+    if (!os_task_create_internal(
+            &os_task_thread_func_wrapper_finite_with_param,
+            p_name,
+            stack_depth,
+            (void*)p_arg,
+            priority,
+            &h_task))
+    {
+        os_free(p_arg);
+        return false;
+    }
+    return true;
 }
 
 ATTR_NORETURN
@@ -152,6 +520,9 @@ os_task_thread_func_wrapper_finite_with_const_param(void* p_arg)
     p_arg                                                = NULL;
     p_param->p_func(p_param->p_arg);
     os_free(p_param);
+#if OS_TASK_REGISTRY
+    os_task_registry_remove(xTaskGetCurrentTaskHandle());
+#endif
     vTaskDelete(NULL);
     assert(0);
 }
@@ -166,7 +537,7 @@ os_task_create_finite_with_const_param(
     const void* const                            p_param,
     const os_task_priority_t                     priority)
 {
-    os_task_arg_finite_with_const_param_t* const p_arg = os_calloc(1, sizeof(*p_arg));
+    os_task_arg_finite_with_const_param_t* p_arg = os_calloc(1, sizeof(*p_arg));
     if (NULL == p_arg)
     {
         return false;
@@ -175,13 +546,18 @@ os_task_create_finite_with_const_param(
     p_arg->p_arg  = p_param;
 
     os_task_handle_t h_task = NULL;
-    return os_task_create_internal(
-        &os_task_thread_func_wrapper_finite_with_const_param,
-        p_name,
-        stack_depth,
-        (void*)p_arg,
-        priority,
-        &h_task);
+    if (!os_task_create_internal(
+            &os_task_thread_func_wrapper_finite_with_const_param,
+            p_name,
+            stack_depth,
+            (void*)p_arg,
+            priority,
+            &h_task))
+    {
+        os_free(p_arg);
+        return false;
+    }
+    return true;
 }
 
 ATTR_NORETURN
@@ -192,6 +568,9 @@ os_task_thread_func_wrapper_finite_without_param(void* p_arg)
     const os_task_finite_func_without_param_t p_func = p_arg;
     p_arg                                            = NULL;
     p_func();
+#if OS_TASK_REGISTRY
+    os_task_registry_remove(xTaskGetCurrentTaskHandle());
+#endif
     vTaskDelete(NULL);
     assert(0);
 }
@@ -228,7 +607,15 @@ os_task_create_static_internal(
     os_task_handle_t* const     ph_task)
 {
     LOG_INFO("Start thread(static) '%s' with priority %d, stack size %u bytes", p_name, priority, stack_depth);
+#if OS_TASK_REGISTRY
+    // The TCB is placed in p_task_mem, so its handle is known before the task is created
+    *ph_task = (os_task_handle_t)p_task_mem;
+    os_task_registry_add(ph_task, p_name, stack_depth, priority, true);
+#endif
     *ph_task = xTaskCreateStatic(p_func, p_name, stack_depth, p_param, priority, p_stack_mem, p_task_mem);
+#if OS_TASK_REGISTRY
+    os_task_registry_on_created(ph_task, NULL != *ph_task);
+#endif
     if (NULL == *ph_task)
     {
         LOG_ERR("Failed to start thread '%s'", p_name);
@@ -329,15 +716,20 @@ os_task_create_static_finite(
     p_arg->p_arg  = p_param;
 
     os_task_handle_t h_task = NULL;
-    return os_task_create_static_internal(
-        &os_task_thread_func_wrapper_finite_with_param,
-        p_name,
-        p_stack_mem,
-        stack_depth,
-        (void*)p_arg,
-        priority,
-        p_task_mem,
-        &h_task);
+    if (!os_task_create_static_internal(
+            &os_task_thread_func_wrapper_finite_with_param,
+            p_name,
+            p_stack_mem,
+            stack_depth,
+            (void*)p_arg,
+            priority,
+            p_task_mem,
+            &h_task))
+    {
+        os_free(p_arg);
+        return false;
+    }
+    return true;
 }
 
 ATTR_NONNULL(1, 3, 7)
@@ -361,15 +753,20 @@ os_task_create_static_finite_with_const_param(
     p_arg->p_arg  = p_param;
 
     os_task_handle_t h_task = NULL;
-    return os_task_create_static_internal(
-        &os_task_thread_func_wrapper_finite_with_const_param,
-        p_name,
-        p_stack_mem,
-        stack_depth,
-        (void*)p_arg,
-        priority,
-        p_task_mem,
-        &h_task);
+    if (!os_task_create_static_internal(
+            &os_task_thread_func_wrapper_finite_with_const_param,
+            p_name,
+            p_stack_mem,
+            stack_depth,
+            (void*)p_arg,
+            priority,
+            p_task_mem,
+            &h_task))
+    {
+        os_free(p_arg);
+        return false;
+    }
+    return true;
 }
 
 ATTR_NONNULL(1, 3, 6)
@@ -395,10 +792,101 @@ os_task_create_static_finite_without_param(
         &h_task);
 }
 
+ATTR_NORETURN
+ATTR_NONNULL(1)
+static void
+os_task_thread_func_wrapper_finite_with_param_no_alloc(void* p_arg)
+{
+    const os_task_arg_finite_with_param_t* p_param = p_arg;
+    p_arg                                          = NULL;
+    p_param->p_func(p_param->p_arg);
+#if OS_TASK_REGISTRY
+    os_task_registry_remove(xTaskGetCurrentTaskHandle());
+#endif
+    vTaskDelete(NULL);
+    assert(0);
+}
+
+ATTR_NONNULL(1, 3, 7)
+ATTR_WARN_UNUSED_RESULT
+bool
+os_task_create_static_finite_no_alloc(
+    const os_task_finite_func_with_param_t p_func,
+    const char* const                      p_name,
+    os_task_stack_type_t* const            p_stack_mem,
+    const uint32_t                         stack_depth,
+    void* const                            p_param,
+    const os_task_priority_t               priority,
+    os_task_static_finite_t* const         p_task_mem)
+{
+    os_task_arg_finite_with_param_t* const p_arg = &p_task_mem->arg.with_param;
+
+    p_arg->p_func = p_func;
+    p_arg->p_arg  = p_param;
+
+    os_task_handle_t h_task = NULL;
+    return os_task_create_static_internal(
+        &os_task_thread_func_wrapper_finite_with_param_no_alloc,
+        p_name,
+        p_stack_mem,
+        stack_depth,
+        (void*)p_arg,
+        priority,
+        &p_task_mem->task_mem,
+        &h_task);
+}
+
+ATTR_NORETURN
+ATTR_NONNULL(1)
+static void
+os_task_thread_func_wrapper_finite_with_const_param_no_alloc(void* p_arg)
+{
+    const os_task_arg_finite_with_const_param_t* p_param = p_arg;
+    p_arg                                                = NULL;
+    p_param->p_func(p_param->p_arg);
+#if OS_TASK_REGISTRY
+    os_task_registry_remove(xTaskGetCurrentTaskHandle());
+#endif
+    vTaskDelete(NULL);
+    assert(0);
+}
+
+ATTR_NONNULL(1, 3, 7)
+ATTR_WARN_UNUSED_RESULT
+bool
+os_task_create_static_finite_with_const_param_no_alloc(
+    const os_task_finite_func_with_const_param_t p_func,
+    const char* const                            p_name,
+    os_task_stack_type_t* const                  p_stack_mem,
+    const uint32_t                               stack_depth,
+    const void* const                            p_param,
+    const os_task_priority_t                     priority,
+    os_task_static_finite_t* const               p_task_mem)
+{
+    os_task_arg_finite_with_const_param_t* const p_arg = &p_task_mem->arg.with_const_param;
+
+    p_arg->p_func = p_func;
+    p_arg->p_arg  = p_param;
+
+    os_task_handle_t h_task = NULL;
+    return os_task_create_static_internal(
+        &os_task_thread_func_wrapper_finite_with_const_param_no_alloc,
+        p_name,
+        p_stack_mem,
+        stack_depth,
+        (void*)p_arg,
+        priority,
+        &p_task_mem->task_mem,
+        &h_task);
+}
+
 ATTR_NONNULL(1)
 void
 os_task_delete(os_task_handle_t* const ph_task)
 {
+#if OS_TASK_REGISTRY
+    os_task_registry_remove((NULL != *ph_task) ? *ph_task : xTaskGetCurrentTaskHandle());
+#endif
     vTaskDelete(*ph_task);
     *ph_task = NULL;
 }
@@ -407,11 +895,22 @@ ATTR_WARN_UNUSED_RESULT
 const char*
 os_task_get_name(void)
 {
+#if OS_TASK_LOG_CTX_CACHE
+    const char* const p_cached_name = pvTaskGetThreadLocalStoragePointer(NULL, OS_TASK_LOG_CTX_TLS_IDX_NAME);
+    if (NULL != p_cached_name)
+    {
+        return p_cached_name;
+    }
+#endif
     const char* task_name = pcTaskGetTaskName(NULL);
     if (NULL == task_name)
     {
-        task_name = "???";
+        return "???";
     }
+#if OS_TASK_LOG_CTX_CACHE
+    // The task name never changes, so it is cached by the task itself on the first call
+    vTaskSetThreadLocalStoragePointer(NULL, OS_TASK_LOG_CTX_TLS_IDX_NAME, (void*)task_name);
+#endif
     return task_name;
 }
 
@@ -6,6 +6,49 @@
  */
 
 #include "os_time.h"
+#include <string.h>
+#include "os_mkgmtime.h"
+
+#define OS_TIME_STRUCT_TM_BASE_YEAR (1900)
+#define OS_TIME_MAX_YEAR            (9999)
+#define OS_TIME_NUM_YEARS_PER_CYCLE (400)
+#define OS_TIME_NUM_MONTHS_PER_YEAR (12)
+#define OS_TIME_NUM_DAYS_PER_WEEK   (7)
+#define OS_TIME_MAX_MDAY            (31)
+#define OS_TIME_MAX_HOUR            (23)
+#define OS_TIME_MAX_MIN             (59)
+#define OS_TIME_MAX_SEC             (60) // leap second is allowed
+#define OS_TIME_MAX_MS              (999U)
+#define OS_TIME_MINUTES_PER_HOUR    (60)
+#define OS_TIME_NAME_SHORT_LEN      (3)
+#define OS_TIME_NUM_MS_DIGITS       (3U)
+#define OS_TIME_DECIMAL_BASE        (10U)
+
+/**
+ * Offsets of the fields in "YYYY-MM-DDTHH:MM:SS"
+ */
+#define OS_TIME_RFC3339_OFFSET_YEAR       (0)
+#define OS_TIME_RFC3339_OFFSET_MONTH      (5)
+#define OS_TIME_RFC3339_OFFSET_MDAY       (8)
+#define OS_TIME_RFC3339_OFFSET_HOUR       (11)
+#define OS_TIME_RFC3339_OFFSET_MIN        (14)
+#define OS_TIME_RFC3339_OFFSET_SEC        (17)
+#define OS_TIME_RFC3339_DATE_TIME_LEN     (19)
+#define OS_TIME_RFC3339_TIME_OFFSET_LEN   (6) // "+HH:MM"
+#define OS_TIME_RFC3339_TIME_OFFSET_H_POS (1)
+#define OS_TIME_RFC3339_TIME_OFFSET_M_POS (4)
+
+/**
+ * Offsets of the fields in "Sun, 06 Nov 1994 08:49:37 GMT"
+ */
+#define OS_TIME_RFC7231_OFFSET_WDAY  (0)
+#define OS_TIME_RFC7231_OFFSET_MDAY  (5)
+#define OS_TIME_RFC7231_OFFSET_MONTH (8)
+#define OS_TIME_RFC7231_OFFSET_YEAR  (12)
+#define OS_TIME_RFC7231_OFFSET_HOUR  (17)
+#define OS_TIME_RFC7231_OFFSET_MIN   (20)
+#define OS_TIME_RFC7231_OFFSET_SEC   (23)
+#define OS_TIME_RFC7231_OFFSET_GMT   (26)
 
 time_t
 os_time_get(void)
@@ -152,3 +195,417 @@ os_time_wday_name_long(const os_time_wday_e day_of_the_week)
             return "???";
     }
 }
+
+static bool
+os_time_is_leap_year(const int32_t year)
+{
+    return (0 == (year % 4)) && ((0 != (year % 100)) || (0 == (year % 400)));
+}
+
+static int32_t
+os_time_get_num_days_in_month(const int32_t year, const int32_t month)
+{
+    static const uint8_t g_num_days_in_month[OS_TIME_NUM_MONTHS_PER_YEAR] = {
+        31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31,
+    };
+    if ((2 == month) && os_time_is_leap_year(year))
+    {
+        return 29;
+    }
+    return g_num_days_in_month[month - 1];
+}
+
+static bool
+os_time_is_tm_valid_for_fmt(const struct tm* const p_tm_time_utc)
+{
+    return (p_tm_time_utc->tm_year >= -OS_TIME_STRUCT_TM_BASE_YEAR)
+           && (p_tm_time_utc->tm_year <= (OS_TIME_MAX_YEAR - OS_TIME_STRUCT_TM_BASE_YEAR))
+           && ((uint32_t)p_tm_time_utc->tm_mon < OS_TIME_NUM_MONTHS_PER_YEAR) && (p_tm_time_utc->tm_mday >= 1)
+           && (p_tm_time_utc->tm_mday <= OS_TIME_MAX_MDAY) && ((uint32_t)p_tm_time_utc->tm_hour <= OS_TIME_MAX_HOUR)
+           && ((uint32_t)p_tm_time_utc->tm_min <= OS_TIME_MAX_MIN)
+           && ((uint32_t)p_tm_time_utc->tm_sec <= OS_TIME_MAX_SEC);
+}
+
+/**
+ * @brief Write the decimal number with leading zeros (without null-terminator).
+ */
+static void
+os_time_put_digits(char* const p_buf, const uint32_t val, const size_t num_digits)
+{
+    uint32_t rem = val;
+    for (size_t i = num_digits; i > 0; --i)
+    {
+        p_buf[i - 1] = (char)('0' + (rem % OS_TIME_DECIMAL_BASE));
+        rem /= OS_TIME_DECIMAL_BASE;
+    }
+}
+
+/**
+ * @brief Write "YYYY-MM-DDTHH:MM:SS" (without null-terminator).
+ */
+static void
+os_time_put_rfc3339_date_time(const struct tm* const p_tm_time_utc, char* const p_buf)
+{
+    os_time_put_digits(
+        &p_buf[OS_TIME_RFC3339_OFFSET_YEAR],
+        (uint32_t)(p_tm_time_utc->tm_year + OS_TIME_STRUCT_TM_BASE_YEAR),
+        4);
+    p_buf[OS_TIME_RFC3339_OFFSET_MONTH - 1] = '-';
+    os_time_put_digits(&p_buf[OS_TIME_RFC3339_OFFSET_MONTH], (uint32_t)(p_tm_time_utc->tm_mon + 1), 2);
+    p_buf[OS_TIME_RFC3339_OFFSET_MDAY - 1] = '-';
+    os_time_put_digits(&p_buf[OS_TIME_RFC3339_OFFSET_MDAY], (uint32_t)p_tm_time_utc->tm_mday, 2);
+    p_buf[OS_TIME_RFC3339_OFFSET_HOUR - 1] = 'T';
+    os_time_put_digits(&p_buf[OS_TIME_RFC3339_OFFSET_HOUR], (uint32_t)p_tm_time_utc->tm_hour, 2);
+    p_buf[OS_TIME_RFC3339_OFFSET_MIN - 1] = ':';
+    os_time_put_digits(&p_buf[OS_TIME_RFC3339_OFFSET_MIN], (uint32_t)p_tm_time_utc->tm_min, 2);
+    p_buf[OS_TIME_RFC3339_OFFSET_SEC - 1] = ':';
+    os_time_put_digits(&p_buf[OS_TIME_RFC3339_OFFSET_SEC], (uint32_t)p_tm_time_utc->tm_sec, 2);
+}
+
+ATTR_NONNULL(1, 2)
+size_t
+os_time_fmt_rfc3339(const struct tm* const p_tm_time_utc, char* const p_buf, const size_t buf_size)
+{
+    if ((buf_size <= OS_TIME_RFC3339_STR_LEN) || (!os_time_is_tm_valid_for_fmt(p_tm_time_utc)))
+    {
+        return 0;
+    }
+    os_time_put_rfc3339_date_time(p_tm_time_utc, p_buf);
+    p_buf[OS_TIME_RFC3339_DATE_TIME_LEN] = 'Z';
+    p_buf[OS_TIME_RFC3339_STR_LEN]       = '\0';
+    return OS_TIME_RFC3339_STR_LEN;
+}
+
+ATTR_NONNULL(1, 3)
+size_t
+os_time_fmt_rfc3339_ms(
+    const struct tm* const p_tm_time_utc,
+    const uint32_t         milliseconds,
+    char* const            p_buf,
+    const size_t           buf_size)
+{
+    if ((buf_size <= OS_TIME_RFC3339_MS_STR_LEN) || (!os_time_is_tm_valid_for_fmt(p_tm_time_utc))
+        || (milliseconds > OS_TIME_MAX_MS))
+    {
+        return 0;
+    }
+    os_time_put_rfc3339_date_time(p_tm_time_utc, p_buf);
+    p_buf[OS_TIME_RFC3339_DATE_TIME_LEN] = '.';
+    os_time_put_digits(&p_buf[OS_TIME_RFC3339_DATE_TIME_LEN + 1], milliseconds, OS_TIME_NUM_MS_DIGITS);
+    p_buf[OS_TIME_RFC3339_MS_STR_LEN - 1] = 'Z';
+    p_buf[OS_TIME_RFC3339_MS_STR_LEN]     = '\0';
+    return OS_TIME_RFC3339_MS_STR_LEN;
+}
+
+ATTR_NONNULL(1, 2)
+size_t
+os_time_fmt_rfc7231(const struct tm* const p_tm_time_utc, char* const p_buf, const size_t buf_size)
+{
+    if ((buf_size <= OS_TIME_RFC7231_STR_LEN) || (!os_time_is_tm_valid_for_fmt(p_tm_time_utc))
+        || ((uint32_t)p_tm_time_utc->tm_wday >= OS_TIME_NUM_DAYS_PER_WEEK))
+    {
+        return 0;
+    }
+    memcpy(
+        &p_buf[OS_TIME_RFC7231_OFFSET_WDAY],
+        os_time_wday_name_mid(os_time_get_tm_wday(p_tm_time_utc)),
+        OS_TIME_NAME_SHORT_LEN);
+    p_buf[OS_TIME_RFC7231_OFFSET_MDAY - 2] = ',';
+    p_buf[OS_TIME_RFC7231_OFFSET_MDAY - 1] = ' ';
+    os_time_put_digits(&p_buf[OS_TIME_RFC7231_OFFSET_MDAY], (uint32_t)p_tm_time_utc->tm_mday, 2);
+    p_buf[OS_TIME_RFC7231_OFFSET_MONTH - 1] = ' ';
+    memcpy(
+        &p_buf[OS_TIME_RFC7231_OFFSET_MONTH],
+        os_time_month_name_short(os_time_get_tm_mon(p_tm_time_utc)),
+        OS_TIME_NAME_SHORT_LEN);
+    p_buf[OS_TIME_RFC7231_OFFSET_YEAR - 1] = ' ';
+    os_time_put_digits(
+        &p_buf[OS_TIME_RFC7231_OFFSET_YEAR],
+        (uint32_t)(p_tm_time_utc->tm_year + OS_TIME_STRUCT_TM_BASE_YEAR),
+        4);
+    p_buf[OS_TIME_RFC7231_OFFSET_HOUR - 1] = ' ';
+    os_time_put_digits(&p_buf[OS_TIME_RFC7231_OFFSET_HOUR], (uint32_t)p_tm_time_utc->tm_hour, 2);
+    p_buf[OS_TIME_RFC7231_OFFSET_MIN - 1] = ':';
+    os_time_put_digits(&p_buf[OS_TIME_RFC7231_OFFSET_MIN], (uint32_t)p_tm_time_utc->tm_min, 2);
+    p_buf[OS_TIME_RFC7231_OFFSET_SEC - 1] = ':';
+    os_time_put_digits(&p_buf[OS_TIME_RFC7231_OFFSET_SEC], (uint32_t)p_tm_time_utc->tm_sec, 2);
+    p_buf[OS_TIME_RFC7231_OFFSET_GMT - 1] = ' ';
+    memcpy(&p_buf[OS_TIME_RFC7231_OFFSET_GMT], "GMT", OS_TIME_NAME_SHORT_LEN);
+    p_buf[OS_TIME_RFC7231_STR_LEN] = '\0';
+    return OS_TIME_RFC7231_STR_LEN;
+}
+
+static bool
+os_time_get_digit(const char ch, uint32_t* const p_digit)
+{
+    const uint32_t digit = (uint32_t)(uint8_t)ch - (uint32_t)'0';
+    if (digit >= OS_TIME_DECIMAL_BASE)
+    {
+        return false;
+    }
+    *p_digit = digit;
+    return true;
+}
+
+static bool
+os_time_get_digits(const char* const p_str, const size_t num_digits, int* const p_val)
+{
+    uint32_t val = 0;
+    for (size_t i = 0; i < num_digits; ++i)
+    {
+        uint32_t digit = 0;
+        if (!os_time_get_digit(p_str[i], &digit))
+        {
+            return false;
+        }
+        val = (val * OS_TIME_DECIMAL_BASE) + digit;
+    }
+    *p_val = (int)val;
+    return true;
+}
+
+/**
+ * @brief Calculate the day of the week (0 - Sunday) using Sakamoto's method.
+ */
+static int
+os_time_calc_wday(const int32_t year, const int32_t month, const int32_t mday)
+{
+    static const uint8_t g_month_offset[OS_TIME_NUM_MONTHS_PER_YEAR] = {
+        0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4,
+    };
+    // Add one 400-year cycle (it does not change the day of the week) to avoid negative values for the year 0
+    const int32_t year_from_march = ((month < 3) ? (year - 1) : year) + OS_TIME_NUM_YEARS_PER_CYCLE;
+    return (int)((year_from_march + (year_from_march / 4) - (year_from_march / 100)
+                  + (year_from_march / OS_TIME_NUM_YEARS_PER_CYCLE)
+                  + g_month_offset[month - 1] + mday)
+                 % OS_TIME_NUM_DAYS_PER_WEEK);
+}
+
+/**
+ * @brief Calculate the day of the year (0 - January 1).
+ */
+static int
+os_time_calc_yday(const int32_t year, const int32_t month, const int32_t mday)
+{
+    static const uint16_t g_num_days_before_month[OS_TIME_NUM_MONTHS_PER_YEAR] = {
+        0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334,
+    };
+    const int32_t leap_day = ((month > 2) && os_time_is_leap_year(year)) ? 1 : 0;
+    return (int)(g_num_days_before_month[month - 1] + mday - 1 + leap_day);
+}
+
+/**
+ * @brief Validate the date and time and convert it to the normalized 'struct tm'.
+ * @param p_tm_time - ptr to 'struct tm' with the year, month and day in tm_year, tm_mon, tm_mday
+ *                    as they are in the string (without offsets), the time fields are already set.
+ * @param offset_minutes - the offset from UTC in minutes.
+ */
+static bool
+os_time_normalize_parsed_tm(struct tm* const p_tm_time, const int32_t offset_minutes)
+{
+    const int32_t year  = p_tm_time->tm_year;
+    const int32_t month = p_tm_time->tm_mon;
+    if ((month < 1) || (month > OS_TIME_NUM_MONTHS_PER_YEAR) || (p_tm_time->tm_mday < 1)
+        || (p_tm_time->tm_mday > os_time_get_num_days_in_month(year, month)) || (p_tm_time->tm_hour > OS_TIME_MAX_HOUR)
+        || (p_tm_time->tm_min > OS_TIME_MAX_MIN) || (p_tm_time->tm_sec > OS_TIME_MAX_SEC))
+    {
+        return false;
+    }
+    p_tm_time->tm_year = year - OS_TIME_STRUCT_TM_BASE_YEAR;
+    p_tm_time->tm_mon  = month - 1;
+    if ((0 == offset_minutes) && (p_tm_time->tm_sec < OS_TIME_MAX_SEC))
+    {
+        // All the fields are already normalized, so only tm_wday and tm_yday need to be calculated.
+        p_tm_time->tm_wday  = os_time_calc_wday(year, month, p_tm_time->tm_mday);
+        p_tm_time->tm_yday  = os_time_calc_yday(year, month, p_tm_time->tm_mday);
+        p_tm_time->tm_isdst = 0;
+        return true;
+    }
+    p_tm_time->tm_min -= offset_minutes;
+
+    int64_t unix_time = 0;
+    return os_mkgmtime64(p_tm_time, &unix_time);
+}
+
+static bool
+os_time_is_rfc3339_date_time_sep(const char ch)
+{
+    return ('T' == ch) || ('t' == ch) || (' ' == ch);
+}
+
+/**
+ * @brief Parse the fraction of a second, the digits after the third one are ignored.
+ * @param p_str - ptr to the first digit after '.'.
+ * @param len - the max length of the fraction.
+ * @param[out] p_milliseconds - ptr to the output variable.
+ * @return the number of digits (0 if there are no digits).
+ */
+static size_t
+os_time_parse_rfc3339_frac(const char* const p_str, const size_t len, uint32_t* const p_milliseconds)
+{
+    uint32_t milliseconds = 0;
+    size_t   num_digits   = 0;
+    uint32_t digit        = 0;
+    while ((num_digits < len) && os_time_get_digit(p_str[num_digits], &digit))
+    {
+        if (num_digits < OS_TIME_NUM_MS_DIGITS)
+        {
+            milliseconds = (milliseconds * OS_TIME_DECIMAL_BASE) + digit;
+        }
+        num_digits += 1;
+    }
+    for (size_t i = num_digits; i < OS_TIME_NUM_MS_DIGITS; ++i)
+    {
+        milliseconds *= OS_TIME_DECIMAL_BASE;
+    }
+    *p_milliseconds = milliseconds;
+    return num_digits;
+}
+
+/**
+ * @brief Parse the time offset: "Z", "+HH:MM" or "-HH:MM".
+ * @param p_str - ptr to the time offset.
+ * @param len - the length of the time offset (it must be the end of the string).
+ * @param[out] p_offset_minutes - ptr to the output variable.
+ * @return true if successful.
+ */
+static bool
+os_time_parse_rfc3339_time_offset(const char* const p_str, const size_t len, int32_t* const p_offset_minutes)
+{
+    if ((1 == len) && (('Z' == p_str[0]) || ('z' == p_str[0])))
+    {
+        *p_offset_minutes = 0;
+        return true;
+    }
+    if ((OS_TIME_RFC3339_TIME_OFFSET_LEN != len) || (('+' != p_str[0]) && ('-' != p_str[0])))
+    {
+        return false;
+    }
+    int offset_hours = 0;
+    int offset_mins  = 0;
+    if ((!os_time_get_digits(&p_str[OS_TIME_RFC3339_TIME_OFFSET_H_POS], 2, &offset_hours))
+        || (':' != p_str[OS_TIME_RFC3339_TIME_OFFSET_M_POS - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC3339_TIME_OFFSET_M_POS], 2, &offset_mins))
+        || (offset_hours > OS_TIME_MAX_HOUR) || (offset_mins > OS_TIME_MAX_MIN))
+    {
+        return false;
+    }
+    const int32_t offset_minutes = (offset_hours * OS_TIME_MINUTES_PER_HOUR) + offset_mins;
+    *p_offset_minutes            = ('-' == p_str[0]) ? -offset_minutes : offset_minutes;
+    return true;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 3)
+bool
+os_time_parse_rfc3339(
+    const char* const p_str,
+    const size_t      len,
+    struct tm* const  p_tm_time_utc,
+    uint32_t* const   p_milliseconds)
+{
+    if (len < OS_TIME_RFC3339_STR_LEN)
+    {
+        return false;
+    }
+    struct tm tm_time = { 0 };
+    if ((!os_time_get_digits(&p_str[OS_TIME_RFC3339_OFFSET_YEAR], 4, &tm_time.tm_year))
+        || ('-' != p_str[OS_TIME_RFC3339_OFFSET_MONTH - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC3339_OFFSET_MONTH], 2, &tm_time.tm_mon))
+        || ('-' != p_str[OS_TIME_RFC3339_OFFSET_MDAY - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC3339_OFFSET_MDAY], 2, &tm_time.tm_mday))
+        || (!os_time_is_rfc3339_date_time_sep(p_str[OS_TIME_RFC3339_OFFSET_HOUR - 1]))
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC3339_OFFSET_HOUR], 2, &tm_time.tm_hour))
+        || (':' != p_str[OS_TIME_RFC3339_OFFSET_MIN - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC3339_OFFSET_MIN], 2, &tm_time.tm_min))
+        || (':' != p_str[OS_TIME_RFC3339_OFFSET_SEC - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC3339_OFFSET_SEC], 2, &tm_time.tm_sec)))
+    {
+        return false;
+    }
+    size_t   idx          = OS_TIME_RFC3339_DATE_TIME_LEN;
+    uint32_t milliseconds = 0;
+    if ('.' == p_str[idx])
+    {
+        idx += 1;
+        const size_t num_digits = os_time_parse_rfc3339_frac(&p_str[idx], len - idx, &milliseconds);
+        if (0 == num_digits)
+        {
+            return false;
+        }
+        idx += num_digits;
+    }
+    int32_t offset_minutes = 0;
+    if ((!os_time_parse_rfc3339_time_offset(&p_str[idx], len - idx, &offset_minutes))
+        || (!os_time_normalize_parsed_tm(&tm_time, offset_minutes)))
+    {
+        return false;
+    }
+    *p_tm_time_utc = tm_time;
+    if (NULL != p_milliseconds)
+    {
+        *p_milliseconds = milliseconds;
+    }
+    return true;
+}
+
+static bool
+os_time_parse_wday_name(const char* const p_str)
+{
+    for (int32_t wday = OS_TIME_WDAY_SUN; wday <= OS_TIME_WDAY_SAT; ++wday)
+    {
+        if (0 == memcmp(p_str, os_time_wday_name_mid((os_time_wday_e)wday), OS_TIME_NAME_SHORT_LEN))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool
+os_time_parse_month_name(const char* const p_str, int* const p_month)
+{
+    for (int32_t month = OS_TIME_MONTH_JAN; month <= OS_TIME_MONTH_DEC; ++month)
+    {
+        if (0 == memcmp(p_str, os_time_month_name_short((os_time_month_e)month), OS_TIME_NAME_SHORT_LEN))
+        {
+            *p_month = month + 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+ATTR_WARN_UNUSED_RESULT
+ATTR_NONNULL(1, 3)
+bool
+os_time_parse_rfc7231(const char* const p_str, const size_t len, struct tm* const p_tm_time_utc)
+{
+    if (OS_TIME_RFC7231_STR_LEN != len)
+    {
+        return false;
+    }
+    // The day of the week is only checked for a valid name, tm_wday is calculated from the date.
+    struct tm tm_time = { 0 };
+    if ((!os_time_parse_wday_name(&p_str[OS_TIME_RFC7231_OFFSET_WDAY]))
+        || (',' != p_str[OS_TIME_RFC7231_OFFSET_MDAY - 2]) || (' ' != p_str[OS_TIME_RFC7231_OFFSET_MDAY - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC7231_OFFSET_MDAY], 2, &tm_time.tm_mday))
+        || (' ' != p_str[OS_TIME_RFC7231_OFFSET_MONTH - 1])
+        || (!os_time_parse_month_name(&p_str[OS_TIME_RFC7231_OFFSET_MONTH], &tm_time.tm_mon))
+        || (' ' != p_str[OS_TIME_RFC7231_OFFSET_YEAR - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC7231_OFFSET_YEAR], 4, &tm_time.tm_year))
+        || (' ' != p_str[OS_TIME_RFC7231_OFFSET_HOUR - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC7231_OFFSET_HOUR], 2, &tm_time.tm_hour))
+        || (':' != p_str[OS_TIME_RFC7231_OFFSET_MIN - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC7231_OFFSET_MIN], 2, &tm_time.tm_min))
+        || (':' != p_str[OS_TIME_RFC7231_OFFSET_SEC - 1])
+        || (!os_time_get_digits(&p_str[OS_TIME_RFC7231_OFFSET_SEC], 2, &tm_time.tm_sec))
+        || (' ' != p_str[OS_TIME_RFC7231_OFFSET_GMT - 1])
+        || (0 != memcmp(&p_str[OS_TIME_RFC7231_OFFSET_GMT], "GMT", OS_TIME_NAME_SHORT_LEN))
+        || (!os_time_normalize_parsed_tm(&tm_time, 0)))
+    {
+        return false;
+    }
+    *p_tm_time_utc = tm_time;
+    return true;
+}
@@ -0,0 +1,313 @@
+/**
+ * @file os_time_cal_cache.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_time_cal_cache.h"
+#include <stdatomic.h>
+#include <stddef.h>
+#include "os_mkgmtime.h"
+
+#define OS_TIME_CAL_CACHE_NUM_HOURS_PER_DAY      (24)
+#define OS_TIME_CAL_CACHE_NUM_MINUTES_PER_HOUR   (60)
+#define OS_TIME_CAL_CACHE_NUM_SECONDS_PER_MINUTE (60)
+#define OS_TIME_CAL_CACHE_NUM_SECONDS_PER_HOUR \
+    (OS_TIME_CAL_CACHE_NUM_MINUTES_PER_HOUR * OS_TIME_CAL_CACHE_NUM_SECONDS_PER_MINUTE)
+#define OS_TIME_CAL_CACHE_NUM_SECONDS_PER_DAY \
+    (OS_TIME_CAL_CACHE_NUM_HOURS_PER_DAY * OS_TIME_CAL_CACHE_NUM_SECONDS_PER_HOUR)
+
+/**
+ * @brief The global calendar cache protected by a sequence lock.
+ * @note The sequence number is odd while the cache is being refreshed, 0 means that the cache is empty.
+ *       All the fields are 32-bit atomics, so the readers never observe torn values on 32-bit CPUs.
+ */
+typedef struct os_time_cal_cache_shared_t
+{
+    atomic_uint_least32_t seq;
+    atomic_int_least32_t  days; ///< the number of days since 1970-01-01
+    atomic_int_least32_t  tm_year;
+    atomic_int_least32_t  tm_mon;
+    atomic_int_least32_t  tm_mday;
+    atomic_int_least32_t  tm_wday;
+    atomic_int_least32_t  tm_yday;
+} os_time_cal_cache_shared_t;
+
+static os_time_cal_cache_shared_t g_os_time_cal_cache_shared;
+
+ATTR_NONNULL(1)
+void
+os_time_cal_cache_init(os_time_cal_cache_t* const p_cache)
+{
+    p_cache->day_start = 0;
+    p_cache->tm_year   = 0;
+    p_cache->tm_mon    = 0;
+    p_cache->tm_mday   = 0;
+    p_cache->tm_wday   = 0;
+    p_cache->tm_yday   = 0;
+    p_cache->is_valid  = false;
+}
+
+static bool
+os_time_cal_cache_is_same_day(const os_time_cal_cache_t* const p_cache, const int64_t unix_time)
+{
+    return p_cache->is_valid && (unix_time >= p_cache->day_start)
+           && ((unix_time - p_cache->day_start) < OS_TIME_CAL_CACHE_NUM_SECONDS_PER_DAY);
+}
+
+static void
+os_time_cal_cache_fill_tm(
+    const os_time_cal_cache_t* const p_cache,
+    const int64_t                    unix_time,
+    struct tm* const                 p_tm_time_utc)
+{
+    const int32_t secs_of_day = (int32_t)(unix_time - p_cache->day_start);
+
+    p_tm_time_utc->tm_year  = p_cache->tm_year;
+    p_tm_time_utc->tm_mon   = p_cache->tm_mon;
+    p_tm_time_utc->tm_mday  = p_cache->tm_mday;
+    p_tm_time_utc->tm_hour  = secs_of_day / OS_TIME_CAL_CACHE_NUM_SECONDS_PER_HOUR;
+    p_tm_time_utc->tm_min   = (secs_of_day % OS_TIME_CAL_CACHE_NUM_SECONDS_PER_HOUR)
+                            / OS_TIME_CAL_CACHE_NUM_SECONDS_PER_MINUTE;
+    p_tm_time_utc->tm_sec   = secs_of_day % OS_TIME_CAL_CACHE_NUM_SECONDS_PER_MINUTE;
+    p_tm_time_utc->tm_wday  = p_cache->tm_wday;
+    p_tm_time_utc->tm_yday  = p_cache->tm_yday;
+    p_tm_time_utc->tm_isdst = 0;
+}
+
+/**
+ * @brief Refresh the cache from the normalized 'struct tm' and the corresponding Unix-time.
+ */
+static void
+os_time_cal_cache_update(
+    os_time_cal_cache_t* const p_cache,
+    const struct tm* const     p_tm_time_utc,
+    const int64_t              unix_time)
+{
+    p_cache->day_start = unix_time
+                         - (((int64_t)p_tm_time_utc->tm_hour * OS_TIME_CAL_CACHE_NUM_SECONDS_PER_HOUR)
+                            + ((int64_t)p_tm_time_utc->tm_min * OS_TIME_CAL_CACHE_NUM_SECONDS_PER_MINUTE)
+                            + p_tm_time_utc->tm_sec);
+    p_cache->tm_year   = p_tm_time_utc->tm_year;
+    p_cache->tm_mon    = p_tm_time_utc->tm_mon;
+    p_cache->tm_mday   = p_tm_time_utc->tm_mday;
+    p_cache->tm_wday   = p_tm_time_utc->tm_wday;
+    p_cache->tm_yday   = p_tm_time_utc->tm_yday;
+    p_cache->is_valid  = true;
+}
+
+ATTR_NONNULL(1, 3)
+struct tm*
+os_time_cal_cache_gmtime_r(os_time_cal_cache_t* const p_cache, const time_t unix_time, struct tm* const p_tm_time_utc)
+{
+    if (os_time_cal_cache_is_same_day(p_cache, (int64_t)unix_time))
+    {
+        os_time_cal_cache_fill_tm(p_cache, (int64_t)unix_time, p_tm_time_utc);
+        return p_tm_time_utc;
+    }
+    if (NULL == os_gmtime64_r((int64_t)unix_time, p_tm_time_utc))
+    {
+        return NULL;
+    }
+    os_time_cal_cache_update(p_cache, p_tm_time_utc, (int64_t)unix_time);
+    return p_tm_time_utc;
+}
+
+static bool
+os_time_cal_cache_mkgmtime_from_cache(
+    const os_time_cal_cache_t* const p_cache,
+    struct tm* const                 p_tm_time_utc,
+    time_t* const                    p_unix_time)
+{
+    if ((!p_cache->is_valid) || (p_tm_time_utc->tm_mday != p_cache->tm_mday)
+        || (p_tm_time_utc->tm_mon != p_cache->tm_mon) || (p_tm_time_utc->tm_year != p_cache->tm_year))
+    {
+        return false;
+    }
+    if (((uint32_t)p_tm_time_utc->tm_hour >= OS_TIME_CAL_CACHE_NUM_HOURS_PER_DAY)
+        || ((uint32_t)p_tm_time_utc->tm_min >= OS_TIME_CAL_CACHE_NUM_MINUTES_PER_HOUR)
+        || ((uint32_t)p_tm_time_utc->tm_sec >= OS_TIME_CAL_CACHE_NUM_SECONDS_PER_MINUTE))
+    {
+        // The time fields need to be normalized, it will be done by os_mkgmtime.
+        return false;
+    }
+    const int64_t unix_time = p_cache->day_start
+                              + ((int64_t)p_tm_time_utc->tm_hour * OS_TIME_CAL_CACHE_NUM_SECONDS_PER_HOUR)
+                              + ((int64_t)p_tm_time_utc->tm_min * OS_TIME_CAL_CACHE_NUM_SECONDS_PER_MINUTE)
+                              + p_tm_time_utc->tm_sec;
+    if ((unix_time < 0) || (unix_time > INT32_MAX))
+    {
+        // Let os_mkgmtime handle the time which is out of its range.
+        return false;
+    }
+    p_tm_time_utc->tm_wday  = p_cache->tm_wday;
+    p_tm_time_utc->tm_yday  = p_cache->tm_yday;
+    p_tm_time_utc->tm_isdst = 0;
+    *p_unix_time            = (time_t)unix_time;
+    return true;
+}
+
+ATTR_NONNULL(1, 2)
+time_t
+os_time_cal_cache_mkgmtime(os_time_cal_cache_t* const p_cache, struct tm* const p_tm_time_utc)
+{
+    time_t unix_time = 0;
+    if (os_time_cal_cache_mkgmtime_from_cache(p_cache, p_tm_time_utc, &unix_time))
+    {
+        return unix_time;
+    }
+    unix_time = os_mkgmtime(p_tm_time_utc);
+    if ((time_t)(-1) != unix_time)
+    {
+        os_time_cal_cache_update(p_cache, p_tm_time_utc, (int64_t)unix_time);
+    }
+    return unix_time;
+}
+
+static bool
+os_time_cal_cache_shared_load(os_time_cal_cache_t* const p_cache)
+{
+    os_time_cal_cache_shared_t* const p_shared = &g_os_time_cal_cache_shared;
+
+    const uint32_t seq_begin = atomic_load_explicit(&p_shared->seq, memory_order_acquire);
+    if ((0 == seq_begin) || (0 != (seq_begin & 1U)))
+    {
+        return false;
+    }
+    const int32_t days    = atomic_load_explicit(&p_shared->days, memory_order_relaxed);
+    const int32_t tm_year = atomic_load_explicit(&p_shared->tm_year, memory_order_relaxed);
+    const int32_t tm_mon  = atomic_load_explicit(&p_shared->tm_mon, memory_order_relaxed);
+    const int32_t tm_mday = atomic_load_explicit(&p_shared->tm_mday, memory_order_relaxed);
+    const int32_t tm_wday = atomic_load_explicit(&p_shared->tm_wday, memory_order_relaxed);
+    const int32_t tm_yday = atomic_load_explicit(&p_shared->tm_yday, memory_order_relaxed);
+
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&p_shared->seq, memory_order_relaxed) != seq_begin)
+    {
+        return false;
+    }
+    p_cache->day_start = (int64_t)days * OS_TIME_CAL_CACHE_NUM_SECONDS_PER_DAY;
+    p_cache->tm_year   = tm_year;
+    p_cache->tm_mon    = tm_mon;
+    p_cache->tm_mday   = tm_mday;
+    p_cache->tm_wday   = tm_wday;
+    p_cache->tm_yday   = tm_yday;
+    p_cache->is_valid  = true;
+    return true;
+}
+
+/**
+ * @brief Try to lock the global cache for writing.
+ * @note Only one task can refresh the cache at a time, the others just skip refreshing it.
+ * @param[out] p_seq - ptr to the variable which receives the sequence number before locking.
+ * @return true if the cache has been locked.
+ */
+static bool
+os_time_cal_cache_shared_try_lock(uint32_t* const p_seq)
+{
+    os_time_cal_cache_shared_t* const p_shared = &g_os_time_cal_cache_shared;
+
+    uint32_t seq = atomic_load_explicit(&p_shared->seq, memory_order_relaxed);
+    if ((0 != (seq & 1U))
+        || (!atomic_compare_exchange_strong_explicit(
+            &p_shared->seq,
+            &seq,
+            seq + 1U,
+            memory_order_acquire,
+            memory_order_relaxed)))
+    {
+        return false;
+    }
+    atomic_thread_fence(memory_order_release);
+    *p_seq = seq;
+    return true;
+}
+
+static void
+os_time_cal_cache_shared_store(const os_time_cal_cache_t* const p_cache)
+{
+    os_time_cal_cache_shared_t* const p_shared = &g_os_time_cal_cache_shared;
+
+    const int64_t days = p_cache->day_start / OS_TIME_CAL_CACHE_NUM_SECONDS_PER_DAY;
+    if ((days > INT32_MAX) || (days < INT32_MIN))
+    {
+        return;
+    }
+    uint32_t seq = 0;
+    if (!os_time_cal_cache_shared_try_lock(&seq))
+    {
+        return;
+    }
+    atomic_store_explicit(&p_shared->days, (int32_t)days, memory_order_relaxed);
+    atomic_store_explicit(&p_shared->tm_year, p_cache->tm_year, memory_order_relaxed);
+    atomic_store_explicit(&p_shared->tm_mon, p_cache->tm_mon, memory_order_relaxed);
+    atomic_store_explicit(&p_shared->tm_mday, p_cache->tm_mday, memory_order_relaxed);
+    atomic_store_explicit(&p_shared->tm_wday, p_cache->tm_wday, memory_order_relaxed);
+    atomic_store_explicit(&p_shared->tm_yday, p_cache->tm_yday, memory_order_relaxed);
+    uint32_t seq_next = seq + 2U;
+    if (0 == seq_next)
+    {
+        // 0 is reserved for the empty cache
+        seq_next = 2U;
+    }
+    atomic_store_explicit(&p_shared->seq, seq_next, memory_order_release);
+}
+
+/**
+ * @brief Publish the local copy of the cache to the global cache if the local copy has been refreshed.
+ */
+static void
+os_time_cal_cache_shared_publish(
+    const os_time_cal_cache_t* const p_cache,
+    const bool                       is_loaded,
+    const int64_t                    prev_day_start)
+{
+    if (p_cache->is_valid && ((!is_loaded) || (prev_day_start != p_cache->day_start)))
+    {
+        os_time_cal_cache_shared_store(p_cache);
+    }
+}
+
+ATTR_NONNULL(2)
+struct tm*
+os_time_cal_cache_shared_gmtime_r(const time_t unix_time, struct tm* const p_tm_time_utc)
+{
+    os_time_cal_cache_t cache = { 0 };
+
+    const bool    is_loaded      = os_time_cal_cache_shared_load(&cache);
+    const int64_t prev_day_start = cache.day_start;
+    if (NULL == os_time_cal_cache_gmtime_r(&cache, unix_time, p_tm_time_utc))
+    {
+        return NULL;
+    }
+    os_time_cal_cache_shared_publish(&cache, is_loaded, prev_day_start);
+    return p_tm_time_utc;
+}
+
+ATTR_NONNULL(1)
+time_t
+os_time_cal_cache_shared_mkgmtime(struct tm* const p_tm_time_utc)
+{
+    os_time_cal_cache_t cache = { 0 };
+
+    const bool    is_loaded      = os_time_cal_cache_shared_load(&cache);
+    const int64_t prev_day_start = cache.day_start;
+    const time_t  unix_time      = os_time_cal_cache_mkgmtime(&cache, p_tm_time_utc);
+    if ((time_t)(-1) != unix_time)
+    {
+        os_time_cal_cache_shared_publish(&cache, is_loaded, prev_day_start);
+    }
+    return unix_time;
+}
+
+void
+os_time_cal_cache_shared_reset(void)
+{
+    uint32_t seq = 0;
+    if (!os_time_cal_cache_shared_try_lock(&seq))
+    {
+        return;
+    }
+    atomic_store_explicit(&g_os_time_cal_cache_shared.seq, 0, memory_order_release);
+}
@@ -0,0 +1,44 @@
+/**
+ * @file os_time_mono.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_time_mono.h"
+#include "freertos/task.h"
+
+#define OS_TIME_MONO_HAS_ESP_TIMER 0
+
+#if defined __has_include
+#if __has_include("esp_timer.h")
+#undef OS_TIME_MONO_HAS_ESP_TIMER
+#define OS_TIME_MONO_HAS_ESP_TIMER 1
+#endif
+#endif
+
+#if OS_TIME_MONO_HAS_ESP_TIMER
+#include "esp_timer.h"
+#endif
+
+_Static_assert(sizeof(TickType_t) <= sizeof(uint32_t), "TickType_t must not be wider than 32 bits");
+
+os_time_mono_tick64_t
+os_time_mono_get_tick64(void)
+{
+    // vTaskSetTimeOutState reads xTickCount and xNumOfOverflows in a critical section,
+    // so they are always consistent with each other.
+    TimeOut_t time_out = { 0 };
+    vTaskSetTimeOutState(&time_out);
+    return os_time_mono_tick64_make((uint32_t)time_out.xOverflowCount, time_out.xTimeOnEntering);
+}
+
+TimeUnitsMicroSeconds_t
+os_time_mono_get_us(void)
+{
+#if OS_TIME_MONO_HAS_ESP_TIMER
+    return (TimeUnitsMicroSeconds_t)esp_timer_get_time();
+#else
+    return os_time_mono_conv_ticks_to_us(os_time_mono_get_tick64());
+#endif
+}
@@ -6,23 +6,25 @@
  */
 
 #include "os_timer_sig.h"
+#include <stdatomic.h>
 #include "os_timer.h"
 #include "os_signal.h"
 #include "os_wrapper_types.h"
 #include "os_malloc.h"
 #include "os_mutex.h"
+#include "os_time_mono.h"
 #include "attribs.h"
 
 struct os_timer_sig_periodic_t
 {
-    os_timer_periodic_t* p_timer;
-    os_signal_t*         p_signal;
-    os_signal_num_e      sig_num;
-    os_delta_ticks_t     period_ticks;
-    TickType_t           last_tick_when_timer_was_triggered;
-    bool                 is_static;
-    volatile bool        is_active;
-    bool                 flag_need_to_restart;
+    os_timer_periodic_t*  p_timer;
+    os_signal_t*          p_signal;
+    os_signal_num_e       sig_num;
+    os_delta_ticks_t      period_ticks;
+    atomic_uint_least64_t last_tick_when_timer_was_triggered;
+    bool                  is_static;
+    volatile bool         is_active;
+    bool                  flag_need_to_restart;
 };
 
 _Static_assert(
@@ -31,19 +33,37 @@ _Static_assert(
 
 struct os_timer_sig_one_shot_t
 {
-    os_timer_one_shot_t* p_timer;
-    os_signal_t*         p_signal;
-    os_signal_num_e      sig_num;
-    os_delta_ticks_t     period_ticks;
-    TickType_t           last_tick_when_timer_was_triggered;
-    bool                 is_static;
-    volatile bool        is_active;
+    os_timer_one_shot_t*  p_timer;
+    os_signal_t*          p_signal;
+    os_signal_num_e       sig_num;
+    os_delta_ticks_t      period_ticks;
+    atomic_uint_least64_t last_tick_when_timer_was_triggered;
+    bool                  is_static;
+    volatile bool         is_active;
 };
 
 _Static_assert(
     sizeof(os_timer_sig_one_shot_t) == sizeof(os_timer_sig_one_shot_static_obj_t),
     "os_timer_sig_one_shot_t != os_timer_sig_one_shot_static_t");
 
+/**
+ * @brief Store the timestamp when the timer was triggered.
+ * @note The timestamp is written by the timer service task and read by the other tasks in *_relaunch,
+ *       so it is stored as a 64-bit atomic to avoid torn reads on 32-bit CPUs
+ *       (on ESP32 the toolchain implements such atomics using a critical section).
+ */
+static void
+os_timer_sig_last_tick_set(atomic_uint_least64_t* const p_last_tick, const os_time_mono_tick64_t tick64)
+{
+    atomic_store_explicit(p_last_tick, tick64, memory_order_relaxed);
+}
+
+static os_time_mono_tick64_t
+os_timer_sig_last_tick_get(atomic_uint_least64_t* const p_last_tick)
+{
+    return atomic_load_explicit(p_last_tick, memory_order_relaxed);
+}
+
 static void
 os_timer_sig_cb_periodic(ATTR_UNUSED os_timer_periodic_t* p_timer, void* p_arg)
 {
@@ -51,8 +71,8 @@ os_timer_sig_cb_periodic(ATTR_UNUSED os_timer_periodic_t* p_timer, void* p_arg)
     {
         return;
     }
-    os_timer_sig_periodic_t* p_obj            = p_arg;
-    p_obj->last_tick_when_timer_was_triggered = xTaskGetTickCount();
+    os_timer_sig_periodic_t* p_obj = p_arg;
+    os_timer_sig_last_tick_set(&p_obj->last_tick_when_timer_was_triggered, os_time_mono_get_tick64());
     if (p_obj->flag_need_to_restart)
     {
         p_obj->is_active            = os_timer_periodic_restart(p_obj->p_timer, p_obj->period_ticks);
@@ -71,8 +91,8 @@ os_timer_sig_cb_one_shot(ATTR_UNUSED os_timer_one_shot_t* p_timer, void* p_arg)
     {
         return;
     }
-    os_timer_sig_one_shot_t* p_obj            = p_arg;
-    p_obj->last_tick_when_timer_was_triggered = xTaskGetTickCount();
+    os_timer_sig_one_shot_t* p_obj = p_arg;
+    os_timer_sig_last_tick_set(&p_obj->last_tick_when_timer_was_triggered, os_time_mono_get_tick64());
     if (p_obj->is_active)
     {
         p_obj->is_active = false;
@@ -93,13 +113,15 @@ os_timer_sig_periodic_create(
     {
         return NULL;
     }
-    p_obj->p_signal                           = p_signal;
-    p_obj->sig_num                            = sig_num;
-    p_obj->period_ticks                       = period_ticks;
-    p_obj->last_tick_when_timer_was_triggered = xTaskGetTickCount() - period_ticks;
-    p_obj->is_static                          = false;
-    p_obj->is_active                          = false;
-    p_obj->flag_need_to_restart               = false;
+    p_obj->p_signal             = p_signal;
+    p_obj->sig_num              = sig_num;
+    p_obj->period_ticks         = period_ticks;
+    p_obj->is_static            = false;
+    p_obj->is_active            = false;
+    p_obj->flag_need_to_restart = false;
+    os_timer_sig_last_tick_set(
+        &p_obj->last_tick_when_timer_was_triggered,
+        os_time_mono_get_tick64() - period_ticks);
     p_obj->p_timer = os_timer_periodic_create(p_timer_name, period_ticks, &os_timer_sig_cb_periodic, p_obj);
     if (NULL == p_obj->p_timer)
     {
@@ -122,13 +144,15 @@ os_timer_sig_periodic_create_static(
 {
     os_timer_sig_periodic_t* const p_obj = (os_timer_sig_periodic_t*)&p_timer_sig_mem->obj_mem;
 
-    p_obj->p_signal                           = p_signal;
-    p_obj->sig_num                            = sig_num;
-    p_obj->period_ticks                       = period_ticks;
-    p_obj->last_tick_when_timer_was_triggered = xTaskGetTickCount() - period_ticks;
-    p_obj->is_static                          = true;
-    p_obj->is_active                          = false;
-    p_obj->flag_need_to_restart               = false;
+    p_obj->p_signal             = p_signal;
+    p_obj->sig_num              = sig_num;
+    p_obj->period_ticks         = period_ticks;
+    p_obj->is_static            = true;
+    p_obj->is_active            = false;
+    p_obj->flag_need_to_restart = false;
+    os_timer_sig_last_tick_set(
+        &p_obj->last_tick_when_timer_was_triggered,
+        os_time_mono_get_tick64() - period_ticks);
 
     p_obj->p_timer = os_timer_periodic_create_static(
         &p_timer_sig_mem->os_timer_mem,
@@ -152,12 +176,14 @@ os_timer_sig_one_shot_create(
     {
         return NULL;
     }
-    p_obj->p_signal                           = p_signal;
-    p_obj->sig_num                            = sig_num;
-    p_obj->period_ticks                       = period_ticks;
-    p_obj->last_tick_when_timer_was_triggered = xTaskGetTickCount() - period_ticks;
-    p_obj->is_static                          = false;
-    p_obj->is_active                          = false;
+    p_obj->p_signal     = p_signal;
+    p_obj->sig_num      = sig_num;
+    p_obj->period_ticks = period_ticks;
+    p_obj->is_static    = false;
+    p_obj->is_active    = false;
+    os_timer_sig_last_tick_set(
+        &p_obj->last_tick_when_timer_was_triggered,
+        os_time_mono_get_tick64() - period_ticks);
     p_obj->p_timer = os_timer_one_shot_create(p_timer_name, period_ticks, &os_timer_sig_cb_one_shot, p_obj);
     if (NULL == p_obj->p_timer)
     {
@@ -180,12 +206,14 @@ os_timer_sig_one_shot_create_static(
 {
     os_timer_sig_one_shot_t* const p_obj = (os_timer_sig_one_shot_t*)&p_timer_sig_mem->obj_mem;
 
-    p_obj->p_signal                           = p_signal;
-    p_obj->sig_num                            = sig_num;
-    p_obj->period_ticks                       = period_ticks;
-    p_obj->last_tick_when_timer_was_triggered = xTaskGetTickCount() - period_ticks;
-    p_obj->is_static                          = true;
-    p_obj->is_active                          = false;
+    p_obj->p_signal     = p_signal;
+    p_obj->sig_num      = sig_num;
+    p_obj->period_ticks = period_ticks;
+    p_obj->is_static    = true;
+    p_obj->is_active    = false;
+    os_timer_sig_last_tick_set(
+        &p_obj->last_tick_when_timer_was_triggered,
+        os_time_mono_get_tick64() - period_ticks);
 
     p_obj->p_timer = os_timer_one_shot_create_static(
         &p_timer_sig_mem->os_timer_mem,
@@ -339,7 +367,9 @@ os_timer_sig_one_shot_update_timestamp_when_timer_was_triggered(
     os_timer_sig_one_shot_t* const p_obj,
     const TickType_t               timestamp)
 {
-    p_obj->last_tick_when_timer_was_triggered = timestamp;
+    os_timer_sig_last_tick_set(
+        &p_obj->last_tick_when_timer_was_triggered,
+        os_time_mono_tick64_extend(os_time_mono_get_tick64(), timestamp));
 }
 
 void
@@ -347,7 +377,9 @@ os_timer_sig_periodic_update_timestamp_when_timer_was_triggered(
     os_timer_sig_periodic_t* const p_obj,
     const TickType_t               timestamp)
 {
-    p_obj->last_tick_when_timer_was_triggered = timestamp;
+    os_timer_sig_last_tick_set(
+        &p_obj->last_tick_when_timer_was_triggered,
+        os_time_mono_tick64_extend(os_time_mono_get_tick64(), timestamp));
 }
 
 void
@@ -360,21 +392,29 @@ os_timer_sig_periodic_relaunch(os_timer_sig_periodic_t* const p_obj, bool flag_r
     p_obj->is_active = false;
     os_timer_periodic_stop(p_obj->p_timer);
 
-    int32_t          delta_ticks = (int32_t)p_obj->period_ticks;
-    const TickType_t cur_tick    = xTaskGetTickCount();
+    // Unsigned math is used, because the period can be up to OS_DELTA_TICKS_MAX
+    // (e.g. os_delta_ticks_from_ms saturates to it), which does not fit in int32_t.
+    os_delta_ticks_t            delta_ticks = p_obj->period_ticks;
+    const os_time_mono_tick64_t cur_tick64  = os_time_mono_get_tick64();
     if (flag_restart_from_current_moment)
     {
-        os_timer_sig_periodic_update_timestamp_when_timer_was_triggered(p_obj, cur_tick);
+        os_timer_sig_last_tick_set(&p_obj->last_tick_when_timer_was_triggered, cur_tick64);
     }
     else
     {
-        const os_delta_ticks_t elapsed_ticks = cur_tick - p_obj->last_tick_when_timer_was_triggered;
+        // 64-bit ticks are used to calculate the elapsed time correctly even if the timer was not triggered
+        // for longer than the wrap-around period of TickType_t.
+        const os_time_mono_tick64_t last_tick64 = os_timer_sig_last_tick_get(
+            &p_obj->last_tick_when_timer_was_triggered);
+        const os_time_mono_tick64_t elapsed_ticks = cur_tick64 - last_tick64;
 
-        delta_ticks = (int32_t)(p_obj->period_ticks - elapsed_ticks);
+        delta_ticks = (elapsed_ticks >= p_obj->period_ticks)
+                          ? 0
+                          : (p_obj->period_ticks - (os_delta_ticks_t)elapsed_ticks);
     }
-    if (delta_ticks > 0)
+    if (0 != delta_ticks)
     {
-        if (delta_ticks == (int32_t)p_obj->period_ticks)
+        if (delta_ticks == p_obj->period_ticks)
         {
             p_obj->flag_need_to_restart = false;
             p_obj->is_active            = os_timer_periodic_restart(p_obj->p_timer, p_obj->period_ticks);
@@ -403,21 +443,29 @@ os_timer_sig_one_shot_relaunch(os_timer_sig_one_shot_t* const p_obj, const bool
     p_obj->is_active = false;
     os_timer_one_shot_stop(p_obj->p_timer);
 
-    int32_t          delta_ticks = (int32_t)p_obj->period_ticks;
-    const TickType_t cur_tick    = xTaskGetTickCount();
+    // Unsigned math is used, because the period can be up to OS_DELTA_TICKS_MAX
+    // (e.g. os_delta_ticks_from_ms saturates to it), which does not fit in int32_t.
+    os_delta_ticks_t            delta_ticks = p_obj->period_ticks;
+    const os_time_mono_tick64_t cur_tick64  = os_time_mono_get_tick64();
     if (flag_restart_from_current_moment)
     {
-        os_timer_sig_one_shot_update_timestamp_when_timer_was_triggered(p_obj, cur_tick);
+        os_timer_sig_last_tick_set(&p_obj->last_tick_when_timer_was_triggered, cur_tick64);
     }
     else
     {
-        const os_delta_ticks_t elapsed_ticks = cur_tick - p_obj->last_tick_when_timer_was_triggered;
+        // 64-bit ticks are used to calculate the elapsed time correctly even if the timer was not triggered
+        // for longer than the wrap-around period of TickType_t.
+        const os_time_mono_tick64_t last_tick64 = os_timer_sig_last_tick_get(
+            &p_obj->last_tick_when_timer_was_triggered);
+        const os_time_mono_tick64_t elapsed_ticks = cur_tick64 - last_tick64;
 
-        delta_ticks = (int32_t)(p_obj->period_ticks - elapsed_ticks);
+        delta_ticks = (elapsed_ticks >= p_obj->period_ticks)
+                          ? 0
+                          : (p_obj->period_ticks - (os_delta_ticks_t)elapsed_ticks);
     }
-    if (delta_ticks > 0)
+    if (0 != delta_ticks)
     {
-        if (delta_ticks == (int32_t)p_obj->period_ticks)
+        if (delta_ticks == p_obj->period_ticks)
         {
             p_obj->is_active = os_timer_one_shot_restart(p_obj->p_timer, p_obj->period_ticks);
         }
@@ -0,0 +1,158 @@
+/**
+ * @file bench_freertos.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "bench_freertos.hpp"
+#include <cassert>
+#include <cstdarg>
+#include <cstdio>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log_test.h"
+
+#define BENCH_LOG_BUF_SIZE (256U)
+
+static BenchFreertos* g_pBenchFreertos;
+
+extern "C" {
+
+/* The log records are formatted into a static buffer and discarded, so that logging does not dominate the results. */
+static char     g_bench_log_buf[BENCH_LOG_BUF_SIZE];
+static uint32_t g_bench_log_cnt;
+
+uint32_t
+esp_log_timestamp(void)
+{
+    return 0;
+}
+
+void
+esp_log_write(esp_log_level_t level, const char* tag, const char* fmt, ...)
+{
+    (void)level;
+    (void)tag;
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(g_bench_log_buf, sizeof(g_bench_log_buf), fmt, args);
+    va_end(args);
+    g_bench_log_cnt += 1;
+}
+
+void
+tdd_assert_trap(void)
+{
+    assert(0);
+}
+
+static volatile int32_t g_flagDisableCheckIsThreadFreeRTOS;
+
+void
+disableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    ++g_flagDisableCheckIsThreadFreeRTOS;
+}
+
+void
+enableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    --g_flagDisableCheckIsThreadFreeRTOS;
+    assert(g_flagDisableCheckIsThreadFreeRTOS >= 0);
+}
+
+int
+checkIfCurThreadIsFreeRTOS(void)
+{
+    if (nullptr == g_pBenchFreertos)
+    {
+        return false;
+    }
+    if (g_flagDisableCheckIsThreadFreeRTOS)
+    {
+        return true;
+    }
+    return (pthread_self() == g_pBenchFreertos->pid_main) ? false : true;
+}
+
+} // extern "C"
+
+static void
+cmdHandlerTask(void* p_param)
+{
+    auto* pObj     = static_cast<BenchFreertos*>(p_param);
+    bool  flagExit = false;
+    sem_post(&pObj->semaFreeRTOS);
+    while (!flagExit)
+    {
+        const std::function<void(void)> func = pObj->cmdQueue.pop();
+        if (func)
+        {
+            func();
+        }
+        else
+        {
+            flagExit = true;
+        }
+        pObj->cmdQueue.notify_handled();
+    }
+    vTaskDelete(nullptr);
+}
+
+static void*
+freertosStartup(void* arg)
+{
+    auto* pObj = static_cast<BenchFreertos*>(arg);
+    disableCheckingIfCurThreadIsFreeRTOS();
+    const bool res = xTaskCreate(
+        &cmdHandlerTask,
+        "cmdHandlerTask",
+        configMINIMAL_STACK_SIZE * 4,
+        pObj,
+        tskIDLE_PRIORITY + 1,
+        nullptr);
+    assert(res);
+    vTaskStartScheduler();
+    return nullptr;
+}
+
+BenchFreertos::BenchFreertos()
+    : Test()
+    , pid_main(0)
+    , pid_freertos(0)
+    , semaFreeRTOS({})
+{
+}
+
+BenchFreertos::~BenchFreertos() = default;
+
+void
+BenchFreertos::SetUp()
+{
+    g_pBenchFreertos = this;
+    sem_init(&semaFreeRTOS, 0, 0);
+    pid_main      = pthread_self();
+    const int err = pthread_create(&pid_freertos, nullptr, &freertosStartup, this);
+    assert(0 == err);
+    while (0 != sem_wait(&semaFreeRTOS))
+    {
+    }
+}
+
+void
+BenchFreertos::TearDown()
+{
+    cmdQueue.push_and_wait(std::function<void(void)>());
+    vTaskEndScheduler();
+    void* ret_code = nullptr;
+    pthread_join(pid_freertos, &ret_code);
+    sem_destroy(&semaFreeRTOS);
+    g_pBenchFreertos = nullptr;
+}
+
+void
+BenchFreertos::run_in_freertos(const std::function<void(void)>& func)
+{
+    cmdQueue.push_and_wait(func);
+}
@@ -0,0 +1,48 @@
+/**
+ * @file bench_freertos.hpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_BENCH_FREERTOS_HPP
+#define RUUVI_BENCH_FREERTOS_HPP
+
+#include <functional>
+#include <pthread.h>
+#include <semaphore.h>
+#include "gtest/gtest.h"
+#include "TQueue.hpp"
+
+/**
+ * @brief The base class for benchmarks which need the FreeRTOS scheduler (POSIX simulator).
+ * @note The scheduler is started in a separate thread for every benchmark,
+ *       the benchmark body is executed in the context of a FreeRTOS task by run_in_freertos.
+ */
+class BenchFreertos : public ::testing::Test
+{
+protected:
+    void
+    SetUp() override;
+
+    void
+    TearDown() override;
+
+public:
+    pthread_t                          pid_main;
+    pthread_t                          pid_freertos;
+    sem_t                              semaFreeRTOS;
+    TQueue<std::function<void(void)>> cmdQueue;
+
+    BenchFreertos();
+
+    ~BenchFreertos() override;
+
+    /**
+     * @brief Execute func in the context of a FreeRTOS task and wait until it is finished.
+     */
+    void
+    run_in_freertos(const std::function<void(void)>& func);
+};
+
+#endif // RUUVI_BENCH_FREERTOS_HPP
@@ -0,0 +1,38 @@
+/**
+ * @file bench_log_dump.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <array>
+#include "bench_freertos.hpp"
+#include "bench_report.hpp"
+#define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
+#include "log.h"
+
+#define BENCH_LOG_DUMP_NUM_ITERATIONS (20000U)
+#define BENCH_LOG_DUMP_BUF_SIZE       (256U)
+
+class BenchLogDump : public BenchFreertos
+{
+};
+
+TEST_F(BenchLogDump, log_print_dump) // NOLINT
+{
+    std::array<uint8_t, BENCH_LOG_DUMP_BUF_SIZE> buf {};
+    for (size_t i = 0; i < buf.size(); ++i)
+    {
+        buf[i] = (uint8_t)i;
+    }
+    uint64_t total_ns = 0;
+    // log_print_dump gets the task name and priority, so it must be called from a FreeRTOS task
+    this->run_in_freertos([&]() {
+        total_ns = bench_measure_ns(BENCH_LOG_DUMP_NUM_ITERATIONS, [&](const uint64_t i) {
+            (void)i;
+            log_print_dump(ESP_LOG_INFO, "bench", "I", buf.data(), (uint32_t)buf.size());
+        });
+    });
+    ASSERT_NE(0, total_ns);
+    bench_report_throughput("log_print_dump_256_bytes", BENCH_LOG_DUMP_NUM_ITERATIONS, total_ns);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file bench_mac_addr.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "gtest/gtest.h"
+#include "mac_addr.h"
+#include "str_buf.h"
+#include "bench_report.hpp"
+
+#define BENCH_MAC_ADDR_NUM_ITERATIONS (1000000U)
+
+/**
+ * @brief The previous implementation of mac_addr_from_str (strtok_r + strlen + isxdigit + strtol),
+ * it is used as the baseline for the benchmark.
+ */
+static bool
+mac_addr_from_str_legacy(const char* const p_mac_addr_str, mac_address_bin_t* p_mac_addr_bin)
+{
+    mac_address_str_t mac_addr_str;
+    if (strlen(p_mac_addr_str) >= sizeof(mac_addr_str))
+    {
+        return false;
+    }
+    strcpy(mac_addr_str.str_buf, p_mac_addr_str);
+
+    const char* const p_delim    = ":";
+    char*             p_save_ptr = nullptr;
+    char*             p_token    = strtok_r(mac_addr_str.str_buf, p_delim, &p_save_ptr);
+    if (nullptr == p_token)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < MAC_ADDRESS_NUM_BYTES && p_token != nullptr; ++i)
+    {
+        if (strlen(p_token) != 2 || !isxdigit(p_token[0]) || !isxdigit(p_token[1]))
+        {
+            return false;
+        }
+        p_mac_addr_bin->mac[i] = (uint8_t)strtol(p_token, nullptr, 16);
+        p_token                = strtok_r(nullptr, p_delim, &p_save_ptr);
+    }
+    return nullptr == p_token;
+}
+
+/**
+ * @brief The previous implementation of mac_address_to_str (str_buf_printf per byte),
+ * it is used as the baseline for the benchmark.
+ */
+static mac_address_str_t
+mac_address_to_str_legacy(const mac_address_bin_t* p_mac)
+{
+    mac_address_str_t mac_str = { 0 };
+    str_buf_t         str_buf = STR_BUF_INIT_WITH_ARR(mac_str.str_buf);
+    const uint8_t*    p_buf   = p_mac->mac;
+    for (size_t i = 0; i < MAC_ADDRESS_NUM_BYTES; ++i)
+    {
+        if (0 != i)
+        {
+            str_buf_printf(&str_buf, ":");
+        }
+        str_buf_printf(&str_buf, "%02X", p_buf[i]);
+    }
+    return mac_str;
+}
+
+TEST(BenchMacAddr, from_str) // NOLINT
+{
+    const std::array<const char*, 4> arr_of_mac_str = {
+        "11:22:33:AA:BB:CC",
+        "C8:25:2D:8E:9C:2C",
+        "ff:ee:dd:cc:bb:aa",
+        "01:23:45:67:89:AB",
+    };
+    // Both implementations must produce the same results
+    for (const char* const p_mac_str : arr_of_mac_str)
+    {
+        mac_address_bin_t mac_addr_bin1 = { 0 };
+        mac_address_bin_t mac_addr_bin2 = { 0 };
+        ASSERT_TRUE(mac_addr_from_str_legacy(p_mac_str, &mac_addr_bin1));
+        ASSERT_TRUE(mac_addr_from_str(p_mac_str, &mac_addr_bin2));
+        ASSERT_EQ(0, memcmp(&mac_addr_bin1, &mac_addr_bin2, sizeof(mac_addr_bin1)));
+    }
+
+    uint32_t          checksum     = 0;
+    mac_address_bin_t mac_addr_bin = { 0 };
+
+    const uint64_t legacy_ns = bench_measure_ns(BENCH_MAC_ADDR_NUM_ITERATIONS, [&](const uint64_t i) {
+        checksum += mac_addr_from_str_legacy(arr_of_mac_str[i % arr_of_mac_str.size()], &mac_addr_bin) ? 1 : 0;
+        checksum += mac_addr_bin.mac[5];
+    });
+    const uint64_t fast_ns = bench_measure_ns(BENCH_MAC_ADDR_NUM_ITERATIONS, [&](const uint64_t i) {
+        checksum -= mac_addr_from_str(arr_of_mac_str[i % arr_of_mac_str.size()], &mac_addr_bin) ? 1 : 0;
+        checksum -= mac_addr_bin.mac[5];
+    });
+    ASSERT_EQ(0, checksum);
+
+    bench_report_throughput("mac_addr_from_str_legacy", BENCH_MAC_ADDR_NUM_ITERATIONS, legacy_ns);
+    bench_report_throughput("mac_addr_from_str", BENCH_MAC_ADDR_NUM_ITERATIONS, fast_ns);
+}
+
+TEST(BenchMacAddr, to_str) // NOLINT
+{
+    const std::array<mac_address_bin_t, 4> arr_of_mac = {
+        MAC_ADDR_INIT(0x11, 0x22, 0x33, 0xAA, 0xBB, 0xCC),
+        MAC_ADDR_INIT(0xC8, 0x25, 0x2D, 0x8E, 0x9C, 0x2C),
+        MAC_ADDR_INIT(0xFF, 0xEE, 0xDD, 0xCC, 0xBB, 0xAA),
+        MAC_ADDR_INIT(0x01, 0x23, 0x45, 0x67, 0x89, 0xAB),
+    };
+    // Both implementations must produce the same results
+    for (const mac_address_bin_t& mac : arr_of_mac)
+    {
+        ASSERT_EQ(
+            std::string(mac_address_to_str_legacy(&mac).str_buf),
+            std::string(mac_address_to_str(&mac).str_buf));
+    }
+
+    uint32_t checksum = 0;
+
+    const uint64_t legacy_ns = bench_measure_ns(BENCH_MAC_ADDR_NUM_ITERATIONS, [&](const uint64_t i) {
+        const mac_address_str_t mac_str = mac_address_to_str_legacy(&arr_of_mac[i % arr_of_mac.size()]);
+        checksum += (uint8_t)mac_str.str_buf[i % MAC_ADDR_STR_LEN];
+    });
+    const uint64_t fast_ns = bench_measure_ns(BENCH_MAC_ADDR_NUM_ITERATIONS, [&](const uint64_t i) {
+        const mac_address_str_t mac_str = mac_address_to_str(&arr_of_mac[i % arr_of_mac.size()]);
+        checksum -= (uint8_t)mac_str.str_buf[i % MAC_ADDR_STR_LEN];
+    });
+    ASSERT_EQ(0, checksum);
+
+    bench_report_throughput("mac_address_to_str_legacy", BENCH_MAC_ADDR_NUM_ITERATIONS, legacy_ns);
+    bench_report_throughput("mac_address_to_str", BENCH_MAC_ADDR_NUM_ITERATIONS, fast_ns);
+}
@@ -0,0 +1,90 @@
+/**
+ * @file bench_mac_addr_map.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "mac_addr_map.h"
+#include "bench_report.hpp"
+
+#define BENCH_MAC_ADDR_MAP_NUM_LOOKUPS (1000000U)
+
+static std::vector<mac_address_bin_t>
+bench_gen_random_macs(const size_t num, const uint32_t seed)
+{
+    std::mt19937                   rng(seed);
+    std::vector<mac_address_bin_t> arr_of_mac(num);
+    for (auto& mac : arr_of_mac)
+    {
+        for (auto& byte : mac.mac)
+        {
+            byte = (uint8_t)rng();
+        }
+    }
+    return arr_of_mac;
+}
+
+static void
+bench_mac_addr_map_lookup(const uint32_t num_devices)
+{
+    mac_addr_map_t* p_map = mac_addr_map_create(num_devices, sizeof(uint32_t));
+    ASSERT_NE(nullptr, p_map);
+
+    const std::vector<mac_address_bin_t> arr_of_mac         = bench_gen_random_macs(num_devices, num_devices);
+    const std::vector<mac_address_bin_t> arr_of_unknown_mac = bench_gen_random_macs(num_devices, num_devices + 1);
+    for (uint32_t i = 0; i < num_devices; ++i)
+    {
+        *static_cast<uint32_t*>(mac_addr_map_insert(p_map, &arr_of_mac[i], 0, nullptr)) = i;
+    }
+    ASSERT_EQ(num_devices, mac_addr_map_get_num_items(p_map));
+
+    // Half of the lookups are hits, half are misses.
+    // The linear search is much slower, so it is measured on a smaller number of lookups.
+    const uint32_t num_linear_lookups = BENCH_MAC_ADDR_MAP_NUM_LOOKUPS / num_devices * 10U;
+    uint64_t       checksum_linear    = 0;
+    const uint64_t linear_ns          = bench_measure_ns(num_linear_lookups, [&](const uint64_t i) {
+        const uint32_t           idx = (uint32_t)((i * 7919U) % num_devices);
+        const mac_address_bin_t& mac = (0 == (i & 1U)) ? arr_of_mac[idx] : arr_of_unknown_mac[idx];
+        for (uint32_t j = 0; j < num_devices; ++j)
+        {
+            if (0 == memcmp(&arr_of_mac[j], &mac, sizeof(mac)))
+            {
+                checksum_linear += j;
+                break;
+            }
+        }
+    });
+
+    uint64_t       checksum_map = 0;
+    const uint64_t map_ns       = bench_measure_ns(BENCH_MAC_ADDR_MAP_NUM_LOOKUPS, [&](const uint64_t i) {
+        const uint32_t           idx     = (uint32_t)((i * 7919U) % num_devices);
+        const mac_address_bin_t& mac     = (0 == (i & 1U)) ? arr_of_mac[idx] : arr_of_unknown_mac[idx];
+        const uint32_t* const    p_value = static_cast<uint32_t*>(mac_addr_map_find(p_map, &mac));
+        if ((nullptr != p_value) && (i < num_linear_lookups))
+        {
+            checksum_map += *p_value;
+        }
+    });
+    mac_addr_map_delete(&p_map);
+    ASSERT_EQ(checksum_linear, checksum_map);
+
+    const std::string suffix = "_" + std::to_string(num_devices);
+    bench_report_throughput("mac_addr_linear_search" + suffix, num_linear_lookups, linear_ns);
+    bench_report_throughput("mac_addr_map_find" + suffix, BENCH_MAC_ADDR_MAP_NUM_LOOKUPS, map_ns);
+}
+
+TEST(BenchMacAddrMap, lookup_1k) // NOLINT
+{
+    bench_mac_addr_map_lookup(1000);
+}
+
+TEST(BenchMacAddrMap, lookup_10k) // NOLINT
+{
+    bench_mac_addr_map_lookup(10000);
+}
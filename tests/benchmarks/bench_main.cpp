@@ -0,0 +1,60 @@
+/**
+ * @file bench_main.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ *
+ * Benchmarks are registered as googletest tests (TEST/TEST_F) and report their results via bench_report_*.
+ * Usage: ruuvi_esp_wrappers-benchmarks [--gtest_filter=...] [--bench_json=<file>] [--bench_csv=<file>]
+ */
+
+#include <cstring>
+#include <string>
+#include "gtest/gtest.h"
+#include "bench_report.hpp"
+
+static bool
+parse_arg(const char* const p_arg, const char* const p_prefix, std::string& value)
+{
+    const size_t prefix_len = strlen(p_prefix);
+    if (0 != strncmp(p_arg, p_prefix, prefix_len))
+    {
+        return false;
+    }
+    value = std::string(&p_arg[prefix_len]);
+    return true;
+}
+
+int
+main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    std::string json_file_name;
+    std::string csv_file_name;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!parse_arg(argv[i], "--bench_json=", json_file_name) && !parse_arg(argv[i], "--bench_csv=", csv_file_name))
+        {
+            fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    int res = RUN_ALL_TESTS();
+
+    printf("\n");
+    bench_report_print(stdout);
+
+    if ((!json_file_name.empty()) && (!bench_report_write_json(json_file_name)))
+    {
+        fprintf(stderr, "Failed to write %s\n", json_file_name.c_str());
+        res = 1;
+    }
+    if ((!csv_file_name.empty()) && (!bench_report_write_csv(csv_file_name)))
+    {
+        fprintf(stderr, "Failed to write %s\n", csv_file_name.c_str());
+        res = 1;
+    }
+    return res;
+}
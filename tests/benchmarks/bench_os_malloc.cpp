@@ -0,0 +1,90 @@
+/**
+ * @file bench_os_malloc.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <array>
+#include "gtest/gtest.h"
+#include "os_malloc.h"
+#include "bench_report.hpp"
+
+#define BENCH_OS_MALLOC_NUM_ITERATIONS (200000U)
+#define BENCH_OS_MALLOC_NUM_BLOCKS     (64U)
+#define BENCH_OS_MALLOC_SIZE_MASK      (0xFFU)
+
+TEST(BenchOsMalloc, malloc_free) // NOLINT
+{
+    uint32_t num_failed = 0;
+
+    const uint64_t total_ns = bench_measure_ns(BENCH_OS_MALLOC_NUM_ITERATIONS, [&](const uint64_t i) {
+        void* p_mem = os_malloc(16U + (i & BENCH_OS_MALLOC_SIZE_MASK));
+        if (nullptr == p_mem)
+        {
+            num_failed += 1;
+        }
+        os_free(p_mem);
+    });
+    ASSERT_EQ(0, num_failed);
+    bench_report_throughput("os_malloc_os_free", BENCH_OS_MALLOC_NUM_ITERATIONS, total_ns);
+}
+
+TEST(BenchOsMalloc, calloc_free) // NOLINT
+{
+    uint32_t num_failed = 0;
+
+    const uint64_t total_ns = bench_measure_ns(BENCH_OS_MALLOC_NUM_ITERATIONS, [&](const uint64_t i) {
+        void* p_mem = os_calloc(1, 16U + (i & BENCH_OS_MALLOC_SIZE_MASK));
+        if (nullptr == p_mem)
+        {
+            num_failed += 1;
+        }
+        os_free(p_mem);
+    });
+    ASSERT_EQ(0, num_failed);
+    bench_report_throughput("os_calloc_os_free", BENCH_OS_MALLOC_NUM_ITERATIONS, total_ns);
+}
+
+TEST(BenchOsMalloc, interleaved_blocks) // NOLINT
+{
+    // Keep up to BENCH_OS_MALLOC_NUM_BLOCKS blocks alive and replace them in a shuffled order
+    std::array<void*, BENCH_OS_MALLOC_NUM_BLOCKS> blocks {};
+    uint32_t                                      num_failed = 0;
+
+    const uint64_t total_ns = bench_measure_ns(BENCH_OS_MALLOC_NUM_ITERATIONS, [&](const uint64_t i) {
+        const size_t idx = (size_t)((i * 7U) % blocks.size());
+        os_free(blocks[idx]);
+        blocks[idx] = os_malloc(16U + ((i * 13U) & BENCH_OS_MALLOC_SIZE_MASK));
+        if (nullptr == blocks[idx])
+        {
+            num_failed += 1;
+        }
+    });
+    for (void*& p_mem : blocks)
+    {
+        os_free(p_mem);
+    }
+    ASSERT_EQ(0, num_failed);
+    bench_report_throughput("os_malloc_os_free_interleaved", BENCH_OS_MALLOC_NUM_ITERATIONS, total_ns);
+}
+
+TEST(BenchOsMalloc, realloc_safe_grow) // NOLINT
+{
+    uint32_t num_failed = 0;
+
+    const uint64_t total_ns = bench_measure_ns(BENCH_OS_MALLOC_NUM_ITERATIONS / 16U, [&](const uint64_t i) {
+        (void)i;
+        void* p_mem = nullptr;
+        for (size_t size = 16; size <= 256; size += 16)
+        {
+            if (!os_realloc_safe(&p_mem, size))
+            {
+                num_failed += 1;
+            }
+        }
+        os_free(p_mem);
+    });
+    ASSERT_EQ(0, num_failed);
+    bench_report_throughput("os_realloc_safe_16_steps", BENCH_OS_MALLOC_NUM_ITERATIONS / 16U, total_ns);
+}
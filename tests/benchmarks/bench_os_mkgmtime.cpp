@@ -0,0 +1,57 @@
+/**
+ * @file bench_os_mkgmtime.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <ctime>
+#include "gtest/gtest.h"
+#include "os_mkgmtime.h"
+#include "bench_report.hpp"
+
+#define BENCH_OS_MKGMTIME_NUM_ITERATIONS (1000000U)
+
+TEST(BenchOsMkgmtime, gmtime) // NOLINT
+{
+    const time_t base_time = 1700000000;
+    int64_t      checksum  = 0;
+
+    // The previous implementation of os_mkgmtime calculated the time and then called gmtime_r to normalize tm
+    const uint64_t gmtime_r_ns = bench_measure_ns(BENCH_OS_MKGMTIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        const time_t time_val = base_time + (time_t)i * 997;
+        struct tm    tm_time  = {};
+        gmtime_r(&time_val, &tm_time);
+        checksum += tm_time.tm_mday;
+    });
+    const uint64_t os_gmtime64_ns = bench_measure_ns(BENCH_OS_MKGMTIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        struct tm tm_time = {};
+        os_gmtime64_r((int64_t)base_time + (int64_t)i * 997, &tm_time);
+        checksum -= tm_time.tm_mday;
+    });
+    ASSERT_EQ(0, checksum);
+
+    bench_report_throughput("gmtime_r", BENCH_OS_MKGMTIME_NUM_ITERATIONS, gmtime_r_ns);
+    bench_report_throughput("os_gmtime64_r", BENCH_OS_MKGMTIME_NUM_ITERATIONS, os_gmtime64_ns);
+}
+
+TEST(BenchOsMkgmtime, mkgmtime) // NOLINT
+{
+    int64_t checksum = 0;
+
+    const uint64_t os_mkgmtime64_ns = bench_measure_ns(BENCH_OS_MKGMTIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        struct tm tm_time = {};
+        tm_time.tm_year   = 2023 - 1900;
+        tm_time.tm_mon    = 11 - 1;
+        tm_time.tm_mday   = 14;
+        tm_time.tm_hour   = 22;
+        tm_time.tm_min    = 13;
+        tm_time.tm_sec    = (int)(i % 1000000U);
+        int64_t unix_time = 0;
+        os_mkgmtime64(&tm_time, &unix_time);
+        checksum += unix_time;
+    });
+    ASSERT_NE(0, checksum);
+
+    bench_report_throughput("os_mkgmtime64", BENCH_OS_MKGMTIME_NUM_ITERATIONS, os_mkgmtime64_ns);
+}
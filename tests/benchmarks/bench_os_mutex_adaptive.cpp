@@ -0,0 +1,118 @@
+/**
+ * @file bench_os_mutex_adaptive.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <atomic>
+#include "bench_freertos.hpp"
+#include "bench_report.hpp"
+#include "os_mutex.h"
+#include "os_mutex_adaptive.h"
+#include "os_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define BENCH_OS_MUTEX_ADAPTIVE_NUM_TASKS      (4U)
+#define BENCH_OS_MUTEX_ADAPTIVE_NUM_ITERATIONS (20000U)
+#define BENCH_OS_MUTEX_ADAPTIVE_NUM_LOCKS \
+    (BENCH_OS_MUTEX_ADAPTIVE_NUM_TASKS * BENCH_OS_MUTEX_ADAPTIVE_NUM_ITERATIONS)
+
+class BenchOsMutexAdaptive : public BenchFreertos
+{
+public:
+    os_mutex_static_t          mutex_mem {};
+    os_mutex_t                 h_mutex {};
+    os_mutex_adaptive_static_t mutex_adaptive_mem {};
+    os_mutex_adaptive_t*       p_mutex_adaptive {};
+    uint32_t                   counter {};
+    std::atomic<uint32_t>      num_finished_tasks {};
+
+    uint64_t
+    run(os_task_finite_func_with_param_t p_func);
+};
+
+static void
+bench_os_mutex_task(void* p_param)
+{
+    auto* const pObj = static_cast<BenchOsMutexAdaptive*>(p_param);
+    for (uint32_t i = 0; i < BENCH_OS_MUTEX_ADAPTIVE_NUM_ITERATIONS; ++i)
+    {
+        os_mutex_lock(pObj->h_mutex);
+        pObj->counter += 1;
+        os_mutex_unlock(pObj->h_mutex);
+    }
+    pObj->num_finished_tasks += 1;
+}
+
+static void
+bench_os_mutex_adaptive_task(void* p_param)
+{
+    auto* const pObj = static_cast<BenchOsMutexAdaptive*>(p_param);
+    for (uint32_t i = 0; i < BENCH_OS_MUTEX_ADAPTIVE_NUM_ITERATIONS; ++i)
+    {
+        os_mutex_adaptive_lock(pObj->p_mutex_adaptive);
+        pObj->counter += 1;
+        os_mutex_adaptive_unlock(pObj->p_mutex_adaptive);
+    }
+    pObj->num_finished_tasks += 1;
+}
+
+uint64_t
+BenchOsMutexAdaptive::run(os_task_finite_func_with_param_t p_func)
+{
+    uint64_t total_ns = 0;
+
+    this->counter            = 0;
+    this->num_finished_tasks = 0;
+    this->run_in_freertos([&]() {
+        const uint64_t t1 = bench_get_clock_monotonic_ns();
+        for (uint32_t i = 0; i < BENCH_OS_MUTEX_ADAPTIVE_NUM_TASKS; ++i)
+        {
+            if (!os_task_create_finite(p_func, "bench", configMINIMAL_STACK_SIZE, this, tskIDLE_PRIORITY + 1))
+            {
+                return;
+            }
+        }
+        while (BENCH_OS_MUTEX_ADAPTIVE_NUM_TASKS != this->num_finished_tasks)
+        {
+            vTaskDelay(1);
+        }
+        total_ns = bench_get_clock_monotonic_ns() - t1;
+    });
+    EXPECT_EQ(BENCH_OS_MUTEX_ADAPTIVE_NUM_LOCKS, this->counter);
+    return total_ns;
+}
+
+/**
+ * The POSIX simulator is single-core, so OS_MUTEX_ADAPTIVE_SPIN is 0 here and this benchmark measures
+ * only the overhead of the bookkeeping of os_mutex_adaptive over os_mutex.
+ * The spinning itself is covered by the unit-tests in test_os_mutex_adaptive with stubbed core functions.
+ */
+TEST_F(BenchOsMutexAdaptive, mutex_vs_mutex_adaptive) // NOLINT
+{
+    this->run_in_freertos([&]() {
+        this->h_mutex          = os_mutex_create_static(&this->mutex_mem);
+        this->p_mutex_adaptive = os_mutex_adaptive_create_static(&this->mutex_adaptive_mem);
+    });
+    ASSERT_NE(nullptr, this->h_mutex);
+    ASSERT_NE(nullptr, this->p_mutex_adaptive);
+
+    const uint64_t mutex_ns = this->run(&bench_os_mutex_task);
+    ASSERT_FALSE(HasFailure());
+    const uint64_t mutex_adaptive_ns = this->run(&bench_os_mutex_adaptive_task);
+    ASSERT_FALSE(HasFailure());
+
+    os_mutex_adaptive_stat_t stat = {};
+    this->run_in_freertos([&]() {
+        os_mutex_adaptive_get_stat(this->p_mutex_adaptive, &stat);
+        os_mutex_adaptive_delete(&this->p_mutex_adaptive);
+        os_mutex_delete(&this->h_mutex);
+    });
+    ASSERT_EQ(BENCH_OS_MUTEX_ADAPTIVE_NUM_LOCKS, stat.num_locks);
+    ASSERT_EQ(stat.num_locks, stat.num_acquired_immediately + stat.num_spin_successes + stat.num_blocks);
+
+    bench_report_throughput("os_mutex_4_tasks", BENCH_OS_MUTEX_ADAPTIVE_NUM_LOCKS, mutex_ns);
+    bench_report_throughput("os_mutex_adaptive_4_tasks", BENCH_OS_MUTEX_ADAPTIVE_NUM_LOCKS, mutex_adaptive_ns);
+}
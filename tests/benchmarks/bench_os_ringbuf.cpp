@@ -0,0 +1,231 @@
+/**
+ * @file bench_os_ringbuf.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include "bench_freertos.hpp"
+#include "bench_report.hpp"
+#include "os_ringbuf.h"
+#include "os_signal.h"
+#include "os_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#define BENCH_OS_RINGBUF_MAX_NUM_PRODUCERS        (2U)
+#define BENCH_OS_RINGBUF_NUM_ITEMS_PER_PRODUCER   (50000U)
+#define BENCH_OS_RINGBUF_CAPACITY                 (64U)
+#define BENCH_OS_RINGBUF_BATCH_SIZE               (8U)
+#define BENCH_OS_RINGBUF_PRODUCER_IDX_SHIFT       (24U)
+#define BENCH_OS_RINGBUF_SIG_RINGBUF              (OS_SIGNAL_NUM_0)
+#define BENCH_OS_RINGBUF_CONSUMER_WAIT_TIMEOUT_MS (1000U)
+
+typedef enum bench_os_ringbuf_type_e
+{
+    BENCH_OS_RINGBUF_TYPE_QUEUE,
+    BENCH_OS_RINGBUF_TYPE_SPSC,
+    BENCH_OS_RINGBUF_TYPE_MPSC,
+} bench_os_ringbuf_type_e;
+
+class BenchOsRingbuf : public BenchFreertos
+{
+public:
+    bench_os_ringbuf_type_e  type {};
+    uint32_t                 num_producers {};
+    std::atomic<uint32_t>    producer_idx {};
+    os_signal_static_t       signal_mem {};
+    os_signal_t*             p_signal {};
+    os_ringbuf_spsc_static_t ringbuf_spsc_mem {};
+    os_ringbuf_spsc_t*       p_ringbuf_spsc {};
+    os_ringbuf_mpsc_static_t ringbuf_mpsc_mem {};
+    os_ringbuf_mpsc_t*       p_ringbuf_mpsc {};
+    QueueHandle_t            h_queue {};
+    uint32_t                 num_received {};
+    uint32_t                 num_wakeups {};
+    bool                     is_order_valid {};
+
+    std::array<uint8_t, OS_RINGBUF_SPSC_BUF_SIZE(sizeof(uint32_t), BENCH_OS_RINGBUF_CAPACITY)> ringbuf_spsc_buf {};
+    std::array<uint32_t, OS_RINGBUF_MPSC_BUF_SIZE(sizeof(uint32_t), BENCH_OS_RINGBUF_CAPACITY) / sizeof(uint32_t)>
+        ringbuf_mpsc_buf {};
+
+    uint64_t
+    run(const bench_os_ringbuf_type_e type, const uint32_t num_producers);
+};
+
+static void
+bench_os_ringbuf_producer_task(void* p_param)
+{
+    auto* const    pObj = static_cast<BenchOsRingbuf*>(p_param);
+    const uint32_t tag  = pObj->producer_idx++ << BENCH_OS_RINGBUF_PRODUCER_IDX_SHIFT;
+
+    std::array<uint32_t, BENCH_OS_RINGBUF_BATCH_SIZE> batch {};
+    uint32_t                                          next_val = 0;
+    while (next_val < BENCH_OS_RINGBUF_NUM_ITEMS_PER_PRODUCER)
+    {
+        if (BENCH_OS_RINGBUF_TYPE_QUEUE == pObj->type)
+        {
+            const uint32_t val = tag | next_val;
+            (void)xQueueSend(pObj->h_queue, &val, portMAX_DELAY);
+            next_val += 1;
+            continue;
+        }
+        const uint32_t num_items
+            = std::min<uint32_t>(batch.size(), BENCH_OS_RINGBUF_NUM_ITEMS_PER_PRODUCER - next_val);
+        for (uint32_t i = 0; i < num_items; ++i)
+        {
+            batch[i] = tag | (next_val + i);
+        }
+        const uint32_t num_pushed = (BENCH_OS_RINGBUF_TYPE_SPSC == pObj->type)
+                                        ? os_ringbuf_spsc_push_batch(pObj->p_ringbuf_spsc, batch.data(), num_items)
+                                        : os_ringbuf_mpsc_push_batch(pObj->p_ringbuf_mpsc, batch.data(), num_items);
+        if (0 == num_pushed)
+        {
+            taskYIELD();
+        }
+        next_val += num_pushed;
+    }
+}
+
+static uint32_t
+bench_os_ringbuf_receive(BenchOsRingbuf* const pObj, uint32_t* const p_items, const uint32_t max_num_items)
+{
+    switch (pObj->type)
+    {
+        case BENCH_OS_RINGBUF_TYPE_QUEUE:
+            return (pdTRUE == xQueueReceive(pObj->h_queue, p_items, portMAX_DELAY)) ? 1 : 0;
+        case BENCH_OS_RINGBUF_TYPE_SPSC:
+            return os_ringbuf_spsc_pop_batch(pObj->p_ringbuf_spsc, p_items, max_num_items);
+        case BENCH_OS_RINGBUF_TYPE_MPSC:
+            return os_ringbuf_mpsc_pop_batch(pObj->p_ringbuf_mpsc, p_items, max_num_items);
+    }
+    return 0;
+}
+
+static void
+bench_os_ringbuf_consume(BenchOsRingbuf* const pObj)
+{
+    std::array<uint32_t, BENCH_OS_RINGBUF_MAX_NUM_PRODUCERS> next_expected {};
+    std::array<uint32_t, BENCH_OS_RINGBUF_CAPACITY>          items {};
+    const uint32_t num_items_total = pObj->num_producers * BENCH_OS_RINGBUF_NUM_ITEMS_PER_PRODUCER;
+    pObj->is_order_valid           = true;
+    while (pObj->num_received < num_items_total)
+    {
+        const uint32_t num_items = bench_os_ringbuf_receive(pObj, items.data(), items.size());
+        if (0 == num_items)
+        {
+            os_signal_events_t sig_events = { 0 };
+            (void)os_signal_wait_with_timeout(
+                pObj->p_signal,
+                OS_DELTA_MS_TO_TICKS(BENCH_OS_RINGBUF_CONSUMER_WAIT_TIMEOUT_MS),
+                &sig_events);
+            pObj->num_wakeups += 1;
+            continue;
+        }
+        for (uint32_t i = 0; i < num_items; ++i)
+        {
+            const uint32_t producer_idx = items[i] >> BENCH_OS_RINGBUF_PRODUCER_IDX_SHIFT;
+            const uint32_t val          = items[i] & ((1U << BENCH_OS_RINGBUF_PRODUCER_IDX_SHIFT) - 1U);
+            if ((producer_idx >= pObj->num_producers) || (val != next_expected[producer_idx]))
+            {
+                pObj->is_order_valid = false;
+            }
+            else
+            {
+                next_expected[producer_idx] += 1;
+            }
+        }
+        pObj->num_received += num_items;
+    }
+}
+
+uint64_t
+BenchOsRingbuf::run(const bench_os_ringbuf_type_e type, const uint32_t num_producers)
+{
+    uint64_t total_ns = 0;
+
+    this->type          = type;
+    this->num_producers = num_producers;
+    this->producer_idx  = 0;
+    this->num_received  = 0;
+    this->num_wakeups   = 0;
+    // The consumer runs in the cmdHandlerTask, the producers are started as separate tasks
+    this->run_in_freertos([&]() {
+        this->p_signal = os_signal_create_static(&this->signal_mem);
+        os_signal_add(this->p_signal, BENCH_OS_RINGBUF_SIG_RINGBUF);
+        os_signal_register_cur_thread(this->p_signal);
+        this->h_queue        = xQueueCreate(BENCH_OS_RINGBUF_CAPACITY, sizeof(uint32_t));
+        this->p_ringbuf_spsc = os_ringbuf_spsc_create_static(
+            &this->ringbuf_spsc_mem,
+            this->ringbuf_spsc_buf.data(),
+            sizeof(uint32_t),
+            BENCH_OS_RINGBUF_CAPACITY,
+            this->p_signal,
+            BENCH_OS_RINGBUF_SIG_RINGBUF);
+        this->p_ringbuf_mpsc = os_ringbuf_mpsc_create_static(
+            &this->ringbuf_mpsc_mem,
+            this->ringbuf_mpsc_buf.data(),
+            sizeof(uint32_t),
+            BENCH_OS_RINGBUF_CAPACITY,
+            this->p_signal,
+            BENCH_OS_RINGBUF_SIG_RINGBUF);
+
+        const uint64_t t1 = bench_get_clock_monotonic_ns();
+        for (uint32_t i = 0; i < num_producers; ++i)
+        {
+            if (!os_task_create_finite(
+                    &bench_os_ringbuf_producer_task,
+                    "producer",
+                    configMINIMAL_STACK_SIZE,
+                    this,
+                    tskIDLE_PRIORITY + 1))
+            {
+                return;
+            }
+        }
+        bench_os_ringbuf_consume(this);
+        total_ns = bench_get_clock_monotonic_ns() - t1;
+
+        // Let the producers finish and delete themselves
+        vTaskDelay(1);
+        vQueueDelete(this->h_queue);
+        this->h_queue = nullptr;
+        os_signal_unregister_cur_thread(this->p_signal);
+        os_signal_delete(&this->p_signal);
+    });
+    EXPECT_EQ(num_producers * BENCH_OS_RINGBUF_NUM_ITEMS_PER_PRODUCER, this->num_received);
+    EXPECT_TRUE(this->is_order_valid);
+    return total_ns;
+}
+
+TEST_F(BenchOsRingbuf, spsc_vs_queue) // NOLINT
+{
+    const uint32_t num_producers = 1;
+    const uint32_t num_items     = num_producers * BENCH_OS_RINGBUF_NUM_ITEMS_PER_PRODUCER;
+
+    const uint64_t queue_ns = this->run(BENCH_OS_RINGBUF_TYPE_QUEUE, num_producers);
+    ASSERT_FALSE(HasFailure());
+    const uint64_t ringbuf_ns = this->run(BENCH_OS_RINGBUF_TYPE_SPSC, num_producers);
+    ASSERT_FALSE(HasFailure());
+
+    bench_report_throughput("xQueueSend_1_producer", num_items, queue_ns);
+    bench_report_throughput("os_ringbuf_spsc_1_producer", num_items, ringbuf_ns);
+}
+
+TEST_F(BenchOsRingbuf, mpsc_vs_queue) // NOLINT
+{
+    const uint32_t num_producers = BENCH_OS_RINGBUF_MAX_NUM_PRODUCERS;
+    const uint32_t num_items     = num_producers * BENCH_OS_RINGBUF_NUM_ITEMS_PER_PRODUCER;
+
+    const uint64_t queue_ns = this->run(BENCH_OS_RINGBUF_TYPE_QUEUE, num_producers);
+    ASSERT_FALSE(HasFailure());
+    const uint64_t ringbuf_ns = this->run(BENCH_OS_RINGBUF_TYPE_MPSC, num_producers);
+    ASSERT_FALSE(HasFailure());
+
+    bench_report_throughput("xQueueSend_2_producers", num_items, queue_ns);
+    bench_report_throughput("os_ringbuf_mpsc_2_producers", num_items, ringbuf_ns);
+}
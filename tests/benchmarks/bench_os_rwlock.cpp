@@ -0,0 +1,114 @@
+/**
+ * @file bench_os_rwlock.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <atomic>
+#include "bench_freertos.hpp"
+#include "bench_report.hpp"
+#include "os_mutex.h"
+#include "os_rwlock.h"
+#include "os_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define BENCH_OS_RWLOCK_NUM_READERS    (4U)
+#define BENCH_OS_RWLOCK_NUM_ITERATIONS (20000U)
+#define BENCH_OS_RWLOCK_NUM_LOCKS      (BENCH_OS_RWLOCK_NUM_READERS * BENCH_OS_RWLOCK_NUM_ITERATIONS)
+
+class BenchOsRwlock : public BenchFreertos
+{
+public:
+    os_mutex_static_t     mutex_mem {};
+    os_mutex_t            h_mutex {};
+    os_rwlock_static_t    rwlock_mem {};
+    os_rwlock_t*          p_rwlock {};
+    uint32_t              shared_val {};
+    std::atomic<uint32_t> num_reads {};
+    std::atomic<uint32_t> num_finished_tasks {};
+
+    uint64_t
+    run(os_task_finite_func_with_param_t p_func);
+};
+
+static void
+bench_os_rwlock_mutex_reader_task(void* p_param)
+{
+    auto* const pObj = static_cast<BenchOsRwlock*>(p_param);
+    uint32_t    sum  = 0;
+    for (uint32_t i = 0; i < BENCH_OS_RWLOCK_NUM_ITERATIONS; ++i)
+    {
+        os_mutex_lock(pObj->h_mutex);
+        sum += pObj->shared_val;
+        os_mutex_unlock(pObj->h_mutex);
+    }
+    pObj->num_reads += sum;
+    pObj->num_finished_tasks += 1;
+}
+
+static void
+bench_os_rwlock_reader_task(void* p_param)
+{
+    auto* const pObj = static_cast<BenchOsRwlock*>(p_param);
+    uint32_t    sum  = 0;
+    for (uint32_t i = 0; i < BENCH_OS_RWLOCK_NUM_ITERATIONS; ++i)
+    {
+        os_rwlock_read_lock(pObj->p_rwlock);
+        sum += pObj->shared_val;
+        os_rwlock_read_unlock(pObj->p_rwlock);
+    }
+    pObj->num_reads += sum;
+    pObj->num_finished_tasks += 1;
+}
+
+uint64_t
+BenchOsRwlock::run(os_task_finite_func_with_param_t p_func)
+{
+    uint64_t total_ns = 0;
+
+    this->shared_val         = 1;
+    this->num_reads          = 0;
+    this->num_finished_tasks = 0;
+    this->run_in_freertos([&]() {
+        const uint64_t t1 = bench_get_clock_monotonic_ns();
+        for (uint32_t i = 0; i < BENCH_OS_RWLOCK_NUM_READERS; ++i)
+        {
+            if (!os_task_create_finite(p_func, "reader", configMINIMAL_STACK_SIZE, this, tskIDLE_PRIORITY + 1))
+            {
+                return;
+            }
+        }
+        while (BENCH_OS_RWLOCK_NUM_READERS != this->num_finished_tasks)
+        {
+            vTaskDelay(1);
+        }
+        total_ns = bench_get_clock_monotonic_ns() - t1;
+    });
+    EXPECT_EQ(BENCH_OS_RWLOCK_NUM_LOCKS, this->num_reads);
+    return total_ns;
+}
+
+TEST_F(BenchOsRwlock, readers_mutex_vs_rwlock) // NOLINT
+{
+    this->run_in_freertos([&]() {
+        this->h_mutex  = os_mutex_create_static(&this->mutex_mem);
+        this->p_rwlock = os_rwlock_create_static(&this->rwlock_mem);
+    });
+    ASSERT_NE(nullptr, this->h_mutex);
+    ASSERT_NE(nullptr, this->p_rwlock);
+
+    const uint64_t mutex_ns = this->run(&bench_os_rwlock_mutex_reader_task);
+    ASSERT_FALSE(HasFailure());
+    const uint64_t rwlock_ns = this->run(&bench_os_rwlock_reader_task);
+    ASSERT_FALSE(HasFailure());
+
+    this->run_in_freertos([&]() {
+        os_rwlock_delete(&this->p_rwlock);
+        os_mutex_delete(&this->h_mutex);
+    });
+
+    bench_report_throughput("os_mutex_4_readers", BENCH_OS_RWLOCK_NUM_LOCKS, mutex_ns);
+    bench_report_throughput("os_rwlock_read_4_readers", BENCH_OS_RWLOCK_NUM_LOCKS, rwlock_ns);
+}
@@ -0,0 +1,117 @@
+/**
+ * @file bench_os_signal.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <vector>
+#include "bench_freertos.hpp"
+#include "bench_report.hpp"
+#include "os_signal.h"
+#include "os_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define BENCH_OS_SIGNAL_NUM_ROUND_TRIPS (2000U)
+#define BENCH_OS_SIGNAL_SIG_PING        (OS_SIGNAL_NUM_0)
+#define BENCH_OS_SIGNAL_SIG_EXIT        (OS_SIGNAL_NUM_1)
+#define BENCH_OS_SIGNAL_SIG_PONG        (OS_SIGNAL_NUM_0)
+
+class BenchOsSignal : public BenchFreertos
+{
+public:
+    os_signal_static_t sig_ping_mem {};
+    os_signal_static_t sig_pong_mem {};
+    os_signal_t*       p_sig_ping {};
+    os_signal_t*       p_sig_pong {};
+};
+
+static void
+wait_until_registration_state(os_signal_t* const p_signal, const bool is_registered)
+{
+    while (os_signal_is_any_thread_registered(p_signal) != is_registered)
+    {
+        vTaskDelay(1);
+    }
+}
+
+static void
+bench_os_signal_responder_task(void* p_param)
+{
+    auto* const pObj = static_cast<BenchOsSignal*>(p_param);
+    if (!os_signal_register_cur_thread(pObj->p_sig_ping))
+    {
+        return;
+    }
+    bool flag_exit = false;
+    while (!flag_exit)
+    {
+        os_signal_events_t sig_events = {};
+        os_signal_wait(pObj->p_sig_ping, &sig_events);
+        for (;;)
+        {
+            const os_signal_num_e sig_num = os_signal_num_get_next(&sig_events);
+            if (OS_SIGNAL_NUM_NONE == sig_num)
+            {
+                break;
+            }
+            if (BENCH_OS_SIGNAL_SIG_EXIT == sig_num)
+            {
+                flag_exit = true;
+            }
+            else
+            {
+                os_signal_send(pObj->p_sig_pong, BENCH_OS_SIGNAL_SIG_PONG);
+            }
+        }
+    }
+    os_signal_unregister_cur_thread(pObj->p_sig_ping);
+}
+
+TEST_F(BenchOsSignal, ping_pong_latency) // NOLINT
+{
+    std::vector<uint64_t> samples_ns;
+    samples_ns.reserve(BENCH_OS_SIGNAL_NUM_ROUND_TRIPS);
+    bool is_started = false;
+
+    // Round trip between two tasks: os_signal_send -> the responder wakes up and sends a signal back.
+    this->run_in_freertos([&]() {
+        this->p_sig_ping = os_signal_create_static(&this->sig_ping_mem);
+        this->p_sig_pong = os_signal_create_static(&this->sig_pong_mem);
+        os_signal_add(this->p_sig_ping, BENCH_OS_SIGNAL_SIG_PING);
+        os_signal_add(this->p_sig_ping, BENCH_OS_SIGNAL_SIG_EXIT);
+        os_signal_add(this->p_sig_pong, BENCH_OS_SIGNAL_SIG_PONG);
+        if (!os_signal_register_cur_thread(this->p_sig_pong))
+        {
+            return;
+        }
+        is_started = os_task_create_finite(
+            &bench_os_signal_responder_task,
+            "responder",
+            configMINIMAL_STACK_SIZE * 2,
+            this,
+            tskIDLE_PRIORITY + 1);
+        if (is_started)
+        {
+            wait_until_registration_state(this->p_sig_ping, true);
+            for (uint32_t i = 0; i < BENCH_OS_SIGNAL_NUM_ROUND_TRIPS; ++i)
+            {
+                const uint64_t     t1         = bench_get_clock_monotonic_ns();
+                os_signal_events_t sig_events = {};
+                os_signal_send(this->p_sig_ping, BENCH_OS_SIGNAL_SIG_PING);
+                os_signal_wait(this->p_sig_pong, &sig_events);
+                const uint64_t t2 = bench_get_clock_monotonic_ns();
+                samples_ns.push_back(t2 - t1);
+            }
+            os_signal_send(this->p_sig_ping, BENCH_OS_SIGNAL_SIG_EXIT);
+            wait_until_registration_state(this->p_sig_ping, false);
+        }
+        os_signal_unregister_cur_thread(this->p_sig_pong);
+        os_signal_delete(&this->p_sig_ping);
+        os_signal_delete(&this->p_sig_pong);
+    });
+    ASSERT_TRUE(is_started);
+    ASSERT_EQ(BENCH_OS_SIGNAL_NUM_ROUND_TRIPS, samples_ns.size());
+    bench_report_latency("os_signal_round_trip", samples_ns);
+}
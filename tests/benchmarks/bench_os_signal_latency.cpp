@@ -0,0 +1,212 @@
+/**
+ * @file bench_os_signal_latency.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <string>
+#include "bench_freertos.hpp"
+#include "bench_report.hpp"
+#include "os_signal.h"
+#include "os_task.h"
+#include "os_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define BENCH_OS_SIGNAL_LATENCY_NUM_TASKS        (3U)
+#define BENCH_OS_SIGNAL_LATENCY_NUM_SENDS        (300U)
+#define BENCH_OS_SIGNAL_LATENCY_SENDS_PER_DELAY  (4U)
+#define BENCH_OS_SIGNAL_LATENCY_WAIT_TIMEOUT     (10U)
+#define BENCH_OS_SIGNAL_LATENCY_SIG_TASK         (OS_SIGNAL_NUM_0)
+#define BENCH_OS_SIGNAL_LATENCY_SIG_TIMER        (OS_SIGNAL_NUM_1)
+#define BENCH_OS_SIGNAL_LATENCY_SIG_EXIT         (OS_SIGNAL_NUM_2)
+#define BENCH_OS_SIGNAL_LATENCY_NS_PER_US        (1000U)
+#define BENCH_OS_SIGNAL_LATENCY_PERCENT_50       (50U)
+#define BENCH_OS_SIGNAL_LATENCY_PERCENT_99       (99U)
+
+class BenchOsSignalLatency;
+
+class BenchOsSignalLatencySender
+{
+public:
+    BenchOsSignalLatency* pObj {};
+    uint32_t              idx {};
+};
+
+class BenchOsSignalLatency : public BenchFreertos
+{
+public:
+    os_signal_static_t         sig_mem[BENCH_OS_SIGNAL_LATENCY_NUM_TASKS] {};
+    os_signal_t*               p_sig[BENCH_OS_SIGNAL_LATENCY_NUM_TASKS] {};
+    BenchOsSignalLatencySender senders[BENCH_OS_SIGNAL_LATENCY_NUM_TASKS] {};
+    volatile uint32_t          num_senders_running {};
+    uint32_t                   timer_cnt {};
+};
+
+static uint32_t
+bench_os_signal_latency_clock_us(void)
+{
+    return (uint32_t)(bench_get_clock_monotonic_ns() / BENCH_OS_SIGNAL_LATENCY_NS_PER_US);
+}
+
+static void
+wait_until_registration_state(os_signal_t* const p_signal, const bool is_registered)
+{
+    while (os_signal_is_any_thread_registered(p_signal) != is_registered)
+    {
+        vTaskDelay(1);
+    }
+}
+
+static void
+bench_os_signal_latency_receiver_task(void* p_param)
+{
+    os_signal_t* const p_signal = static_cast<os_signal_t*>(p_param);
+    if (!os_signal_register_cur_thread(p_signal))
+    {
+        return;
+    }
+    bool flag_exit = false;
+    while (!flag_exit)
+    {
+        os_signal_events_t sig_events = {};
+        if (!os_signal_wait_with_timeout(p_signal, BENCH_OS_SIGNAL_LATENCY_WAIT_TIMEOUT, &sig_events))
+        {
+            continue;
+        }
+        for (;;)
+        {
+            const os_signal_num_e sig_num = os_signal_num_get_next(&sig_events);
+            if (OS_SIGNAL_NUM_NONE == sig_num)
+            {
+                break;
+            }
+            if (BENCH_OS_SIGNAL_LATENCY_SIG_EXIT == sig_num)
+            {
+                flag_exit = true;
+            }
+        }
+    }
+    os_signal_unregister_cur_thread(p_signal);
+}
+
+static void
+bench_os_signal_latency_sender_task(void* p_param)
+{
+    auto* const p_sender = static_cast<BenchOsSignalLatencySender*>(p_param);
+    auto* const pObj     = p_sender->pObj;
+    for (uint32_t i = 0; i < BENCH_OS_SIGNAL_LATENCY_NUM_SENDS; ++i)
+    {
+        // Every sender sends to all the receivers, so the receiver priority may be lower or higher than the sender one
+        const uint32_t receiver_idx = (p_sender->idx + i) % BENCH_OS_SIGNAL_LATENCY_NUM_TASKS;
+        os_signal_send(pObj->p_sig[receiver_idx], BENCH_OS_SIGNAL_LATENCY_SIG_TASK);
+        if (0 == ((i + 1) % BENCH_OS_SIGNAL_LATENCY_SENDS_PER_DELAY))
+        {
+            vTaskDelay(1);
+        }
+    }
+    __atomic_fetch_sub(&pObj->num_senders_running, 1U, __ATOMIC_SEQ_CST);
+}
+
+static void
+bench_os_signal_latency_timer_cb(os_timer_periodic_t* const p_timer, void* const p_arg)
+{
+    (void)p_timer;
+    auto* const    pObj         = static_cast<BenchOsSignalLatency*>(p_arg);
+    const uint32_t receiver_idx = pObj->timer_cnt % BENCH_OS_SIGNAL_LATENCY_NUM_TASKS;
+    pObj->timer_cnt += 1;
+    os_signal_send(pObj->p_sig[receiver_idx], BENCH_OS_SIGNAL_LATENCY_SIG_TIMER);
+}
+
+static void
+bench_os_signal_latency_report(const uint32_t receiver_idx, const os_signal_latency_stat_t* const p_stat)
+{
+    const double mean_us = (0 != p_stat->num_samples) ? ((double)p_stat->total_us / (double)p_stat->num_samples)
+                                                      : 0.0;
+    bench_report_latency_summary(
+        std::string("os_signal_wake_prio_") + std::to_string(receiver_idx + 1),
+        p_stat->num_samples,
+        mean_us * BENCH_OS_SIGNAL_LATENCY_NS_PER_US,
+        (uint64_t)p_stat->min_us * BENCH_OS_SIGNAL_LATENCY_NS_PER_US,
+        (uint64_t)os_signal_latency_get_percentile_us(p_stat, BENCH_OS_SIGNAL_LATENCY_PERCENT_50)
+            * BENCH_OS_SIGNAL_LATENCY_NS_PER_US,
+        (uint64_t)os_signal_latency_get_percentile_us(p_stat, BENCH_OS_SIGNAL_LATENCY_PERCENT_99)
+            * BENCH_OS_SIGNAL_LATENCY_NS_PER_US,
+        (uint64_t)p_stat->max_us * BENCH_OS_SIGNAL_LATENCY_NS_PER_US);
+}
+
+TEST_F(BenchOsSignalLatency, contention_multiple_priorities) // NOLINT
+{
+    os_signal_latency_stat_t stats[BENCH_OS_SIGNAL_LATENCY_NUM_TASKS] = {};
+    bool                     is_started                               = true;
+
+    // Receivers with the priorities 1..3 are woken up by senders with the priorities 1..3
+    // and by the periodic timer callback, the latency is measured by os_signal itself.
+    os_signal_latency_set_clock(&bench_os_signal_latency_clock_us);
+    this->run_in_freertos([&]() {
+        for (uint32_t i = 0; i < BENCH_OS_SIGNAL_LATENCY_NUM_TASKS; ++i)
+        {
+            this->p_sig[i] = os_signal_create_static(&this->sig_mem[i]);
+            os_signal_add(this->p_sig[i], BENCH_OS_SIGNAL_LATENCY_SIG_TASK);
+            os_signal_add(this->p_sig[i], BENCH_OS_SIGNAL_LATENCY_SIG_TIMER);
+            os_signal_add(this->p_sig[i], BENCH_OS_SIGNAL_LATENCY_SIG_EXIT);
+            if (!os_task_create_finite(
+                    &bench_os_signal_latency_receiver_task,
+                    "receiver",
+                    configMINIMAL_STACK_SIZE * 2,
+                    this->p_sig[i],
+                    tskIDLE_PRIORITY + 1 + i))
+            {
+                is_started = false;
+                return;
+            }
+            wait_until_registration_state(this->p_sig[i], true);
+        }
+        os_timer_periodic_t* p_timer = os_timer_periodic_create("bench", 1, &bench_os_signal_latency_timer_cb, this);
+        if (nullptr == p_timer)
+        {
+            is_started = false;
+            return;
+        }
+        os_timer_periodic_start(p_timer);
+
+        this->num_senders_running = BENCH_OS_SIGNAL_LATENCY_NUM_TASKS;
+        for (uint32_t i = 0; i < BENCH_OS_SIGNAL_LATENCY_NUM_TASKS; ++i)
+        {
+            this->senders[i].pObj = this;
+            this->senders[i].idx  = i;
+            if (!os_task_create_finite(
+                    &bench_os_signal_latency_sender_task,
+                    "sender",
+                    configMINIMAL_STACK_SIZE * 2,
+                    &this->senders[i],
+                    tskIDLE_PRIORITY + 1 + i))
+            {
+                is_started = false;
+                __atomic_fetch_sub(&this->num_senders_running, 1U, __ATOMIC_SEQ_CST);
+            }
+        }
+        while (0 != __atomic_load_n(&this->num_senders_running, __ATOMIC_SEQ_CST))
+        {
+            vTaskDelay(1);
+        }
+        os_timer_periodic_stop(p_timer);
+        os_timer_periodic_delete(&p_timer);
+
+        for (uint32_t i = 0; i < BENCH_OS_SIGNAL_LATENCY_NUM_TASKS; ++i)
+        {
+            os_signal_send(this->p_sig[i], BENCH_OS_SIGNAL_LATENCY_SIG_EXIT);
+            wait_until_registration_state(this->p_sig[i], false);
+            os_signal_latency_get_stat(this->p_sig[i], &stats[i]);
+            os_signal_delete(&this->p_sig[i]);
+        }
+    });
+    os_signal_latency_set_clock(nullptr);
+    ASSERT_TRUE(is_started);
+    for (uint32_t i = 0; i < BENCH_OS_SIGNAL_LATENCY_NUM_TASKS; ++i)
+    {
+        ASSERT_NE(0, stats[i].num_samples);
+        bench_os_signal_latency_report(i, &stats[i]);
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file bench_os_str.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <array>
+#include <cstdlib>
+#include "gtest/gtest.h"
+#include "os_str.h"
+#include "bench_report.hpp"
+
+#define BENCH_OS_STR_NUM_ITERATIONS (1000000U)
+
+TEST(BenchOsStr, parse_uint32_dec) // NOLINT
+{
+    const std::array<const char*, 4> arr_of_str = { "0", "2345", "4294967", "123456789" };
+
+    uint32_t       checksum   = 0;
+    const uint64_t strtoul_ns = bench_measure_ns(BENCH_OS_STR_NUM_ITERATIONS, [&](const uint64_t i) {
+        checksum += os_str_to_uint32_cptr(arr_of_str[i % arr_of_str.size()], nullptr, 10);
+    });
+
+    uint32_t       num_failed = 0;
+    const uint64_t fast_ns    = bench_measure_ns(BENCH_OS_STR_NUM_ITERATIONS, [&](const uint64_t i) {
+        uint32_t val = 0;
+        if (!os_str_parse_uint32_dec(arr_of_str[i % arr_of_str.size()], OS_STR_PARSE_LEN_UNLIMITED, nullptr, &val))
+        {
+            num_failed += 1;
+        }
+        checksum -= val;
+    });
+    ASSERT_EQ(0, num_failed);
+    ASSERT_EQ(0, checksum);
+
+    bench_report_throughput("os_str_to_uint32_cptr", BENCH_OS_STR_NUM_ITERATIONS, strtoul_ns);
+    bench_report_throughput("os_str_parse_uint32_dec", BENCH_OS_STR_NUM_ITERATIONS, fast_ns);
+}
+
+TEST(BenchOsStr, parse_float) // NOLINT
+{
+    const std::array<const char*, 4> arr_of_str = { "23.45", "-0.125", "1013.25", "51.5" };
+
+    float          checksum  = 0;
+    const uint64_t strtof_ns = bench_measure_ns(BENCH_OS_STR_NUM_ITERATIONS, [&](const uint64_t i) {
+        checksum += strtof(arr_of_str[i % arr_of_str.size()], nullptr);
+    });
+
+    float          checksum2  = 0;
+    uint32_t       num_failed = 0;
+    const uint64_t fast_ns    = bench_measure_ns(BENCH_OS_STR_NUM_ITERATIONS, [&](const uint64_t i) {
+        float val = 0;
+        if (!os_str_parse_float(arr_of_str[i % arr_of_str.size()], OS_STR_PARSE_LEN_UNLIMITED, nullptr, &val))
+        {
+            num_failed += 1;
+        }
+        checksum2 += val;
+    });
+    ASSERT_EQ(0, num_failed);
+    ASSERT_EQ(checksum, checksum2);
+
+    bench_report_throughput("strtof", BENCH_OS_STR_NUM_ITERATIONS, strtof_ns);
+    bench_report_throughput("os_str_parse_float", BENCH_OS_STR_NUM_ITERATIONS, fast_ns);
+}
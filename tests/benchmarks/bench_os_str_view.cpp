@@ -0,0 +1,134 @@
+/**
+ * @file bench_os_str_view.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include "gtest/gtest.h"
+#include "os_str_view.h"
+#include "os_str.h"
+#include "bench_report.hpp"
+
+#define BENCH_OS_STR_VIEW_NUM_ITERATIONS (1000000U)
+
+typedef struct bench_record_t
+{
+    mac_address_bin_t mac;
+    int32_t           rssi;
+    uint32_t          counter;
+    uint64_t          timestamp;
+    bool              is_connectable;
+    uint8_t           data[31];
+    size_t            data_len;
+} bench_record_t;
+
+static bool
+parse_record_in_place(const char* const p_buf, const size_t len, bench_record_t* const p_rec)
+{
+    os_str_view_t view = OS_STR_VIEW_INIT(p_buf, len);
+    return os_str_view_parse_mac(&view, &p_rec->mac) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_int32(&view, &p_rec->rssi) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_uint32(&view, &p_rec->counter) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_uint64(&view, &p_rec->timestamp) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_bool(&view, &p_rec->is_connectable) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_hex_bytes(&view, p_rec->data, sizeof(p_rec->data), &p_rec->data_len)
+           && os_str_view_is_empty(&view);
+}
+
+/**
+ * @brief The conventional way of parsing: copy every field to a null-terminated buffer and parse it,
+ * it is used as the baseline for the benchmark.
+ */
+static bool
+parse_record_copy_then_parse(const char* const p_buf, const size_t len, bench_record_t* const p_rec)
+{
+    char        field[64];
+    const char* p_cur = p_buf;
+    const char* p_end = &p_buf[len];
+    for (uint32_t field_idx = 0; field_idx < 6; ++field_idx)
+    {
+        const char* p_delim = static_cast<const char*>(memchr(p_cur, ',', (size_t)(p_end - p_cur)));
+        if (nullptr == p_delim)
+        {
+            p_delim = p_end;
+        }
+        const size_t field_len = (size_t)(p_delim - p_cur);
+        if (field_len >= sizeof(field))
+        {
+            return false;
+        }
+        memcpy(field, p_cur, field_len);
+        field[field_len] = '\0';
+        switch (field_idx)
+        {
+            case 0:
+                if (!mac_addr_from_str(field, &p_rec->mac))
+                {
+                    return false;
+                }
+                break;
+            case 1:
+                p_rec->rssi = os_str_to_int32_cptr(field, nullptr, 10);
+                break;
+            case 2:
+                p_rec->counter = os_str_to_uint32_cptr(field, nullptr, 10);
+                break;
+            case 3:
+                p_rec->timestamp = strtoull(field, nullptr, 10);
+                break;
+            case 4:
+                p_rec->is_connectable = (0 == strcmp(field, "true"));
+                break;
+            default:
+                p_rec->data_len = field_len / 2;
+                for (size_t i = 0; i < p_rec->data_len; ++i)
+                {
+                    char byte_str[3] = { field[i * 2], field[i * 2 + 1], '\0' };
+                    p_rec->data[i]   = (uint8_t)os_str_to_uint32_cptr(byte_str, nullptr, 16);
+                }
+                break;
+        }
+        p_cur = p_delim + 1;
+    }
+    return true;
+}
+
+TEST(BenchOsStrView, parse_record) // NOLINT
+{
+    // The record is a part of a bigger receive buffer, so it is not null-terminated
+    const char* const p_rx_buf = "C8:25:2D:8E:9C:2C,-75,1234567,1700000000123,true,0201061BFF99040512FC5394C37C0004"
+                                 "FFFC040CAC364200CDCBB8334C884F\r\nC8:25:2D:8E:9C:2D,...";
+    const size_t      rec_len  = (size_t)(strstr(p_rx_buf, "\r\n") - p_rx_buf);
+
+    // Both implementations must produce the same results
+    bench_record_t rec1 = {};
+    bench_record_t rec2 = {};
+    ASSERT_TRUE(parse_record_copy_then_parse(p_rx_buf, rec_len, &rec1));
+    ASSERT_TRUE(parse_record_in_place(p_rx_buf, rec_len, &rec2));
+    ASSERT_EQ(0, memcmp(&rec1.mac, &rec2.mac, sizeof(rec1.mac)));
+    ASSERT_EQ(rec1.rssi, rec2.rssi);
+    ASSERT_EQ(rec1.counter, rec2.counter);
+    ASSERT_EQ(rec1.timestamp, rec2.timestamp);
+    ASSERT_EQ(rec1.is_connectable, rec2.is_connectable);
+    ASSERT_EQ(rec1.data_len, rec2.data_len);
+    ASSERT_EQ(0, memcmp(rec1.data, rec2.data, rec1.data_len));
+
+    uint32_t       checksum = 0;
+    const uint64_t copy_ns  = bench_measure_ns(BENCH_OS_STR_VIEW_NUM_ITERATIONS, [&](const uint64_t i) {
+        (void)i;
+        checksum += parse_record_copy_then_parse(p_rx_buf, rec_len, &rec1) ? 1 : 0;
+        checksum += rec1.counter;
+    });
+    const uint64_t in_place_ns = bench_measure_ns(BENCH_OS_STR_VIEW_NUM_ITERATIONS, [&](const uint64_t i) {
+        (void)i;
+        checksum -= parse_record_in_place(p_rx_buf, rec_len, &rec2) ? 1 : 0;
+        checksum -= rec2.counter;
+    });
+    ASSERT_EQ(0, checksum);
+
+    bench_report_throughput("parse_record_copy_then_parse", BENCH_OS_STR_VIEW_NUM_ITERATIONS, copy_ns);
+    bench_report_throughput("parse_record_os_str_view", BENCH_OS_STR_VIEW_NUM_ITERATIONS, in_place_ns);
+}
@@ -0,0 +1,68 @@
+/**
+ * @file bench_os_task_log_ctx.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "bench_freertos.hpp"
+#include "bench_report.hpp"
+#include "os_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
+#include "log.h"
+
+#define BENCH_OS_TASK_LOG_CTX_NUM_ITERATIONS (100000U)
+
+static const char* TAG = "bench";
+
+class BenchOsTaskLogCtx : public BenchFreertos
+{
+};
+
+static void
+bench_os_task_log_ctx_reset(void)
+{
+    vTaskSetThreadLocalStoragePointer(nullptr, OS_TASK_LOG_CTX_TLS_IDX_NAME, nullptr);
+}
+
+TEST_F(BenchOsTaskLogCtx, get_name_and_priority) // NOLINT
+{
+    uint64_t          cached_ns   = 0;
+    uint64_t          uncached_ns = 0;
+    volatile uint32_t sum         = 0;
+    this->run_in_freertos([&]() {
+        cached_ns = bench_measure_ns(BENCH_OS_TASK_LOG_CTX_NUM_ITERATIONS, [&](const uint64_t i) {
+            (void)i;
+            sum += os_task_get_priority() + (uint32_t)os_task_get_name()[0];
+        });
+        // The cache is reset before every call, so the time includes filling the cache
+        uncached_ns = bench_measure_ns(BENCH_OS_TASK_LOG_CTX_NUM_ITERATIONS, [&](const uint64_t i) {
+            (void)i;
+            bench_os_task_log_ctx_reset();
+            sum += os_task_get_priority() + (uint32_t)os_task_get_name()[0];
+        });
+    });
+    ASSERT_NE(0, sum);
+    bench_report_throughput("os_task_get_name_priority_cached", BENCH_OS_TASK_LOG_CTX_NUM_ITERATIONS, cached_ns);
+    bench_report_throughput("os_task_get_name_priority_uncached", BENCH_OS_TASK_LOG_CTX_NUM_ITERATIONS, uncached_ns);
+}
+
+TEST_F(BenchOsTaskLogCtx, log_info) // NOLINT
+{
+    uint64_t cached_ns   = 0;
+    uint64_t uncached_ns = 0;
+    this->run_in_freertos([&]() {
+        cached_ns = bench_measure_ns(BENCH_OS_TASK_LOG_CTX_NUM_ITERATIONS, [&](const uint64_t i) {
+            LOG_INFO("Iteration %u", (printf_uint_t)i);
+        });
+        uncached_ns = bench_measure_ns(BENCH_OS_TASK_LOG_CTX_NUM_ITERATIONS, [&](const uint64_t i) {
+            bench_os_task_log_ctx_reset();
+            LOG_INFO("Iteration %u", (printf_uint_t)i);
+        });
+    });
+    ASSERT_NE(0, cached_ns);
+    bench_report_throughput("log_info_with_log_ctx_cached", BENCH_OS_TASK_LOG_CTX_NUM_ITERATIONS, cached_ns);
+    bench_report_throughput("log_info_with_log_ctx_uncached", BENCH_OS_TASK_LOG_CTX_NUM_ITERATIONS, uncached_ns);
+}
@@ -0,0 +1,97 @@
+/**
+ * @file bench_os_time.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <cstring>
+#include <ctime>
+#include "gtest/gtest.h"
+#include "os_time.h"
+#include "os_mkgmtime.h"
+#include "bench_report.hpp"
+
+#define BENCH_OS_TIME_NUM_ITERATIONS (1000000U)
+
+static struct tm
+bench_get_tm(const int64_t unix_time)
+{
+    struct tm tm_time = {};
+    os_gmtime64_r(unix_time, &tm_time);
+    return tm_time;
+}
+
+TEST(BenchOsTime, fmt) // NOLINT
+{
+    const int64_t base_time = 1700000000;
+    char          buf[64]   = {};
+    uint32_t      checksum  = 0;
+
+    const uint64_t strftime_rfc3339_ns = bench_measure_ns(BENCH_OS_TIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        const struct tm tm_time = bench_get_tm(base_time + (int64_t)i);
+        checksum += (uint32_t)strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", &tm_time);
+    });
+    const uint64_t os_time_rfc3339_ns = bench_measure_ns(BENCH_OS_TIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        const struct tm tm_time = bench_get_tm(base_time + (int64_t)i);
+        checksum -= (uint32_t)os_time_fmt_rfc3339(&tm_time, buf, sizeof(buf));
+    });
+    const uint64_t strftime_rfc7231_ns = bench_measure_ns(BENCH_OS_TIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        const struct tm tm_time = bench_get_tm(base_time + (int64_t)i);
+        checksum += (uint32_t)strftime(buf, sizeof(buf), "%a, %d %b %Y %H:%M:%S GMT", &tm_time);
+    });
+    const uint64_t os_time_rfc7231_ns = bench_measure_ns(BENCH_OS_TIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        const struct tm tm_time = bench_get_tm(base_time + (int64_t)i);
+        checksum -= (uint32_t)os_time_fmt_rfc7231(&tm_time, buf, sizeof(buf));
+    });
+    ASSERT_EQ(0, checksum);
+
+    bench_report_throughput("strftime_rfc3339", BENCH_OS_TIME_NUM_ITERATIONS, strftime_rfc3339_ns);
+    bench_report_throughput("os_time_fmt_rfc3339", BENCH_OS_TIME_NUM_ITERATIONS, os_time_rfc3339_ns);
+    bench_report_throughput("strftime_rfc7231", BENCH_OS_TIME_NUM_ITERATIONS, strftime_rfc7231_ns);
+    bench_report_throughput("os_time_fmt_rfc7231", BENCH_OS_TIME_NUM_ITERATIONS, os_time_rfc7231_ns);
+}
+
+TEST(BenchOsTime, parse) // NOLINT
+{
+    const char* const p_rfc3339 = "2023-11-14T22:13:20Z";
+    const char* const p_rfc7231 = "Tue, 14 Nov 2023 22:13:20 GMT";
+    const size_t      len3339   = strlen(p_rfc3339);
+    const size_t      len7231   = strlen(p_rfc7231);
+    int32_t           checksum  = 0;
+
+    const uint64_t strptime_rfc3339_ns = bench_measure_ns(BENCH_OS_TIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        (void)i;
+        struct tm tm_time = {};
+        strptime(p_rfc3339, "%Y-%m-%dT%H:%M:%SZ", &tm_time);
+        checksum += tm_time.tm_sec;
+    });
+    const uint64_t os_time_rfc3339_ns = bench_measure_ns(BENCH_OS_TIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        (void)i;
+        struct tm tm_time = {};
+        if (os_time_parse_rfc3339(p_rfc3339, len3339, &tm_time, nullptr))
+        {
+            checksum -= tm_time.tm_sec;
+        }
+    });
+    const uint64_t strptime_rfc7231_ns = bench_measure_ns(BENCH_OS_TIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        (void)i;
+        struct tm tm_time = {};
+        strptime(p_rfc7231, "%a, %d %b %Y %H:%M:%S GMT", &tm_time);
+        checksum += tm_time.tm_sec;
+    });
+    const uint64_t os_time_rfc7231_ns = bench_measure_ns(BENCH_OS_TIME_NUM_ITERATIONS, [&](const uint64_t i) {
+        (void)i;
+        struct tm tm_time = {};
+        if (os_time_parse_rfc7231(p_rfc7231, len7231, &tm_time))
+        {
+            checksum -= tm_time.tm_sec;
+        }
+    });
+    ASSERT_EQ(0, checksum);
+
+    bench_report_throughput("strptime_rfc3339", BENCH_OS_TIME_NUM_ITERATIONS, strptime_rfc3339_ns);
+    bench_report_throughput("os_time_parse_rfc3339", BENCH_OS_TIME_NUM_ITERATIONS, os_time_rfc3339_ns);
+    bench_report_throughput("strptime_rfc7231", BENCH_OS_TIME_NUM_ITERATIONS, strptime_rfc7231_ns);
+    bench_report_throughput("os_time_parse_rfc7231", BENCH_OS_TIME_NUM_ITERATIONS, os_time_rfc7231_ns);
+}
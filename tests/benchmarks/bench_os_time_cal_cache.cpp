@@ -0,0 +1,79 @@
+/**
+ * @file bench_os_time_cal_cache.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <ctime>
+#include "gtest/gtest.h"
+#include "os_time_cal_cache.h"
+#include "os_mkgmtime.h"
+#include "bench_report.hpp"
+
+#define BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS (1000000U)
+
+static struct tm
+bench_init_tm(const int hour, const int min, const int sec)
+{
+    struct tm tm_time = {};
+    tm_time.tm_year   = 2023 - 1900;
+    tm_time.tm_mon    = 11 - 1;
+    tm_time.tm_mday   = 15;
+    tm_time.tm_hour   = hour;
+    tm_time.tm_min    = min;
+    tm_time.tm_sec    = sec;
+    return tm_time;
+}
+
+TEST(BenchOsTimeCalCache, gmtime_r) // NOLINT
+{
+    const time_t        base_time = 1700006400;
+    int32_t             checksum  = 0;
+    os_time_cal_cache_t cache     = {};
+    os_time_cal_cache_init(&cache);
+    os_time_cal_cache_shared_reset();
+
+    const uint64_t gmtime_r_ns = bench_measure_ns(BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, [&](const uint64_t i) {
+        const time_t unix_time = base_time + (time_t)(i % 86400U);
+        struct tm    tm_time   = {};
+        gmtime_r(&unix_time, &tm_time);
+        checksum += tm_time.tm_sec;
+    });
+    const uint64_t cache_ns = bench_measure_ns(BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, [&](const uint64_t i) {
+        struct tm tm_time = {};
+        os_time_cal_cache_gmtime_r(&cache, base_time + (time_t)(i % 86400U), &tm_time);
+        checksum -= tm_time.tm_sec;
+    });
+    ASSERT_EQ(0, checksum);
+    const uint64_t shared_ns = bench_measure_ns(BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, [&](const uint64_t i) {
+        struct tm tm_time = {};
+        os_time_cal_cache_shared_gmtime_r(base_time + (time_t)(i % 86400U), &tm_time);
+        checksum += tm_time.tm_sec;
+    });
+    ASSERT_NE(0, checksum);
+
+    bench_report_throughput("gmtime_r_same_day", BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, gmtime_r_ns);
+    bench_report_throughput("os_time_cal_cache_gmtime_r", BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, cache_ns);
+    bench_report_throughput("os_time_cal_cache_shared_gmtime_r", BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, shared_ns);
+}
+
+TEST(BenchOsTimeCalCache, mkgmtime) // NOLINT
+{
+    int64_t             checksum = 0;
+    os_time_cal_cache_t cache    = {};
+    os_time_cal_cache_init(&cache);
+
+    const uint64_t os_mkgmtime_ns = bench_measure_ns(BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, [&](const uint64_t i) {
+        struct tm tm_time = bench_init_tm((int)((i / 3600U) % 24U), (int)((i / 60U) % 60U), (int)(i % 60U));
+        checksum += os_mkgmtime(&tm_time);
+    });
+    const uint64_t cache_ns = bench_measure_ns(BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, [&](const uint64_t i) {
+        struct tm tm_time = bench_init_tm((int)((i / 3600U) % 24U), (int)((i / 60U) % 60U), (int)(i % 60U));
+        checksum -= os_time_cal_cache_mkgmtime(&cache, &tm_time);
+    });
+    ASSERT_EQ(0, checksum);
+
+    bench_report_throughput("os_mkgmtime_same_day", BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, os_mkgmtime_ns);
+    bench_report_throughput("os_time_cal_cache_mkgmtime", BENCH_OS_TIME_CAL_CACHE_NUM_ITERATIONS, cache_ns);
+}
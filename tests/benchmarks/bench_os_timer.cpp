@@ -0,0 +1,128 @@
+/**
+ * @file bench_os_timer.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <vector>
+#include "bench_freertos.hpp"
+#include "bench_report.hpp"
+#include "os_signal.h"
+#include "os_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define BENCH_OS_TIMER_NUM_SAMPLES (200U)
+#define BENCH_OS_TIMER_SIG_TIMER   (OS_SIGNAL_NUM_0)
+
+class BenchOsTimer : public BenchFreertos
+{
+public:
+    os_signal_static_t    sig_mem {};
+    os_signal_t*          p_sig {};
+    volatile uint64_t     timestamp_cb {};
+    bool                  is_finished {};
+    std::vector<uint64_t> cb_timestamps;
+};
+
+static void
+bench_os_timer_one_shot_cb(os_timer_one_shot_t* const p_timer, void* const p_arg)
+{
+    (void)p_timer;
+    auto* const pObj   = static_cast<BenchOsTimer*>(p_arg);
+    pObj->timestamp_cb = bench_get_clock_monotonic_ns();
+    os_signal_send(pObj->p_sig, BENCH_OS_TIMER_SIG_TIMER);
+}
+
+static void
+bench_os_timer_periodic_cb(os_timer_periodic_t* const p_timer, void* const p_arg)
+{
+    (void)p_timer;
+    auto* const pObj = static_cast<BenchOsTimer*>(p_arg);
+    if (pObj->cb_timestamps.size() <= BENCH_OS_TIMER_NUM_SAMPLES)
+    {
+        pObj->cb_timestamps.push_back(bench_get_clock_monotonic_ns());
+    }
+    else if (!pObj->is_finished)
+    {
+        // The signal is sent only once, the timer may trigger again before it is stopped
+        pObj->is_finished = true;
+        os_signal_send(pObj->p_sig, BENCH_OS_TIMER_SIG_TIMER);
+    }
+}
+
+TEST_F(BenchOsTimer, one_shot_latency) // NOLINT
+{
+    std::vector<uint64_t> fire_samples_ns;
+    std::vector<uint64_t> wakeup_samples_ns;
+    fire_samples_ns.reserve(BENCH_OS_TIMER_NUM_SAMPLES);
+    wakeup_samples_ns.reserve(BENCH_OS_TIMER_NUM_SAMPLES);
+
+    // Measure the time from os_timer_one_shot_restart with the delay of 1 tick to the callback
+    // and the time from the callback (in the timer service task) to the wake-up of the waiting task.
+    this->run_in_freertos([&]() {
+        this->p_sig = os_signal_create_static(&this->sig_mem);
+        os_signal_add(this->p_sig, BENCH_OS_TIMER_SIG_TIMER);
+        if (!os_signal_register_cur_thread(this->p_sig))
+        {
+            return;
+        }
+        os_timer_one_shot_t* p_timer = os_timer_one_shot_create("bench", 1, &bench_os_timer_one_shot_cb, this);
+        if (nullptr != p_timer)
+        {
+            for (uint32_t i = 0; i < BENCH_OS_TIMER_NUM_SAMPLES; ++i)
+            {
+                os_signal_events_t sig_events = {};
+                const uint64_t     t1         = bench_get_clock_monotonic_ns();
+                if (!os_timer_one_shot_restart(p_timer, 1))
+                {
+                    break;
+                }
+                os_signal_wait(this->p_sig, &sig_events);
+                const uint64_t t2 = bench_get_clock_monotonic_ns();
+                fire_samples_ns.push_back(this->timestamp_cb - t1);
+                wakeup_samples_ns.push_back(t2 - this->timestamp_cb);
+            }
+            os_timer_one_shot_delete(&p_timer);
+        }
+        os_signal_unregister_cur_thread(this->p_sig);
+        os_signal_delete(&this->p_sig);
+    });
+    ASSERT_EQ(BENCH_OS_TIMER_NUM_SAMPLES, fire_samples_ns.size());
+    bench_report_latency("os_timer_one_shot_1_tick_fire", fire_samples_ns);
+    bench_report_latency("os_timer_cb_to_task_wakeup", wakeup_samples_ns);
+}
+
+TEST_F(BenchOsTimer, periodic_jitter) // NOLINT
+{
+    this->cb_timestamps.reserve(BENCH_OS_TIMER_NUM_SAMPLES + 1);
+
+    this->run_in_freertos([&]() {
+        this->p_sig = os_signal_create_static(&this->sig_mem);
+        os_signal_add(this->p_sig, BENCH_OS_TIMER_SIG_TIMER);
+        if (!os_signal_register_cur_thread(this->p_sig))
+        {
+            return;
+        }
+        os_timer_periodic_t* p_timer = os_timer_periodic_create("bench", 1, &bench_os_timer_periodic_cb, this);
+        if (nullptr != p_timer)
+        {
+            os_timer_periodic_start(p_timer);
+            os_signal_events_t sig_events = {};
+            os_signal_wait(this->p_sig, &sig_events);
+            os_timer_periodic_stop(p_timer);
+            os_timer_periodic_delete(&p_timer);
+        }
+        os_signal_unregister_cur_thread(this->p_sig);
+        os_signal_delete(&this->p_sig);
+    });
+    ASSERT_EQ(BENCH_OS_TIMER_NUM_SAMPLES + 1, this->cb_timestamps.size());
+
+    std::vector<uint64_t> intervals_ns;
+    for (size_t i = 1; i < this->cb_timestamps.size(); ++i)
+    {
+        intervals_ns.push_back(this->cb_timestamps[i] - this->cb_timestamps[i - 1]);
+    }
+    bench_report_latency("os_timer_periodic_1_tick_interval", intervals_ns);
+}
@@ -0,0 +1,248 @@
+/**
+ * @file bench_report.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "bench_report.hpp"
+#include <algorithm>
+#include <cinttypes>
+#include <ctime>
+#include "gtest/gtest.h"
+
+#define BENCH_REPORT_PERCENT_50  (50U)
+#define BENCH_REPORT_PERCENT_99  (99U)
+#define BENCH_REPORT_PERCENT_100 (100U)
+
+static std::vector<BenchResult> g_bench_results;
+
+uint64_t
+bench_get_clock_monotonic_ns()
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+static BenchResult
+bench_report_create_result(const std::string& name)
+{
+    BenchResult                      result {};
+    const ::testing::TestInfo* const p_test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    if (nullptr != p_test_info)
+    {
+        result.suite = std::string(p_test_info->test_case_name()) + "." + p_test_info->name();
+    }
+    result.name = name;
+    return result;
+}
+
+void
+bench_report_throughput(const std::string& name, const uint64_t num_iterations, const uint64_t total_ns)
+{
+    BenchResult result    = bench_report_create_result(name);
+    result.num_iterations = num_iterations;
+    result.mean_ns        = (0 != num_iterations) ? ((double)total_ns / (double)num_iterations) : 0.0;
+    g_bench_results.push_back(result);
+}
+
+/**
+ * @brief Get the percentile of the sorted samples using the nearest-rank method.
+ */
+static uint64_t
+bench_report_get_percentile(const std::vector<uint64_t>& sorted_samples, const uint32_t percent)
+{
+    const size_t rank = (sorted_samples.size() * percent + BENCH_REPORT_PERCENT_100 - 1) / BENCH_REPORT_PERCENT_100;
+    return sorted_samples[(0 != rank) ? (rank - 1) : 0];
+}
+
+void
+bench_report_latency(const std::string& name, std::vector<uint64_t> samples_ns)
+{
+    BenchResult result    = bench_report_create_result(name);
+    result.num_iterations = samples_ns.size();
+    if (!samples_ns.empty())
+    {
+        std::sort(samples_ns.begin(), samples_ns.end());
+        uint64_t sum_ns = 0;
+        for (const uint64_t sample_ns : samples_ns)
+        {
+            sum_ns += sample_ns;
+        }
+        result.mean_ns           = (double)sum_ns / (double)samples_ns.size();
+        result.min_ns            = samples_ns.front();
+        result.p50_ns            = bench_report_get_percentile(samples_ns, BENCH_REPORT_PERCENT_50);
+        result.p99_ns            = bench_report_get_percentile(samples_ns, BENCH_REPORT_PERCENT_99);
+        result.max_ns            = samples_ns.back();
+        result.has_latency_stats = true;
+    }
+    g_bench_results.push_back(result);
+}
+
+void
+bench_report_latency_summary(
+    const std::string& name,
+    const uint64_t     num_samples,
+    const double       mean_ns,
+    const uint64_t     min_ns,
+    const uint64_t     p50_ns,
+    const uint64_t     p99_ns,
+    const uint64_t     max_ns)
+{
+    BenchResult result    = bench_report_create_result(name);
+    result.num_iterations = num_samples;
+    if (0 != num_samples)
+    {
+        result.mean_ns           = mean_ns;
+        result.min_ns            = min_ns;
+        result.p50_ns            = p50_ns;
+        result.p99_ns            = p99_ns;
+        result.max_ns            = max_ns;
+        result.has_latency_stats = true;
+    }
+    g_bench_results.push_back(result);
+}
+
+const std::vector<BenchResult>&
+bench_report_get_results()
+{
+    return g_bench_results;
+}
+
+void
+bench_report_print(FILE* p_file)
+{
+    fprintf(
+        p_file,
+        "%-48s %-36s %10s %12s %10s %10s %10s %10s\n",
+        "suite",
+        "name",
+        "iterations",
+        "mean_ns",
+        "min_ns",
+        "p50_ns",
+        "p99_ns",
+        "max_ns");
+    for (const BenchResult& result : g_bench_results)
+    {
+        fprintf(
+            p_file,
+            "%-48s %-36s %10" PRIu64 " %12.1f",
+            result.suite.c_str(),
+            result.name.c_str(),
+            result.num_iterations,
+            result.mean_ns);
+        if (result.has_latency_stats)
+        {
+            fprintf(
+                p_file,
+                " %10" PRIu64 " %10" PRIu64 " %10" PRIu64 " %10" PRIu64,
+                result.min_ns,
+                result.p50_ns,
+                result.p99_ns,
+                result.max_ns);
+        }
+        fprintf(p_file, "\n");
+    }
+}
+
+static std::string
+bench_report_json_escape(const std::string& str)
+{
+    std::string res;
+    for (const char ch : str)
+    {
+        if (('"' == ch) || ('\\' == ch))
+        {
+            res += '\\';
+            res += ch;
+        }
+        else if ((unsigned char)ch < ' ')
+        {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", (unsigned)ch);
+            res += buf;
+        }
+        else
+        {
+            res += ch;
+        }
+    }
+    return res;
+}
+
+bool
+bench_report_write_json(const std::string& file_name)
+{
+    FILE* p_file = fopen(file_name.c_str(), "w");
+    if (nullptr == p_file)
+    {
+        return false;
+    }
+    fprintf(p_file, "{\n");
+    fprintf(p_file, "  \"context\": {\n");
+    fprintf(p_file, "    \"timestamp\": %" PRIu64 ",\n", (uint64_t)time(nullptr));
+    fprintf(p_file, "    \"compiler\": \"%s\"\n", bench_report_json_escape(__VERSION__).c_str());
+    fprintf(p_file, "  },\n");
+    fprintf(p_file, "  \"benchmarks\": [");
+    bool is_first = true;
+    for (const BenchResult& result : g_bench_results)
+    {
+        fprintf(p_file, "%s\n    {", is_first ? "" : ",");
+        is_first = false;
+        fprintf(p_file, "\"suite\": \"%s\", ", bench_report_json_escape(result.suite).c_str());
+        fprintf(p_file, "\"name\": \"%s\", ", bench_report_json_escape(result.name).c_str());
+        fprintf(p_file, "\"iterations\": %" PRIu64 ", ", result.num_iterations);
+        fprintf(p_file, "\"mean_ns\": %.1f", result.mean_ns);
+        if (result.has_latency_stats)
+        {
+            fprintf(
+                p_file,
+                ", \"min_ns\": %" PRIu64 ", \"p50_ns\": %" PRIu64 ", \"p99_ns\": %" PRIu64 ", \"max_ns\": %" PRIu64,
+                result.min_ns,
+                result.p50_ns,
+                result.p99_ns,
+                result.max_ns);
+        }
+        fprintf(p_file, "}");
+    }
+    fprintf(p_file, "\n  ]\n}\n");
+    return 0 == fclose(p_file);
+}
+
+bool
+bench_report_write_csv(const std::string& file_name)
+{
+    FILE* p_file = fopen(file_name.c_str(), "w");
+    if (nullptr == p_file)
+    {
+        return false;
+    }
+    fprintf(p_file, "suite,name,iterations,mean_ns,min_ns,p50_ns,p99_ns,max_ns\n");
+    for (const BenchResult& result : g_bench_results)
+    {
+        fprintf(
+            p_file,
+            "%s,%s,%" PRIu64 ",%.1f",
+            result.suite.c_str(),
+            result.name.c_str(),
+            result.num_iterations,
+            result.mean_ns);
+        if (result.has_latency_stats)
+        {
+            fprintf(
+                p_file,
+                ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n",
+                result.min_ns,
+                result.p50_ns,
+                result.p99_ns,
+                result.max_ns);
+        }
+        else
+        {
+            fprintf(p_file, ",,,,\n");
+        }
+    }
+    return 0 == fclose(p_file);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file bench_report.hpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_BENCH_REPORT_HPP
+#define RUUVI_BENCH_REPORT_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+class BenchResult
+{
+public:
+    std::string suite;
+    std::string name;
+    uint64_t    num_iterations {};
+    double      mean_ns {};
+    uint64_t    min_ns {};
+    uint64_t    p50_ns {};
+    uint64_t    p99_ns {};
+    uint64_t    max_ns {};
+    bool        has_latency_stats {};
+};
+
+uint64_t
+bench_get_clock_monotonic_ns();
+
+/**
+ * @brief Run func num_iterations times and return the total time in nanoseconds.
+ */
+template<typename TFunc>
+uint64_t
+bench_measure_ns(const uint64_t num_iterations, TFunc func)
+{
+    const uint64_t t1 = bench_get_clock_monotonic_ns();
+    for (uint64_t i = 0; i < num_iterations; ++i)
+    {
+        func(i);
+    }
+    const uint64_t t2 = bench_get_clock_monotonic_ns();
+    return t2 - t1;
+}
+
+/**
+ * @brief Add the result of a throughput benchmark (the mean time of one operation) for the current test.
+ */
+void
+bench_report_throughput(const std::string& name, const uint64_t num_iterations, const uint64_t total_ns);
+
+/**
+ * @brief Add the result of a latency benchmark (min/p50/p99/max of the samples) for the current test.
+ */
+void
+bench_report_latency(const std::string& name, std::vector<uint64_t> samples_ns);
+
+/**
+ * @brief Add the result of a latency benchmark for the current test when the statistics are already aggregated
+ *        (e.g. by a histogram collected in the code under test).
+ */
+void
+bench_report_latency_summary(
+    const std::string& name,
+    const uint64_t     num_samples,
+    const double       mean_ns,
+    const uint64_t     min_ns,
+    const uint64_t     p50_ns,
+    const uint64_t     p99_ns,
+    const uint64_t     max_ns);
+
+const std::vector<BenchResult>&
+bench_report_get_results();
+
+void
+bench_report_print(FILE* p_file);
+
+bool
+bench_report_write_json(const std::string& file_name);
+
+bool
+bench_report_write_csv(const std::string& file_name);
+
+#endif // RUUVI_BENCH_REPORT_HPP
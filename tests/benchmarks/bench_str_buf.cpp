@@ -0,0 +1,62 @@
+/**
+ * @file bench_str_buf.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <array>
+#include "gtest/gtest.h"
+#include "str_buf.h"
+#include "os_malloc.h"
+#include "bench_report.hpp"
+
+#define BENCH_STR_BUF_NUM_ITERATIONS (200000U)
+#define BENCH_STR_BUF_BIN_SIZE       (64U)
+
+TEST(BenchStrBuf, printf) // NOLINT
+{
+    std::array<char, 128> buf {};
+    uint64_t              total_len = 0;
+
+    const uint64_t total_ns = bench_measure_ns(BENCH_STR_BUF_NUM_ITERATIONS, [&](const uint64_t i) {
+        str_buf_t str_buf = STR_BUF_INIT(buf.data(), buf.size());
+        str_buf_printf(&str_buf, "id=%u, name=%s, val=%d", (unsigned)i, "sensor", -(int)(i & 0xFFU));
+        total_len += str_buf_get_len(&str_buf);
+    });
+    ASSERT_NE(0, total_len);
+    bench_report_throughput("str_buf_printf", BENCH_STR_BUF_NUM_ITERATIONS, total_ns);
+}
+
+TEST(BenchStrBuf, printf_with_alloc) // NOLINT
+{
+    uint64_t total_len = 0;
+
+    const uint64_t total_ns = bench_measure_ns(BENCH_STR_BUF_NUM_ITERATIONS, [&](const uint64_t i) {
+        str_buf_t str_buf = str_buf_printf_with_alloc("id=%u, name=%s", (unsigned)i, "sensor");
+        total_len += str_buf_get_len(&str_buf);
+        str_buf_free_buf(&str_buf);
+    });
+    ASSERT_NE(0, total_len);
+    bench_report_throughput("str_buf_printf_with_alloc", BENCH_STR_BUF_NUM_ITERATIONS, total_ns);
+}
+
+TEST(BenchStrBuf, bin_to_hex) // NOLINT
+{
+    std::array<uint8_t, BENCH_STR_BUF_BIN_SIZE>        bin {};
+    std::array<char, (BENCH_STR_BUF_BIN_SIZE * 2) + 1> hex {};
+    for (size_t i = 0; i < bin.size(); ++i)
+    {
+        bin[i] = (uint8_t)i;
+    }
+    uint64_t total_len = 0;
+
+    const uint64_t total_ns = bench_measure_ns(BENCH_STR_BUF_NUM_ITERATIONS, [&](const uint64_t i) {
+        (void)i;
+        str_buf_t str_buf = STR_BUF_INIT(hex.data(), hex.size());
+        str_buf_bin_to_hex(&str_buf, bin.data(), bin.size());
+        total_len += str_buf_get_len(&str_buf);
+    });
+    ASSERT_EQ((uint64_t)BENCH_STR_BUF_NUM_ITERATIONS * BENCH_STR_BUF_BIN_SIZE * 2, total_len);
+    bench_report_throughput("str_buf_bin_to_hex_64_bytes", BENCH_STR_BUF_NUM_ITERATIONS, total_ns);
+}
@@ -7,7 +7,9 @@
 
 #include "mac_addr.h"
 #include "gtest/gtest.h"
+#include <array>
 #include <string>
+#include <cstring>
 
 using namespace std;
 
@@ -75,6 +77,105 @@ TEST_F(TestMacAddr, test_mac_address_to_str) // NOLINT
     ASSERT_EQ(string("11:22:33:AA:BB:CC"), string(mac_str.str_buf));
 }
 
+TEST_F(TestMacAddr, test_mac_address_to_str_lower) // NOLINT
+{
+    const mac_address_bin_t mac = MAC_ADDR_INIT(0x11, 0x22, 0x33, 0xAA, 0xBB, 0xCC);
+    const mac_address_str_t mac_str = mac_address_to_str_lower(&mac);
+    ASSERT_EQ(string("11:22:33:aa:bb:cc"), string(mac_str.str_buf));
+}
+
+TEST_F(TestMacAddr, test_mac_address_to_str_no_sep) // NOLINT
+{
+    const mac_address_bin_t mac = MAC_ADDR_INIT(0x11, 0x22, 0x33, 0xAA, 0xBB, 0xCC);
+    const mac_address_str_t mac_str = mac_address_to_str_no_sep(&mac);
+    ASSERT_EQ(string("112233AABBCC"), string(mac_str.str_buf));
+    for (size_t i = MAC_ADDR_STR_NO_SEP_LEN; i < sizeof(mac_str.str_buf); ++i)
+    {
+        ASSERT_EQ('\0', mac_str.str_buf[i]);
+    }
+}
+
+TEST_F(TestMacAddr, test_mac_address_to_str_with_fmt) // NOLINT
+{
+    const mac_address_bin_t mac = MAC_ADDR_INIT(0x0F, 0xF0, 0x00, 0xFF, 0x9A, 0xE5);
+    ASSERT_EQ(
+        string("0F:F0:00:FF:9A:E5"),
+        string(mac_address_to_str_with_fmt(&mac, MAC_ADDR_STR_FMT_COLON_UPPER).str_buf));
+    ASSERT_EQ(
+        string("0f:f0:00:ff:9a:e5"),
+        string(mac_address_to_str_with_fmt(&mac, MAC_ADDR_STR_FMT_COLON_LOWER).str_buf));
+    ASSERT_EQ(
+        string("0FF000FF9AE5"),
+        string(mac_address_to_str_with_fmt(&mac, MAC_ADDR_STR_FMT_NO_SEP_UPPER).str_buf));
+    ASSERT_EQ(
+        string("0ff000ff9ae5"),
+        string(mac_address_to_str_with_fmt(&mac, MAC_ADDR_STR_FMT_NO_SEP_LOWER).str_buf));
+}
+
+TEST_F(TestMacAddr, test_mac_addr_to_str_buf) // NOLINT
+{
+    const mac_address_bin_t mac = MAC_ADDR_INIT(0x11, 0x22, 0x33, 0xAA, 0xBB, 0xCC);
+    char                    buf[MAC_ADDR_STR_LEN + 2];
+    memset(buf, '#', sizeof(buf));
+    ASSERT_EQ(MAC_ADDR_STR_LEN, mac_addr_to_str_buf(&mac, MAC_ADDR_STR_FMT_COLON_UPPER, buf));
+    ASSERT_EQ(string("11:22:33:AA:BB:CC"), string(buf));
+    ASSERT_EQ('#', buf[MAC_ADDR_STR_LEN + 1]);
+
+    memset(buf, '#', sizeof(buf));
+    ASSERT_EQ(MAC_ADDR_STR_NO_SEP_LEN, mac_addr_to_str_buf(&mac, MAC_ADDR_STR_FMT_NO_SEP_LOWER, buf));
+    ASSERT_EQ(string("112233aabbcc"), string(buf));
+    ASSERT_EQ('#', buf[MAC_ADDR_STR_NO_SEP_LEN + 1]);
+}
+
+TEST_F(TestMacAddr, test_mac_addr_to_str_batch) // NOLINT
+{
+    const std::array<mac_address_bin_t, 3> arr_of_mac = {
+        MAC_ADDR_INIT(0x11, 0x22, 0x33, 0xAA, 0xBB, 0xCC),
+        MAC_ADDR_INIT(0xC8, 0x25, 0x2D, 0x8E, 0x9C, 0x2C),
+        MAC_ADDR_INIT(0x01, 0x23, 0x45, 0x67, 0x89, 0xAB),
+    };
+    const size_t stride = MAC_ADDR_STR_LEN + 1;
+    char         buf[(MAC_ADDR_STR_LEN + 1) * 3 + 1];
+    memset(buf, '#', sizeof(buf));
+    ASSERT_TRUE(
+        mac_addr_to_str_batch(arr_of_mac.data(), arr_of_mac.size(), MAC_ADDR_STR_FMT_COLON_UPPER, buf, sizeof(buf)));
+    ASSERT_EQ(string("11:22:33:AA:BB:CC"), string(&buf[0 * stride]));
+    ASSERT_EQ(string("C8:25:2D:8E:9C:2C"), string(&buf[1 * stride]));
+    ASSERT_EQ(string("01:23:45:67:89:AB"), string(&buf[2 * stride]));
+    ASSERT_EQ('#', buf[3 * stride]);
+
+    const size_t stride_no_sep = MAC_ADDR_STR_NO_SEP_LEN + 1;
+    memset(buf, '#', sizeof(buf));
+    ASSERT_TRUE(mac_addr_to_str_batch(
+        arr_of_mac.data(),
+        arr_of_mac.size(),
+        MAC_ADDR_STR_FMT_NO_SEP_LOWER,
+        buf,
+        stride_no_sep * arr_of_mac.size()));
+    ASSERT_EQ(string("112233aabbcc"), string(&buf[0 * stride_no_sep]));
+    ASSERT_EQ(string("c8252d8e9c2c"), string(&buf[1 * stride_no_sep]));
+    ASSERT_EQ(string("0123456789ab"), string(&buf[2 * stride_no_sep]));
+    ASSERT_EQ('#', buf[3 * stride_no_sep]);
+}
+
+TEST_F(TestMacAddr, test_mac_addr_to_str_batch_buf_too_small) // NOLINT
+{
+    const std::array<mac_address_bin_t, 2> arr_of_mac = {
+        MAC_ADDR_INIT(0x11, 0x22, 0x33, 0xAA, 0xBB, 0xCC),
+        MAC_ADDR_INIT(0xC8, 0x25, 0x2D, 0x8E, 0x9C, 0x2C),
+    };
+    char buf[(MAC_ADDR_STR_LEN + 1) * 2];
+    memset(buf, '#', sizeof(buf));
+    ASSERT_FALSE(mac_addr_to_str_batch(
+        arr_of_mac.data(),
+        arr_of_mac.size(),
+        MAC_ADDR_STR_FMT_COLON_UPPER,
+        buf,
+        sizeof(buf) - 1));
+    ASSERT_EQ('#', buf[0]);
+    ASSERT_TRUE(mac_addr_to_str_batch(arr_of_mac.data(), 0, MAC_ADDR_STR_FMT_COLON_UPPER, buf, 0));
+}
+
 TEST_F(TestMacAddr, test_mac_addr_from_str) // NOLINT
 {
     mac_address_bin_t mac_addr_bin = { 0 };
@@ -91,3 +192,85 @@ TEST_F(TestMacAddr, test_mac_addr_from_str) // NOLINT
     ASSERT_FALSE(mac_addr_from_str("11:22:33:AA:BB:C", &mac_addr_bin));
     ASSERT_FALSE(mac_addr_from_str("", &mac_addr_bin));
 }
+
+TEST_F(TestMacAddr, test_mac_addr_from_str_lower_case) // NOLINT
+{
+    mac_address_bin_t mac_addr_bin = { 0 };
+    ASSERT_TRUE(mac_addr_from_str("0a:1b:2c:3D:4e:fF", &mac_addr_bin));
+    ASSERT_EQ(0x0AU, mac_addr_bin.mac[0]);
+    ASSERT_EQ(0x1BU, mac_addr_bin.mac[1]);
+    ASSERT_EQ(0x2CU, mac_addr_bin.mac[2]);
+    ASSERT_EQ(0x3DU, mac_addr_bin.mac[3]);
+    ASSERT_EQ(0x4EU, mac_addr_bin.mac[4]);
+    ASSERT_EQ(0xFFU, mac_addr_bin.mac[5]);
+}
+
+TEST_F(TestMacAddr, test_mac_addr_from_str_dash) // NOLINT
+{
+    mac_address_bin_t mac_addr_bin = { 0 };
+    ASSERT_TRUE(mac_addr_from_str("11-22-33-AA-BB-CC", &mac_addr_bin));
+    ASSERT_EQ(0x11U, mac_addr_bin.mac[0]);
+    ASSERT_EQ(0x22U, mac_addr_bin.mac[1]);
+    ASSERT_EQ(0x33U, mac_addr_bin.mac[2]);
+    ASSERT_EQ(0xAAU, mac_addr_bin.mac[3]);
+    ASSERT_EQ(0xBBU, mac_addr_bin.mac[4]);
+    ASSERT_EQ(0xCCU, mac_addr_bin.mac[5]);
+}
+
+TEST_F(TestMacAddr, test_mac_addr_from_str_no_separator) // NOLINT
+{
+    mac_address_bin_t mac_addr_bin = { 0 };
+    ASSERT_TRUE(mac_addr_from_str("112233aabbcc", &mac_addr_bin));
+    ASSERT_EQ(0x11U, mac_addr_bin.mac[0]);
+    ASSERT_EQ(0x22U, mac_addr_bin.mac[1]);
+    ASSERT_EQ(0x33U, mac_addr_bin.mac[2]);
+    ASSERT_EQ(0xAAU, mac_addr_bin.mac[3]);
+    ASSERT_EQ(0xBBU, mac_addr_bin.mac[4]);
+    ASSERT_EQ(0xCCU, mac_addr_bin.mac[5]);
+}
+
+TEST_F(TestMacAddr, test_mac_addr_from_str_invalid) // NOLINT
+{
+    const mac_address_bin_t mac_addr_orig = MAC_ADDR_INIT(0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U);
+    mac_address_bin_t       mac_addr_bin  = mac_addr_orig;
+
+    ASSERT_FALSE(mac_addr_from_str("11:22:33", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("11:22:33:AA:BB:CC:", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("11:22:33:AA:BB:CC:DD", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("11:22:33-AA:BB:CC", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("11.22.33.AA.BB.CC", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("11::22:33:AA:BB:C", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str(":11:22:33:AA:BB:C", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("11:22:33:AA:BB:CG", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("G1:22:33:AA:BB:CC", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("11:22:33:AA:BB: C", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("112233AABBC", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("112233AABBCCD", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("112233AABBCX", &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str("11223\xAA" "AABBCC", &mac_addr_bin));
+    ASSERT_EQ(0, memcmp(&mac_addr_orig, &mac_addr_bin, sizeof(mac_addr_bin)));
+}
+
+TEST_F(TestMacAddr, test_mac_addr_from_str_with_len) // NOLINT
+{
+    const char* const p_json = R"({"mac":"11:22:33:AA:BB:CC","mac2":"a1b2c3d4e5f6"})";
+    mac_address_bin_t mac_addr_bin = { 0 };
+
+    ASSERT_TRUE(mac_addr_from_str_with_len(&p_json[8], MAC_ADDR_STR_LEN, &mac_addr_bin));
+    ASSERT_EQ(0x11U, mac_addr_bin.mac[0]);
+    ASSERT_EQ(0xCCU, mac_addr_bin.mac[5]);
+
+    ASSERT_TRUE(mac_addr_from_str_with_len(&p_json[35], MAC_ADDR_STR_NO_SEP_LEN, &mac_addr_bin));
+    ASSERT_EQ(0xA1U, mac_addr_bin.mac[0]);
+    ASSERT_EQ(0xB2U, mac_addr_bin.mac[1]);
+    ASSERT_EQ(0xC3U, mac_addr_bin.mac[2]);
+    ASSERT_EQ(0xD4U, mac_addr_bin.mac[3]);
+    ASSERT_EQ(0xE5U, mac_addr_bin.mac[4]);
+    ASSERT_EQ(0xF6U, mac_addr_bin.mac[5]);
+
+    ASSERT_FALSE(mac_addr_from_str_with_len(&p_json[8], MAC_ADDR_STR_LEN + 1, &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str_with_len(&p_json[8], MAC_ADDR_STR_LEN - 1, &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str_with_len(&p_json[8], 0, &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str_with_len(nullptr, MAC_ADDR_STR_LEN, &mac_addr_bin));
+    ASSERT_FALSE(mac_addr_from_str_with_len(&p_json[8], MAC_ADDR_STR_LEN, nullptr));
+}
@@ -0,0 +1,371 @@
+/**
+ * @file test_mac_addr_map.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <list>
+#include <map>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "mac_addr_map.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestMacAddrMap;
+static TestMacAddrMap* g_pTestClass;
+
+class TestMacAddrMap : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass = this;
+    }
+
+    void
+    TearDown() override
+    {
+        mac_addr_map_delete(&this->m_p_map);
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestMacAddrMap();
+
+    ~TestMacAddrMap() override;
+
+    bool            m_malloc_fail;
+    mac_addr_map_t* m_p_map;
+};
+
+TestMacAddrMap::TestMacAddrMap()
+    : Test()
+    , m_malloc_fail(false)
+    , m_p_map(nullptr)
+{
+}
+
+TestMacAddrMap::~TestMacAddrMap() = default;
+
+extern "C" {
+
+void*
+os_calloc(const size_t nmemb, const size_t size)
+{
+    if (g_pTestClass->m_malloc_fail)
+    {
+        return nullptr;
+    }
+    return calloc(nmemb, size);
+}
+
+void
+os_free_internal(void* ptr)
+{
+    free(ptr);
+}
+
+} // extern "C"
+
+static mac_address_bin_t
+gen_mac(const uint32_t idx)
+{
+    return MAC_ADDR_INIT(
+        0xC8,
+        0x25,
+        (uint8_t)(idx >> 24U),
+        (uint8_t)(idx >> 16U),
+        (uint8_t)(idx >> 8U),
+        (uint8_t)(idx >> 0U));
+}
+
+static bool
+cb_collect_macs(const mac_address_bin_t* const p_mac, const uint32_t timestamp, void* const p_value, void* const p_ctx)
+{
+    (void)timestamp;
+    (void)p_value;
+    auto* const p_arr_of_mac = static_cast<vector<mac_address_bin_t>*>(p_ctx);
+    p_arr_of_mac->push_back(*p_mac);
+    return true;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestMacAddrMap, test_create_invalid_capacity) // NOLINT
+{
+    ASSERT_EQ(nullptr, mac_addr_map_create(0, 4));
+    ASSERT_EQ(nullptr, mac_addr_map_create(MAC_ADDR_MAP_MAX_CAPACITY + 1, 4));
+}
+
+TEST_F(TestMacAddrMap, test_create_malloc_failed) // NOLINT
+{
+    this->m_malloc_fail = true;
+    ASSERT_EQ(nullptr, mac_addr_map_create(10, 4));
+}
+
+TEST_F(TestMacAddrMap, test_insert_find_erase) // NOLINT
+{
+    this->m_p_map = mac_addr_map_create(10, sizeof(uint32_t));
+    ASSERT_NE(nullptr, this->m_p_map);
+    ASSERT_EQ(10, mac_addr_map_get_capacity(this->m_p_map));
+    ASSERT_EQ(0, mac_addr_map_get_num_items(this->m_p_map));
+
+    const mac_address_bin_t mac1 = MAC_ADDR_INIT(0x11, 0x22, 0x33, 0xAA, 0xBB, 0xCC);
+    const mac_address_bin_t mac2 = MAC_ADDR_INIT(0x11, 0x22, 0x33, 0xAA, 0xBB, 0xCD);
+    ASSERT_EQ(nullptr, mac_addr_map_find(this->m_p_map, &mac1));
+    ASSERT_FALSE(mac_addr_map_contains(this->m_p_map, &mac1));
+
+    bool      is_new   = false;
+    uint32_t* p_value1 = static_cast<uint32_t*>(mac_addr_map_insert(this->m_p_map, &mac1, 100, &is_new));
+    ASSERT_TRUE(is_new);
+    ASSERT_EQ(0, *p_value1);
+    ASSERT_EQ(0, (uintptr_t)p_value1 % MAC_ADDR_MAP_ALIGNMENT);
+    *p_value1 = 0x12345678U;
+
+    uint32_t* p_value2 = static_cast<uint32_t*>(mac_addr_map_insert(this->m_p_map, &mac2, 101, nullptr));
+    *p_value2          = 0xAABBCCDDU;
+    ASSERT_EQ(2, mac_addr_map_get_num_items(this->m_p_map));
+
+    ASSERT_EQ(p_value1, mac_addr_map_insert(this->m_p_map, &mac1, 102, &is_new));
+    ASSERT_FALSE(is_new);
+    ASSERT_EQ(0x12345678U, *p_value1);
+    ASSERT_EQ(2, mac_addr_map_get_num_items(this->m_p_map));
+
+    uint32_t timestamp = 0;
+    ASSERT_TRUE(mac_addr_map_get_timestamp(this->m_p_map, &mac1, &timestamp));
+    ASSERT_EQ(102, timestamp);
+    ASSERT_TRUE(mac_addr_map_get_timestamp(this->m_p_map, &mac2, &timestamp));
+    ASSERT_EQ(101, timestamp);
+
+    ASSERT_EQ(p_value2, mac_addr_map_find(this->m_p_map, &mac2));
+    ASSERT_EQ(0xAABBCCDDU, *p_value2);
+
+    ASSERT_TRUE(mac_addr_map_erase(this->m_p_map, &mac1));
+    ASSERT_FALSE(mac_addr_map_erase(this->m_p_map, &mac1));
+    ASSERT_EQ(nullptr, mac_addr_map_find(this->m_p_map, &mac1));
+    ASSERT_FALSE(mac_addr_map_get_timestamp(this->m_p_map, &mac1, &timestamp));
+    ASSERT_TRUE(mac_addr_map_contains(this->m_p_map, &mac2));
+    ASSERT_EQ(1, mac_addr_map_get_num_items(this->m_p_map));
+
+    mac_addr_map_clear(this->m_p_map);
+    ASSERT_EQ(0, mac_addr_map_get_num_items(this->m_p_map));
+    ASSERT_FALSE(mac_addr_map_contains(this->m_p_map, &mac2));
+}
+
+TEST_F(TestMacAddrMap, test_set_without_value) // NOLINT
+{
+    this->m_p_map = mac_addr_map_create(4, 0);
+    ASSERT_NE(nullptr, this->m_p_map);
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        const mac_address_bin_t mac = gen_mac(i);
+        ASSERT_NE(nullptr, mac_addr_map_insert(this->m_p_map, &mac, 0, nullptr));
+    }
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        const mac_address_bin_t mac = gen_mac(i);
+        ASSERT_TRUE(mac_addr_map_contains(this->m_p_map, &mac));
+    }
+    const mac_address_bin_t mac = gen_mac(4);
+    ASSERT_FALSE(mac_addr_map_contains(this->m_p_map, &mac));
+}
+
+TEST_F(TestMacAddrMap, test_create_static) // NOLINT
+{
+    const uint32_t        capacity   = 5;
+    const uint32_t        value_size = 3;
+    mac_addr_map_static_t map_mem    = {};
+    alignas(MAC_ADDR_MAP_ALIGNMENT) uint8_t buf[MAC_ADDR_MAP_BUF_SIZE(value_size, capacity) + 1];
+    ASSERT_EQ(nullptr, mac_addr_map_create_static(&map_mem, &buf[0], 0, value_size));
+    ASSERT_EQ(nullptr, mac_addr_map_create_static(&map_mem, &buf[1], capacity, value_size));
+
+    memset(buf, 0xA5, sizeof(buf));
+    this->m_p_map = mac_addr_map_create_static(&map_mem, &buf[0], capacity, value_size);
+    ASSERT_NE(nullptr, this->m_p_map);
+    for (uint32_t i = 0; i < capacity * 3; ++i)
+    {
+        const mac_address_bin_t mac     = gen_mac(i);
+        uint8_t* const          p_value = static_cast<uint8_t*>(mac_addr_map_insert(this->m_p_map, &mac, i, nullptr));
+        ASSERT_EQ(0, p_value[0]);
+        ASSERT_EQ(0, p_value[value_size - 1]);
+        memset(p_value, 0xFF, value_size);
+    }
+    ASSERT_EQ(0xA5, buf[MAC_ADDR_MAP_BUF_SIZE(value_size, capacity)]);
+    ASSERT_EQ(capacity, mac_addr_map_get_num_items(this->m_p_map));
+    mac_addr_map_delete(&this->m_p_map);
+    ASSERT_EQ(nullptr, this->m_p_map);
+}
+
+TEST_F(TestMacAddrMap, test_lru_eviction) // NOLINT
+{
+    this->m_p_map = mac_addr_map_create(3, sizeof(uint32_t));
+    ASSERT_NE(nullptr, this->m_p_map);
+    const mac_address_bin_t mac0 = gen_mac(0);
+    const mac_address_bin_t mac1 = gen_mac(1);
+    const mac_address_bin_t mac2 = gen_mac(2);
+    const mac_address_bin_t mac3 = gen_mac(3);
+    const mac_address_bin_t mac4 = gen_mac(4);
+    (void)mac_addr_map_insert(this->m_p_map, &mac0, 0, nullptr);
+    (void)mac_addr_map_insert(this->m_p_map, &mac1, 0, nullptr);
+    (void)mac_addr_map_insert(this->m_p_map, &mac2, 0, nullptr);
+
+    // mac0 becomes the most recently used one, so mac1 is evicted
+    ASSERT_NE(nullptr, mac_addr_map_find(this->m_p_map, &mac0));
+    bool is_new = false;
+    (void)mac_addr_map_insert(this->m_p_map, &mac3, 0, &is_new);
+    ASSERT_TRUE(is_new);
+    ASSERT_EQ(3, mac_addr_map_get_num_items(this->m_p_map));
+    ASSERT_FALSE(mac_addr_map_contains(this->m_p_map, &mac1));
+    ASSERT_TRUE(mac_addr_map_contains(this->m_p_map, &mac0));
+    ASSERT_TRUE(mac_addr_map_contains(this->m_p_map, &mac2));
+    ASSERT_TRUE(mac_addr_map_contains(this->m_p_map, &mac3));
+
+    // mac_addr_map_contains does not change the LRU order, so mac2 is evicted
+    (void)mac_addr_map_insert(this->m_p_map, &mac4, 0, nullptr);
+    ASSERT_FALSE(mac_addr_map_contains(this->m_p_map, &mac2));
+
+    vector<mac_address_bin_t> arr_of_mac;
+    mac_addr_map_foreach(this->m_p_map, &cb_collect_macs, &arr_of_mac);
+    ASSERT_EQ(3, arr_of_mac.size());
+    ASSERT_EQ(0, memcmp(&mac4, &arr_of_mac[0], sizeof(mac4)));
+    ASSERT_EQ(0, memcmp(&mac3, &arr_of_mac[1], sizeof(mac3)));
+    ASSERT_EQ(0, memcmp(&mac0, &arr_of_mac[2], sizeof(mac0)));
+}
+
+TEST_F(TestMacAddrMap, test_foreach_stop) // NOLINT
+{
+    this->m_p_map = mac_addr_map_create(10, 0);
+    ASSERT_NE(nullptr, this->m_p_map);
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        const mac_address_bin_t mac = gen_mac(i);
+        (void)mac_addr_map_insert(this->m_p_map, &mac, 0, nullptr);
+    }
+    uint32_t cnt = 0;
+    mac_addr_map_foreach(
+        this->m_p_map,
+        [](const mac_address_bin_t* const p_mac, const uint32_t timestamp, void* const p_value, void* const p_ctx) {
+            (void)p_mac;
+            (void)timestamp;
+            (void)p_value;
+            *static_cast<uint32_t*>(p_ctx) += 1;
+            return *static_cast<uint32_t*>(p_ctx) < 2;
+        },
+        &cnt);
+    ASSERT_EQ(2, cnt);
+}
+
+TEST_F(TestMacAddrMap, test_erase_expired) // NOLINT
+{
+    this->m_p_map = mac_addr_map_create(10, 0);
+    ASSERT_NE(nullptr, this->m_p_map);
+    // The timestamps wrap around
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        const mac_address_bin_t mac = gen_mac(i);
+        (void)mac_addr_map_insert(this->m_p_map, &mac, UINT32_MAX - 4U + i, nullptr);
+    }
+    // cur_timestamp = 5, age of entry i is (10 - i)
+    ASSERT_EQ(5, mac_addr_map_erase_expired(this->m_p_map, 5, 5));
+    ASSERT_EQ(5, mac_addr_map_get_num_items(this->m_p_map));
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        const mac_address_bin_t mac = gen_mac(i);
+        ASSERT_EQ(i >= 5, mac_addr_map_contains(this->m_p_map, &mac)) << "i=" << i;
+    }
+    ASSERT_EQ(0, mac_addr_map_erase_expired(this->m_p_map, 5, 5));
+    ASSERT_EQ(5, mac_addr_map_erase_expired(this->m_p_map, 100, 5));
+    ASSERT_EQ(0, mac_addr_map_get_num_items(this->m_p_map));
+}
+
+TEST_F(TestMacAddrMap, test_random_operations_against_reference) // NOLINT
+{
+    const uint32_t capacity = 200;
+    this->m_p_map           = mac_addr_map_create(capacity, sizeof(uint32_t));
+    ASSERT_NE(nullptr, this->m_p_map);
+
+    // The reference model: the LRU list (front is the most recently used) and the map of values
+    list<uint32_t>          lru;
+    std::map<uint32_t, int> values;
+    std::mt19937            rng(12345);
+
+    for (uint32_t iter = 0; iter < 200000; ++iter)
+    {
+        // Use a narrow range of keys to get many hits, and keys with common prefixes to get collisions
+        const uint32_t          key = rng() % (capacity * 2);
+        const mac_address_bin_t mac = gen_mac(key * 0x10000U);
+        switch (rng() % 4)
+        {
+            case 0:
+            case 1:
+            {
+                bool       is_new     = false;
+                uint32_t*  p_value    = static_cast<uint32_t*>(mac_addr_map_insert(this->m_p_map, &mac, iter, &is_new));
+                const bool is_present = 0 != values.count(key);
+                ASSERT_EQ(!is_present, is_new);
+                if (is_present)
+                {
+                    ASSERT_EQ((uint32_t)values[key], *p_value);
+                    lru.remove(key);
+                }
+                else
+                {
+                    ASSERT_EQ(0, *p_value);
+                    if (values.size() == capacity)
+                    {
+                        values.erase(lru.back());
+                        lru.pop_back();
+                    }
+                }
+                lru.push_front(key);
+                values[key] = (int)iter;
+                *p_value    = iter;
+                break;
+            }
+            case 2:
+            {
+                const uint32_t* const p_value = static_cast<uint32_t*>(mac_addr_map_find(this->m_p_map, &mac));
+                if (0 != values.count(key))
+                {
+                    ASSERT_NE(nullptr, p_value);
+                    ASSERT_EQ((uint32_t)values[key], *p_value);
+                    lru.remove(key);
+                    lru.push_front(key);
+                }
+                else
+                {
+                    ASSERT_EQ(nullptr, p_value);
+                }
+                break;
+            }
+            default:
+            {
+                const bool is_present = 0 != values.count(key);
+                ASSERT_EQ(is_present, mac_addr_map_erase(this->m_p_map, &mac));
+                if (is_present)
+                {
+                    values.erase(key);
+                    lru.remove(key);
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(values.size(), mac_addr_map_get_num_items(this->m_p_map));
+    }
+    for (const auto& item : values)
+    {
+        const mac_address_bin_t mac = gen_mac(item.first * 0x10000U);
+        ASSERT_TRUE(mac_addr_map_contains(this->m_p_map, &mac));
+    }
+}
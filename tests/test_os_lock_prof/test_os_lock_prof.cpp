@@ -0,0 +1,540 @@
+/**
+ * @file test_os_lock_prof.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <string>
+#include <array>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "esp_log_wrapper.hpp"
+#include "os_lock_prof.h"
+#include "os_mutex.h"
+#include "os_mutex_recursive.h"
+#include "os_sema.h"
+#include "os_task.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsLockProf;
+static TestOsLockProf* g_pTestClass;
+
+extern "C" {
+
+struct QueueDefinition
+{
+    union
+    {
+        StaticSemaphore_t static_sema;
+        struct
+        {
+            bool        isStaticallyAllocated;
+            bool        isUsed;
+            bool        isBusy; //!< the lock is held by another task
+            uint8_t     queueType;
+            uint32_t    count;
+            UBaseType_t queueNumber;
+        };
+    };
+};
+
+} // extern "C"
+
+class TestOsLockProf : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        esp_log_wrapper_init();
+        g_pTestClass = this;
+        os_lock_prof_init();
+    }
+
+    void
+    TearDown() override
+    {
+        os_lock_prof_deinit();
+        esp_log_wrapper_deinit();
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestOsLockProf();
+
+    ~TestOsLockProf() override;
+
+    TickType_t m_tickCount;
+    TickType_t m_ticksToBlock;
+    bool       m_isReleasedWhileWaiting;
+
+    std::array<struct QueueDefinition, 2> arrOfQueues;
+};
+
+TestOsLockProf::TestOsLockProf()
+    : Test()
+    , m_tickCount(0)
+    , m_ticksToBlock(0)
+    , m_isReleasedWhileWaiting(false)
+    , arrOfQueues()
+{
+}
+
+TestOsLockProf::~TestOsLockProf() = default;
+
+#define TEST_CHECK_LOG_RECORD(level_, msg_) ESP_LOG_WRAPPER_TEST_CHECK_LOG_RECORD("os_lock_prof", level_, msg_)
+
+extern "C" {
+
+void*
+os_calloc(const size_t nmemb, const size_t size)
+{
+    return calloc(nmemb, size);
+}
+
+void
+os_free_internal(void* ptr)
+{
+    free(ptr);
+}
+
+const char*
+os_task_get_name(void)
+{
+    static const char g_task_name[] = "main";
+    return g_task_name;
+}
+
+os_task_priority_t
+os_task_get_priority(void)
+{
+    return 0;
+}
+
+TickType_t
+xTaskGetTickCount(void)
+{
+    return g_pTestClass->m_tickCount;
+}
+
+static QueueHandle_t
+prvInitialiseQueue(struct QueueDefinition* p_queue, const uint8_t queueType, const bool isStaticallyAllocated)
+{
+    p_queue->isStaticallyAllocated = isStaticallyAllocated;
+    p_queue->isUsed                = true;
+    p_queue->isBusy                = false;
+    p_queue->queueType             = queueType;
+    p_queue->count                 = 0;
+    p_queue->queueNumber           = 0;
+    return p_queue;
+}
+
+static QueueHandle_t
+prvAllocQueue(const uint8_t queueType)
+{
+    auto iter = std::find_if(
+        g_pTestClass->arrOfQueues.begin(),
+        g_pTestClass->arrOfQueues.end(),
+        [](const struct QueueDefinition& x) { return !x.isUsed; });
+    if (g_pTestClass->arrOfQueues.end() == iter)
+    {
+        return nullptr;
+    }
+    return prvInitialiseQueue(&*iter, queueType, false);
+}
+
+static BaseType_t
+prvTakeQueue(QueueHandle_t xQueue, TickType_t xTicksToWait)
+{
+    assert(xQueue->isUsed);
+    if (xQueue->isBusy)
+    {
+        if (0 == xTicksToWait)
+        {
+            return pdFALSE;
+        }
+        g_pTestClass->m_tickCount += g_pTestClass->m_ticksToBlock;
+        if (!g_pTestClass->m_isReleasedWhileWaiting)
+        {
+            return pdFALSE;
+        }
+        xQueue->isBusy = false;
+    }
+    if (queueQUEUE_TYPE_BINARY_SEMAPHORE == xQueue->queueType)
+    {
+        if (0 == xQueue->count)
+        {
+            return pdFALSE;
+        }
+        xQueue->count = 0;
+        return pdTRUE;
+    }
+    if ((queueQUEUE_TYPE_MUTEX == xQueue->queueType) && (0 != xQueue->count))
+    {
+        return pdFALSE;
+    }
+    xQueue->count += 1;
+    return pdTRUE;
+}
+
+static BaseType_t
+prvGiveQueue(QueueHandle_t xQueue)
+{
+    assert(xQueue->isUsed);
+    if (queueQUEUE_TYPE_BINARY_SEMAPHORE == xQueue->queueType)
+    {
+        xQueue->count = 1;
+        return pdPASS;
+    }
+    if (0 == xQueue->count)
+    {
+        return pdFALSE;
+    }
+    xQueue->count -= 1;
+    return pdPASS;
+}
+
+QueueHandle_t
+xQueueCreateMutex(const uint8_t ucQueueType)
+{
+    return prvAllocQueue(ucQueueType);
+}
+
+QueueHandle_t
+xQueueCreateMutexStatic(const uint8_t ucQueueType, StaticQueue_t* pxStaticQueue)
+{
+    return prvInitialiseQueue(reinterpret_cast<struct QueueDefinition*>(pxStaticQueue), ucQueueType, true);
+}
+
+QueueHandle_t
+xQueueGenericCreate(const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, const uint8_t ucQueueType)
+{
+    assert(1 == uxQueueLength);
+    assert(semSEMAPHORE_QUEUE_ITEM_LENGTH == uxItemSize);
+    return prvAllocQueue(ucQueueType);
+}
+
+QueueHandle_t
+xQueueGenericCreateStatic(
+    const UBaseType_t uxQueueLength,
+    const UBaseType_t uxItemSize,
+    uint8_t*          pucQueueStorage,
+    StaticQueue_t*    pxStaticQueue,
+    const uint8_t     ucQueueType)
+{
+    assert(1 == uxQueueLength);
+    assert(semSEMAPHORE_QUEUE_ITEM_LENGTH == uxItemSize);
+    assert(nullptr == pucQueueStorage);
+    return prvInitialiseQueue(reinterpret_cast<struct QueueDefinition*>(pxStaticQueue), ucQueueType, true);
+}
+
+void
+vQueueDelete(QueueHandle_t xQueue)
+{
+    assert(xQueue->isUsed);
+    xQueue->isUsed = false;
+}
+
+BaseType_t
+xQueueSemaphoreTake(QueueHandle_t xQueue, TickType_t xTicksToWait)
+{
+    assert(queueQUEUE_TYPE_RECURSIVE_MUTEX != xQueue->queueType);
+    return prvTakeQueue(xQueue, xTicksToWait);
+}
+
+BaseType_t
+xQueueGenericSend(
+    QueueHandle_t     xQueue,
+    const void* const pvItemToQueue,
+    TickType_t        xTicksToWait,
+    const BaseType_t  xCopyPosition)
+{
+    assert(nullptr == pvItemToQueue);
+    assert(semGIVE_BLOCK_TIME == xTicksToWait);
+    assert(queueSEND_TO_BACK == xCopyPosition);
+    assert(queueQUEUE_TYPE_RECURSIVE_MUTEX != xQueue->queueType);
+    return prvGiveQueue(xQueue);
+}
+
+void
+vQueueSetQueueNumber(QueueHandle_t xQueue, UBaseType_t uxQueueNumber)
+{
+    assert(xQueue->isUsed);
+    xQueue->queueNumber = uxQueueNumber;
+}
+
+UBaseType_t
+uxQueueGetQueueNumber(QueueHandle_t xQueue)
+{
+    assert(xQueue->isUsed);
+    return xQueue->queueNumber;
+}
+
+BaseType_t
+xQueueTakeMutexRecursive(QueueHandle_t xMutex, TickType_t xTicksToWait)
+{
+    assert(queueQUEUE_TYPE_RECURSIVE_MUTEX == xMutex->queueType);
+    return prvTakeQueue(xMutex, xTicksToWait);
+}
+
+BaseType_t
+xQueueGiveMutexRecursive(QueueHandle_t xMutex)
+{
+    assert(queueQUEUE_TYPE_RECURSIVE_MUTEX == xMutex->queueType);
+    return prvGiveQueue(xMutex);
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsLockProf, test_register_unregister) // NOLINT
+{
+    os_mutex_static_t           mutex_mem     = {};
+    os_mutex_recursive_static_t mutex_rec_mem = {};
+
+    os_mutex_t           h_mutex     = os_mutex_create_static_named(&mutex_mem, "mutex1");
+    os_mutex_recursive_t h_mutex_rec = os_mutex_recursive_create_static_named(&mutex_rec_mem, "mutex_rec1");
+    os_sema_t            h_sema      = os_sema_create_named("sema1");
+    os_mutex_t           h_mutex2    = os_mutex_create();
+    ASSERT_NE(nullptr, h_sema);
+    ASSERT_NE(nullptr, h_mutex2);
+
+    std::array<os_lock_prof_info_t, OS_LOCK_PROF_MAX_NUM_LOCKS> arr_of_info = {};
+    ASSERT_EQ(4, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(h_mutex, arr_of_info[0].h_lock);
+    ASSERT_EQ(string("mutex1"), string(arr_of_info[0].name));
+    ASSERT_EQ(OS_LOCK_PROF_TYPE_MUTEX, arr_of_info[0].type);
+    ASSERT_EQ(h_mutex_rec, arr_of_info[1].h_lock);
+    ASSERT_EQ(string("mutex_rec1"), string(arr_of_info[1].name));
+    ASSERT_EQ(OS_LOCK_PROF_TYPE_MUTEX_RECURSIVE, arr_of_info[1].type);
+    ASSERT_EQ(h_sema, arr_of_info[2].h_lock);
+    ASSERT_EQ(string("sema1"), string(arr_of_info[2].name));
+    ASSERT_EQ(OS_LOCK_PROF_TYPE_SEMA, arr_of_info[2].type);
+    ASSERT_EQ(h_mutex2, arr_of_info[3].h_lock);
+    ASSERT_EQ(string(""), string(arr_of_info[3].name));
+    ASSERT_EQ(OS_LOCK_PROF_TYPE_MUTEX, arr_of_info[3].type);
+
+    os_mutex_recursive_delete(&h_mutex_rec);
+    ASSERT_EQ(3, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(h_mutex, arr_of_info[0].h_lock);
+    ASSERT_EQ(h_sema, arr_of_info[1].h_lock);
+    ASSERT_EQ(h_mutex2, arr_of_info[2].h_lock);
+
+    ASSERT_EQ(1, os_lock_prof_get_snapshot(arr_of_info.data(), 1));
+
+    os_mutex_delete(&h_mutex);
+    os_sema_delete(&h_sema);
+    os_mutex_delete(&h_mutex2);
+    ASSERT_EQ(0, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(0, os_lock_prof_get_num_overflows());
+}
+
+TEST_F(TestOsLockProf, test_mutex_stat) // NOLINT
+{
+    os_mutex_static_t mutex_mem = {};
+    os_mutex_t        h_mutex   = os_mutex_create_static_named(&mutex_mem, "mutex1");
+    auto* const       p_queue   = reinterpret_cast<struct QueueDefinition*>(h_mutex);
+
+    os_mutex_lock(h_mutex);
+    this->m_tickCount += 5;
+    os_mutex_unlock(h_mutex);
+
+    p_queue->isBusy = true;
+    ASSERT_FALSE(os_mutex_try_lock(h_mutex));
+
+    this->m_ticksToBlock           = 7;
+    this->m_isReleasedWhileWaiting = true;
+    ASSERT_TRUE(os_mutex_lock_with_timeout(h_mutex, 10));
+    this->m_tickCount += 3;
+    os_mutex_unlock(h_mutex);
+
+    p_queue->isBusy                = true;
+    this->m_ticksToBlock           = 10;
+    this->m_isReleasedWhileWaiting = false;
+    ASSERT_FALSE(os_mutex_lock_with_timeout(h_mutex, 10));
+
+    std::array<os_lock_prof_info_t, OS_LOCK_PROF_MAX_NUM_LOCKS> arr_of_info = {};
+    ASSERT_EQ(1, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(2, arr_of_info[0].num_acquisitions);
+    ASSERT_EQ(3, arr_of_info[0].num_contentions);
+    ASSERT_EQ(2, arr_of_info[0].num_timeouts);
+    ASSERT_EQ(17, arr_of_info[0].total_wait_ticks);
+    ASSERT_EQ(10, arr_of_info[0].max_wait_ticks);
+    ASSERT_EQ(5, arr_of_info[0].max_hold_ticks);
+
+    os_lock_prof_reset();
+    ASSERT_EQ(1, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(h_mutex, arr_of_info[0].h_lock);
+    ASSERT_EQ(string("mutex1"), string(arr_of_info[0].name));
+    ASSERT_EQ(0, arr_of_info[0].num_acquisitions);
+    ASSERT_EQ(0, arr_of_info[0].num_contentions);
+    ASSERT_EQ(0, arr_of_info[0].num_timeouts);
+    ASSERT_EQ(0, arr_of_info[0].total_wait_ticks);
+    ASSERT_EQ(0, arr_of_info[0].max_wait_ticks);
+    ASSERT_EQ(0, arr_of_info[0].max_hold_ticks);
+
+    os_mutex_delete(&h_mutex);
+}
+
+TEST_F(TestOsLockProf, test_mutex_recursive_hold_time) // NOLINT
+{
+    os_mutex_recursive_static_t mutex_mem = {};
+    os_mutex_recursive_t        h_mutex   = os_mutex_recursive_create_static_named(&mutex_mem, "mutex_rec1");
+
+    os_mutex_recursive_lock(h_mutex);
+    this->m_tickCount += 2;
+    os_mutex_recursive_lock(h_mutex);
+    this->m_tickCount += 3;
+    os_mutex_recursive_unlock(h_mutex);
+    this->m_tickCount += 4;
+    os_mutex_recursive_unlock(h_mutex);
+
+    std::array<os_lock_prof_info_t, OS_LOCK_PROF_MAX_NUM_LOCKS> arr_of_info = {};
+    ASSERT_EQ(1, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(2, arr_of_info[0].num_acquisitions);
+    ASSERT_EQ(0, arr_of_info[0].num_contentions);
+    ASSERT_EQ(0, arr_of_info[0].num_timeouts);
+    ASSERT_EQ(9, arr_of_info[0].max_hold_ticks);
+
+    os_mutex_recursive_delete(&h_mutex);
+}
+
+TEST_F(TestOsLockProf, test_sema_stat) // NOLINT
+{
+    os_sema_static_t sema_mem = {};
+    os_sema_t        h_sema   = os_sema_create_static_named(&sema_mem, "sema1");
+
+    ASSERT_FALSE(os_sema_wait_immediate(h_sema));
+    os_sema_signal(h_sema);
+    this->m_tickCount += 5;
+    ASSERT_TRUE(os_sema_wait_with_timeout(h_sema, 10));
+    this->m_tickCount += 5;
+    os_sema_signal(h_sema);
+    os_sema_wait_infinite(h_sema);
+
+    std::array<os_lock_prof_info_t, OS_LOCK_PROF_MAX_NUM_LOCKS> arr_of_info = {};
+    ASSERT_EQ(1, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(2, arr_of_info[0].num_acquisitions);
+    ASSERT_EQ(1, arr_of_info[0].num_contentions);
+    ASSERT_EQ(1, arr_of_info[0].num_timeouts);
+    ASSERT_EQ(0, arr_of_info[0].max_hold_ticks);
+
+    os_sema_delete(&h_sema);
+}
+
+TEST_F(TestOsLockProf, test_overflow) // NOLINT
+{
+    std::array<os_mutex_static_t, OS_LOCK_PROF_MAX_NUM_LOCKS + 1> arr_of_mutex_mem = {};
+    std::array<os_mutex_t, OS_LOCK_PROF_MAX_NUM_LOCKS + 1>        arr_of_mutexes   = {};
+    for (uint32_t i = 0; i < arr_of_mutexes.size(); ++i)
+    {
+        arr_of_mutexes[i] = os_mutex_create_static_named(&arr_of_mutex_mem[i], "mutex");
+    }
+
+    std::array<os_lock_prof_info_t, OS_LOCK_PROF_MAX_NUM_LOCKS + 1> arr_of_info = {};
+    ASSERT_EQ(OS_LOCK_PROF_MAX_NUM_LOCKS, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(1, os_lock_prof_get_num_overflows());
+
+    // The lock which was not registered still works
+    ASSERT_TRUE(os_mutex_try_lock(arr_of_mutexes[OS_LOCK_PROF_MAX_NUM_LOCKS]));
+    os_mutex_unlock(arr_of_mutexes[OS_LOCK_PROF_MAX_NUM_LOCKS]);
+
+    os_lock_prof_reset();
+    ASSERT_EQ(0, os_lock_prof_get_num_overflows());
+
+    for (auto& h_mutex : arr_of_mutexes)
+    {
+        os_mutex_delete(&h_mutex);
+    }
+}
+
+TEST_F(TestOsLockProf, test_log_dump_sorted_by_total_wait) // NOLINT
+{
+    os_mutex_static_t mutex1_mem = {};
+    os_mutex_static_t mutex2_mem = {};
+    os_mutex_t        h_mutex1   = os_mutex_create_static_named(&mutex1_mem, "mutex1");
+    os_mutex_t        h_mutex2   = os_mutex_create_static_named(&mutex2_mem, "mutex2");
+
+    this->m_isReleasedWhileWaiting = true;
+
+    reinterpret_cast<struct QueueDefinition*>(h_mutex1)->isBusy = true;
+    this->m_ticksToBlock                                         = 3;
+    os_mutex_lock(h_mutex1);
+    os_mutex_unlock(h_mutex1);
+
+    reinterpret_cast<struct QueueDefinition*>(h_mutex2)->isBusy = true;
+    this->m_ticksToBlock                                         = 8;
+    os_mutex_lock(h_mutex2);
+    this->m_tickCount += 2;
+    os_mutex_unlock(h_mutex2);
+
+    os_lock_prof_log_dump();
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Num locks registered: 2, not registered: 0");
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_INFO,
+        "[ 0] 'mutex2' (mutex): acquired 1, contended 1, timeouts 0, wait total 8, wait max 8, hold max 2 ticks");
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_INFO,
+        "[ 1] 'mutex1' (mutex): acquired 1, contended 1, timeouts 0, wait total 3, wait max 3, hold max 0 ticks");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    os_mutex_delete(&h_mutex1);
+    os_mutex_delete(&h_mutex2);
+}
+
+TEST_F(TestOsLockProf, test_lock_registered_before_reinit) // NOLINT
+{
+    os_mutex_static_t mutex1_mem = {};
+    os_mutex_static_t mutex2_mem = {};
+    os_mutex_t        h_mutex1   = os_mutex_create_static_named(&mutex1_mem, "mutex1");
+
+    os_lock_prof_deinit();
+    os_lock_prof_init();
+
+    // mutex2 takes the entry which was used by mutex1, the stale entry index of mutex1 must be ignored
+    os_mutex_t h_mutex2 = os_mutex_create_static_named(&mutex2_mem, "mutex2");
+    os_mutex_lock(h_mutex1);
+    os_mutex_unlock(h_mutex1);
+
+    std::array<os_lock_prof_info_t, OS_LOCK_PROF_MAX_NUM_LOCKS> arr_of_info = {};
+    ASSERT_EQ(1, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(h_mutex2, arr_of_info[0].h_lock);
+    ASSERT_EQ(0, arr_of_info[0].num_acquisitions);
+
+    os_mutex_lock(h_mutex2);
+    os_mutex_unlock(h_mutex2);
+    ASSERT_EQ(1, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(1, arr_of_info[0].num_acquisitions);
+
+    os_mutex_delete(&h_mutex1);
+    os_mutex_delete(&h_mutex2);
+    ASSERT_EQ(0, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+}
+
+TEST_F(TestOsLockProf, test_not_initialized) // NOLINT
+{
+    os_lock_prof_deinit();
+
+    os_mutex_t h_mutex = os_mutex_create_named("mutex1");
+    ASSERT_NE(nullptr, h_mutex);
+    os_mutex_lock(h_mutex);
+    os_mutex_unlock(h_mutex);
+
+    std::array<os_lock_prof_info_t, OS_LOCK_PROF_MAX_NUM_LOCKS> arr_of_info = {};
+    ASSERT_EQ(0, os_lock_prof_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(0, os_lock_prof_get_num_overflows());
+
+    os_lock_prof_log_dump();
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "os_lock_prof is not initialized");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    os_mutex_delete(&h_mutex);
+}
@@ -7,6 +7,7 @@
 
 #include "os_malloc.h"
 #include "gtest/gtest.h"
+#include <cstring>
 #include <string>
 
 using namespace std;
@@ -75,3 +76,63 @@ TEST_F(TestOsMalloc, test_os_realloc) // NOLINT
     os_free(ptr2);
     ASSERT_EQ(nullptr, ptr2);
 }
+
+TEST_F(TestOsMalloc, test_os_realloc_safe_and_clean) // NOLINT
+{
+    void* ptr = os_malloc(4);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_TRUE(os_realloc_safe_and_clean(&ptr, 1 * 1024));
+    ASSERT_NE(nullptr, ptr);
+
+    // The original block is freed and the pointer is cleared if the reallocation failed
+    ASSERT_FALSE(os_realloc_safe_and_clean(&ptr, SIZE_MAX / 2));
+    ASSERT_EQ(nullptr, ptr);
+}
+
+TEST_F(TestOsMalloc, test_os_malloc_caps) // NOLINT
+{
+    for (uint32_t i = 0; i < OS_MALLOC_CAPS_NUM; ++i)
+    {
+        void* ptr = os_malloc_caps(100, static_cast<os_malloc_caps_e>(i));
+        ASSERT_NE(nullptr, ptr);
+        os_free(ptr);
+        ASSERT_EQ(nullptr, ptr);
+    }
+    ASSERT_EQ(nullptr, os_malloc_caps(100, static_cast<os_malloc_caps_e>(OS_MALLOC_CAPS_NUM)));
+}
+
+TEST_F(TestOsMalloc, test_os_calloc_caps) // NOLINT
+{
+    auto* ptr = static_cast<uint32_t*>(os_calloc_caps(sizeof(uint32_t), 100, OS_MALLOC_CAPS_SPIRAM));
+    ASSERT_NE(nullptr, ptr);
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(0, ptr[i]);
+    }
+    os_free(ptr);
+    ASSERT_EQ(nullptr, ptr);
+    ASSERT_EQ(nullptr, os_calloc_caps(sizeof(uint32_t), 100, static_cast<os_malloc_caps_e>(OS_MALLOC_CAPS_NUM)));
+}
+
+TEST_F(TestOsMalloc, test_os_realloc_caps_safe) // NOLINT
+{
+    auto* ptr = static_cast<uint8_t*>(os_malloc_caps(4, OS_MALLOC_CAPS_SPIRAM));
+    ASSERT_NE(nullptr, ptr);
+    memset(ptr, 0x5A, 4);
+    ASSERT_TRUE(os_realloc_caps_safe((void**)&ptr, 1 * 1024, OS_MALLOC_CAPS_SPIRAM));
+    ASSERT_NE(nullptr, ptr);
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        ASSERT_EQ(0x5A, ptr[i]);
+    }
+
+    // The pointer is not changed if the capabilities are invalid or the reallocation failed
+    const uint8_t* const saved_ptr = ptr;
+    ASSERT_FALSE(os_realloc_caps_safe((void**)&ptr, 16, static_cast<os_malloc_caps_e>(OS_MALLOC_CAPS_NUM)));
+    ASSERT_EQ(saved_ptr, ptr);
+    ASSERT_FALSE(os_realloc_caps_safe((void**)&ptr, SIZE_MAX / 2, OS_MALLOC_CAPS_INTERNAL));
+    ASSERT_EQ(saved_ptr, ptr);
+
+    os_free(ptr);
+    ASSERT_EQ(nullptr, ptr);
+}
@@ -0,0 +1,318 @@
+/**
+ * @file test_os_malloc_guard.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <string>
+#include <array>
+#include "gtest/gtest.h"
+#include "esp_log_wrapper.hpp"
+#include "os_malloc.h"
+#include "os_mutex.h"
+#include "os_task.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsMallocGuard;
+static TestOsMallocGuard* g_pTestClass;
+
+class TestOsMallocGuard : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        esp_log_wrapper_init();
+        g_pTestClass = this;
+        os_malloc_trace_init();
+    }
+
+    void
+    TearDown() override
+    {
+        os_malloc_trace_deinit();
+        esp_log_wrapper_deinit();
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestOsMallocGuard();
+
+    ~TestOsMallocGuard() override;
+
+    uint32_t       m_mutex_lock_cnt;
+    const uint8_t* m_p_watched_buf; //!< the first byte of this block is saved on lock and unlock of the mutex
+    uint8_t        m_watched_byte_on_lock;
+    uint8_t        m_watched_byte_on_unlock;
+};
+
+TestOsMallocGuard::TestOsMallocGuard()
+    : Test()
+    , m_mutex_lock_cnt(0)
+    , m_p_watched_buf(nullptr)
+    , m_watched_byte_on_lock(0)
+    , m_watched_byte_on_unlock(0)
+{
+}
+
+TestOsMallocGuard::~TestOsMallocGuard() = default;
+
+#define TEST_CHECK_LOG_RECORD(level_, msg_) ESP_LOG_WRAPPER_TEST_CHECK_LOG_RECORD("MEM_TRACE", level_, msg_)
+
+extern "C" {
+
+const char*
+os_task_get_name(void)
+{
+    static const char g_task_name[] = "main";
+    return g_task_name;
+}
+
+os_task_priority_t
+os_task_get_priority(void)
+{
+    return 0;
+}
+
+TickType_t
+xTaskGetTickCount(void)
+{
+    return 0;
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_delete(os_mutex_t* const ph_mutex)
+{
+    *ph_mutex = nullptr;
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_mutex_lock_cnt += 1;
+    if (nullptr != g_pTestClass->m_p_watched_buf)
+    {
+        g_pTestClass->m_watched_byte_on_lock = g_pTestClass->m_p_watched_buf[0];
+    }
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_mutex_lock_cnt -= 1;
+    if (nullptr != g_pTestClass->m_p_watched_buf)
+    {
+        g_pTestClass->m_watched_byte_on_unlock = g_pTestClass->m_p_watched_buf[0];
+    }
+}
+
+} // extern "C"
+
+static string
+ptr_to_str(const void* const ptr)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%p", ptr);
+    return string(buf);
+}
+
+static string
+site_to_str(const int32_t line)
+{
+    return string(__FILE__) + ":" + to_string(line);
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsMallocGuard, test_no_errors) // NOLINT
+{
+    auto* p_buf = static_cast<uint8_t*>(os_malloc(10));
+    ASSERT_NE(nullptr, p_buf);
+    memset(p_buf, 0xFF, 10);
+    ASSERT_EQ(0, os_malloc_check_all());
+
+    const uint8_t* const p_freed_buf = p_buf;
+    os_free(p_buf);
+    // The freed block is kept in the quarantine and filled with the poison pattern
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(OS_MALLOC_GUARD_POISON_BYTE, p_freed_buf[i]);
+    }
+    ASSERT_EQ(0, os_malloc_check_all());
+    ASSERT_EQ(0, os_malloc_guard_flush_quarantine());
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+}
+
+TEST_F(TestOsMallocGuard, test_buffer_overflow) // NOLINT
+{
+    auto*         p_buf = static_cast<uint8_t*>(os_malloc(10));
+    const int32_t line  = __LINE__ - 1;
+    ASSERT_NE(nullptr, p_buf);
+    const string msg = "Block " + ptr_to_str(p_buf) + " (10 bytes) allocated at " + site_to_str(line)
+                       + ": rear canary is corrupted (buffer overflow)";
+    p_buf[10] = 0;
+
+    ASSERT_EQ(1, os_malloc_check_all());
+    TEST_CHECK_LOG_RECORD(ESP_LOG_ERROR, msg);
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    os_free(p_buf);
+    TEST_CHECK_LOG_RECORD(ESP_LOG_ERROR, msg);
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocGuard, test_buffer_underflow) // NOLINT
+{
+    auto*         p_buf = static_cast<uint8_t*>(os_calloc(2, 4));
+    const int32_t line  = __LINE__ - 1;
+    ASSERT_NE(nullptr, p_buf);
+    p_buf[-1]                = 0;
+    const void* const p_addr = p_buf;
+
+    os_free(p_buf);
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_ERROR,
+        "Block " + ptr_to_str(p_addr) + " (8 bytes) allocated at " + site_to_str(line)
+            + ": front canary is corrupted (buffer underflow)");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocGuard, test_use_after_free) // NOLINT
+{
+    auto*         p_buf      = static_cast<uint8_t*>(os_malloc(16));
+    const int32_t line_alloc = __LINE__ - 1;
+    ASSERT_NE(nullptr, p_buf);
+    uint8_t* const p_freed_buf = p_buf;
+    os_free(p_buf);
+    const int32_t line_free = __LINE__ - 1;
+    ASSERT_EQ(0, os_malloc_check_all());
+
+    p_freed_buf[5] = 0;
+    const string msg = "Block " + ptr_to_str(p_freed_buf) + " (16 bytes) allocated at " + site_to_str(line_alloc)
+                       + " and freed at " + site_to_str(line_free) + ": freed block was modified (use after free)";
+    ASSERT_EQ(1, os_malloc_check_all());
+    TEST_CHECK_LOG_RECORD(ESP_LOG_ERROR, msg);
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    ASSERT_EQ(1, os_malloc_guard_flush_quarantine());
+    TEST_CHECK_LOG_RECORD(ESP_LOG_ERROR, msg);
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+    ASSERT_EQ(0, os_malloc_check_all());
+}
+
+TEST_F(TestOsMallocGuard, test_use_after_free_detected_on_eviction_from_quarantine) // NOLINT
+{
+    auto*         p_buf1     = static_cast<uint8_t*>(os_malloc(4));
+    const int32_t line_alloc = __LINE__ - 1;
+    auto*         p_buf2     = static_cast<uint8_t*>(os_malloc(4));
+    auto*         p_buf3     = static_cast<uint8_t*>(os_malloc(4));
+    ASSERT_NE(nullptr, p_buf1);
+    ASSERT_NE(nullptr, p_buf2);
+    ASSERT_NE(nullptr, p_buf3);
+
+    uint8_t* const p_freed_buf1 = p_buf1;
+    os_free(p_buf1);
+    const int32_t line_free = __LINE__ - 1;
+    p_freed_buf1[0]         = 0;
+    os_free(p_buf2);
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    // The quarantine is full, so the oldest block is checked and released
+    os_free(p_buf3);
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_ERROR,
+        "Block " + ptr_to_str(p_freed_buf1) + " (4 bytes) allocated at " + site_to_str(line_alloc) + " and freed at "
+            + site_to_str(line_free) + ": freed block was modified (use after free)");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+    ASSERT_EQ(0, os_malloc_check_all());
+}
+
+TEST_F(TestOsMallocGuard, test_free_poisons_block_under_mutex) // NOLINT
+{
+    auto* p_buf = static_cast<uint8_t*>(os_malloc(16));
+    ASSERT_NE(nullptr, p_buf);
+    memset(p_buf, 0x5A, 16);
+
+    // The block must not be seen as freed by os_malloc_check_all while it is being poisoned
+    this->m_p_watched_buf = p_buf;
+    os_free(p_buf);
+    this->m_p_watched_buf = nullptr;
+    ASSERT_EQ(0x5A, this->m_watched_byte_on_lock);
+    ASSERT_EQ(OS_MALLOC_GUARD_POISON_BYTE, this->m_watched_byte_on_unlock);
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+    ASSERT_EQ(0, os_malloc_check_all());
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocGuard, test_double_free) // NOLINT
+{
+    auto*         p_buf      = static_cast<uint8_t*>(os_malloc(4));
+    const int32_t line_alloc = __LINE__ - 1;
+    ASSERT_NE(nullptr, p_buf);
+    uint8_t*          p_buf_copy = p_buf;
+    const void* const p_addr     = p_buf;
+    os_free(p_buf);
+    const int32_t line_free1 = __LINE__ - 1;
+    os_free(p_buf_copy);
+    const int32_t line_free2 = __LINE__ - 1;
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_ERROR,
+        "Double free of block " + ptr_to_str(p_addr) + " at " + site_to_str(line_free2) + ", it was allocated at "
+            + site_to_str(line_alloc) + " and freed at " + site_to_str(line_free1));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+    ASSERT_EQ(0, os_malloc_check_all());
+}
+
+TEST_F(TestOsMallocGuard, test_realloc) // NOLINT
+{
+    auto* p_buf = static_cast<uint8_t*>(os_malloc(4));
+    ASSERT_NE(nullptr, p_buf);
+    memset(p_buf, 0x11, 4);
+    ASSERT_TRUE(os_realloc_safe((void**)&p_buf, 8));
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        ASSERT_EQ(0x11, p_buf[i]);
+    }
+    memset(p_buf, 0x22, 8);
+    ASSERT_EQ(0, os_malloc_check_all());
+    os_free(p_buf);
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocGuard, test_not_initialized) // NOLINT
+{
+    os_malloc_trace_deinit();
+
+    auto*         p_buf = static_cast<uint8_t*>(os_malloc(4));
+    const int32_t line  = __LINE__ - 1;
+    ASSERT_NE(nullptr, p_buf);
+    ASSERT_EQ(0, os_malloc_check_all());
+    ASSERT_EQ(0, os_malloc_guard_flush_quarantine());
+
+    // The canaries are checked on free even if the trace is not initialized, but the block is not quarantined
+    p_buf[4]                 = 0;
+    const void* const p_addr = p_buf;
+    os_free(p_buf);
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_ERROR,
+        "Block " + ptr_to_str(p_addr) + " (4 bytes) allocated at " + site_to_str(line)
+            + ": rear canary is corrupted (buffer overflow)");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
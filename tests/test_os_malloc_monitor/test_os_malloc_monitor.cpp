@@ -0,0 +1,493 @@
+/**
+ * @file test_os_malloc_monitor.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <string>
+#include <array>
+#include "gtest/gtest.h"
+#include "esp_log_wrapper.hpp"
+#include "os_malloc_monitor.h"
+#include "os_mutex.h"
+#include "os_task.h"
+#include "os_timer.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsMallocMonitor;
+static TestOsMallocMonitor* g_pTestClass;
+
+// The static timer is created only once and it is reused by the next tests, so its callback is saved globally
+static os_timer_callback_periodic_t g_p_timer_cb;
+
+class TestOsMallocMonitor : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        esp_log_wrapper_init();
+        g_pTestClass = this;
+    }
+
+    void
+    TearDown() override
+    {
+        os_malloc_monitor_deinit();
+        esp_log_wrapper_deinit();
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestOsMallocMonitor();
+
+    ~TestOsMallocMonitor() override;
+
+    TickType_t                    m_tickCount;
+    os_malloc_monitor_heap_info_t m_heap_info;
+    bool                          m_is_heap_info_valid;
+    uint32_t                      m_mutex_lock_cnt;
+    bool                          m_is_mutex_deleted;
+    os_timer_callback_periodic_t  m_timer_cb;
+    os_delta_ticks_t              m_timer_period;
+    bool                          m_is_timer_active;
+    bool                          m_is_timer_deleted;
+    uint32_t                      m_signal_send_cnt;
+    os_signal_num_e               m_signal_num;
+    uint32_t                      m_threshold_cb_cnt;
+    os_malloc_monitor_sample_t    m_threshold_cb_sample;
+};
+
+TestOsMallocMonitor::TestOsMallocMonitor()
+    : Test()
+    , m_tickCount(0)
+    , m_heap_info({})
+    , m_is_heap_info_valid(true)
+    , m_mutex_lock_cnt(0)
+    , m_is_mutex_deleted(false)
+    , m_timer_cb(nullptr)
+    , m_timer_period(0)
+    , m_is_timer_active(false)
+    , m_is_timer_deleted(false)
+    , m_signal_send_cnt(0)
+    , m_signal_num(OS_SIGNAL_NUM_NONE)
+    , m_threshold_cb_cnt(0)
+    , m_threshold_cb_sample({})
+{
+}
+
+TestOsMallocMonitor::~TestOsMallocMonitor() = default;
+
+#define TEST_CHECK_LOG_RECORD(level_, msg_) ESP_LOG_WRAPPER_TEST_CHECK_LOG_RECORD("os_malloc_monitor", level_, msg_)
+
+extern "C" {
+
+const char*
+os_task_get_name(void)
+{
+    static const char g_task_name[] = "main";
+    return g_task_name;
+}
+
+os_task_priority_t
+os_task_get_priority(void)
+{
+    return 0;
+}
+
+TickType_t
+xTaskGetTickCount(void)
+{
+    return g_pTestClass->m_tickCount;
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_delete(os_mutex_t* const ph_mutex)
+{
+    *ph_mutex                        = nullptr;
+    g_pTestClass->m_is_mutex_deleted = true;
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_mutex_lock_cnt += 1;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_mutex_lock_cnt -= 1;
+}
+
+os_timer_periodic_t*
+os_timer_periodic_create_static(
+    os_timer_periodic_static_t* const  p_mem,
+    const char* const                  p_timer_name,
+    const os_delta_ticks_t             period_ticks,
+    const os_timer_callback_periodic_t p_cb_func,
+    void* const                        p_arg)
+{
+    (void)p_timer_name;
+    (void)p_arg;
+    g_pTestClass->m_timer_cb     = p_cb_func;
+    g_pTestClass->m_timer_period = period_ticks;
+    g_p_timer_cb                 = p_cb_func;
+    return reinterpret_cast<os_timer_periodic_t*>(p_mem);
+}
+
+void
+os_timer_periodic_delete(os_timer_periodic_t** const p_p_timer)
+{
+    *p_p_timer                       = nullptr;
+    g_pTestClass->m_is_timer_deleted = true;
+}
+
+void
+os_timer_periodic_start(os_timer_periodic_t* const p_timer)
+{
+    (void)p_timer;
+    g_pTestClass->m_is_timer_active = true;
+}
+
+void
+os_timer_periodic_stop(os_timer_periodic_t* const p_timer)
+{
+    (void)p_timer;
+    g_pTestClass->m_is_timer_active = false;
+}
+
+bool
+os_timer_periodic_restart(os_timer_periodic_t* const p_timer, const os_delta_ticks_t period_ticks)
+{
+    (void)p_timer;
+    g_pTestClass->m_timer_period    = period_ticks;
+    g_pTestClass->m_is_timer_active = true;
+    return true;
+}
+
+bool
+os_signal_send(os_signal_t* const p_signal, const os_signal_num_e sig_num)
+{
+    (void)p_signal;
+    g_pTestClass->m_signal_send_cnt += 1;
+    g_pTestClass->m_signal_num = sig_num;
+    return true;
+}
+
+} // extern "C"
+
+static bool
+test_get_heap_info(os_malloc_monitor_heap_info_t* const p_heap_info)
+{
+    if (!g_pTestClass->m_is_heap_info_valid)
+    {
+        return false;
+    }
+    *p_heap_info = g_pTestClass->m_heap_info;
+    return true;
+}
+
+static void
+test_cb_threshold(const os_malloc_monitor_sample_t* const p_sample, void* const p_arg)
+{
+    auto* const pObj = static_cast<TestOsMallocMonitor*>(p_arg);
+    pObj->m_threshold_cb_cnt += 1;
+    pObj->m_threshold_cb_sample = *p_sample;
+}
+
+static os_malloc_monitor_cfg_t
+test_get_default_cfg()
+{
+    os_malloc_monitor_cfg_t cfg = {};
+    cfg.cb_get_heap_info        = &test_get_heap_info;
+    cfg.sig_num                 = OS_SIGNAL_NUM_NONE;
+    return cfg;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsMallocMonitor, test_calc_fragmentation_percent) // NOLINT
+{
+    os_malloc_monitor_heap_info_t heap_info = {};
+    ASSERT_EQ(0, os_malloc_monitor_calc_fragmentation_percent(&heap_info));
+
+    heap_info.free_size          = 1000;
+    heap_info.largest_free_block = 1000;
+    ASSERT_EQ(0, os_malloc_monitor_calc_fragmentation_percent(&heap_info));
+
+    heap_info.largest_free_block = 250;
+    ASSERT_EQ(75, os_malloc_monitor_calc_fragmentation_percent(&heap_info));
+
+    heap_info.largest_free_block = 0;
+    ASSERT_EQ(100, os_malloc_monitor_calc_fragmentation_percent(&heap_info));
+
+    heap_info.largest_free_block = 2000;
+    ASSERT_EQ(0, os_malloc_monitor_calc_fragmentation_percent(&heap_info));
+
+    heap_info.free_size          = UINT32_MAX;
+    heap_info.largest_free_block = UINT32_MAX / 2;
+    ASSERT_EQ(50, os_malloc_monitor_calc_fragmentation_percent(&heap_info));
+}
+
+TEST_F(TestOsMallocMonitor, test_init_without_heap_info_provider) // NOLINT
+{
+    os_malloc_monitor_cfg_t cfg = test_get_default_cfg();
+    cfg.cb_get_heap_info        = nullptr;
+    ASSERT_FALSE(os_malloc_monitor_init(&cfg));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_ERROR, "The heap info provider must be set on this platform");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+    ASSERT_FALSE(os_malloc_monitor_sample(nullptr));
+}
+
+TEST_F(TestOsMallocMonitor, test_sample_and_history) // NOLINT
+{
+    const os_malloc_monitor_cfg_t cfg = test_get_default_cfg();
+    ASSERT_TRUE(os_malloc_monitor_init(&cfg));
+
+    std::array<os_malloc_monitor_sample_t, OS_MALLOC_MONITOR_HISTORY_LEN + 1> arr_of_samples = {};
+    ASSERT_EQ(0, os_malloc_monitor_get_history(arr_of_samples.data(), arr_of_samples.size()));
+
+    for (uint32_t i = 0; i < OS_MALLOC_MONITOR_HISTORY_LEN + 2; ++i)
+    {
+        this->m_tickCount                    = 100 + i;
+        this->m_heap_info.free_size          = 1000 - i * 100;
+        this->m_heap_info.min_free_size      = 500 - i * 10;
+        this->m_heap_info.largest_free_block = 500 - i * 100;
+
+        os_malloc_monitor_sample_t sample = {};
+        ASSERT_TRUE(os_malloc_monitor_sample(&sample));
+        ASSERT_EQ(100 + i, sample.timestamp);
+        ASSERT_EQ(1000 - i * 100, sample.heap_info.free_size);
+        ASSERT_EQ(500 - i * 10, sample.heap_info.min_free_size);
+        ASSERT_EQ(500 - i * 100, sample.heap_info.largest_free_block);
+    }
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+
+    // The oldest samples are overwritten
+    ASSERT_EQ(
+        OS_MALLOC_MONITOR_HISTORY_LEN,
+        os_malloc_monitor_get_history(arr_of_samples.data(), arr_of_samples.size()));
+    for (uint32_t i = 0; i < OS_MALLOC_MONITOR_HISTORY_LEN; ++i)
+    {
+        ASSERT_EQ(102 + i, arr_of_samples[i].timestamp);
+        ASSERT_EQ(800 - i * 100, arr_of_samples[i].heap_info.free_size);
+    }
+    ASSERT_EQ(62, arr_of_samples[0].fragmentation_percent);  // 500 of 800 bytes are not in the largest block
+    ASSERT_EQ(71, arr_of_samples[1].fragmentation_percent);  // 500 of 700
+    ASSERT_EQ(83, arr_of_samples[2].fragmentation_percent);  // 500 of 600
+    ASSERT_EQ(100, arr_of_samples[3].fragmentation_percent); // 500 of 500
+
+    // Only the newest samples are copied if the output array is smaller than the history
+    arr_of_samples = {};
+    ASSERT_EQ(2, os_malloc_monitor_get_history(arr_of_samples.data(), 2));
+    ASSERT_EQ(104, arr_of_samples[0].timestamp);
+    ASSERT_EQ(105, arr_of_samples[1].timestamp);
+    ASSERT_EQ(0, arr_of_samples[2].timestamp);
+
+    // A failed sample is not added to the history
+    this->m_is_heap_info_valid = false;
+    ASSERT_FALSE(os_malloc_monitor_sample(nullptr));
+    ASSERT_EQ(2, os_malloc_monitor_get_history(arr_of_samples.data(), 2));
+    ASSERT_EQ(105, arr_of_samples[1].timestamp);
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocMonitor, test_threshold_is_edge_triggered) // NOLINT
+{
+    os_signal_static_t      signal_mem      = {};
+    os_malloc_monitor_cfg_t cfg             = test_get_default_cfg();
+    cfg.fragmentation_threshold_percent     = 50;
+    cfg.cb_threshold                        = &test_cb_threshold;
+    cfg.p_cb_threshold_arg                  = this;
+    cfg.p_signal                            = reinterpret_cast<os_signal_t*>(&signal_mem);
+    cfg.sig_num                             = OS_SIGNAL_NUM_3;
+    ASSERT_TRUE(os_malloc_monitor_init(&cfg));
+
+    this->m_heap_info.free_size          = 1000;
+    this->m_heap_info.min_free_size      = 800;
+    this->m_heap_info.largest_free_block = 501;
+    ASSERT_TRUE(os_malloc_monitor_sample(nullptr));
+    ASSERT_EQ(0, this->m_threshold_cb_cnt);
+    ASSERT_EQ(0, this->m_signal_send_cnt);
+
+    this->m_tickCount                    = 10;
+    this->m_heap_info.largest_free_block = 500;
+    ASSERT_TRUE(os_malloc_monitor_sample(nullptr));
+    ASSERT_EQ(1, this->m_threshold_cb_cnt);
+    ASSERT_EQ(10, this->m_threshold_cb_sample.timestamp);
+    ASSERT_EQ(50, this->m_threshold_cb_sample.fragmentation_percent);
+    ASSERT_EQ(1, this->m_signal_send_cnt);
+    ASSERT_EQ(OS_SIGNAL_NUM_3, this->m_signal_num);
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_WARN,
+        "Heap fragmentation 50% reached the threshold 50%: free 1000, min free 800, largest free block 500");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    // No notification while the fragmentation remains above the threshold
+    this->m_heap_info.largest_free_block = 100;
+    ASSERT_TRUE(os_malloc_monitor_sample(nullptr));
+    ASSERT_EQ(1, this->m_threshold_cb_cnt);
+    ASSERT_EQ(1, this->m_signal_send_cnt);
+
+    // The notification is re-armed after the fragmentation drops below the threshold
+    this->m_heap_info.largest_free_block = 900;
+    ASSERT_TRUE(os_malloc_monitor_sample(nullptr));
+    ASSERT_EQ(1, this->m_threshold_cb_cnt);
+
+    this->m_tickCount                    = 20;
+    this->m_heap_info.largest_free_block = 200;
+    ASSERT_TRUE(os_malloc_monitor_sample(nullptr));
+    ASSERT_EQ(2, this->m_threshold_cb_cnt);
+    ASSERT_EQ(20, this->m_threshold_cb_sample.timestamp);
+    ASSERT_EQ(80, this->m_threshold_cb_sample.fragmentation_percent);
+    ASSERT_EQ(2, this->m_signal_send_cnt);
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_WARN,
+        "Heap fragmentation 80% reached the threshold 50%: free 1000, min free 800, largest free block 200");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocMonitor, test_threshold_disabled) // NOLINT
+{
+    os_malloc_monitor_cfg_t cfg = test_get_default_cfg();
+    cfg.cb_threshold            = &test_cb_threshold;
+    cfg.p_cb_threshold_arg      = this;
+    ASSERT_TRUE(os_malloc_monitor_init(&cfg));
+
+    this->m_heap_info.free_size = 1000;
+    ASSERT_TRUE(os_malloc_monitor_sample(nullptr));
+    ASSERT_EQ(0, this->m_threshold_cb_cnt);
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocMonitor, test_start_stop) // NOLINT
+{
+    const os_malloc_monitor_cfg_t cfg = test_get_default_cfg();
+    ASSERT_TRUE(os_malloc_monitor_init(&cfg));
+
+    ASSERT_TRUE(os_malloc_monitor_start(10));
+    ASSERT_TRUE(this->m_is_timer_active);
+    ASSERT_EQ(10, this->m_timer_period);
+    ASSERT_NE(nullptr, this->m_timer_cb);
+
+    this->m_tickCount           = 10;
+    this->m_heap_info.free_size = 1000;
+    this->m_timer_cb(nullptr, nullptr);
+    this->m_tickCount = 20;
+    this->m_timer_cb(nullptr, nullptr);
+
+    std::array<os_malloc_monitor_sample_t, OS_MALLOC_MONITOR_HISTORY_LEN> arr_of_samples = {};
+    ASSERT_EQ(2, os_malloc_monitor_get_history(arr_of_samples.data(), arr_of_samples.size()));
+    ASSERT_EQ(10, arr_of_samples[0].timestamp);
+    ASSERT_EQ(20, arr_of_samples[1].timestamp);
+
+    os_malloc_monitor_stop();
+    ASSERT_FALSE(this->m_is_timer_active);
+
+    // The timer is reused on restart
+    this->m_timer_cb = nullptr;
+    ASSERT_TRUE(os_malloc_monitor_start(20));
+    ASSERT_TRUE(this->m_is_timer_active);
+    ASSERT_EQ(20, this->m_timer_period);
+    ASSERT_EQ(nullptr, this->m_timer_cb);
+
+    os_malloc_monitor_deinit();
+    ASSERT_FALSE(this->m_is_timer_active);
+    ASSERT_FALSE(this->m_is_timer_deleted);
+
+    // The static timer is not deleted on deinit, it is reused after the next init
+    ASSERT_TRUE(os_malloc_monitor_init(&cfg));
+    ASSERT_TRUE(os_malloc_monitor_start(30));
+    ASSERT_TRUE(this->m_is_timer_active);
+    ASSERT_EQ(30, this->m_timer_period);
+    ASSERT_EQ(nullptr, this->m_timer_cb);
+    ASSERT_FALSE(this->m_is_timer_deleted);
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocMonitor, test_timer_cb_after_deinit) // NOLINT
+{
+    const os_malloc_monitor_cfg_t cfg = test_get_default_cfg();
+    ASSERT_TRUE(os_malloc_monitor_init(&cfg));
+    ASSERT_TRUE(os_malloc_monitor_start(10));
+    ASSERT_NE(nullptr, g_p_timer_cb);
+
+    os_malloc_monitor_deinit();
+    ASSERT_FALSE(this->m_is_timer_active);
+    ASSERT_FALSE(this->m_is_mutex_deleted);
+
+    // The callback which has been already started by the timer service task before the stop does nothing
+    g_p_timer_cb(nullptr, nullptr);
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+    ASSERT_FALSE(os_malloc_monitor_sample(nullptr));
+
+    ASSERT_TRUE(os_malloc_monitor_init(&cfg));
+    std::array<os_malloc_monitor_sample_t, OS_MALLOC_MONITOR_HISTORY_LEN> arr_of_samples = {};
+    ASSERT_EQ(0, os_malloc_monitor_get_history(arr_of_samples.data(), arr_of_samples.size()));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocMonitor, test_log_dump) // NOLINT
+{
+    const os_malloc_monitor_cfg_t cfg = test_get_default_cfg();
+    ASSERT_TRUE(os_malloc_monitor_init(&cfg));
+
+    os_malloc_monitor_log_dump();
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Num samples: 0");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    this->m_tickCount                    = 5;
+    this->m_heap_info.free_size          = 2000;
+    this->m_heap_info.min_free_size      = 1500;
+    this->m_heap_info.largest_free_block = 1500;
+    ASSERT_TRUE(os_malloc_monitor_sample(nullptr));
+    this->m_tickCount                    = 6;
+    this->m_heap_info.free_size          = 1000;
+    this->m_heap_info.min_free_size      = 900;
+    this->m_heap_info.largest_free_block = 100;
+    ASSERT_TRUE(os_malloc_monitor_sample(nullptr));
+
+    os_malloc_monitor_log_dump();
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Num samples: 2");
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_INFO,
+        "[ 0] at 5: free 2000, min free 1500, largest free block 1500, fragmentation 25%");
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_INFO,
+        "[ 1] at 6: free 1000, min free 900, largest free block 100, fragmentation 90%");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsMallocMonitor, test_not_initialized) // NOLINT
+{
+    std::array<os_malloc_monitor_sample_t, OS_MALLOC_MONITOR_HISTORY_LEN> arr_of_samples = {};
+
+    ASSERT_FALSE(os_malloc_monitor_sample(nullptr));
+    ASSERT_EQ(0, os_malloc_monitor_get_history(arr_of_samples.data(), arr_of_samples.size()));
+
+    ASSERT_FALSE(os_malloc_monitor_start(10));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_ERROR, "os_malloc_monitor is not initialized");
+    ASSERT_FALSE(this->m_is_timer_active);
+
+    os_malloc_monitor_stop();
+    os_malloc_monitor_log_dump();
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "os_malloc_monitor is not initialized");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
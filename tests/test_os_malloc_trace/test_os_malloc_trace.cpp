@@ -0,0 +1,489 @@
+/**
+ * @file test_os_malloc_trace.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <string>
+#include <cstring>
+#include <array>
+#include "gtest/gtest.h"
+#include "esp_log_wrapper.hpp"
+#include "os_malloc.h"
+#include "os_mutex.h"
+#include "os_task.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsMallocTrace;
+static TestOsMallocTrace* g_pTestClass;
+
+class TestOsMallocTrace : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        esp_log_wrapper_init();
+        g_pTestClass = this;
+        os_malloc_trace_init();
+    }
+
+    void
+    TearDown() override
+    {
+        os_malloc_trace_deinit();
+        esp_log_wrapper_deinit();
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestOsMallocTrace();
+
+    ~TestOsMallocTrace() override;
+
+    uint32_t m_mutex_lock_cnt;
+    uint32_t m_realloc_cnt;
+    bool     m_is_realloc_in_place;
+};
+
+TestOsMallocTrace::TestOsMallocTrace()
+    : Test()
+    , m_mutex_lock_cnt(0)
+    , m_realloc_cnt(0)
+    , m_is_realloc_in_place(false)
+{
+}
+
+TestOsMallocTrace::~TestOsMallocTrace() = default;
+
+#define TEST_CHECK_LOG_RECORD(level_, msg_) ESP_LOG_WRAPPER_TEST_CHECK_LOG_RECORD("MEM_TRACE", level_, msg_)
+
+extern "C" {
+
+const char*
+os_task_get_name(void)
+{
+    static const char g_task_name[] = "main";
+    return g_task_name;
+}
+
+os_task_priority_t
+os_task_get_priority(void)
+{
+    return 0;
+}
+
+TickType_t
+xTaskGetTickCount(void)
+{
+    return 0;
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_delete(os_mutex_t* const ph_mutex)
+{
+    *ph_mutex = nullptr;
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_mutex_lock_cnt += 1;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_mutex_lock_cnt -= 1;
+}
+
+void*
+__real_realloc(void* ptr, size_t size);
+
+/**
+ * @brief The wrapper for realloc, it counts the calls and can emulate an allocator which resizes the block in place,
+ *        so that the tests do not depend on the behaviour of the realloc in the C library.
+ * @note The test must not grow the block beyond the size which was originally allocated by the C library
+ *       when m_is_realloc_in_place is set.
+ */
+void*
+__wrap_realloc(void* ptr, size_t size)
+{
+    if (nullptr == g_pTestClass)
+    {
+        return __real_realloc(ptr, size);
+    }
+    g_pTestClass->m_realloc_cnt += 1;
+    if (g_pTestClass->m_is_realloc_in_place)
+    {
+        return ptr;
+    }
+    return __real_realloc(ptr, size);
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsMallocTrace, test_get_sites_since) // NOLINT
+{
+    void* p_old = os_malloc(100);
+    ASSERT_NE(nullptr, p_old);
+    const int32_t line_old = __LINE__ - 2;
+
+    const os_malloc_trace_generation_t generation = os_malloc_trace_mark();
+    ASSERT_EQ(1, generation);
+
+    std::array<void*, 3> arr_of_blocks = {};
+    int32_t              line_loop     = 0;
+    for (auto& p_block : arr_of_blocks)
+    {
+        p_block   = os_calloc(2, 10);
+        line_loop = __LINE__ - 1;
+        ASSERT_NE(nullptr, p_block);
+    }
+    void* p_new = os_malloc(50);
+    ASSERT_NE(nullptr, p_new);
+    const int32_t line_new = __LINE__ - 2;
+    os_free(arr_of_blocks[1]);
+
+    std::array<os_malloc_trace_site_t, 4> arr_of_sites       = {};
+    uint32_t                              num_blocks_skipped = 1;
+    ASSERT_EQ(
+        2,
+        os_malloc_trace_get_sites_since(generation, arr_of_sites.data(), arr_of_sites.size(), &num_blocks_skipped));
+    ASSERT_EQ(0, num_blocks_skipped);
+    ASSERT_EQ(string(__FILE__), string(arr_of_sites[0].p_file));
+    ASSERT_EQ(line_new, arr_of_sites[0].line);
+    ASSERT_EQ(1, arr_of_sites[0].num_blocks);
+    ASSERT_EQ(50, arr_of_sites[0].num_bytes);
+    ASSERT_EQ(string(__FILE__), string(arr_of_sites[1].p_file));
+    ASSERT_EQ(line_loop, arr_of_sites[1].line);
+    ASSERT_EQ(2, arr_of_sites[1].num_blocks);
+    ASSERT_EQ(40, arr_of_sites[1].num_bytes);
+
+    // The blocks allocated before the mark are included for the generation 0
+    ASSERT_EQ(3, os_malloc_trace_get_sites_since(0, arr_of_sites.data(), arr_of_sites.size(), nullptr));
+    ASSERT_EQ(line_old, arr_of_sites[2].line);
+    ASSERT_EQ(100, arr_of_sites[2].num_bytes);
+
+    // The blocks freed after the next mark are not reported
+    const os_malloc_trace_generation_t generation2 = os_malloc_trace_mark();
+    ASSERT_EQ(2, generation2);
+    ASSERT_EQ(0, os_malloc_trace_get_sites_since(generation2, arr_of_sites.data(), arr_of_sites.size(), nullptr));
+    os_free(p_new);
+    os_free(arr_of_blocks[0]);
+    os_free(arr_of_blocks[2]);
+    ASSERT_EQ(0, os_malloc_trace_get_sites_since(generation, arr_of_sites.data(), arr_of_sites.size(), nullptr));
+    os_free(p_old);
+    ASSERT_EQ(0, os_malloc_trace_get_num_blocks());
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+}
+
+TEST_F(TestOsMallocTrace, test_get_sites_since_overflow) // NOLINT
+{
+    const os_malloc_trace_generation_t generation = os_malloc_trace_mark();
+
+    void* p_block1 = os_malloc(1);
+    void* p_block2 = os_malloc(2);
+    void* p_block3 = os_malloc(3);
+    void* p_block4 = os_malloc(4);
+
+    std::array<os_malloc_trace_site_t, 2> arr_of_sites       = {};
+    uint32_t                              num_blocks_skipped = 0;
+    ASSERT_EQ(
+        2,
+        os_malloc_trace_get_sites_since(generation, arr_of_sites.data(), arr_of_sites.size(), &num_blocks_skipped));
+    ASSERT_EQ(2, num_blocks_skipped);
+    ASSERT_EQ(4, arr_of_sites[0].num_bytes);
+    ASSERT_EQ(3, arr_of_sites[1].num_bytes);
+
+    os_free(p_block1);
+    os_free(p_block2);
+    os_free(p_block3);
+    os_free(p_block4);
+}
+
+TEST_F(TestOsMallocTrace, test_realloc_is_reported_as_new_block) // NOLINT
+{
+    void* p_block = os_malloc(10);
+    ASSERT_NE(nullptr, p_block);
+
+    const os_malloc_trace_generation_t generation = os_malloc_trace_mark();
+
+    ASSERT_TRUE(os_realloc_safe(&p_block, 20));
+    const int32_t line_realloc = __LINE__ - 1;
+
+    std::array<os_malloc_trace_site_t, 4> arr_of_sites = {};
+    ASSERT_EQ(1, os_malloc_trace_get_sites_since(generation, arr_of_sites.data(), arr_of_sites.size(), nullptr));
+    ASSERT_EQ(line_realloc, arr_of_sites[0].line);
+    ASSERT_EQ(20, arr_of_sites[0].num_bytes);
+    os_free(p_block);
+}
+
+TEST_F(TestOsMallocTrace, test_realloc_shrink_in_place) // NOLINT
+{
+    auto* p_block = static_cast<uint8_t*>(os_malloc(1000));
+    ASSERT_NE(nullptr, p_block);
+    memset(p_block, 0x5A, 1000);
+    const uint8_t* const p_block_orig = p_block;
+
+    // The whole block with the trace header is passed to realloc, so the block stays in place
+    // if the allocator resizes it in place.
+    this->m_is_realloc_in_place = true;
+    ASSERT_TRUE(os_realloc_safe((void**)&p_block, 100));
+    this->m_is_realloc_in_place = false;
+    ASSERT_EQ(1, this->m_realloc_cnt);
+    ASSERT_EQ(p_block_orig, p_block);
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(0x5A, p_block[i]);
+    }
+    ASSERT_EQ(1, os_malloc_trace_get_num_blocks());
+    os_free(p_block);
+    ASSERT_EQ(0, os_malloc_trace_get_num_blocks());
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+}
+
+TEST_F(TestOsMallocTrace, test_realloc_grow_copy_count) // NOLINT
+{
+    const uint32_t num_reallocs = 256;
+
+    // The block is allocated with the max size first, so that the in-place realloc emulated by the wrapper
+    // never exceeds the memory which was really allocated.
+    auto* p_block = static_cast<uint8_t*>(os_malloc(16 + num_reallocs));
+    ASSERT_NE(nullptr, p_block);
+    p_block[0] = 0x5A;
+
+    this->m_is_realloc_in_place = true;
+    ASSERT_TRUE(os_realloc_safe((void**)&p_block, 16));
+
+    // Before realloc was done in place, each step allocated a new block and copied the data,
+    // so the number of copies was equal to the number of reallocations.
+    // Now the data is moved only by realloc itself, when the allocator can't resize the block in place.
+    uint32_t num_copies = 0;
+    for (uint32_t i = 1; i <= num_reallocs; ++i)
+    {
+        const uint8_t* const p_prev = p_block;
+        ASSERT_TRUE(os_realloc_safe((void**)&p_block, 16 + i));
+        if (p_prev != p_block)
+        {
+            num_copies += 1;
+        }
+        ASSERT_EQ(0x5A, p_block[0]);
+    }
+    this->m_is_realloc_in_place = false;
+    ASSERT_EQ(0, num_copies);
+    ASSERT_EQ(num_reallocs + 1, this->m_realloc_cnt);
+    ASSERT_EQ(1, os_malloc_trace_get_num_blocks());
+    os_free(p_block);
+}
+
+TEST_F(TestOsMallocTrace, test_realloc_failed) // NOLINT
+{
+    void*         p_block1 = os_malloc(1);
+    const int32_t line1    = __LINE__ - 1;
+    void*         p_block2 = os_malloc(2);
+    const int32_t line2    = __LINE__ - 1;
+    void*         p_block3 = os_malloc(3);
+    const int32_t line3    = __LINE__ - 1;
+
+    void* const p_block2_orig = p_block2;
+    ASSERT_FALSE(os_realloc_safe(&p_block2, SIZE_MAX / 2));
+    ASSERT_EQ(p_block2_orig, p_block2);
+    ASSERT_FALSE(os_realloc_safe(&p_block2, SIZE_MAX));
+    ASSERT_EQ(p_block2_orig, p_block2);
+
+    // The block which failed to be reallocated is kept in its original position
+    std::array<os_malloc_trace_site_t, 4> arr_of_sites = {};
+    ASSERT_EQ(3, os_malloc_trace_get_sites_since(0, arr_of_sites.data(), arr_of_sites.size(), nullptr));
+    ASSERT_EQ(line3, arr_of_sites[0].line);
+    ASSERT_EQ(line2, arr_of_sites[1].line);
+    ASSERT_EQ(line1, arr_of_sites[2].line);
+
+    ASSERT_FALSE(os_realloc_safe_and_clean(&p_block2, SIZE_MAX / 2));
+    ASSERT_EQ(nullptr, p_block2);
+    ASSERT_EQ(2, os_malloc_trace_get_num_blocks());
+
+    os_free(p_block1);
+    os_free(p_block3);
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+}
+
+TEST_F(TestOsMallocTrace, test_caps_stat) // NOLINT
+{
+    os_malloc_trace_caps_stat_t stat = {};
+
+    void* p_block1 = os_malloc(10);
+    void* p_block2 = os_malloc_caps(100, OS_MALLOC_CAPS_SPIRAM);
+    void* p_block3 = os_calloc_caps(2, 30, OS_MALLOC_CAPS_SPIRAM);
+    void* p_block4 = os_malloc_caps(20, OS_MALLOC_CAPS_DMA);
+    ASSERT_NE(nullptr, p_block1);
+    ASSERT_NE(nullptr, p_block2);
+    ASSERT_NE(nullptr, p_block3);
+    ASSERT_NE(nullptr, p_block4);
+    ASSERT_EQ(nullptr, os_malloc_caps(10, static_cast<os_malloc_caps_e>(OS_MALLOC_CAPS_NUM)));
+    ASSERT_EQ(4, os_malloc_trace_get_num_blocks());
+
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_DEFAULT, &stat));
+    ASSERT_EQ(1, stat.num_blocks);
+    ASSERT_EQ(10, stat.num_bytes);
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_SPIRAM, &stat));
+    ASSERT_EQ(2, stat.num_blocks);
+    ASSERT_EQ(160, stat.num_bytes);
+    ASSERT_EQ(160, stat.max_num_bytes);
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_DMA, &stat));
+    ASSERT_EQ(1, stat.num_blocks);
+    ASSERT_EQ(20, stat.num_bytes);
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_INTERNAL, &stat));
+    ASSERT_EQ(0, stat.num_blocks);
+    ASSERT_EQ(0, stat.max_num_bytes);
+    ASSERT_FALSE(os_malloc_trace_get_caps_stat(static_cast<os_malloc_caps_e>(OS_MALLOC_CAPS_NUM), &stat));
+
+    // The reallocated block keeps its capabilities
+    ASSERT_TRUE(os_realloc_safe(&p_block2, 40));
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_SPIRAM, &stat));
+    ASSERT_EQ(2, stat.num_blocks);
+    ASSERT_EQ(100, stat.num_bytes);
+    ASSERT_EQ(160, stat.max_num_bytes);
+
+    os_free(p_block2);
+    os_free(p_block3);
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_SPIRAM, &stat));
+    ASSERT_EQ(0, stat.num_blocks);
+    ASSERT_EQ(0, stat.num_bytes);
+    ASSERT_EQ(160, stat.max_num_bytes);
+
+    os_malloc_trace_dump();
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Num blocks allocated: 2");
+    esp_log_wrapper_pop();
+    esp_log_wrapper_pop();
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Memory default: 1 blocks, 10 bytes (max 10 bytes)");
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Memory spiram: 0 blocks, 0 bytes (max 160 bytes)");
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Memory dma: 1 blocks, 20 bytes (max 20 bytes)");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    os_free(p_block1);
+    os_free(p_block4);
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+}
+
+TEST_F(TestOsMallocTrace, test_realloc_caps) // NOLINT
+{
+    os_malloc_trace_caps_stat_t stat = {};
+
+    void* p_block = os_malloc_caps(100, OS_MALLOC_CAPS_SPIRAM);
+    ASSERT_NE(nullptr, p_block);
+
+    // The block is not changed if the capabilities are invalid
+    void* const p_block_orig = p_block;
+    ASSERT_FALSE(os_realloc_caps_safe(&p_block, 40, static_cast<os_malloc_caps_e>(OS_MALLOC_CAPS_NUM)));
+    ASSERT_EQ(p_block_orig, p_block);
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_SPIRAM, &stat));
+    ASSERT_EQ(1, stat.num_blocks);
+    ASSERT_EQ(100, stat.num_bytes);
+
+    // The reallocated block is moved to the memory with the new capabilities
+    ASSERT_TRUE(os_realloc_caps_safe(&p_block, 40, OS_MALLOC_CAPS_INTERNAL));
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_SPIRAM, &stat));
+    ASSERT_EQ(0, stat.num_blocks);
+    ASSERT_EQ(0, stat.num_bytes);
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_INTERNAL, &stat));
+    ASSERT_EQ(1, stat.num_blocks);
+    ASSERT_EQ(40, stat.num_bytes);
+
+    // The next plain realloc keeps the new capabilities
+    ASSERT_TRUE(os_realloc_safe(&p_block, 50));
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_INTERNAL, &stat));
+    ASSERT_EQ(1, stat.num_blocks);
+    ASSERT_EQ(50, stat.num_bytes);
+
+    os_free(p_block);
+    ASSERT_TRUE(os_malloc_trace_get_caps_stat(OS_MALLOC_CAPS_INTERNAL, &stat));
+    ASSERT_EQ(0, stat.num_blocks);
+    ASSERT_EQ(0, this->m_mutex_lock_cnt);
+}
+
+TEST_F(TestOsMallocTrace, test_dump_since) // NOLINT
+{
+    void* p_old = os_malloc(100);
+
+    const os_malloc_trace_generation_t generation = os_malloc_trace_mark();
+
+    void*         p_block1 = os_malloc(10);
+    const int32_t line1    = __LINE__ - 1;
+    void*         p_block2 = os_malloc(30);
+    const int32_t line2    = __LINE__ - 1;
+
+    os_malloc_trace_dump_since(generation);
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Num call sites with blocks allocated since generation 1: 2");
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("[ 0] ") + __FILE__ + ":" + to_string(line2) + ": 1 blocks, 30 bytes");
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("[ 1] ") + __FILE__ + ":" + to_string(line1) + ": 1 blocks, 10 bytes");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    os_free(p_block1);
+    os_free(p_block2);
+    os_free(p_old);
+}
+
+TEST_F(TestOsMallocTrace, test_dump_since_with_skipped_blocks) // NOLINT
+{
+    const os_malloc_trace_generation_t generation = os_malloc_trace_mark();
+
+    std::array<void*, OS_MALLOC_TRACE_MAX_NUM_SITES + 1> arr_of_blocks = {};
+
+    arr_of_blocks[0] = os_malloc(1);
+    arr_of_blocks[1] = os_malloc(2);
+    arr_of_blocks[2] = os_malloc(3);
+    arr_of_blocks[3] = os_malloc(4);
+    arr_of_blocks[4] = os_malloc(5);
+
+    os_malloc_trace_dump_since(generation);
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Num call sites with blocks allocated since generation 1: 4");
+    for (uint32_t i = 0; i < OS_MALLOC_TRACE_MAX_NUM_SITES; ++i)
+    {
+        ASSERT_FALSE(esp_log_wrapper_is_empty());
+        esp_log_wrapper_pop();
+    }
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "Num blocks from other call sites: 1");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    for (auto& p_block : arr_of_blocks)
+    {
+        os_free(p_block);
+    }
+}
+
+TEST_F(TestOsMallocTrace, test_not_initialized) // NOLINT
+{
+    os_malloc_trace_deinit();
+
+    void* p_block = os_malloc(10);
+    ASSERT_NE(nullptr, p_block);
+    ASSERT_EQ(0, os_malloc_trace_mark());
+
+    std::array<os_malloc_trace_site_t, 4> arr_of_sites       = {};
+    uint32_t                              num_blocks_skipped = 1;
+    ASSERT_EQ(0, os_malloc_trace_get_sites_since(0, arr_of_sites.data(), arr_of_sites.size(), &num_blocks_skipped));
+    ASSERT_EQ(0, num_blocks_skipped);
+
+    os_malloc_trace_dump_since(0);
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, "os_malloc trace is not initialized");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+    os_free(p_block);
+}
@@ -7,6 +7,10 @@
 
 #include "os_mkgmtime.h"
 #include "gtest/gtest.h"
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <random>
 #include <string>
 
 using namespace std;
@@ -169,3 +173,212 @@ TEST_F(TestOsMkgmtime, test_os_gmtime_2038_01_19_03_14_08)
     struct tm tm_time = init_tm(2038, 1, 19, 3, 14, 8);
     ASSERT_EQ(-1, os_mkgmtime(&tm_time));
 }
+
+static bool
+is_leap_year(const int year)
+{
+    return (0 == (year % 4)) && ((0 != (year % 100)) || (0 == (year % 400)));
+}
+
+static int
+get_num_days_in_month(const int year, const int month)
+{
+    static const int num_days[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return ((2 == month) && is_leap_year(year)) ? 29 : num_days[month - 1];
+}
+
+TEST_F(TestOsMkgmtime, test_os_mkgmtime64_2038_01_19_03_14_08) // NOLINT
+{
+    struct tm tm_time   = init_tm(2038, 1, 19, 3, 14, 8);
+    int64_t   unix_time = 0;
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(0x80000000LL, unix_time);
+    ASSERT_EQ(138, tm_time.tm_year);
+    ASSERT_EQ(1 - 1, tm_time.tm_mon);
+    ASSERT_EQ(19, tm_time.tm_mday);
+    ASSERT_EQ(3, tm_time.tm_hour);
+    ASSERT_EQ(14, tm_time.tm_min);
+    ASSERT_EQ(8, tm_time.tm_sec);
+    ASSERT_EQ(19 - 1, tm_time.tm_yday);
+    ASSERT_EQ(2, tm_time.tm_wday);
+    ASSERT_EQ(0, tm_time.tm_isdst);
+}
+
+TEST_F(TestOsMkgmtime, test_os_mkgmtime64_2106_02_07_06_28_16) // NOLINT
+{
+    struct tm tm_time   = init_tm(2106, 2, 7, 6, 28, 16);
+    int64_t   unix_time = 0;
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(0x100000000LL, unix_time);
+    ASSERT_EQ(0, tm_time.tm_wday);
+}
+
+TEST_F(TestOsMkgmtime, test_os_mkgmtime64_1969_12_31_23_59_59) // NOLINT
+{
+    struct tm tm_time   = init_tm(1969, 12, 31, 23, 59, 59);
+    int64_t   unix_time = 0;
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(-1, unix_time);
+    ASSERT_EQ(69, tm_time.tm_year);
+    ASSERT_EQ(12 - 1, tm_time.tm_mon);
+    ASSERT_EQ(31, tm_time.tm_mday);
+    ASSERT_EQ(365 - 1, tm_time.tm_yday);
+    ASSERT_EQ(3, tm_time.tm_wday);
+
+    // os_mkgmtime does not support the dates before 1970 and does not change tm
+    tm_time = init_tm(1969, 12, 31, 23, 59, 59);
+    ASSERT_EQ(-1, os_mkgmtime(&tm_time));
+    ASSERT_EQ(0, tm_time.tm_yday);
+}
+
+TEST_F(TestOsMkgmtime, test_os_mkgmtime64_normalization) // NOLINT
+{
+    int64_t unix_time = 0;
+
+    // 40 October is changed into 9 November
+    struct tm tm_time = init_tm(2021, 10, 40, 12, 0, 0);
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(121, tm_time.tm_year);
+    ASSERT_EQ(11 - 1, tm_time.tm_mon);
+    ASSERT_EQ(9, tm_time.tm_mday);
+
+    // Negative month
+    tm_time = init_tm(2021, 1, 15, 0, 0, 0);
+    tm_time.tm_mon -= 1;
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(120, tm_time.tm_year);
+    ASSERT_EQ(12 - 1, tm_time.tm_mon);
+    ASSERT_EQ(15, tm_time.tm_mday);
+
+    tm_time.tm_mon = -25;
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(117, tm_time.tm_year);
+    ASSERT_EQ(12 - 1, tm_time.tm_mon);
+
+    // Negative seconds and large hours
+    tm_time = init_tm(2000, 1, 1, 0, 0, -1);
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(946684799, unix_time);
+    ASSERT_EQ(99, tm_time.tm_year);
+    ASSERT_EQ(31, tm_time.tm_mday);
+    ASSERT_EQ(59, tm_time.tm_sec);
+
+    tm_time = init_tm(2000, 2, 28, 48, 0, 0);
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(3 - 1, tm_time.tm_mon);
+    ASSERT_EQ(1, tm_time.tm_mday);
+    ASSERT_EQ(0, tm_time.tm_hour);
+}
+
+TEST_F(TestOsMkgmtime, test_os_mkgmtime64_out_of_range) // NOLINT
+{
+    struct tm tm_time   = init_tm(2000, 1, 1, 0, 0, 0);
+    int64_t   unix_time = 123;
+    tm_time.tm_year     = INT_MAX;
+    tm_time.tm_mon      = 12;
+    ASSERT_FALSE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(123, unix_time);
+    ASSERT_EQ(INT_MAX, tm_time.tm_year);
+    ASSERT_EQ(12, tm_time.tm_mon);
+
+    tm_time.tm_year = INT_MAX;
+    tm_time.tm_mon  = 11;
+    tm_time.tm_mday = 31;
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(INT_MAX, tm_time.tm_year);
+
+    tm_time.tm_year = INT_MIN;
+    tm_time.tm_mon  = 0;
+    tm_time.tm_mday = 1;
+    ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+    ASSERT_EQ(INT_MIN, tm_time.tm_year);
+    tm_time.tm_sec = -1;
+    ASSERT_FALSE(os_mkgmtime64(&tm_time, &unix_time));
+}
+
+TEST_F(TestOsMkgmtime, test_os_gmtime64_r_out_of_range) // NOLINT
+{
+    struct tm tm_time = {};
+    ASSERT_EQ(nullptr, os_gmtime64_r(INT64_MAX, &tm_time));
+    ASSERT_EQ(nullptr, os_gmtime64_r(INT64_MIN, &tm_time));
+    // The number of seconds of the day is calculated without multiplying the number of days back
+    ASSERT_EQ(nullptr, os_gmtime64_r(INT64_MIN + 1, &tm_time));
+    ASSERT_EQ(nullptr, os_gmtime64_r(INT64_MIN + (24 * 60 * 60) - 1, &tm_time));
+}
+
+TEST_F(TestOsMkgmtime, test_os_mkgmtime64_round_trip_every_day_1600_2500) // NOLINT
+{
+    struct tm tm_time_start = init_tm(1600, 1, 1, 0, 0, 0);
+    int64_t   unix_time     = 0;
+    ASSERT_TRUE(os_mkgmtime64(&tm_time_start, &unix_time));
+    ASSERT_EQ(-11676096000LL, unix_time);
+    ASSERT_EQ(6, tm_time_start.tm_wday);
+
+    int64_t days_since_1970 = unix_time / 86400;
+    int     wday            = tm_time_start.tm_wday;
+    for (int year = 1600; year <= 2500; ++year)
+    {
+        int yday = 0;
+        for (int month = 1; month <= 12; ++month)
+        {
+            for (int mday = 1; mday <= get_num_days_in_month(year, month); ++mday)
+            {
+                const int hour = (int)(days_since_1970 % 24 + 24) % 24;
+                const int min  = (int)(days_since_1970 % 60 + 60) % 60;
+                const int sec  = (int)(days_since_1970 % 61 + 61) % 60;
+
+                struct tm tm_time = init_tm(year, month, mday, hour, min, sec);
+                ASSERT_TRUE(os_mkgmtime64(&tm_time, &unix_time));
+                ASSERT_EQ(days_since_1970 * 86400 + hour * 3600 + min * 60 + sec, unix_time);
+                ASSERT_EQ(year - 1900, tm_time.tm_year);
+                ASSERT_EQ(month - 1, tm_time.tm_mon);
+                ASSERT_EQ(mday, tm_time.tm_mday);
+                ASSERT_EQ(hour, tm_time.tm_hour);
+                ASSERT_EQ(min, tm_time.tm_min);
+                ASSERT_EQ(sec, tm_time.tm_sec);
+                ASSERT_EQ(yday, tm_time.tm_yday);
+                ASSERT_EQ(wday, tm_time.tm_wday);
+                ASSERT_EQ(0, tm_time.tm_isdst);
+
+                struct tm tm_time2 = {};
+                ASSERT_EQ(&tm_time2, os_gmtime64_r(unix_time, &tm_time2));
+                ASSERT_EQ(0, memcmp(&tm_time, &tm_time2, sizeof(tm_time)));
+
+                days_since_1970 += 1;
+                yday += 1;
+                wday = (wday + 1) % 7;
+            }
+        }
+    }
+}
+
+TEST_F(TestOsMkgmtime, test_os_gmtime64_r_compare_with_gmtime_r) // NOLINT
+{
+    if (sizeof(time_t) < sizeof(int64_t))
+    {
+        return;
+    }
+    std::mt19937_64                        rng(2038);
+    std::uniform_int_distribution<int64_t> dist(-315569520000LL, 315569520000LL); // +-10000 years
+    for (uint32_t i = 0; i < 1000000; ++i)
+    {
+        const int64_t unix_time = dist(rng);
+        const time_t  time_val  = (time_t)unix_time;
+        struct tm     tm_time1  = {};
+        struct tm     tm_time2  = {};
+        ASSERT_NE(nullptr, gmtime_r(&time_val, &tm_time1));
+        ASSERT_EQ(&tm_time2, os_gmtime64_r(unix_time, &tm_time2));
+        ASSERT_EQ(tm_time1.tm_year, tm_time2.tm_year);
+        ASSERT_EQ(tm_time1.tm_mon, tm_time2.tm_mon);
+        ASSERT_EQ(tm_time1.tm_mday, tm_time2.tm_mday);
+        ASSERT_EQ(tm_time1.tm_hour, tm_time2.tm_hour);
+        ASSERT_EQ(tm_time1.tm_min, tm_time2.tm_min);
+        ASSERT_EQ(tm_time1.tm_sec, tm_time2.tm_sec);
+        ASSERT_EQ(tm_time1.tm_yday, tm_time2.tm_yday);
+        ASSERT_EQ(tm_time1.tm_wday, tm_time2.tm_wday);
+
+        int64_t unix_time2 = 0;
+        ASSERT_TRUE(os_mkgmtime64(&tm_time2, &unix_time2));
+        ASSERT_EQ(unix_time, unix_time2);
+    }
+}
@@ -0,0 +1,337 @@
+/**
+ * @file test_os_msgpool.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <cstddef>
+#include <cassert>
+#include <cstring>
+#include <set>
+#include <vector>
+#include "gtest/gtest.h"
+#include "os_msgpool.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsMsgpool;
+static TestOsMsgpool* g_pTestClass;
+
+class TestOsMsgpool : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass = this;
+    }
+
+    void
+    TearDown() override
+    {
+        os_msgpool_delete(&this->m_p_msgpool);
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestOsMsgpool();
+
+    ~TestOsMsgpool() override;
+
+    bool          m_malloc_fail;
+    bool          m_is_isr_context;
+    TickType_t    m_tickCount;
+    uint32_t      m_numCallsGetTickCountFromIsr;
+    uint32_t      m_numSignals;
+    uint32_t      m_dummySignal;
+    os_msgpool_t* m_p_msgpool;
+
+    os_signal_t*
+    getSignal()
+    {
+        return reinterpret_cast<os_signal_t*>(&this->m_dummySignal);
+    }
+};
+
+TestOsMsgpool::TestOsMsgpool()
+    : Test()
+    , m_malloc_fail(false)
+    , m_is_isr_context(false)
+    , m_tickCount(0)
+    , m_numCallsGetTickCountFromIsr(0)
+    , m_numSignals(0)
+    , m_dummySignal(0)
+    , m_p_msgpool(nullptr)
+{
+}
+
+TestOsMsgpool::~TestOsMsgpool() = default;
+
+extern "C" {
+
+void*
+os_calloc(const size_t nmemb, const size_t size)
+{
+    if (g_pTestClass->m_malloc_fail)
+    {
+        return nullptr;
+    }
+    return calloc(nmemb, size);
+}
+
+void
+os_free_internal(void* ptr)
+{
+    free(ptr);
+}
+
+bool
+os_signal_send(os_signal_t* const p_signal, const os_signal_num_e sig_num)
+{
+    assert(p_signal == g_pTestClass->getSignal());
+    assert(OS_SIGNAL_NUM_2 == sig_num);
+    g_pTestClass->m_numSignals += 1;
+    return true;
+}
+
+BaseType_t
+xPortInIsrContext(void)
+{
+    return g_pTestClass->m_is_isr_context ? pdTRUE : pdFALSE;
+}
+
+TickType_t
+xTaskGetTickCount(void)
+{
+    assert(!g_pTestClass->m_is_isr_context);
+    return g_pTestClass->m_tickCount;
+}
+
+TickType_t
+xTaskGetTickCountFromISR(void)
+{
+    assert(g_pTestClass->m_is_isr_context);
+    g_pTestClass->m_numCallsGetTickCountFromIsr += 1;
+    return g_pTestClass->m_tickCount;
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsMsgpool, create_invalid_params) // NOLINT
+{
+    ASSERT_EQ(nullptr, os_msgpool_create(0, 4, nullptr, OS_SIGNAL_NUM_2));
+    ASSERT_EQ(nullptr, os_msgpool_create(16, 0, nullptr, OS_SIGNAL_NUM_2));
+}
+
+TEST_F(TestOsMsgpool, create_no_mem) // NOLINT
+{
+    this->m_malloc_fail = true;
+    ASSERT_EQ(nullptr, os_msgpool_create(16, 4, nullptr, OS_SIGNAL_NUM_2));
+}
+
+TEST_F(TestOsMsgpool, create_delete) // NOLINT
+{
+    this->m_p_msgpool = os_msgpool_create(10, 3, nullptr, OS_SIGNAL_NUM_2);
+    ASSERT_NE(nullptr, this->m_p_msgpool);
+    const uint32_t block_size = os_msgpool_get_block_size(this->m_p_msgpool);
+    ASSERT_GE(block_size, 10);
+    ASSERT_EQ(0, block_size % alignof(max_align_t));
+
+    os_msgpool_stat_t stat = {};
+    os_msgpool_get_stat(this->m_p_msgpool, &stat);
+    ASSERT_EQ(0, stat.num_acquired);
+    ASSERT_EQ(0, stat.num_in_use);
+
+    os_msgpool_delete(&this->m_p_msgpool);
+    ASSERT_EQ(nullptr, this->m_p_msgpool);
+}
+
+TEST_F(TestOsMsgpool, acquire_until_exhausted) // NOLINT
+{
+    const uint32_t num_blocks = 40; // more than one word of the bitmap of free buffers
+    this->m_p_msgpool         = os_msgpool_create(24, num_blocks, nullptr, OS_SIGNAL_NUM_2);
+    ASSERT_NE(nullptr, this->m_p_msgpool);
+    const uint32_t block_size = os_msgpool_get_block_size(this->m_p_msgpool);
+
+    std::vector<uint8_t*> blocks;
+    std::set<uint8_t*>    unique_blocks;
+    for (uint32_t i = 0; i < num_blocks; ++i)
+    {
+        auto* const p_block = static_cast<uint8_t*>(os_msgpool_acquire(this->m_p_msgpool));
+        ASSERT_NE(nullptr, p_block);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(p_block) % alignof(max_align_t));
+        memset(p_block, static_cast<int>(i), block_size);
+        blocks.push_back(p_block);
+        unique_blocks.insert(p_block);
+    }
+    ASSERT_EQ(num_blocks, unique_blocks.size());
+    ASSERT_EQ(nullptr, os_msgpool_acquire(this->m_p_msgpool));
+    ASSERT_EQ(nullptr, os_msgpool_acquire(this->m_p_msgpool));
+    for (uint32_t i = 0; i < num_blocks; ++i)
+    {
+        for (uint32_t j = 0; j < block_size; ++j)
+        {
+            ASSERT_EQ(static_cast<uint8_t>(i), blocks[i][j]);
+        }
+    }
+
+    os_msgpool_stat_t stat = {};
+    os_msgpool_get_stat(this->m_p_msgpool, &stat);
+    ASSERT_EQ(num_blocks, stat.num_acquired);
+    ASSERT_EQ(2, stat.num_exhausted);
+    ASSERT_EQ(num_blocks, stat.num_in_use);
+    ASSERT_EQ(num_blocks, stat.max_in_use);
+
+    os_msgpool_release(this->m_p_msgpool, blocks[35]);
+    ASSERT_EQ(blocks[35], os_msgpool_acquire(this->m_p_msgpool));
+    ASSERT_EQ(nullptr, os_msgpool_acquire(this->m_p_msgpool));
+
+    for (auto* const p_block : blocks)
+    {
+        os_msgpool_release(this->m_p_msgpool, p_block);
+    }
+    os_msgpool_get_stat(this->m_p_msgpool, &stat);
+    ASSERT_EQ(num_blocks + 1, stat.num_acquired);
+    ASSERT_EQ(3, stat.num_exhausted);
+    ASSERT_EQ(0, stat.num_in_use);
+    ASSERT_EQ(num_blocks, stat.max_in_use);
+}
+
+TEST_F(TestOsMsgpool, post_receive_release) // NOLINT
+{
+    this->m_p_msgpool = os_msgpool_create(16, 4, this->getSignal(), OS_SIGNAL_NUM_2);
+    ASSERT_NE(nullptr, this->m_p_msgpool);
+    ASSERT_EQ(nullptr, os_msgpool_receive(this->m_p_msgpool));
+
+    this->m_tickCount  = 100;
+    auto* const p_msg1 = static_cast<char*>(os_msgpool_acquire(this->m_p_msgpool));
+    auto* const p_msg2 = static_cast<char*>(os_msgpool_acquire(this->m_p_msgpool));
+    ASSERT_NE(nullptr, p_msg1);
+    ASSERT_NE(nullptr, p_msg2);
+    snprintf(p_msg1, 16, "msg1");
+    snprintf(p_msg2, 16, "msg2");
+
+    ASSERT_TRUE(os_msgpool_post(this->m_p_msgpool, p_msg1));
+    ASSERT_EQ(1, this->m_numSignals);
+    this->m_tickCount = 103;
+    ASSERT_TRUE(os_msgpool_post(this->m_p_msgpool, p_msg2));
+    ASSERT_EQ(1, this->m_numSignals);
+
+    this->m_tickCount     = 110;
+    char* const p_rx_msg1 = static_cast<char*>(os_msgpool_receive(this->m_p_msgpool));
+    ASSERT_EQ(p_msg1, p_rx_msg1);
+    ASSERT_STREQ("msg1", p_rx_msg1);
+    os_msgpool_release(this->m_p_msgpool, p_rx_msg1);
+
+    char* const p_rx_msg2 = static_cast<char*>(os_msgpool_receive(this->m_p_msgpool));
+    ASSERT_EQ(p_msg2, p_rx_msg2);
+    ASSERT_STREQ("msg2", p_rx_msg2);
+    os_msgpool_release(this->m_p_msgpool, p_rx_msg2);
+    ASSERT_EQ(nullptr, os_msgpool_receive(this->m_p_msgpool));
+
+    os_msgpool_stat_t stat = {};
+    os_msgpool_get_stat(this->m_p_msgpool, &stat);
+    ASSERT_EQ(2, stat.num_acquired);
+    ASSERT_EQ(0, stat.num_exhausted);
+    ASSERT_EQ(2, stat.num_posted);
+    ASSERT_EQ(2, stat.num_received);
+    ASSERT_EQ(0, stat.num_in_use);
+    ASSERT_EQ(2, stat.max_in_use);
+    ASSERT_EQ(10 + 7, stat.total_latency_ticks);
+    ASSERT_EQ(10, stat.max_latency_ticks);
+
+    // The consumer drained the queue, so the next post must wake it up again
+    void* const p_msg3 = os_msgpool_acquire(this->m_p_msgpool);
+    ASSERT_NE(nullptr, p_msg3);
+    ASSERT_TRUE(os_msgpool_post(this->m_p_msgpool, p_msg3));
+    ASSERT_EQ(2, this->m_numSignals);
+    ASSERT_EQ(p_msg3, os_msgpool_receive(this->m_p_msgpool));
+    os_msgpool_release(this->m_p_msgpool, p_msg3);
+}
+
+TEST_F(TestOsMsgpool, post_all_blocks) // NOLINT
+{
+    const uint32_t num_blocks = 5; // the capacity of the queue of posted buffers is rounded up to 8
+    this->m_p_msgpool         = os_msgpool_create(8, num_blocks, nullptr, OS_SIGNAL_NUM_2);
+    ASSERT_NE(nullptr, this->m_p_msgpool);
+
+    for (uint32_t iter = 0; iter < 3; ++iter)
+    {
+        std::vector<void*> blocks;
+        for (uint32_t i = 0; i < num_blocks; ++i)
+        {
+            void* const p_block = os_msgpool_acquire(this->m_p_msgpool);
+            ASSERT_NE(nullptr, p_block);
+            ASSERT_TRUE(os_msgpool_post(this->m_p_msgpool, p_block));
+            blocks.push_back(p_block);
+        }
+        ASSERT_EQ(nullptr, os_msgpool_acquire(this->m_p_msgpool));
+        for (uint32_t i = 0; i < num_blocks; ++i)
+        {
+            void* const p_block = os_msgpool_receive(this->m_p_msgpool);
+            ASSERT_EQ(blocks[i], p_block);
+            os_msgpool_release(this->m_p_msgpool, p_block);
+        }
+        ASSERT_EQ(nullptr, os_msgpool_receive(this->m_p_msgpool));
+    }
+}
+
+TEST_F(TestOsMsgpool, acquire_and_post_from_isr) // NOLINT
+{
+    this->m_p_msgpool = os_msgpool_create(32, 2, this->getSignal(), OS_SIGNAL_NUM_2);
+    ASSERT_NE(nullptr, this->m_p_msgpool);
+
+    this->m_is_isr_context = true;
+    this->m_tickCount      = 50;
+    void* const p_msg      = os_msgpool_acquire(this->m_p_msgpool);
+    ASSERT_NE(nullptr, p_msg);
+    ASSERT_TRUE(os_msgpool_post(this->m_p_msgpool, p_msg));
+    ASSERT_EQ(1, this->m_numCallsGetTickCountFromIsr);
+    ASSERT_EQ(1, this->m_numSignals);
+    this->m_is_isr_context = false;
+
+    this->m_tickCount = 52;
+    ASSERT_EQ(p_msg, os_msgpool_receive(this->m_p_msgpool));
+    os_msgpool_release(this->m_p_msgpool, p_msg);
+
+    os_msgpool_stat_t stat = {};
+    os_msgpool_get_stat(this->m_p_msgpool, &stat);
+    ASSERT_EQ(2, stat.total_latency_ticks);
+    ASSERT_EQ(2, stat.max_latency_ticks);
+}
+
+TEST_F(TestOsMsgpool, reset_stat) // NOLINT
+{
+    this->m_p_msgpool = os_msgpool_create(8, 4, nullptr, OS_SIGNAL_NUM_2);
+    ASSERT_NE(nullptr, this->m_p_msgpool);
+
+    void* const p_msg1 = os_msgpool_acquire(this->m_p_msgpool);
+    void* const p_msg2 = os_msgpool_acquire(this->m_p_msgpool);
+    ASSERT_NE(nullptr, p_msg1);
+    ASSERT_NE(nullptr, p_msg2);
+    os_msgpool_release(this->m_p_msgpool, p_msg2);
+
+    os_msgpool_reset_stat(this->m_p_msgpool);
+    os_msgpool_stat_t stat = {};
+    os_msgpool_get_stat(this->m_p_msgpool, &stat);
+    ASSERT_EQ(0, stat.num_acquired);
+    ASSERT_EQ(0, stat.num_exhausted);
+    ASSERT_EQ(0, stat.num_posted);
+    ASSERT_EQ(0, stat.num_received);
+    ASSERT_EQ(1, stat.num_in_use);
+    ASSERT_EQ(1, stat.max_in_use);
+    ASSERT_EQ(0, stat.total_latency_ticks);
+    ASSERT_EQ(0, stat.max_latency_ticks);
+
+    os_msgpool_release(this->m_p_msgpool, p_msg1);
+}
@@ -0,0 +1,391 @@
+/**
+ * @file test_os_mutex_adaptive.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <cassert>
+#include "gtest/gtest.h"
+#include "os_mutex_adaptive.h"
+#include "freertos/task.h"
+
+using namespace std;
+
+#define TEST_CORE_ID_OWNER   (1)
+#define TEST_CORE_ID_SPINNER (0)
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsMutexAdaptive;
+static TestOsMutexAdaptive* g_pTestClass;
+
+class TestOsMutexAdaptive : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass               = this;
+        this->m_isLocked           = false;
+        this->m_hCurTask           = this->getOwnerTask();
+        this->m_curCoreId          = TEST_CORE_ID_OWNER;
+        this->m_tickCount          = 0;
+        this->m_isOwnerRunning     = true;
+        this->m_numReleaseAt       = 0;
+        this->m_numOwnerChecks     = 0;
+        this->m_lastCheckedCore    = -1;
+        this->m_numLockWithTimeout = 0;
+        this->m_lastTicksToWait    = 0;
+        this->m_lockWithTimeoutRes = true;
+        this->p_mutex              = os_mutex_adaptive_create_static(&this->mutex_mem);
+    }
+
+    void
+    TearDown() override
+    {
+        os_mutex_adaptive_delete(&this->p_mutex);
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestOsMutexAdaptive();
+
+    ~TestOsMutexAdaptive() override;
+
+    bool         m_isLocked;
+    TaskHandle_t m_hCurTask;
+    BaseType_t   m_curCoreId;
+    TickType_t   m_tickCount;
+    bool         m_isOwnerRunning;
+    uint32_t     m_numReleaseAt; //!< the owner releases the mutex on this check (0 - never)
+    uint32_t     m_numOwnerChecks;
+    BaseType_t   m_lastCheckedCore;
+    uint32_t     m_numLockWithTimeout;
+    TickType_t   m_lastTicksToWait;
+    bool         m_lockWithTimeoutRes;
+    uint32_t     m_ownerTaskStub;
+    uint32_t     m_spinnerTaskStub;
+
+    os_mutex_adaptive_static_t mutex_mem;
+    os_mutex_adaptive_t*       p_mutex;
+
+    TaskHandle_t
+    getOwnerTask()
+    {
+        return reinterpret_cast<TaskHandle_t>(&this->m_ownerTaskStub);
+    }
+
+    TaskHandle_t
+    getSpinnerTask()
+    {
+        return reinterpret_cast<TaskHandle_t>(&this->m_spinnerTaskStub);
+    }
+
+    void
+    switchToOwner()
+    {
+        this->m_hCurTask  = this->getOwnerTask();
+        this->m_curCoreId = TEST_CORE_ID_OWNER;
+    }
+
+    void
+    switchToSpinner()
+    {
+        this->m_hCurTask  = this->getSpinnerTask();
+        this->m_curCoreId = TEST_CORE_ID_SPINNER;
+    }
+
+    /**
+     * @brief The owner task locks the mutex on its core, then the spinner task tries to lock it.
+     * @param num_release_at - the owner releases the mutex on this check of the spinner (0 - never).
+     * @return the result of os_mutex_adaptive_lock_with_timeout in the spinner task.
+     */
+    bool
+    lockContended(const uint32_t num_release_at, const os_delta_ticks_t ticks_to_wait)
+    {
+        this->switchToOwner();
+        os_mutex_adaptive_lock(this->p_mutex);
+        this->switchToSpinner();
+        this->m_numReleaseAt   = num_release_at;
+        this->m_numOwnerChecks = 0;
+        return os_mutex_adaptive_lock_with_timeout(this->p_mutex, ticks_to_wait);
+    }
+
+    uint32_t
+    getSpinLimit()
+    {
+        os_mutex_adaptive_stat_t stat = {};
+        os_mutex_adaptive_get_stat(this->p_mutex, &stat);
+        return stat.spin_limit;
+    }
+};
+
+TestOsMutexAdaptive::TestOsMutexAdaptive()
+    : Test()
+    , m_isLocked(false)
+    , m_hCurTask(nullptr)
+    , m_curCoreId(0)
+    , m_tickCount(0)
+    , m_isOwnerRunning(true)
+    , m_numReleaseAt(0)
+    , m_numOwnerChecks(0)
+    , m_lastCheckedCore(-1)
+    , m_numLockWithTimeout(0)
+    , m_lastTicksToWait(0)
+    , m_lockWithTimeoutRes(true)
+    , m_ownerTaskStub(0)
+    , m_spinnerTaskStub(0)
+    , mutex_mem()
+    , p_mutex(nullptr)
+{
+}
+
+TestOsMutexAdaptive::~TestOsMutexAdaptive() = default;
+
+extern "C" {
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_delete(os_mutex_t* const ph_mutex)
+{
+    *ph_mutex = nullptr;
+}
+
+bool
+os_mutex_try_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    if (g_pTestClass->m_isLocked)
+    {
+        return false;
+    }
+    g_pTestClass->m_isLocked = true;
+    return true;
+}
+
+bool
+os_mutex_lock_with_timeout(os_mutex_t const h_mutex, const os_delta_ticks_t ticks_to_wait)
+{
+    (void)h_mutex;
+    g_pTestClass->m_numLockWithTimeout += 1;
+    g_pTestClass->m_lastTicksToWait = ticks_to_wait;
+    if (!g_pTestClass->m_lockWithTimeoutRes)
+    {
+        return false;
+    }
+    // Emulate the owner which releases the mutex while the current task is blocked
+    g_pTestClass->m_isLocked = true;
+    return true;
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    assert(!g_pTestClass->m_isLocked);
+    g_pTestClass->m_isLocked = true;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    assert(g_pTestClass->m_isLocked);
+    g_pTestClass->m_isLocked = false;
+}
+
+TaskHandle_t
+xTaskGetCurrentTaskHandle(void)
+{
+    return g_pTestClass->m_hCurTask;
+}
+
+TickType_t
+xTaskGetTickCount(void)
+{
+    return g_pTestClass->m_tickCount;
+}
+
+BaseType_t
+xPortGetCoreID(void)
+{
+    return g_pTestClass->m_curCoreId;
+}
+
+/**
+ * @brief Every call of this function is a spin iteration while the mutex is held, it takes one tick.
+ */
+TaskHandle_t
+xTaskGetCurrentTaskHandleForCPU(BaseType_t cpuid)
+{
+    g_pTestClass->m_numOwnerChecks += 1;
+    g_pTestClass->m_lastCheckedCore = cpuid;
+    g_pTestClass->m_tickCount += 1;
+    if (!g_pTestClass->m_isOwnerRunning)
+    {
+        return nullptr;
+    }
+    if (g_pTestClass->m_numOwnerChecks == g_pTestClass->m_numReleaseAt)
+    {
+        // The owner is running on the other core and releases the mutex while the current task is spinning
+        const TaskHandle_t h_cur_task = g_pTestClass->m_hCurTask;
+        g_pTestClass->switchToOwner();
+        os_mutex_adaptive_unlock(g_pTestClass->p_mutex);
+        g_pTestClass->m_hCurTask  = h_cur_task;
+        g_pTestClass->m_curCoreId = TEST_CORE_ID_SPINNER;
+    }
+    return g_pTestClass->getOwnerTask();
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsMutexAdaptive, test_acquired_immediately) // NOLINT
+{
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MIN_SPINS, this->getSpinLimit());
+    os_mutex_adaptive_lock(this->p_mutex);
+    ASSERT_TRUE(this->m_isLocked);
+    os_mutex_adaptive_unlock(this->p_mutex);
+    ASSERT_FALSE(this->m_isLocked);
+
+    os_mutex_adaptive_stat_t stat = {};
+    os_mutex_adaptive_get_stat(this->p_mutex, &stat);
+    ASSERT_EQ(1, stat.num_locks);
+    ASSERT_EQ(1, stat.num_acquired_immediately);
+    ASSERT_EQ(0, stat.num_spin_successes);
+    ASSERT_EQ(0, stat.num_blocks);
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MIN_SPINS, stat.spin_limit);
+    ASSERT_EQ(0, this->m_numOwnerChecks);
+}
+
+TEST_F(TestOsMutexAdaptive, test_try_lock_does_not_spin) // NOLINT
+{
+    this->switchToOwner();
+    os_mutex_adaptive_lock(this->p_mutex);
+    this->switchToSpinner();
+    ASSERT_FALSE(os_mutex_adaptive_try_lock(this->p_mutex));
+    ASSERT_EQ(0, this->m_numOwnerChecks);
+    ASSERT_EQ(0, this->m_numLockWithTimeout);
+    this->switchToOwner();
+    os_mutex_adaptive_unlock(this->p_mutex);
+}
+
+TEST_F(TestOsMutexAdaptive, test_spin_success) // NOLINT
+{
+    ASSERT_TRUE(this->lockContended(2, OS_DELTA_TICKS_INFINITE));
+    ASSERT_TRUE(this->m_isLocked);
+    ASSERT_EQ(2, this->m_numOwnerChecks);
+    ASSERT_EQ(TEST_CORE_ID_OWNER, this->m_lastCheckedCore);
+    ASSERT_EQ(0, this->m_numLockWithTimeout);
+    os_mutex_adaptive_unlock(this->p_mutex);
+
+    os_mutex_adaptive_stat_t stat = {};
+    os_mutex_adaptive_get_stat(this->p_mutex, &stat);
+    ASSERT_EQ(2, stat.num_locks);
+    ASSERT_EQ(1, stat.num_acquired_immediately);
+    ASSERT_EQ(1, stat.num_spin_successes);
+    ASSERT_EQ(0, stat.num_blocks);
+}
+
+TEST_F(TestOsMutexAdaptive, test_owner_not_running) // NOLINT
+{
+    this->m_isOwnerRunning = false;
+    ASSERT_TRUE(this->lockContended(0, OS_DELTA_TICKS_INFINITE));
+    // The spinning is stopped on the first check, the budget is not wasted and the spin limit is not changed
+    ASSERT_EQ(1, this->m_numOwnerChecks);
+    ASSERT_EQ(1, this->m_numLockWithTimeout);
+    ASSERT_EQ(OS_DELTA_TICKS_INFINITE, this->m_lastTicksToWait);
+    os_mutex_adaptive_unlock(this->p_mutex);
+
+    os_mutex_adaptive_stat_t stat = {};
+    os_mutex_adaptive_get_stat(this->p_mutex, &stat);
+    ASSERT_EQ(0, stat.num_spin_successes);
+    ASSERT_EQ(1, stat.num_blocks);
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MIN_SPINS, stat.spin_limit);
+}
+
+TEST_F(TestOsMutexAdaptive, test_budget_exhausted) // NOLINT
+{
+    ASSERT_TRUE(this->lockContended(0, 100));
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MIN_SPINS, this->m_numOwnerChecks);
+    ASSERT_EQ(1, this->m_numLockWithTimeout);
+    // Each spin iteration takes one tick in this test, so only the remaining time is waited in the kernel
+    ASSERT_EQ(100 - OS_MUTEX_ADAPTIVE_MIN_SPINS, this->m_lastTicksToWait);
+    os_mutex_adaptive_unlock(this->p_mutex);
+
+    os_mutex_adaptive_stat_t stat = {};
+    os_mutex_adaptive_get_stat(this->p_mutex, &stat);
+    ASSERT_EQ(2, stat.num_locks);
+    ASSERT_EQ(0, stat.num_spin_successes);
+    ASSERT_EQ(1, stat.num_blocks);
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MIN_SPINS, stat.spin_limit);
+}
+
+TEST_F(TestOsMutexAdaptive, test_budget_exhausted_timeout) // NOLINT
+{
+    this->m_lockWithTimeoutRes = false;
+    ASSERT_FALSE(this->lockContended(0, 2));
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MIN_SPINS, this->m_numOwnerChecks);
+    ASSERT_EQ(1, this->m_numLockWithTimeout);
+    // The timeout has expired while spinning
+    ASSERT_EQ(0, this->m_lastTicksToWait);
+    this->switchToOwner();
+    os_mutex_adaptive_unlock(this->p_mutex);
+
+    os_mutex_adaptive_stat_t stat = {};
+    os_mutex_adaptive_get_stat(this->p_mutex, &stat);
+    ASSERT_EQ(1, stat.num_locks);
+    ASSERT_EQ(0, stat.num_blocks);
+}
+
+TEST_F(TestOsMutexAdaptive, test_spin_limit_adaptation) // NOLINT
+{
+    // The owner always releases the mutex just before the last spin,
+    // so the spin limit grows until it reaches the maximum
+    uint32_t spin_limit = this->getSpinLimit();
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(this->lockContended(spin_limit - 1, OS_DELTA_TICKS_INFINITE));
+        ASSERT_EQ(spin_limit - 1, this->m_numOwnerChecks);
+        os_mutex_adaptive_unlock(this->p_mutex);
+        const uint32_t new_spin_limit = this->getSpinLimit();
+        ASSERT_GE(new_spin_limit, spin_limit);
+        spin_limit = new_spin_limit;
+    }
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MAX_SPINS, spin_limit);
+    ASSERT_EQ(0, this->m_numLockWithTimeout);
+
+    os_mutex_adaptive_stat_t stat = {};
+    os_mutex_adaptive_get_stat(this->p_mutex, &stat);
+    ASSERT_EQ(100, stat.num_spin_successes);
+    ASSERT_EQ(0, stat.num_blocks);
+
+    // The spin limit is not changed by resetting the counters
+    os_mutex_adaptive_reset_stat(this->p_mutex);
+    os_mutex_adaptive_get_stat(this->p_mutex, &stat);
+    ASSERT_EQ(0, stat.num_spin_successes);
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MAX_SPINS, stat.spin_limit);
+
+    // The owner holds the mutex for longer than the whole budget, so the spin limit shrinks to the minimum
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(this->lockContended(0, OS_DELTA_TICKS_INFINITE));
+        ASSERT_EQ(spin_limit, this->m_numOwnerChecks);
+        os_mutex_adaptive_unlock(this->p_mutex);
+        const uint32_t new_spin_limit = this->getSpinLimit();
+        ASSERT_LE(new_spin_limit, spin_limit);
+        spin_limit = new_spin_limit;
+    }
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MIN_SPINS, spin_limit);
+    ASSERT_EQ(100, this->m_numLockWithTimeout);
+}
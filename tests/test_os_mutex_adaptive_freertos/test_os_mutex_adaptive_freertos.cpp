@@ -0,0 +1,369 @@
+/**
+ * @file test_os_mutex_adaptive_freertos.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <string>
+#include <atomic>
+#include <semaphore.h>
+#include "gtest/gtest.h"
+#include "os_mutex_adaptive.h"
+#include "os_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "TQueue.hpp"
+#include "esp_log_wrapper.hpp"
+#include <sys/time.h>
+
+using namespace std;
+
+#define TEST_NUM_CONTENDING_TASKS (4U)
+#define TEST_NUM_ITERATIONS       (20000U)
+
+typedef enum MainTaskCmd_Tag
+{
+    MainTaskCmd_Exit,
+    MainTaskCmd_MutexAdaptiveCreate,
+    MainTaskCmd_MutexAdaptiveCreateStatic,
+    MainTaskCmd_MutexAdaptiveDelete,
+    MainTaskCmd_MutexAdaptiveLock,
+    MainTaskCmd_MutexAdaptiveTryLock,
+    MainTaskCmd_MutexAdaptiveUnlock,
+    MainTaskCmd_MutexAdaptiveGetStat,
+    MainTaskCmd_MutexAdaptiveResetStat,
+    MainTaskCmd_RunContendingTasks,
+} MainTaskCmd_e;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsMutexAdaptiveFreertos;
+static TestOsMutexAdaptiveFreertos* g_pTestClass;
+
+static void*
+freertosStartup(void* arg);
+
+class TestOsMutexAdaptiveFreertos : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        esp_log_wrapper_init();
+        sem_init(&semaFreeRTOS, 0, 0);
+        pid_test      = pthread_self();
+        const int err = pthread_create(&pid_freertos, nullptr, &freertosStartup, this);
+        assert(0 == err);
+        while (0 != sem_wait(&semaFreeRTOS))
+        {
+        }
+    }
+
+    void
+    TearDown() override
+    {
+        cmdQueue.push_and_wait(MainTaskCmd_Exit);
+        vTaskEndScheduler();
+        void* ret_code = nullptr;
+        pthread_join(pid_freertos, &ret_code);
+        sem_destroy(&semaFreeRTOS);
+        esp_log_wrapper_deinit();
+        g_pTestClass = nullptr;
+    }
+
+public:
+    pthread_t                  pid_test;
+    pthread_t                  pid_freertos;
+    sem_t                      semaFreeRTOS;
+    TQueue<MainTaskCmd_e>      cmdQueue;
+    os_mutex_adaptive_static_t mutex_adaptive_mem;
+    os_mutex_adaptive_t*       p_mutex_adaptive;
+    bool                       cmd_result;
+    os_mutex_adaptive_stat_t   stat;
+    uint32_t                   counter;
+    std::atomic<uint32_t>      num_finished_tasks;
+
+    TestOsMutexAdaptiveFreertos();
+
+    ~TestOsMutexAdaptiveFreertos() override;
+
+    bool
+    wait_until_tasks_finished(const uint32_t timeout_ms);
+};
+
+TestOsMutexAdaptiveFreertos::TestOsMutexAdaptiveFreertos()
+    : Test()
+    , pid_test(0)
+    , pid_freertos(0)
+    , semaFreeRTOS({})
+    , mutex_adaptive_mem({})
+    , p_mutex_adaptive(nullptr)
+    , cmd_result(false)
+    , stat({})
+    , counter(0)
+    , num_finished_tasks(0)
+{
+    g_pTestClass = this;
+}
+
+TestOsMutexAdaptiveFreertos::~TestOsMutexAdaptiveFreertos()
+{
+    g_pTestClass = nullptr;
+}
+
+extern "C" {
+
+static struct timespec
+timespec_get_clock_monotonic(void)
+{
+    struct timespec timestamp = {};
+    clock_gettime(CLOCK_MONOTONIC, &timestamp);
+    return timestamp;
+}
+
+static struct timespec
+timespec_diff(const struct timespec* p_t2, const struct timespec* p_t1)
+{
+    struct timespec result = {
+        .tv_sec  = p_t2->tv_sec - p_t1->tv_sec,
+        .tv_nsec = p_t2->tv_nsec - p_t1->tv_nsec,
+    };
+    if (result.tv_nsec < 0)
+    {
+        result.tv_sec -= 1;
+        result.tv_nsec += 1000000000;
+    }
+    return result;
+}
+
+static uint32_t
+timespec_diff_ms(const struct timespec* p_t2, const struct timespec* p_t1)
+{
+    struct timespec diff = timespec_diff(p_t2, p_t1);
+    return diff.tv_sec * 1000 + diff.tv_nsec / 1000000;
+}
+
+void
+tdd_assert_trap(void)
+{
+    assert(0);
+}
+
+static volatile int32_t g_flagDisableCheckIsThreadFreeRTOS;
+
+void
+disableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    ++g_flagDisableCheckIsThreadFreeRTOS;
+}
+
+void
+enableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    --g_flagDisableCheckIsThreadFreeRTOS;
+    assert(g_flagDisableCheckIsThreadFreeRTOS >= 0);
+}
+
+int
+checkIfCurThreadIsFreeRTOS(void)
+{
+    if (nullptr == g_pTestClass)
+    {
+        return false;
+    }
+    if (g_flagDisableCheckIsThreadFreeRTOS)
+    {
+        return true;
+    }
+    const pthread_t cur_thread_pid = pthread_self();
+    if (cur_thread_pid == g_pTestClass->pid_test)
+    {
+        return false;
+    }
+    return true;
+}
+
+} // extern "C"
+
+bool
+TestOsMutexAdaptiveFreertos::wait_until_tasks_finished(const uint32_t timeout_ms)
+{
+    struct timespec t1 = timespec_get_clock_monotonic();
+    struct timespec t2 = t1;
+    while (timespec_diff_ms(&t2, &t1) < timeout_ms)
+    {
+        if (TEST_NUM_CONTENDING_TASKS == this->num_finished_tasks)
+        {
+            return true;
+        }
+        usleep(1000);
+        t2 = timespec_get_clock_monotonic();
+    }
+    return false;
+}
+
+static void
+contendingTask(void* p_param)
+{
+    auto* pObj = static_cast<TestOsMutexAdaptiveFreertos*>(p_param);
+    for (uint32_t i = 0; i < TEST_NUM_ITERATIONS; ++i)
+    {
+        os_mutex_adaptive_lock(pObj->p_mutex_adaptive);
+        pObj->counter += 1;
+        os_mutex_adaptive_unlock(pObj->p_mutex_adaptive);
+    }
+    pObj->num_finished_tasks += 1;
+}
+
+static bool
+runContendingTasks(TestOsMutexAdaptiveFreertos* const pObj)
+{
+    pObj->counter            = 0;
+    pObj->num_finished_tasks = 0;
+    for (uint32_t i = 0; i < TEST_NUM_CONTENDING_TASKS; ++i)
+    {
+        if (!os_task_create_finite(&contendingTask, "contending", configMINIMAL_STACK_SIZE, pObj, tskIDLE_PRIORITY + 1))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void
+cmdHandlerTask(void* p_param)
+{
+    auto* pObj     = static_cast<TestOsMutexAdaptiveFreertos*>(p_param);
+    bool  flagExit = false;
+    sem_post(&pObj->semaFreeRTOS);
+    while (!flagExit)
+    {
+        const MainTaskCmd_e cmd = pObj->cmdQueue.pop();
+        switch (cmd)
+        {
+            case MainTaskCmd_Exit:
+                flagExit = true;
+                break;
+            case MainTaskCmd_MutexAdaptiveCreate:
+                pObj->p_mutex_adaptive = os_mutex_adaptive_create();
+                break;
+            case MainTaskCmd_MutexAdaptiveCreateStatic:
+                pObj->p_mutex_adaptive = os_mutex_adaptive_create_static(&pObj->mutex_adaptive_mem);
+                break;
+            case MainTaskCmd_MutexAdaptiveDelete:
+                os_mutex_adaptive_delete(&pObj->p_mutex_adaptive);
+                break;
+            case MainTaskCmd_MutexAdaptiveLock:
+                os_mutex_adaptive_lock(pObj->p_mutex_adaptive);
+                break;
+            case MainTaskCmd_MutexAdaptiveTryLock:
+                pObj->cmd_result = os_mutex_adaptive_try_lock(pObj->p_mutex_adaptive);
+                break;
+            case MainTaskCmd_MutexAdaptiveUnlock:
+                os_mutex_adaptive_unlock(pObj->p_mutex_adaptive);
+                break;
+            case MainTaskCmd_MutexAdaptiveGetStat:
+                os_mutex_adaptive_get_stat(pObj->p_mutex_adaptive, &pObj->stat);
+                break;
+            case MainTaskCmd_MutexAdaptiveResetStat:
+                os_mutex_adaptive_reset_stat(pObj->p_mutex_adaptive);
+                break;
+            case MainTaskCmd_RunContendingTasks:
+                pObj->cmd_result = runContendingTasks(pObj);
+                break;
+            default:
+                printf("Error: Unknown cmd %d\n", (int)cmd);
+                exit(1);
+                break;
+        }
+        pObj->cmdQueue.notify_handled();
+    }
+    vTaskDelete(nullptr);
+}
+
+static void*
+freertosStartup(void* arg)
+{
+    auto* pObj = static_cast<TestOsMutexAdaptiveFreertos*>(arg);
+    disableCheckingIfCurThreadIsFreeRTOS();
+    const bool res
+        = xTaskCreate(&cmdHandlerTask, "cmdHandlerTask", configMINIMAL_STACK_SIZE, pObj, tskIDLE_PRIORITY + 1, nullptr);
+    assert(res);
+    vTaskStartScheduler();
+    return nullptr;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsMutexAdaptiveFreertos, test_create_delete) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveCreate);
+    ASSERT_NE(nullptr, this->p_mutex_adaptive);
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveDelete);
+    ASSERT_EQ(nullptr, this->p_mutex_adaptive);
+
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveCreateStatic);
+    ASSERT_EQ(
+        reinterpret_cast<void*>(&this->mutex_adaptive_mem),
+        reinterpret_cast<void*>(this->p_mutex_adaptive));
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveDelete);
+    ASSERT_EQ(nullptr, this->p_mutex_adaptive);
+}
+
+TEST_F(TestOsMutexAdaptiveFreertos, test_lock_unlock_stat) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveCreate);
+    ASSERT_NE(nullptr, this->p_mutex_adaptive);
+
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveGetStat);
+    ASSERT_EQ(0, this->stat.num_locks);
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MIN_SPINS, this->stat.spin_limit);
+
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveLock);
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveTryLock);
+    ASSERT_FALSE(this->cmd_result);
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveUnlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveTryLock);
+    ASSERT_TRUE(this->cmd_result);
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveUnlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveGetStat);
+    ASSERT_EQ(2, this->stat.num_locks);
+    ASSERT_EQ(2, this->stat.num_acquired_immediately);
+    ASSERT_EQ(0, this->stat.num_spin_successes);
+    ASSERT_EQ(0, this->stat.num_blocks);
+
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveResetStat);
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveGetStat);
+    ASSERT_EQ(0, this->stat.num_locks);
+    ASSERT_EQ(0, this->stat.num_acquired_immediately);
+    ASSERT_EQ(OS_MUTEX_ADAPTIVE_MIN_SPINS, this->stat.spin_limit);
+
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveDelete);
+}
+
+TEST_F(TestOsMutexAdaptiveFreertos, test_contending_tasks) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveCreate);
+    ASSERT_NE(nullptr, this->p_mutex_adaptive);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RunContendingTasks);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_tasks_finished(60000));
+    ASSERT_EQ(TEST_NUM_CONTENDING_TASKS * TEST_NUM_ITERATIONS, this->counter);
+
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveGetStat);
+    ASSERT_EQ(TEST_NUM_CONTENDING_TASKS * TEST_NUM_ITERATIONS, this->stat.num_locks);
+    ASSERT_EQ(
+        this->stat.num_locks,
+        this->stat.num_acquired_immediately + this->stat.num_spin_successes + this->stat.num_blocks);
+    ASSERT_GE(this->stat.spin_limit, OS_MUTEX_ADAPTIVE_MIN_SPINS);
+    ASSERT_LE(this->stat.spin_limit, OS_MUTEX_ADAPTIVE_MAX_SPINS);
+
+    cmdQueue.push_and_wait(MainTaskCmd_MutexAdaptiveDelete);
+}
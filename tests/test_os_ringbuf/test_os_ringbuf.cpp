@@ -0,0 +1,388 @@
+/**
+ * @file test_os_ringbuf.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <array>
+#include <algorithm>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "os_ringbuf.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsRingbuf;
+static TestOsRingbuf* g_pTestClass;
+
+class TestOsRingbuf : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass = this;
+        this->m_numSignals.store(0);
+        this->m_lastSigNum = OS_SIGNAL_NUM_NONE;
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestOsRingbuf();
+
+    ~TestOsRingbuf() override;
+
+    std::atomic<uint32_t>        m_numSignals;
+    std::atomic<os_signal_num_e> m_lastSigNum;
+    uint32_t                     m_dummySignal;
+
+    os_signal_t*
+    getSignal()
+    {
+        return reinterpret_cast<os_signal_t*>(&this->m_dummySignal);
+    }
+};
+
+TestOsRingbuf::TestOsRingbuf()
+    : Test()
+    , m_numSignals(0)
+    , m_lastSigNum(OS_SIGNAL_NUM_NONE)
+    , m_dummySignal(0)
+{
+}
+
+TestOsRingbuf::~TestOsRingbuf() = default;
+
+extern "C" {
+
+bool
+os_signal_send(os_signal_t* const p_signal, const os_signal_num_e sig_num)
+{
+    assert(p_signal == g_pTestClass->getSignal());
+    g_pTestClass->m_numSignals += 1;
+    g_pTestClass->m_lastSigNum = sig_num;
+    return true;
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsRingbuf, spsc_create_invalid_params) // NOLINT
+{
+    os_ringbuf_spsc_static_t mem {};
+    std::array<uint8_t, 64>  buf {};
+
+    ASSERT_EQ(nullptr, os_ringbuf_spsc_create_static(&mem, buf.data(), 1, 0, nullptr, OS_SIGNAL_NUM_0));
+    ASSERT_EQ(nullptr, os_ringbuf_spsc_create_static(&mem, buf.data(), 1, 3, nullptr, OS_SIGNAL_NUM_0));
+    ASSERT_EQ(nullptr, os_ringbuf_spsc_create_static(&mem, buf.data(), 1, 12, nullptr, OS_SIGNAL_NUM_0));
+    ASSERT_EQ(nullptr, os_ringbuf_spsc_create_static(&mem, buf.data(), 0, 16, nullptr, OS_SIGNAL_NUM_0));
+    ASSERT_NE(nullptr, os_ringbuf_spsc_create_static(&mem, buf.data(), 1, 1, nullptr, OS_SIGNAL_NUM_0));
+    ASSERT_NE(nullptr, os_ringbuf_spsc_create_static(&mem, buf.data(), 4, 16, nullptr, OS_SIGNAL_NUM_0));
+}
+
+TEST_F(TestOsRingbuf, spsc_push_pop_full_empty) // NOLINT
+{
+    os_ringbuf_spsc_static_t                          mem {};
+    std::array<uint8_t, OS_RINGBUF_SPSC_BUF_SIZE(4, 4)> buf {};
+    os_ringbuf_spsc_t* const p_rb = os_ringbuf_spsc_create_static(&mem, buf.data(), 4, 4, nullptr, OS_SIGNAL_NUM_0);
+    ASSERT_NE(nullptr, p_rb);
+
+    uint32_t val = 0;
+    ASSERT_FALSE(os_ringbuf_spsc_pop(p_rb, &val));
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(os_ringbuf_spsc_push(p_rb, &i));
+    }
+    ASSERT_EQ(4, os_ringbuf_spsc_get_num_items(p_rb));
+    const uint32_t extra = 100;
+    ASSERT_FALSE(os_ringbuf_spsc_push(p_rb, &extra));
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(os_ringbuf_spsc_pop(p_rb, &val));
+        ASSERT_EQ(i, val);
+    }
+    ASSERT_FALSE(os_ringbuf_spsc_pop(p_rb, &val));
+    ASSERT_EQ(0, os_ringbuf_spsc_get_num_items(p_rb));
+}
+
+TEST_F(TestOsRingbuf, spsc_batch_wraparound) // NOLINT
+{
+    os_ringbuf_spsc_static_t                          mem {};
+    std::array<uint8_t, OS_RINGBUF_SPSC_BUF_SIZE(2, 8)> buf {};
+    os_ringbuf_spsc_t* const p_rb = os_ringbuf_spsc_create_static(&mem, buf.data(), 2, 8, nullptr, OS_SIGNAL_NUM_0);
+    ASSERT_NE(nullptr, p_rb);
+
+    std::array<uint16_t, 10> in {};
+    std::array<uint16_t, 10> out {};
+    uint16_t                 next_val      = 0;
+    uint16_t                 next_expected = 0;
+    for (uint32_t iter = 0; iter < 20; ++iter)
+    {
+        for (uint32_t i = 0; i < in.size(); ++i)
+        {
+            in[i] = static_cast<uint16_t>(next_val + i);
+        }
+        const uint32_t num_pushed = os_ringbuf_spsc_push_batch(p_rb, in.data(), 5 + (iter % 4));
+        ASSERT_EQ(5 + (iter % 4), num_pushed);
+        next_val = static_cast<uint16_t>(next_val + num_pushed);
+
+        const uint32_t num_popped = os_ringbuf_spsc_pop_batch(p_rb, out.data(), out.size());
+        ASSERT_EQ(num_pushed, num_popped);
+        for (uint32_t i = 0; i < num_popped; ++i)
+        {
+            ASSERT_EQ(next_expected, out[i]);
+            next_expected += 1;
+        }
+    }
+}
+
+TEST_F(TestOsRingbuf, spsc_batch_partial) // NOLINT
+{
+    os_ringbuf_spsc_static_t                          mem {};
+    std::array<uint8_t, OS_RINGBUF_SPSC_BUF_SIZE(1, 8)> buf {};
+    os_ringbuf_spsc_t* const p_rb = os_ringbuf_spsc_create_static(&mem, buf.data(), 1, 8, nullptr, OS_SIGNAL_NUM_0);
+    ASSERT_NE(nullptr, p_rb);
+
+    const std::array<uint8_t, 10> in = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    std::array<uint8_t, 10>       out {};
+    ASSERT_EQ(8, os_ringbuf_spsc_push_batch(p_rb, in.data(), in.size()));
+    ASSERT_EQ(0, os_ringbuf_spsc_push_batch(p_rb, in.data(), in.size()));
+    ASSERT_EQ(3, os_ringbuf_spsc_pop_batch(p_rb, out.data(), 3));
+    const std::array<uint8_t, 4> in2 = { 10, 11, 12, 13 };
+    ASSERT_EQ(3, os_ringbuf_spsc_push_batch(p_rb, in2.data(), in2.size()));
+    ASSERT_EQ(8, os_ringbuf_spsc_pop_batch(p_rb, out.data(), out.size()));
+    const std::array<uint8_t, 8> expected = { 3, 4, 5, 6, 7, 10, 11, 12 };
+    for (uint32_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(expected[i], out[i]);
+    }
+}
+
+TEST_F(TestOsRingbuf, spsc_signal_only_on_transition_from_empty) // NOLINT
+{
+    os_ringbuf_spsc_static_t                          mem {};
+    std::array<uint8_t, OS_RINGBUF_SPSC_BUF_SIZE(4, 8)> buf {};
+    os_ringbuf_spsc_t* const                          p_rb
+        = os_ringbuf_spsc_create_static(&mem, buf.data(), 4, 8, this->getSignal(), OS_SIGNAL_NUM_3);
+    ASSERT_NE(nullptr, p_rb);
+
+    uint32_t val = 0;
+    ASSERT_TRUE(os_ringbuf_spsc_push(p_rb, &val));
+    ASSERT_EQ(1, this->m_numSignals.load());
+    ASSERT_EQ(OS_SIGNAL_NUM_3, this->m_lastSigNum);
+    ASSERT_TRUE(os_ringbuf_spsc_push(p_rb, &val));
+    ASSERT_TRUE(os_ringbuf_spsc_push(p_rb, &val));
+    ASSERT_EQ(1, this->m_numSignals.load());
+
+    ASSERT_TRUE(os_ringbuf_spsc_pop(p_rb, &val));
+    ASSERT_TRUE(os_ringbuf_spsc_push(p_rb, &val));
+    ASSERT_EQ(1, this->m_numSignals.load());
+
+    std::array<uint32_t, 8> out {};
+    ASSERT_EQ(3, os_ringbuf_spsc_pop_batch(p_rb, out.data(), out.size()));
+    const std::array<uint32_t, 4> in {};
+    ASSERT_EQ(4, os_ringbuf_spsc_push_batch(p_rb, in.data(), in.size()));
+    ASSERT_EQ(2, this->m_numSignals.load());
+}
+
+TEST_F(TestOsRingbuf, spsc_two_threads) // NOLINT
+{
+    constexpr uint32_t                                  num_items = 200000;
+    os_ringbuf_spsc_static_t                            mem {};
+    std::array<uint8_t, OS_RINGBUF_SPSC_BUF_SIZE(4, 64)> buf {};
+    os_ringbuf_spsc_t* const p_rb = os_ringbuf_spsc_create_static(&mem, buf.data(), 4, 64, nullptr, OS_SIGNAL_NUM_0);
+    ASSERT_NE(nullptr, p_rb);
+
+    std::thread producer([p_rb]() {
+        std::array<uint32_t, 7> batch {};
+        uint32_t                next_val = 0;
+        while (next_val < num_items)
+        {
+            for (uint32_t i = 0; i < batch.size(); ++i)
+            {
+                batch[i] = next_val + i;
+            }
+            const uint32_t num_to_push = std::min<uint32_t>(batch.size(), num_items - next_val);
+            const uint32_t num_pushed  = os_ringbuf_spsc_push_batch(p_rb, batch.data(), num_to_push);
+            if (0 == num_pushed)
+            {
+                std::this_thread::yield();
+            }
+            next_val += num_pushed;
+        }
+    });
+
+    std::array<uint32_t, 13> out {};
+    uint32_t                 next_expected = 0;
+    while (next_expected < num_items)
+    {
+        const uint32_t num_popped = os_ringbuf_spsc_pop_batch(p_rb, out.data(), out.size());
+        if (0 == num_popped)
+        {
+            std::this_thread::yield();
+        }
+        for (uint32_t i = 0; i < num_popped; ++i)
+        {
+            ASSERT_EQ(next_expected, out[i]);
+            next_expected += 1;
+        }
+    }
+    producer.join();
+    ASSERT_EQ(0, os_ringbuf_spsc_get_num_items(p_rb));
+}
+
+TEST_F(TestOsRingbuf, mpsc_create_invalid_params) // NOLINT
+{
+    os_ringbuf_mpsc_static_t mem {};
+    std::array<uint32_t, 32> buf {};
+    uint8_t* const           p_buf = reinterpret_cast<uint8_t*>(buf.data());
+
+    ASSERT_EQ(nullptr, os_ringbuf_mpsc_create_static(&mem, p_buf, 1, 0, nullptr, OS_SIGNAL_NUM_0));
+    ASSERT_EQ(nullptr, os_ringbuf_mpsc_create_static(&mem, p_buf, 1, 5, nullptr, OS_SIGNAL_NUM_0));
+    ASSERT_EQ(nullptr, os_ringbuf_mpsc_create_static(&mem, p_buf, 0, 8, nullptr, OS_SIGNAL_NUM_0));
+    ASSERT_EQ(nullptr, os_ringbuf_mpsc_create_static(&mem, p_buf + 1, 4, 8, nullptr, OS_SIGNAL_NUM_0));
+    ASSERT_NE(nullptr, os_ringbuf_mpsc_create_static(&mem, p_buf, 4, 8, nullptr, OS_SIGNAL_NUM_0));
+}
+
+TEST_F(TestOsRingbuf, mpsc_push_pop_batch_wraparound) // NOLINT
+{
+    os_ringbuf_mpsc_static_t mem {};
+    std::array<uint32_t, OS_RINGBUF_MPSC_BUF_SIZE(4, 8) / sizeof(uint32_t)> buf {};
+    os_ringbuf_mpsc_t* const p_rb = os_ringbuf_mpsc_create_static(&mem, buf.data(), 4, 8, nullptr, OS_SIGNAL_NUM_0);
+    ASSERT_NE(nullptr, p_rb);
+
+    uint32_t val = 0;
+    ASSERT_FALSE(os_ringbuf_mpsc_pop(p_rb, &val));
+
+    std::array<uint32_t, 10> in {};
+    std::array<uint32_t, 10> out {};
+    uint32_t                 next_val      = 0;
+    uint32_t                 next_expected = 0;
+    for (uint32_t iter = 0; iter < 20; ++iter)
+    {
+        for (uint32_t i = 0; i < in.size(); ++i)
+        {
+            in[i] = next_val + i;
+        }
+        const uint32_t num_pushed = os_ringbuf_mpsc_push_batch(p_rb, in.data(), in.size());
+        ASSERT_EQ(8, num_pushed);
+        ASSERT_EQ(8, os_ringbuf_mpsc_get_num_items(p_rb));
+        ASSERT_FALSE(os_ringbuf_mpsc_push(p_rb, &val));
+        next_val += num_pushed;
+
+        ASSERT_TRUE(os_ringbuf_mpsc_pop(p_rb, &val));
+        ASSERT_EQ(next_expected, val);
+        next_expected += 1;
+        const uint32_t num_popped = os_ringbuf_mpsc_pop_batch(p_rb, out.data(), 3 + (iter % 5));
+        ASSERT_EQ(3 + (iter % 5), num_popped);
+        for (uint32_t i = 0; i < num_popped; ++i)
+        {
+            ASSERT_EQ(next_expected, out[i]);
+            next_expected += 1;
+        }
+        const uint32_t num_rest = os_ringbuf_mpsc_pop_batch(p_rb, out.data(), out.size());
+        for (uint32_t i = 0; i < num_rest; ++i)
+        {
+            ASSERT_EQ(next_expected, out[i]);
+            next_expected += 1;
+        }
+        ASSERT_EQ(next_val, next_expected);
+    }
+}
+
+TEST_F(TestOsRingbuf, mpsc_signal_only_on_transition_from_empty) // NOLINT
+{
+    os_ringbuf_mpsc_static_t mem {};
+    std::array<uint32_t, OS_RINGBUF_MPSC_BUF_SIZE(4, 8) / sizeof(uint32_t)> buf {};
+    os_ringbuf_mpsc_t* const p_rb
+        = os_ringbuf_mpsc_create_static(&mem, buf.data(), 4, 8, this->getSignal(), OS_SIGNAL_NUM_5);
+    ASSERT_NE(nullptr, p_rb);
+
+    const std::array<uint32_t, 3> in = { 1, 2, 3 };
+    ASSERT_EQ(3, os_ringbuf_mpsc_push_batch(p_rb, in.data(), in.size()));
+    ASSERT_EQ(1, this->m_numSignals.load());
+    ASSERT_EQ(OS_SIGNAL_NUM_5, this->m_lastSigNum);
+    ASSERT_TRUE(os_ringbuf_mpsc_push(p_rb, &in[0]));
+    ASSERT_EQ(1, this->m_numSignals.load());
+
+    std::array<uint32_t, 8> out {};
+    ASSERT_EQ(4, os_ringbuf_mpsc_pop_batch(p_rb, out.data(), out.size()));
+    ASSERT_TRUE(os_ringbuf_mpsc_push(p_rb, &in[0]));
+    ASSERT_EQ(2, this->m_numSignals.load());
+}
+
+TEST_F(TestOsRingbuf, mpsc_multiple_producers) // NOLINT
+{
+    constexpr uint32_t num_producers         = 4;
+    constexpr uint32_t num_items_per_producer = 100000;
+
+    os_ringbuf_mpsc_static_t mem {};
+    std::array<uint32_t, OS_RINGBUF_MPSC_BUF_SIZE(4, 32) / sizeof(uint32_t)> buf {};
+    os_ringbuf_mpsc_t* const p_rb
+        = os_ringbuf_mpsc_create_static(&mem, buf.data(), 4, 32, this->getSignal(), OS_SIGNAL_NUM_0);
+    ASSERT_NE(nullptr, p_rb);
+
+    std::vector<std::thread> producers;
+    for (uint32_t producer_idx = 0; producer_idx < num_producers; ++producer_idx)
+    {
+        producers.emplace_back([p_rb, producer_idx]() {
+            std::array<uint32_t, 3> batch {};
+            uint32_t                next_val = 0;
+            while (next_val < num_items_per_producer)
+            {
+                for (uint32_t i = 0; i < batch.size(); ++i)
+                {
+                    batch[i] = (producer_idx << 24U) | (next_val + i);
+                }
+                const uint32_t num_to_push = std::min<uint32_t>(batch.size(), num_items_per_producer - next_val);
+                const uint32_t num_pushed  = os_ringbuf_mpsc_push_batch(p_rb, batch.data(), num_to_push);
+                if (0 == num_pushed)
+                {
+                    std::this_thread::yield();
+                }
+                next_val += num_pushed;
+            }
+        });
+    }
+
+    std::array<uint32_t, num_producers> next_expected {};
+    std::array<uint32_t, 16>            out {};
+    uint32_t                            num_received = 0;
+    while (num_received < (num_producers * num_items_per_producer))
+    {
+        const uint32_t num_popped = os_ringbuf_mpsc_pop_batch(p_rb, out.data(), out.size());
+        if (0 == num_popped)
+        {
+            std::this_thread::yield();
+        }
+        for (uint32_t i = 0; i < num_popped; ++i)
+        {
+            const uint32_t producer_idx = out[i] >> 24U;
+            ASSERT_LT(producer_idx, num_producers);
+            ASSERT_EQ(next_expected[producer_idx], out[i] & 0xFFFFFFU);
+            next_expected[producer_idx] += 1;
+        }
+        num_received += num_popped;
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    ASSERT_EQ(0, os_ringbuf_mpsc_get_num_items(p_rb));
+    ASSERT_GE(this->m_numSignals.load(), 1);
+}
@@ -0,0 +1,418 @@
+/**
+ * @file test_os_ringbuf_freertos.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <string>
+#include <array>
+#include <atomic>
+#include <algorithm>
+#include <semaphore.h>
+#include "gtest/gtest.h"
+#include "os_ringbuf.h"
+#include "os_signal.h"
+#include "os_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "TQueue.hpp"
+#include "esp_log_wrapper.hpp"
+#include <sys/time.h>
+
+using namespace std;
+
+#define TEST_RINGBUF_MAX_NUM_PRODUCERS        (2U)
+#define TEST_RINGBUF_NUM_ITEMS_PER_PRODUCER   (50000U)
+#define TEST_RINGBUF_CAPACITY                 (64U)
+#define TEST_RINGBUF_BATCH_SIZE               (8U)
+#define TEST_RINGBUF_PRODUCER_IDX_SHIFT       (24U)
+#define TEST_RINGBUF_SIG_RINGBUF              (OS_SIGNAL_NUM_0)
+#define TEST_RINGBUF_CONSUMER_WAIT_TIMEOUT_MS (1000U)
+
+typedef enum MainTaskCmd_Tag
+{
+    MainTaskCmd_Exit,
+    MainTaskCmd_RunRingbufSpsc,
+    MainTaskCmd_RunRingbufMpsc,
+} MainTaskCmd_e;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsRingbufFreertos;
+static TestOsRingbufFreertos* g_pTestClass;
+
+static void*
+freertosStartup(void* arg);
+
+class TestOsRingbufFreertos : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        esp_log_wrapper_init();
+        sem_init(&semaFreeRTOS, 0, 0);
+        pid_test      = pthread_self();
+        const int err = pthread_create(&pid_freertos, nullptr, &freertosStartup, this);
+        assert(0 == err);
+        while (0 != sem_wait(&semaFreeRTOS))
+        {
+        }
+    }
+
+    void
+    TearDown() override
+    {
+        cmdQueue.push_and_wait(MainTaskCmd_Exit);
+        vTaskEndScheduler();
+        void* ret_code = nullptr;
+        pthread_join(pid_freertos, &ret_code);
+        sem_destroy(&semaFreeRTOS);
+        esp_log_wrapper_deinit();
+        g_pTestClass = nullptr;
+    }
+
+public:
+    pthread_t                pid_test;
+    pthread_t                pid_freertos;
+    sem_t                    semaFreeRTOS;
+    TQueue<MainTaskCmd_e>    cmdQueue;
+    bool                     is_mpsc;
+    uint32_t                 num_producers;
+    os_signal_static_t       signal_mem;
+    os_signal_t*             p_signal;
+    os_ringbuf_spsc_static_t ringbuf_spsc_mem;
+    os_ringbuf_spsc_t*       p_ringbuf_spsc;
+    os_ringbuf_mpsc_static_t ringbuf_mpsc_mem;
+    os_ringbuf_mpsc_t*       p_ringbuf_mpsc;
+    bool                     cmd_result;
+    uint32_t                 num_received;
+    uint32_t                 num_wakeups;
+    bool                     is_order_valid;
+    std::atomic<bool>        is_finished;
+
+    std::array<uint8_t, OS_RINGBUF_SPSC_BUF_SIZE(sizeof(uint32_t), TEST_RINGBUF_CAPACITY)> ringbuf_spsc_buf;
+    std::array<uint32_t, OS_RINGBUF_MPSC_BUF_SIZE(sizeof(uint32_t), TEST_RINGBUF_CAPACITY) / sizeof(uint32_t)>
+        ringbuf_mpsc_buf;
+
+    TestOsRingbufFreertos();
+
+    ~TestOsRingbufFreertos() override;
+
+    bool
+    wait_until_finished(const uint32_t timeout_ms);
+
+    void
+    run_producers_and_consumer(const MainTaskCmd_e cmd, const uint32_t num_producers);
+};
+
+TestOsRingbufFreertos::TestOsRingbufFreertos()
+    : Test()
+    , pid_test(0)
+    , pid_freertos(0)
+    , semaFreeRTOS({})
+    , is_mpsc(false)
+    , num_producers(0)
+    , signal_mem({})
+    , p_signal(nullptr)
+    , ringbuf_spsc_mem({})
+    , p_ringbuf_spsc(nullptr)
+    , ringbuf_mpsc_mem({})
+    , p_ringbuf_mpsc(nullptr)
+    , cmd_result(false)
+    , num_received(0)
+    , num_wakeups(0)
+    , is_order_valid(false)
+    , is_finished(false)
+    , ringbuf_spsc_buf({})
+    , ringbuf_mpsc_buf({})
+{
+    g_pTestClass = this;
+}
+
+TestOsRingbufFreertos::~TestOsRingbufFreertos()
+{
+    g_pTestClass = nullptr;
+}
+
+extern "C" {
+
+static struct timespec
+timespec_get_clock_monotonic(void)
+{
+    struct timespec timestamp = {};
+    clock_gettime(CLOCK_MONOTONIC, &timestamp);
+    return timestamp;
+}
+
+static struct timespec
+timespec_diff(const struct timespec* p_t2, const struct timespec* p_t1)
+{
+    struct timespec result = {
+        .tv_sec  = p_t2->tv_sec - p_t1->tv_sec,
+        .tv_nsec = p_t2->tv_nsec - p_t1->tv_nsec,
+    };
+    if (result.tv_nsec < 0)
+    {
+        result.tv_sec -= 1;
+        result.tv_nsec += 1000000000;
+    }
+    return result;
+}
+
+static uint32_t
+timespec_diff_ms(const struct timespec* p_t2, const struct timespec* p_t1)
+{
+    struct timespec diff = timespec_diff(p_t2, p_t1);
+    return diff.tv_sec * 1000 + diff.tv_nsec / 1000000;
+}
+
+void
+tdd_assert_trap(void)
+{
+    assert(0);
+}
+
+static volatile int32_t g_flagDisableCheckIsThreadFreeRTOS;
+
+void
+disableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    ++g_flagDisableCheckIsThreadFreeRTOS;
+}
+
+void
+enableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    --g_flagDisableCheckIsThreadFreeRTOS;
+    assert(g_flagDisableCheckIsThreadFreeRTOS >= 0);
+}
+
+int
+checkIfCurThreadIsFreeRTOS(void)
+{
+    if (nullptr == g_pTestClass)
+    {
+        return false;
+    }
+    if (g_flagDisableCheckIsThreadFreeRTOS)
+    {
+        return true;
+    }
+    const pthread_t cur_thread_pid = pthread_self();
+    if (cur_thread_pid == g_pTestClass->pid_test)
+    {
+        return false;
+    }
+    return true;
+}
+
+} // extern "C"
+
+bool
+TestOsRingbufFreertos::wait_until_finished(const uint32_t timeout_ms)
+{
+    struct timespec t1 = timespec_get_clock_monotonic();
+    struct timespec t2 = t1;
+    while (timespec_diff_ms(&t2, &t1) < timeout_ms)
+    {
+        if (this->is_finished)
+        {
+            return true;
+        }
+        usleep(1000);
+        t2 = timespec_get_clock_monotonic();
+    }
+    return false;
+}
+
+static uint32_t g_producerIdx;
+
+static void
+producerTask(void* p_param)
+{
+    auto* const    pObj         = static_cast<TestOsRingbufFreertos*>(p_param);
+    const uint32_t producer_idx = g_producerIdx++;
+    const uint32_t tag          = producer_idx << TEST_RINGBUF_PRODUCER_IDX_SHIFT;
+
+    std::array<uint32_t, TEST_RINGBUF_BATCH_SIZE> batch {};
+    uint32_t                                      next_val = 0;
+    while (next_val < TEST_RINGBUF_NUM_ITEMS_PER_PRODUCER)
+    {
+        const uint32_t num_items = std::min<uint32_t>(batch.size(), TEST_RINGBUF_NUM_ITEMS_PER_PRODUCER - next_val);
+        for (uint32_t i = 0; i < num_items; ++i)
+        {
+            batch[i] = tag | (next_val + i);
+        }
+        const uint32_t num_pushed = pObj->is_mpsc
+                                        ? os_ringbuf_mpsc_push_batch(pObj->p_ringbuf_mpsc, batch.data(), num_items)
+                                        : os_ringbuf_spsc_push_batch(pObj->p_ringbuf_spsc, batch.data(), num_items);
+        if (0 == num_pushed)
+        {
+            taskYIELD();
+        }
+        next_val += num_pushed;
+    }
+}
+
+static void
+consumerTask(void* p_param)
+{
+    auto* const pObj = static_cast<TestOsRingbufFreertos*>(p_param);
+    os_signal_register_cur_thread(pObj->p_signal);
+    g_producerIdx = 0;
+    for (uint32_t i = 0; i < pObj->num_producers; ++i)
+    {
+        if (!os_task_create_finite(&producerTask, "producer", configMINIMAL_STACK_SIZE, pObj, tskIDLE_PRIORITY + 1))
+        {
+            assert(0);
+        }
+    }
+
+    std::array<uint32_t, TEST_RINGBUF_MAX_NUM_PRODUCERS> next_expected {};
+    std::array<uint32_t, TEST_RINGBUF_CAPACITY>          items {};
+    const uint32_t num_items_total = pObj->num_producers * TEST_RINGBUF_NUM_ITEMS_PER_PRODUCER;
+    pObj->is_order_valid           = true;
+    while (pObj->num_received < num_items_total)
+    {
+        const uint32_t num_items = pObj->is_mpsc
+                                       ? os_ringbuf_mpsc_pop_batch(pObj->p_ringbuf_mpsc, items.data(), items.size())
+                                       : os_ringbuf_spsc_pop_batch(pObj->p_ringbuf_spsc, items.data(), items.size());
+        if (0 == num_items)
+        {
+            os_signal_events_t sig_events = { 0 };
+            (void)os_signal_wait_with_timeout(
+                pObj->p_signal,
+                OS_DELTA_MS_TO_TICKS(TEST_RINGBUF_CONSUMER_WAIT_TIMEOUT_MS),
+                &sig_events);
+            pObj->num_wakeups += 1;
+            continue;
+        }
+        for (uint32_t i = 0; i < num_items; ++i)
+        {
+            const uint32_t producer_idx = items[i] >> TEST_RINGBUF_PRODUCER_IDX_SHIFT;
+            const uint32_t val          = items[i] & ((1U << TEST_RINGBUF_PRODUCER_IDX_SHIFT) - 1U);
+            if ((producer_idx >= pObj->num_producers) || (val != next_expected[producer_idx]))
+            {
+                pObj->is_order_valid = false;
+            }
+            else
+            {
+                next_expected[producer_idx] += 1;
+            }
+        }
+        pObj->num_received += num_items;
+    }
+    os_signal_unregister_cur_thread(pObj->p_signal);
+    pObj->is_finished = true;
+}
+
+static bool
+runProducersAndConsumer(TestOsRingbufFreertos* const pObj, const bool is_mpsc)
+{
+    pObj->is_mpsc      = is_mpsc;
+    pObj->num_received = 0;
+    pObj->num_wakeups  = 0;
+    pObj->is_finished  = false;
+    if (nullptr == pObj->p_signal)
+    {
+        pObj->p_signal = os_signal_create_static(&pObj->signal_mem);
+        os_signal_add(pObj->p_signal, TEST_RINGBUF_SIG_RINGBUF);
+    }
+    if (is_mpsc)
+    {
+        pObj->p_ringbuf_mpsc = os_ringbuf_mpsc_create_static(
+            &pObj->ringbuf_mpsc_mem,
+            pObj->ringbuf_mpsc_buf.data(),
+            sizeof(uint32_t),
+            TEST_RINGBUF_CAPACITY,
+            pObj->p_signal,
+            TEST_RINGBUF_SIG_RINGBUF);
+    }
+    else
+    {
+        pObj->p_ringbuf_spsc = os_ringbuf_spsc_create_static(
+            &pObj->ringbuf_spsc_mem,
+            pObj->ringbuf_spsc_buf.data(),
+            sizeof(uint32_t),
+            TEST_RINGBUF_CAPACITY,
+            pObj->p_signal,
+            TEST_RINGBUF_SIG_RINGBUF);
+    }
+    return os_task_create_finite(&consumerTask, "consumer", configMINIMAL_STACK_SIZE * 2, pObj, tskIDLE_PRIORITY + 1);
+}
+
+static void
+cmdHandlerTask(void* p_param)
+{
+    auto* pObj     = static_cast<TestOsRingbufFreertos*>(p_param);
+    bool  flagExit = false;
+    sem_post(&pObj->semaFreeRTOS);
+    while (!flagExit)
+    {
+        const MainTaskCmd_e cmd = pObj->cmdQueue.pop();
+        switch (cmd)
+        {
+            case MainTaskCmd_Exit:
+                os_signal_delete(&pObj->p_signal);
+                flagExit = true;
+                break;
+            case MainTaskCmd_RunRingbufSpsc:
+                pObj->cmd_result = runProducersAndConsumer(pObj, false);
+                break;
+            case MainTaskCmd_RunRingbufMpsc:
+                pObj->cmd_result = runProducersAndConsumer(pObj, true);
+                break;
+            default:
+                printf("Error: Unknown cmd %d\n", (int)cmd);
+                exit(1);
+                break;
+        }
+        pObj->cmdQueue.notify_handled();
+    }
+    vTaskDelete(nullptr);
+}
+
+static void*
+freertosStartup(void* arg)
+{
+    auto* pObj = static_cast<TestOsRingbufFreertos*>(arg);
+    disableCheckingIfCurThreadIsFreeRTOS();
+    const bool res
+        = xTaskCreate(&cmdHandlerTask, "cmdHandlerTask", configMINIMAL_STACK_SIZE, pObj, tskIDLE_PRIORITY + 1, nullptr);
+    assert(res);
+    vTaskStartScheduler();
+    return nullptr;
+}
+
+void
+TestOsRingbufFreertos::run_producers_and_consumer(const MainTaskCmd_e cmd, const uint32_t num_producers)
+{
+    this->num_producers = num_producers;
+    cmdQueue.push_and_wait(cmd);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_finished(60000));
+    ASSERT_EQ(num_producers * TEST_RINGBUF_NUM_ITEMS_PER_PRODUCER, this->num_received);
+    ASSERT_TRUE(this->is_order_valid);
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsRingbufFreertos, test_spsc_one_producer) // NOLINT
+{
+    this->run_producers_and_consumer(MainTaskCmd_RunRingbufSpsc, 1);
+    ASSERT_FALSE(HasFailure());
+    // The consumer is woken up only when the ring buffer becomes non-empty, not for every item
+    ASSERT_LT(this->num_wakeups, TEST_RINGBUF_NUM_ITEMS_PER_PRODUCER);
+}
+
+TEST_F(TestOsRingbufFreertos, test_mpsc_two_producers) // NOLINT
+{
+    this->run_producers_and_consumer(MainTaskCmd_RunRingbufMpsc, TEST_RINGBUF_MAX_NUM_PRODUCERS);
+    ASSERT_FALSE(HasFailure());
+    ASSERT_LT(this->num_wakeups, TEST_RINGBUF_MAX_NUM_PRODUCERS * TEST_RINGBUF_NUM_ITEMS_PER_PRODUCER);
+}
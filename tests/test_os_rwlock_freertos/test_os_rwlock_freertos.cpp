@@ -0,0 +1,525 @@
+/**
+ * @file test_os_rwlock_freertos.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <string>
+#include <atomic>
+#include <semaphore.h>
+#include "gtest/gtest.h"
+#include "os_rwlock.h"
+#include "os_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "TQueue.hpp"
+#include "esp_log_wrapper.hpp"
+#include <sys/time.h>
+
+using namespace std;
+
+typedef enum MainTaskCmd_Tag
+{
+    MainTaskCmd_Exit,
+    MainTaskCmd_RwlockCreate,
+    MainTaskCmd_RwlockCreateStatic,
+    MainTaskCmd_RwlockDelete,
+    MainTaskCmd_RwlockReadLock,
+    MainTaskCmd_RwlockReadTryLock,
+    MainTaskCmd_RwlockReadUnlock,
+    MainTaskCmd_RwlockWriteLock,
+    MainTaskCmd_RwlockWriteTryLock,
+    MainTaskCmd_RwlockWriteUnlock,
+    MainTaskCmd_RwlockGetStat,
+    MainTaskCmd_RunReaderTask,
+    MainTaskCmd_RunWriterTask,
+} MainTaskCmd_e;
+
+typedef enum HelperTaskState_Tag
+{
+    HelperTaskState_NotStarted,
+    HelperTaskState_Waiting,
+    HelperTaskState_Locked,
+    HelperTaskState_Timeout,
+    HelperTaskState_Finished,
+} HelperTaskState_e;
+
+typedef struct HelperTask_t
+{
+    os_delta_ticks_t               ticks_to_wait;
+    std::atomic<HelperTaskState_e> state;
+    std::atomic<bool>              flag_release;
+} HelperTask_t;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsRwlockFreertos;
+static TestOsRwlockFreertos* g_pTestClass;
+
+static void*
+freertosStartup(void* arg);
+
+class TestOsRwlockFreertos : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        esp_log_wrapper_init();
+        sem_init(&semaFreeRTOS, 0, 0);
+        pid_test      = pthread_self();
+        const int err = pthread_create(&pid_freertos, nullptr, &freertosStartup, this);
+        assert(0 == err);
+        while (0 != sem_wait(&semaFreeRTOS))
+        {
+        }
+    }
+
+    void
+    TearDown() override
+    {
+        cmdQueue.push_and_wait(MainTaskCmd_Exit);
+        vTaskEndScheduler();
+        void* ret_code = nullptr;
+        pthread_join(pid_freertos, &ret_code);
+        sem_destroy(&semaFreeRTOS);
+        esp_log_wrapper_deinit();
+        g_pTestClass = nullptr;
+    }
+
+public:
+    pthread_t             pid_test;
+    pthread_t             pid_freertos;
+    sem_t                 semaFreeRTOS;
+    TQueue<MainTaskCmd_e> cmdQueue;
+    os_rwlock_static_t    rwlock_mem;
+    os_rwlock_t*          p_rwlock;
+    bool                  cmd_result;
+    os_rwlock_stat_t      stat;
+    HelperTask_t          reader;
+    HelperTask_t          writer;
+
+    TestOsRwlockFreertos();
+
+    ~TestOsRwlockFreertos() override;
+
+    static bool
+    wait_until_state(const HelperTask_t* const p_task, const HelperTaskState_e state, const uint32_t timeout_ms);
+};
+
+TestOsRwlockFreertos::TestOsRwlockFreertos()
+    : Test()
+    , pid_test(0)
+    , pid_freertos(0)
+    , semaFreeRTOS({})
+    , rwlock_mem({})
+    , p_rwlock(nullptr)
+    , cmd_result(false)
+    , stat({})
+{
+    this->reader.ticks_to_wait = 0;
+    this->reader.state         = HelperTaskState_NotStarted;
+    this->reader.flag_release  = false;
+    this->writer.ticks_to_wait = 0;
+    this->writer.state         = HelperTaskState_NotStarted;
+    this->writer.flag_release  = false;
+    g_pTestClass               = this;
+}
+
+TestOsRwlockFreertos::~TestOsRwlockFreertos()
+{
+    g_pTestClass = nullptr;
+}
+
+extern "C" {
+
+static struct timespec
+timespec_get_clock_monotonic(void)
+{
+    struct timespec timestamp = {};
+    clock_gettime(CLOCK_MONOTONIC, &timestamp);
+    return timestamp;
+}
+
+static struct timespec
+timespec_diff(const struct timespec* p_t2, const struct timespec* p_t1)
+{
+    struct timespec result = {
+        .tv_sec  = p_t2->tv_sec - p_t1->tv_sec,
+        .tv_nsec = p_t2->tv_nsec - p_t1->tv_nsec,
+    };
+    if (result.tv_nsec < 0)
+    {
+        result.tv_sec -= 1;
+        result.tv_nsec += 1000000000;
+    }
+    return result;
+}
+
+static uint32_t
+timespec_diff_ms(const struct timespec* p_t2, const struct timespec* p_t1)
+{
+    struct timespec diff = timespec_diff(p_t2, p_t1);
+    return diff.tv_sec * 1000 + diff.tv_nsec / 1000000;
+}
+
+void
+tdd_assert_trap(void)
+{
+    assert(0);
+}
+
+static volatile int32_t g_flagDisableCheckIsThreadFreeRTOS;
+
+void
+disableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    ++g_flagDisableCheckIsThreadFreeRTOS;
+}
+
+void
+enableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    --g_flagDisableCheckIsThreadFreeRTOS;
+    assert(g_flagDisableCheckIsThreadFreeRTOS >= 0);
+}
+
+int
+checkIfCurThreadIsFreeRTOS(void)
+{
+    if (nullptr == g_pTestClass)
+    {
+        return false;
+    }
+    if (g_flagDisableCheckIsThreadFreeRTOS)
+    {
+        return true;
+    }
+    const pthread_t cur_thread_pid = pthread_self();
+    if (cur_thread_pid == g_pTestClass->pid_test)
+    {
+        return false;
+    }
+    return true;
+}
+
+} // extern "C"
+
+bool
+TestOsRwlockFreertos::wait_until_state(
+    const HelperTask_t* const p_task,
+    const HelperTaskState_e   state,
+    const uint32_t            timeout_ms)
+{
+    struct timespec t1 = timespec_get_clock_monotonic();
+    struct timespec t2 = t1;
+    while (timespec_diff_ms(&t2, &t1) < timeout_ms)
+    {
+        if (state == p_task->state)
+        {
+            return true;
+        }
+        usleep(1000);
+        t2 = timespec_get_clock_monotonic();
+    }
+    return false;
+}
+
+static void
+readerTask(void* p_param)
+{
+    auto* pObj         = static_cast<TestOsRwlockFreertos*>(p_param);
+    pObj->reader.state = HelperTaskState_Waiting;
+    if (!os_rwlock_read_lock_with_timeout(pObj->p_rwlock, pObj->reader.ticks_to_wait))
+    {
+        pObj->reader.state = HelperTaskState_Timeout;
+        return;
+    }
+    pObj->reader.state = HelperTaskState_Locked;
+    while (!pObj->reader.flag_release)
+    {
+        vTaskDelay(1);
+    }
+    os_rwlock_read_unlock(pObj->p_rwlock);
+    pObj->reader.state = HelperTaskState_Finished;
+}
+
+static void
+writerTask(void* p_param)
+{
+    auto* pObj         = static_cast<TestOsRwlockFreertos*>(p_param);
+    pObj->writer.state = HelperTaskState_Waiting;
+    if (!os_rwlock_write_lock_with_timeout(pObj->p_rwlock, pObj->writer.ticks_to_wait))
+    {
+        pObj->writer.state = HelperTaskState_Timeout;
+        return;
+    }
+    pObj->writer.state = HelperTaskState_Locked;
+    while (!pObj->writer.flag_release)
+    {
+        vTaskDelay(1);
+    }
+    os_rwlock_write_unlock(pObj->p_rwlock);
+    pObj->writer.state = HelperTaskState_Finished;
+}
+
+static void
+cmdHandlerTask(void* p_param)
+{
+    auto* pObj     = static_cast<TestOsRwlockFreertos*>(p_param);
+    bool  flagExit = false;
+    sem_post(&pObj->semaFreeRTOS);
+    while (!flagExit)
+    {
+        const MainTaskCmd_e cmd = pObj->cmdQueue.pop();
+        switch (cmd)
+        {
+            case MainTaskCmd_Exit:
+                flagExit = true;
+                break;
+            case MainTaskCmd_RwlockCreate:
+                pObj->p_rwlock = os_rwlock_create();
+                break;
+            case MainTaskCmd_RwlockCreateStatic:
+                pObj->p_rwlock = os_rwlock_create_static(&pObj->rwlock_mem);
+                break;
+            case MainTaskCmd_RwlockDelete:
+                os_rwlock_delete(&pObj->p_rwlock);
+                break;
+            case MainTaskCmd_RwlockReadLock:
+                os_rwlock_read_lock(pObj->p_rwlock);
+                break;
+            case MainTaskCmd_RwlockReadTryLock:
+                pObj->cmd_result = os_rwlock_read_try_lock(pObj->p_rwlock);
+                break;
+            case MainTaskCmd_RwlockReadUnlock:
+                os_rwlock_read_unlock(pObj->p_rwlock);
+                break;
+            case MainTaskCmd_RwlockWriteLock:
+                os_rwlock_write_lock(pObj->p_rwlock);
+                break;
+            case MainTaskCmd_RwlockWriteTryLock:
+                pObj->cmd_result = os_rwlock_write_try_lock(pObj->p_rwlock);
+                break;
+            case MainTaskCmd_RwlockWriteUnlock:
+                os_rwlock_write_unlock(pObj->p_rwlock);
+                break;
+            case MainTaskCmd_RwlockGetStat:
+                os_rwlock_get_stat(pObj->p_rwlock, &pObj->stat);
+                break;
+            case MainTaskCmd_RunReaderTask:
+                pObj->cmd_result = os_task_create_finite(
+                    &readerTask,
+                    "reader",
+                    configMINIMAL_STACK_SIZE,
+                    pObj,
+                    tskIDLE_PRIORITY + 1);
+                break;
+            case MainTaskCmd_RunWriterTask:
+                pObj->cmd_result = os_task_create_finite(
+                    &writerTask,
+                    "writer",
+                    configMINIMAL_STACK_SIZE,
+                    pObj,
+                    tskIDLE_PRIORITY + 1);
+                break;
+            default:
+                printf("Error: Unknown cmd %d\n", (int)cmd);
+                exit(1);
+                break;
+        }
+        pObj->cmdQueue.notify_handled();
+    }
+    vTaskDelete(nullptr);
+}
+
+static void*
+freertosStartup(void* arg)
+{
+    auto* pObj = static_cast<TestOsRwlockFreertos*>(arg);
+    disableCheckingIfCurThreadIsFreeRTOS();
+    const bool res
+        = xTaskCreate(&cmdHandlerTask, "cmdHandlerTask", configMINIMAL_STACK_SIZE, pObj, tskIDLE_PRIORITY + 1, nullptr);
+    assert(res);
+    vTaskStartScheduler();
+    return nullptr;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsRwlockFreertos, test_create_delete) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockCreate);
+    ASSERT_NE(nullptr, this->p_rwlock);
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockDelete);
+    ASSERT_EQ(nullptr, this->p_rwlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockCreateStatic);
+    ASSERT_EQ(reinterpret_cast<void*>(&this->rwlock_mem), reinterpret_cast<void*>(this->p_rwlock));
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockDelete);
+    ASSERT_EQ(nullptr, this->p_rwlock);
+}
+
+TEST_F(TestOsRwlockFreertos, test_multiple_readers) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockCreate);
+    ASSERT_NE(nullptr, this->p_rwlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockReadLock);
+
+    this->reader.ticks_to_wait = OS_DELTA_TICKS_IMMEDIATE;
+    cmdQueue.push_and_wait(MainTaskCmd_RunReaderTask);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Locked, 1000));
+
+    this->writer.ticks_to_wait = OS_DELTA_TICKS_IMMEDIATE;
+    cmdQueue.push_and_wait(MainTaskCmd_RunWriterTask);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->writer, HelperTaskState_Timeout, 1000));
+
+    this->reader.flag_release = true;
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Finished, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockWriteTryLock);
+    ASSERT_FALSE(this->cmd_result);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockReadUnlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockWriteTryLock);
+    ASSERT_TRUE(this->cmd_result);
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockWriteUnlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockGetStat);
+    ASSERT_EQ(2, this->stat.num_read_locks);
+    ASSERT_EQ(1, this->stat.num_write_locks);
+    ASSERT_EQ(0, this->stat.num_read_contentions);
+    ASSERT_EQ(2, this->stat.num_write_contentions);
+    ASSERT_EQ(0, this->stat.num_read_timeouts);
+    ASSERT_EQ(2, this->stat.num_write_timeouts);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockDelete);
+}
+
+TEST_F(TestOsRwlockFreertos, test_writer_blocks_readers) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockCreateStatic);
+    ASSERT_NE(nullptr, this->p_rwlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockWriteLock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockReadTryLock);
+    ASSERT_FALSE(this->cmd_result);
+
+    this->reader.ticks_to_wait = OS_DELTA_MS_TO_TICKS(50);
+    cmdQueue.push_and_wait(MainTaskCmd_RunReaderTask);
+    ASSERT_TRUE(this->cmd_result);
+    const struct timespec t1 = timespec_get_clock_monotonic();
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Timeout, 1000));
+    const struct timespec t2 = timespec_get_clock_monotonic();
+    ASSERT_GE(timespec_diff_ms(&t2, &t1), 40);
+
+    this->reader.state         = HelperTaskState_NotStarted;
+    this->reader.ticks_to_wait = OS_DELTA_TICKS_INFINITE;
+    cmdQueue.push_and_wait(MainTaskCmd_RunReaderTask);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Waiting, 1000));
+    ASSERT_FALSE(wait_until_state(&this->reader, HelperTaskState_Locked, 50));
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockWriteUnlock);
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Locked, 1000));
+    this->reader.flag_release = true;
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Finished, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockGetStat);
+    ASSERT_EQ(1, this->stat.num_read_locks);
+    ASSERT_EQ(1, this->stat.num_write_locks);
+    ASSERT_EQ(3, this->stat.num_read_contentions);
+    ASSERT_EQ(0, this->stat.num_write_contentions);
+    ASSERT_EQ(2, this->stat.num_read_timeouts);
+    ASSERT_EQ(0, this->stat.num_write_timeouts);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockDelete);
+}
+
+TEST_F(TestOsRwlockFreertos, test_writer_preference) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockCreate);
+    ASSERT_NE(nullptr, this->p_rwlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockReadLock);
+
+    this->writer.ticks_to_wait = OS_DELTA_TICKS_INFINITE;
+    cmdQueue.push_and_wait(MainTaskCmd_RunWriterTask);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->writer, HelperTaskState_Waiting, 1000));
+    ASSERT_FALSE(wait_until_state(&this->writer, HelperTaskState_Locked, 50));
+
+    // The lock is held only by a reader, but new readers must wait for the waiting writer
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockReadTryLock);
+    ASSERT_FALSE(this->cmd_result);
+
+    this->reader.ticks_to_wait = OS_DELTA_TICKS_INFINITE;
+    cmdQueue.push_and_wait(MainTaskCmd_RunReaderTask);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Waiting, 1000));
+    ASSERT_FALSE(wait_until_state(&this->reader, HelperTaskState_Locked, 50));
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockReadUnlock);
+    ASSERT_TRUE(wait_until_state(&this->writer, HelperTaskState_Locked, 1000));
+    ASSERT_FALSE(wait_until_state(&this->reader, HelperTaskState_Locked, 50));
+
+    this->writer.flag_release = true;
+    ASSERT_TRUE(wait_until_state(&this->writer, HelperTaskState_Finished, 1000));
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Locked, 1000));
+    this->reader.flag_release = true;
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Finished, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockGetStat);
+    ASSERT_EQ(2, this->stat.num_read_locks);
+    ASSERT_EQ(1, this->stat.num_write_locks);
+    ASSERT_EQ(2, this->stat.num_read_contentions);
+    ASSERT_EQ(1, this->stat.num_write_contentions);
+    ASSERT_EQ(1, this->stat.num_read_timeouts);
+    ASSERT_EQ(0, this->stat.num_write_timeouts);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockDelete);
+}
+
+TEST_F(TestOsRwlockFreertos, test_writer_timeout_unblocks_readers) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockCreate);
+    ASSERT_NE(nullptr, this->p_rwlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockReadLock);
+
+    this->writer.ticks_to_wait = OS_DELTA_MS_TO_TICKS(100);
+    cmdQueue.push_and_wait(MainTaskCmd_RunWriterTask);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->writer, HelperTaskState_Waiting, 1000));
+
+    this->reader.ticks_to_wait = OS_DELTA_TICKS_INFINITE;
+    cmdQueue.push_and_wait(MainTaskCmd_RunReaderTask);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Waiting, 1000));
+
+    ASSERT_TRUE(wait_until_state(&this->writer, HelperTaskState_Timeout, 1000));
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Locked, 1000));
+    this->reader.flag_release = true;
+    ASSERT_TRUE(wait_until_state(&this->reader, HelperTaskState_Finished, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockReadUnlock);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockGetStat);
+    ASSERT_EQ(2, this->stat.num_read_locks);
+    ASSERT_EQ(0, this->stat.num_write_locks);
+    ASSERT_EQ(1, this->stat.num_read_contentions);
+    ASSERT_EQ(1, this->stat.num_write_contentions);
+    ASSERT_EQ(0, this->stat.num_read_timeouts);
+    ASSERT_EQ(1, this->stat.num_write_timeouts);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RwlockDelete);
+}
@@ -185,6 +185,17 @@ checkIfCurThreadIsFreeRTOS(void)
     return true;
 }
 
+static uint32_t g_fake_clock_us;
+static uint32_t g_fake_clock_step_us;
+
+static uint32_t
+fake_clock_us(void)
+{
+    const uint32_t timestamp_us = g_fake_clock_us;
+    g_fake_clock_us += g_fake_clock_step_us;
+    return timestamp_us;
+}
+
 } // extern "C"
 
 bool
@@ -520,3 +531,81 @@ TEST_F(TestOsSignalFreertos, test1) // NOLINT
         ASSERT_EQ(2, pEv->thread_num);
     }
 }
+
+TEST_F(TestOsSignalFreertos, test_latency_percentile) // NOLINT
+{
+    os_signal_latency_stat_t stat = {};
+    ASSERT_EQ(0, os_signal_latency_get_percentile_us(&stat, 50));
+
+    stat.num_samples = 100;
+    stat.min_us      = 1;
+    stat.max_us      = 5000;
+    stat.hist[0]     = 50; // 0..1 us
+    stat.hist[3]     = 49; // 8..15 us
+    stat.hist[12]    = 1;  // 4096..8191 us
+    ASSERT_EQ(1, os_signal_latency_get_percentile_us(&stat, 0));
+    ASSERT_EQ(1, os_signal_latency_get_percentile_us(&stat, 50));
+    ASSERT_EQ(15, os_signal_latency_get_percentile_us(&stat, 51));
+    ASSERT_EQ(15, os_signal_latency_get_percentile_us(&stat, 99));
+    ASSERT_EQ(5000, os_signal_latency_get_percentile_us(&stat, 100));
+    ASSERT_EQ(5000, os_signal_latency_get_percentile_us(&stat, 200));
+
+    // The last bucket counts all the latencies above its lower bound
+    stat             = {};
+    stat.num_samples = 1;
+    stat.min_us      = UINT32_MAX;
+    stat.max_us      = UINT32_MAX;
+
+    stat.hist[OS_SIGNAL_LATENCY_NUM_BUCKETS - 1] = 1;
+    ASSERT_EQ(UINT32_MAX, os_signal_latency_get_percentile_us(&stat, 50));
+}
+
+TEST_F(TestOsSignalFreertos, test_latency) // NOLINT
+{
+    g_fake_clock_us      = 0xFFFFFF00U; // check the wrap-around of the clock
+    g_fake_clock_step_us = 100;
+    os_signal_latency_set_clock(&fake_clock_us);
+
+    cmdQueue.push_and_wait(MainTaskCmd_RunSignalHandlerTask1);
+    ASSERT_TRUE(this->result_run_signal_handler_task);
+    ASSERT_TRUE(wait_until_thread1_registered(1000));
+
+    os_signal_latency_stat_t stat = {};
+    os_signal_latency_get_stat(this->p_signal, &stat);
+    ASSERT_EQ(0, stat.num_samples);
+
+    // os_signal_send and the wake-up of the waiting task read the clock once each
+    cmdQueue.push_and_wait(MainTaskCmd_SendToTask1Signal1);
+    ASSERT_TRUE(wait_until_new_events_pushed(1, 1000));
+    testEvents.clear();
+    os_signal_latency_get_stat(this->p_signal, &stat);
+    ASSERT_EQ(1, stat.num_samples);
+    ASSERT_EQ(100, stat.min_us);
+    ASSERT_EQ(100, stat.max_us);
+    ASSERT_EQ(100, stat.total_us);
+    ASSERT_EQ(1, stat.hist[6]); // 64..127 us
+    ASSERT_EQ(100, os_signal_latency_get_percentile_us(&stat, 50));
+
+    g_fake_clock_step_us = 3000;
+    cmdQueue.push_and_wait(MainTaskCmd_SendToTask1Signal0);
+    ASSERT_TRUE(wait_until_new_events_pushed(1, 1000));
+    testEvents.clear();
+    os_signal_latency_get_stat(this->p_signal, &stat);
+    ASSERT_EQ(2, stat.num_samples);
+    ASSERT_EQ(100, stat.min_us);
+    ASSERT_EQ(3000, stat.max_us);
+    ASSERT_EQ(3100, stat.total_us);
+    ASSERT_EQ(1, stat.hist[11]); // 2048..4095 us
+    ASSERT_EQ(127, os_signal_latency_get_percentile_us(&stat, 50));
+    ASSERT_EQ(3000, os_signal_latency_get_percentile_us(&stat, 99));
+
+    os_signal_latency_reset(this->p_signal);
+    os_signal_latency_get_stat(this->p_signal, &stat);
+    ASSERT_EQ(0, stat.num_samples);
+    ASSERT_EQ(0, stat.max_us);
+    ASSERT_EQ(0, stat.hist[11]);
+
+    cmdQueue.push_and_wait(MainTaskCmd_SendToTask1Signal2);
+    ASSERT_TRUE(wait_until_new_events_pushed(2, 1000));
+    os_signal_latency_set_clock(nullptr);
+}
@@ -0,0 +1,353 @@
+/**
+ * @file test_os_str_parse.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_str.h"
+#include "gtest/gtest.h"
+#include <array>
+#include <cctype>
+#include <cfloat>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsStrParse : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    TestOsStrParse();
+
+    ~TestOsStrParse() override;
+};
+
+TestOsStrParse::TestOsStrParse()
+    : Test()
+{
+}
+
+TestOsStrParse::~TestOsStrParse() = default;
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsStrParse, test_get_hex_digit) // NOLINT
+{
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        const char     ch     = (char)i;
+        const char     buf[2] = { ch, '\0' };
+        char*          p_end  = nullptr;
+        const uint32_t val    = (0 != isxdigit((int)i)) ? (uint32_t)strtoul(buf, &p_end, 16) : OS_STR_HEX_DIGIT_INVALID;
+        ASSERT_EQ(val, os_str_get_hex_digit(ch)) << i;
+    }
+}
+
+TEST_F(TestOsStrParse, test_uint32_dec_compare_with_os_str_to_uint32) // NOLINT
+{
+    const std::array<const char*, 8> arr_of_str = {
+        "0", "1", "123", "00123", "4294967294", "123abc", "65535 ", "1000000000",
+    };
+    for (const char* const p_str : arr_of_str)
+    {
+        const char*    p_end1 = nullptr;
+        const char*    p_end2 = nullptr;
+        uint32_t       val    = 0;
+        const uint32_t val1   = os_str_to_uint32_cptr(p_str, &p_end1, 10);
+        ASSERT_TRUE(os_str_parse_uint32_dec(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end2, &val));
+        ASSERT_EQ(val1, val);
+        ASSERT_EQ(p_end1, p_end2);
+    }
+}
+
+TEST_F(TestOsStrParse, test_uint32_dec_max_and_overflow) // NOLINT
+{
+    uint32_t    val   = 1;
+    const char* p_str = "4294967295";
+    const char* p_end = nullptr;
+    ASSERT_TRUE(os_str_parse_uint32_dec(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(UINT32_MAX, val);
+    ASSERT_EQ(&p_str[10], p_end);
+
+    val   = 1;
+    p_str = "4294967296";
+    ASSERT_FALSE(os_str_parse_uint32_dec(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(1, val);
+    ASSERT_EQ(p_str, p_end);
+    // os_str_to_uint32 silently saturates the value
+    ASSERT_EQ(UINT32_MAX, os_str_to_uint32_cptr(p_str, nullptr, 10));
+
+    p_str = "99999999999999999999";
+    ASSERT_FALSE(os_str_parse_uint32_dec(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(p_str, p_end);
+}
+
+TEST_F(TestOsStrParse, test_uint32_dec_invalid) // NOLINT
+{
+    uint32_t    val   = 7;
+    const char* p_end = nullptr;
+    ASSERT_FALSE(os_str_parse_uint32_dec("", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_uint32_dec("abc", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_uint32_dec("-1", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_uint32_dec("+1", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    // Unlike strtoul, the leading whitespaces are not skipped
+    ASSERT_FALSE(os_str_parse_uint32_dec(" 1", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_uint32_dec("123", 0, &p_end, &val));
+    ASSERT_EQ(7, val);
+}
+
+TEST_F(TestOsStrParse, test_uint32_dec_with_len) // NOLINT
+{
+    // The buffer is not null-terminated
+    const char  buf[] = { '1', '2', '3', '4', '5' };
+    uint32_t    val   = 0;
+    const char* p_end = nullptr;
+    ASSERT_TRUE(os_str_parse_uint32_dec(buf, 3, &p_end, &val));
+    ASSERT_EQ(123, val);
+    ASSERT_EQ(&buf[3], p_end);
+
+    ASSERT_TRUE(os_str_parse_uint32_dec(buf, sizeof(buf), nullptr, &val));
+    ASSERT_EQ(12345, val);
+
+    const char* const p_json = "{\"temperature\":2345,\"humidity\":51}";
+    ASSERT_TRUE(os_str_parse_uint32_dec(&p_json[15], 4, &p_end, &val));
+    ASSERT_EQ(2345, val);
+    ASSERT_EQ(&p_json[19], p_end);
+}
+
+TEST_F(TestOsStrParse, test_uint32_hex) // NOLINT
+{
+    const std::array<const char*, 9> arr_of_str = {
+        "0", "1f", "1F", "0x123", "0XaBcD", "FFFFFFFF", "0xFFFFFFFF", "12g", "0xg",
+    };
+    for (const char* const p_str : arr_of_str)
+    {
+        const char*    p_end1 = nullptr;
+        const char*    p_end2 = nullptr;
+        uint32_t       val    = 0;
+        const uint32_t val1   = os_str_to_uint32_cptr(p_str, &p_end1, 16);
+        ASSERT_TRUE(os_str_parse_uint32_hex(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end2, &val));
+        ASSERT_EQ(val1, val);
+        ASSERT_EQ(p_end1, p_end2);
+    }
+
+    uint32_t    val   = 5;
+    const char* p_end = nullptr;
+    ASSERT_FALSE(os_str_parse_uint32_hex("100000000", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_uint32_hex("x12", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_uint32_hex(":", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_uint32_hex("@", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_uint32_hex("G", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(5, val);
+
+    // The prefix is not accepted if the digits are beyond the length
+    const char* const p_str = "0x12";
+    ASSERT_TRUE(os_str_parse_uint32_hex(p_str, 2, &p_end, &val));
+    ASSERT_EQ(0, val);
+    ASSERT_EQ(&p_str[1], p_end);
+}
+
+TEST_F(TestOsStrParse, test_int32_dec_compare_with_os_str_to_int32) // NOLINT
+{
+    const std::array<const char*, 10> arr_of_str = {
+        "0", "-0", "+5", "-5", "123", "-123abc", "2147483647", "-2147483648", "-2147483647", "42 ",
+    };
+    for (const char* const p_str : arr_of_str)
+    {
+        const char*   p_end1 = nullptr;
+        const char*   p_end2 = nullptr;
+        int32_t       val    = 0;
+        const int32_t val1   = os_str_to_int32_cptr(p_str, &p_end1, 10);
+        ASSERT_TRUE(os_str_parse_int32_dec(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end2, &val));
+        ASSERT_EQ(val1, val);
+        ASSERT_EQ(p_end1, p_end2);
+    }
+}
+
+TEST_F(TestOsStrParse, test_int32_dec_overflow) // NOLINT
+{
+    int32_t     val   = 3;
+    const char* p_end = nullptr;
+    ASSERT_FALSE(os_str_parse_int32_dec("2147483648", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_int32_dec("-2147483649", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_int32_dec("-", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_int32_dec("-5", 1, &p_end, &val));
+    ASSERT_EQ(3, val);
+}
+
+TEST_F(TestOsStrParse, test_uint64) // NOLINT
+{
+    const std::array<const char*, 6> arr_of_str = {
+        "0", "1", "4294967296", "18446744073709551615", "12345678901234567890x", "00000000000000000000000000001",
+    };
+    for (const char* const p_str : arr_of_str)
+    {
+        char*          p_end1 = nullptr;
+        const char*    p_end2 = nullptr;
+        uint64_t       val    = 0;
+        const uint64_t val1   = strtoull(p_str, &p_end1, 10);
+        ASSERT_TRUE(os_str_parse_uint64_dec(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end2, &val));
+        ASSERT_EQ(val1, val);
+        ASSERT_EQ(p_end1, p_end2);
+    }
+    uint64_t    val   = 0;
+    const char* p_end = nullptr;
+    ASSERT_FALSE(os_str_parse_uint64_dec("18446744073709551616", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_uint64_dec("100000000000000000000", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+
+    ASSERT_TRUE(os_str_parse_uint64_hex("0xFFFFFFFFFFFFFFFF", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(UINT64_MAX, val);
+    ASSERT_TRUE(os_str_parse_uint64_hex("123456789abcdef0", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(0x123456789ABCDEF0ULL, val);
+    ASSERT_FALSE(os_str_parse_uint64_hex("0x10000000000000000", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+}
+
+TEST_F(TestOsStrParse, test_int64) // NOLINT
+{
+    const std::array<const char*, 6> arr_of_str = {
+        "0", "-1", "+4294967296", "9223372036854775807", "-9223372036854775808", "-9223372036854775807",
+    };
+    for (const char* const p_str : arr_of_str)
+    {
+        char*         p_end1 = nullptr;
+        const char*   p_end2 = nullptr;
+        int64_t       val    = 0;
+        const int64_t val1   = strtoll(p_str, &p_end1, 10);
+        ASSERT_TRUE(os_str_parse_int64_dec(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end2, &val));
+        ASSERT_EQ(val1, val);
+        ASSERT_EQ(p_end1, p_end2);
+    }
+    int64_t     val   = 0;
+    const char* p_end = nullptr;
+    ASSERT_FALSE(os_str_parse_int64_dec("9223372036854775808", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_int64_dec("-9223372036854775809", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+}
+
+TEST_F(TestOsStrParse, test_float_compare_with_strtof) // NOLINT
+{
+    const std::array<const char*, 20> arr_of_str = {
+        "0",
+        "-0.0",
+        "1",
+        "23.45",
+        "-23.45",
+        "+0.5",
+        ".5",
+        "5.",
+        "1e3",
+        "1E-3",
+        "-1.25e+2",
+        "3.4028234e38",
+        "1.17549435e-38",
+        "1e-45",
+        "123456789012345678901234567890",
+        "0.000000000000000000000000000001",
+        "3.14159265358979323846",
+        "100.125xyz",
+        "7e",
+        "7e+",
+    };
+    for (const char* const p_str : arr_of_str)
+    {
+        char*       p_end1 = nullptr;
+        const char* p_end2 = nullptr;
+        float       val    = 0;
+        const float val1   = strtof(p_str, &p_end1);
+        ASSERT_TRUE(os_str_parse_float(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end2, &val));
+        ASSERT_EQ(val1, val);
+        ASSERT_EQ(p_end1, p_end2);
+    }
+}
+
+TEST_F(TestOsStrParse, test_float_invalid) // NOLINT
+{
+    float       val   = 1.0f;
+    const char* p_str = "3.5e38";
+    const char* p_end = nullptr;
+    ASSERT_FALSE(os_str_parse_float(p_str, OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(p_str, p_end);
+    ASSERT_FALSE(os_str_parse_float("-1e300", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_float("", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_float(".", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_float("-.e5", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_float("inf", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_FALSE(os_str_parse_float("nan", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(1.0f, val);
+
+    ASSERT_TRUE(os_str_parse_float("1e-400", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(0.0f, val);
+    ASSERT_TRUE(os_str_parse_float("0e999999999999", OS_STR_PARSE_LEN_UNLIMITED, &p_end, &val));
+    ASSERT_EQ(0.0f, val);
+}
+
+TEST_F(TestOsStrParse, test_float_overflow_boundary) // NOLINT
+{
+    // The values below FLT_MAX + half ULP (2^128 - 2^103 = 3.4028235677973366e38) are rounded to FLT_MAX
+    float val = 0;
+    ASSERT_TRUE(os_str_parse_float("3.40282356e38", OS_STR_PARSE_LEN_UNLIMITED, nullptr, &val));
+    ASSERT_EQ(FLT_MAX, val);
+    ASSERT_EQ(FLT_MAX, strtof("3.40282356e38", nullptr));
+    ASSERT_TRUE(os_str_parse_float("-3.402823567e38", OS_STR_PARSE_LEN_UNLIMITED, nullptr, &val));
+    ASSERT_EQ(-FLT_MAX, val);
+
+    // The values starting from FLT_MAX + half ULP are rounded to infinity
+    ASSERT_FALSE(os_str_parse_float(
+        "340282356779733661637539395458142568448",
+        OS_STR_PARSE_LEN_UNLIMITED,
+        nullptr,
+        &val));
+    ASSERT_FALSE(os_str_parse_float("3.4028236e38", OS_STR_PARSE_LEN_UNLIMITED, nullptr, &val));
+    ASSERT_FALSE(os_str_parse_float("1e39", OS_STR_PARSE_LEN_UNLIMITED, nullptr, &val));
+    ASSERT_EQ(-FLT_MAX, val);
+}
+
+TEST_F(TestOsStrParse, test_float_fast_path_compare_with_strtof) // NOLINT
+{
+    // Sensor-like values with up to 7 significant digits are correctly rounded
+    std::array<char, 32> buf {};
+    for (int32_t i = -200000; i <= 200000; i += 7)
+    {
+        for (int32_t num_frac_digits = 0; num_frac_digits <= 6; num_frac_digits += 3)
+        {
+            (void)snprintf(buf.data(), buf.size(), "%de-%d", (int)i, (int)num_frac_digits);
+            float val = 0;
+            ASSERT_TRUE(os_str_parse_float(buf.data(), OS_STR_PARSE_LEN_UNLIMITED, nullptr, &val));
+            ASSERT_EQ(strtof(buf.data(), nullptr), val) << buf.data();
+        }
+    }
+}
+
+TEST_F(TestOsStrParse, test_float_with_len) // NOLINT
+{
+    const char* const p_str = "-12.5e3";
+    float             val   = 0;
+    const char*       p_end = nullptr;
+    ASSERT_TRUE(os_str_parse_float(p_str, 5, &p_end, &val));
+    ASSERT_EQ(-12.5f, val);
+    ASSERT_EQ(&p_str[5], p_end);
+    ASSERT_TRUE(os_str_parse_float(p_str, 6, &p_end, &val));
+    ASSERT_EQ(-12.5f, val);
+    ASSERT_EQ(&p_str[5], p_end);
+    ASSERT_TRUE(os_str_parse_float(p_str, 7, &p_end, &val));
+    ASSERT_EQ(-12500.0f, val);
+    ASSERT_EQ(&p_str[7], p_end);
+}
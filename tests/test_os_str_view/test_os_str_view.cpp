@@ -0,0 +1,296 @@
+/**
+ * @file test_os_str_view.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "os_str_view.h"
+#include "os_str.h"
+#include "gtest/gtest.h"
+#include <array>
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsStrView : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    TestOsStrView();
+
+    ~TestOsStrView() override;
+};
+
+TestOsStrView::TestOsStrView()
+    : Test()
+{
+}
+
+TestOsStrView::~TestOsStrView() = default;
+
+static string
+view_to_string(const os_str_view_t& view)
+{
+    return string(view.p_str, view.len);
+}
+
+typedef struct test_record_t
+{
+    mac_address_bin_t mac;
+    int32_t           rssi;
+    uint32_t          counter;
+    uint64_t          timestamp;
+    bool              is_connectable;
+    uint8_t           data[31];
+    size_t            data_len;
+} test_record_t;
+
+static bool
+parse_record_in_place(const char* const p_buf, const size_t len, test_record_t* const p_rec)
+{
+    os_str_view_t view = OS_STR_VIEW_INIT(p_buf, len);
+    return os_str_view_parse_mac(&view, &p_rec->mac) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_int32(&view, &p_rec->rssi) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_uint32(&view, &p_rec->counter) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_uint64(&view, &p_rec->timestamp) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_bool(&view, &p_rec->is_connectable) && os_str_view_consume_char(&view, ',')
+           && os_str_view_parse_hex_bytes(&view, p_rec->data, sizeof(p_rec->data), &p_rec->data_len)
+           && os_str_view_is_empty(&view);
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsStrView, test_from_cstr_and_is_equal) // NOLINT
+{
+    const os_str_view_t view = os_str_view_from_cstr("abc");
+    ASSERT_EQ(3, view.len);
+    ASSERT_TRUE(os_str_view_is_equal_cstr(&view, "abc"));
+    ASSERT_FALSE(os_str_view_is_equal_cstr(&view, "ab"));
+    ASSERT_FALSE(os_str_view_is_equal_cstr(&view, "abcd"));
+    ASSERT_FALSE(os_str_view_is_empty(&view));
+
+    const os_str_view_t empty_view = os_str_view_from_cstr("");
+    ASSERT_TRUE(os_str_view_is_empty(&empty_view));
+    ASSERT_TRUE(os_str_view_is_equal_cstr(&empty_view, ""));
+}
+
+TEST_F(TestOsStrView, test_skip) // NOLINT
+{
+    os_str_view_t view = os_str_view_from_cstr(" \t abc");
+    os_str_view_skip_spaces(&view);
+    ASSERT_EQ(string("abc"), view_to_string(view));
+    os_str_view_skip(&view, 1);
+    ASSERT_EQ(string("bc"), view_to_string(view));
+    os_str_view_skip(&view, 10);
+    ASSERT_TRUE(os_str_view_is_empty(&view));
+    os_str_view_skip_spaces(&view);
+    ASSERT_TRUE(os_str_view_is_empty(&view));
+}
+
+TEST_F(TestOsStrView, test_consume_char) // NOLINT
+{
+    os_str_view_t view = os_str_view_from_cstr(",x");
+    ASSERT_FALSE(os_str_view_consume_char(&view, 'x'));
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+    ASSERT_TRUE(os_str_view_consume_char(&view, 'x'));
+    ASSERT_FALSE(os_str_view_consume_char(&view, 'x'));
+}
+
+TEST_F(TestOsStrView, test_split) // NOLINT
+{
+    os_str_view_t view  = os_str_view_from_cstr("a,,bc");
+    os_str_view_t token = {};
+    ASSERT_TRUE(os_str_view_split(&view, ',', &token));
+    ASSERT_EQ(string("a"), view_to_string(token));
+    ASSERT_TRUE(os_str_view_split(&view, ',', &token));
+    ASSERT_EQ(string(""), view_to_string(token));
+    ASSERT_TRUE(os_str_view_split(&view, ',', &token));
+    ASSERT_EQ(string("bc"), view_to_string(token));
+    ASSERT_FALSE(os_str_view_split(&view, ',', &token));
+}
+
+TEST_F(TestOsStrView, test_parse_numbers) // NOLINT
+{
+    // The buffer is not null-terminated
+    const char    buf[] = { '1', '2', '3', ',', '-', '4', '5', ',', '0', 'x', 'F', 'F', ',', '2', '.', '5', '9' };
+    os_str_view_t view  = OS_STR_VIEW_INIT(buf, sizeof(buf) - 1);
+
+    uint32_t val_u32 = 0;
+    ASSERT_TRUE(os_str_view_parse_uint32(&view, &val_u32));
+    ASSERT_EQ(123, val_u32);
+    ASSERT_FALSE(os_str_view_parse_uint32(&view, &val_u32));
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+
+    int32_t val_i32 = 0;
+    ASSERT_TRUE(os_str_view_parse_int32(&view, &val_i32));
+    ASSERT_EQ(-45, val_i32);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+
+    ASSERT_TRUE(os_str_view_parse_uint32_hex(&view, &val_u32));
+    ASSERT_EQ(0xFF, val_u32);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+
+    float val_float = 0;
+    ASSERT_TRUE(os_str_view_parse_float(&view, &val_float));
+    ASSERT_EQ(2.5f, val_float);
+    ASSERT_TRUE(os_str_view_is_empty(&view));
+
+    view             = os_str_view_from_cstr("18446744073709551615;");
+    uint64_t val_u64 = 0;
+    ASSERT_TRUE(os_str_view_parse_uint64(&view, &val_u64));
+    ASSERT_EQ(UINT64_MAX, val_u64);
+    ASSERT_EQ(string(";"), view_to_string(view));
+}
+
+TEST_F(TestOsStrView, test_parse_number_failure_does_not_change_view) // NOLINT
+{
+    os_str_view_t view    = os_str_view_from_cstr("4294967296");
+    uint32_t      val_u32 = 5;
+    ASSERT_FALSE(os_str_view_parse_uint32(&view, &val_u32));
+    ASSERT_EQ(5, val_u32);
+    ASSERT_EQ(string("4294967296"), view_to_string(view));
+}
+
+TEST_F(TestOsStrView, test_parse_bool) // NOLINT
+{
+    os_str_view_t view = os_str_view_from_cstr("true,false,1,0,tru");
+    bool          val  = false;
+    ASSERT_TRUE(os_str_view_parse_bool(&view, &val));
+    ASSERT_TRUE(val);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+    ASSERT_TRUE(os_str_view_parse_bool(&view, &val));
+    ASSERT_FALSE(val);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+    ASSERT_TRUE(os_str_view_parse_bool(&view, &val));
+    ASSERT_TRUE(val);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+    ASSERT_TRUE(os_str_view_parse_bool(&view, &val));
+    ASSERT_FALSE(val);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+    ASSERT_FALSE(os_str_view_parse_bool(&view, &val));
+    ASSERT_EQ(string("tru"), view_to_string(view));
+}
+
+TEST_F(TestOsStrView, test_parse_bool_prefix_of_longer_token) // NOLINT
+{
+    const std::array<const char*, 8> arr_of_str = {
+        "10", "01", "trueish", "false_", "1.5", "0x1", "truefalse", "true1",
+    };
+    for (const char* const p_str : arr_of_str)
+    {
+        os_str_view_t view = os_str_view_from_cstr(p_str);
+        bool          val  = false;
+        ASSERT_FALSE(os_str_view_parse_bool(&view, &val)) << p_str;
+        // The view is not modified
+        ASSERT_EQ(string(p_str), view_to_string(view));
+    }
+}
+
+TEST_F(TestOsStrView, test_parse_bool_followed_by_delimiter) // NOLINT
+{
+    os_str_view_t view = os_str_view_from_cstr("true;0 false\t1");
+    bool          val  = false;
+    ASSERT_TRUE(os_str_view_parse_bool(&view, &val));
+    ASSERT_TRUE(val);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ';'));
+    ASSERT_TRUE(os_str_view_parse_bool(&view, &val));
+    ASSERT_FALSE(val);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ' '));
+    ASSERT_TRUE(os_str_view_parse_bool(&view, &val));
+    ASSERT_FALSE(val);
+    ASSERT_TRUE(os_str_view_consume_char(&view, '\t'));
+    ASSERT_TRUE(os_str_view_parse_bool(&view, &val));
+    ASSERT_TRUE(val);
+    ASSERT_TRUE(os_str_view_is_empty(&view));
+
+    // The end of the view is also a valid end of the token even if the buffer continues
+    os_str_view_t view2 = { "10", 1 };
+    ASSERT_TRUE(os_str_view_parse_bool(&view2, &val));
+    ASSERT_TRUE(val);
+    ASSERT_TRUE(os_str_view_is_empty(&view2));
+}
+
+TEST_F(TestOsStrView, test_parse_mac) // NOLINT
+{
+    os_str_view_t     view = os_str_view_from_cstr("C8:25:2D:8E:9C:2C,c8-25-2d-8e-9c-2d,C8252D8E9C2E");
+    mac_address_bin_t mac  = {};
+    ASSERT_TRUE(os_str_view_parse_mac(&view, &mac));
+    ASSERT_EQ(0x2C, mac.mac[5]);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+    ASSERT_TRUE(os_str_view_parse_mac(&view, &mac));
+    ASSERT_EQ(0x2D, mac.mac[5]);
+    ASSERT_TRUE(os_str_view_consume_char(&view, ','));
+    ASSERT_TRUE(os_str_view_parse_mac(&view, &mac));
+    ASSERT_EQ(0xC8, mac.mac[0]);
+    ASSERT_EQ(0x2E, mac.mac[5]);
+    ASSERT_TRUE(os_str_view_is_empty(&view));
+
+    view = os_str_view_from_cstr("C8:25:2D:8E:9C");
+    ASSERT_FALSE(os_str_view_parse_mac(&view, &mac));
+    ASSERT_EQ(14, view.len);
+    view = os_str_view_from_cstr("C8:25:2D:8E:9C:2G");
+    ASSERT_FALSE(os_str_view_parse_mac(&view, &mac));
+    view = os_str_view_from_cstr("C8252D");
+    ASSERT_FALSE(os_str_view_parse_mac(&view, &mac));
+}
+
+TEST_F(TestOsStrView, test_parse_hex_bytes) // NOLINT
+{
+    os_str_view_t view      = os_str_view_from_cstr("0201061bFF,");
+    uint8_t       buf[5]    = {};
+    size_t        num_bytes = 0;
+    ASSERT_TRUE(os_str_view_parse_hex_bytes(&view, buf, sizeof(buf), &num_bytes));
+    ASSERT_EQ(5, num_bytes);
+    ASSERT_EQ(0x02, buf[0]);
+    ASSERT_EQ(0x1B, buf[3]);
+    ASSERT_EQ(0xFF, buf[4]);
+    ASSERT_EQ(string(","), view_to_string(view));
+
+    view = os_str_view_from_cstr("0201061BFF00");
+    ASSERT_FALSE(os_str_view_parse_hex_bytes(&view, buf, sizeof(buf), &num_bytes));
+    view = os_str_view_from_cstr("020");
+    ASSERT_FALSE(os_str_view_parse_hex_bytes(&view, buf, sizeof(buf), &num_bytes));
+    view = os_str_view_from_cstr("x");
+    ASSERT_FALSE(os_str_view_parse_hex_bytes(&view, buf, sizeof(buf), &num_bytes));
+    ASSERT_EQ(string("x"), view_to_string(view));
+}
+
+TEST_F(TestOsStrView, test_parse_record) // NOLINT
+{
+    // The record is a part of a bigger receive buffer, so it is not null-terminated
+    const char* const p_rx_buf = "C8:25:2D:8E:9C:2C,-75,1234567,1700000000123,true,0201061BFF99040512FC5394C37C0004"
+                                 "FFFC040CAC364200CDCBB8334C884F\r\nC8:25:2D:8E:9C:2D,...";
+    const size_t      rec_len  = (size_t)(strstr(p_rx_buf, "\r\n") - p_rx_buf);
+
+    test_record_t rec = {};
+    ASSERT_TRUE(parse_record_in_place(p_rx_buf, rec_len, &rec));
+    const mac_address_bin_t mac = { { 0xC8, 0x25, 0x2D, 0x8E, 0x9C, 0x2C } };
+    ASSERT_EQ(0, memcmp(&mac, &rec.mac, sizeof(mac)));
+    ASSERT_EQ(-75, rec.rssi);
+    ASSERT_EQ(1234567, rec.counter);
+    ASSERT_EQ(1700000000123ULL, rec.timestamp);
+    ASSERT_TRUE(rec.is_connectable);
+    ASSERT_EQ(31, rec.data_len);
+    ASSERT_EQ(0x02, rec.data[0]);
+    ASSERT_EQ(0x4F, rec.data[30]);
+
+    // The record without the last character is not valid
+    ASSERT_FALSE(parse_record_in_place(p_rx_buf, rec_len - 1, &rec));
+}
@@ -9,8 +9,10 @@
 #include <cstdlib>
 #include <cassert>
 #include <string>
+#include <algorithm>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "os_mutex.h"
 #include "test_os_task.hpp"
 
 using namespace std;
@@ -22,19 +24,32 @@ extern "C" {
 void*
 os_calloc(const size_t nmemb, const size_t size)
 {
-    return calloc(nmemb, size);
+    void* ptr = calloc(nmemb, size);
+    if (nullptr != ptr)
+    {
+        g_pTestClass->m_numAllocatedBlocks += 1;
+    }
+    return ptr;
 }
 
 void
 os_free_internal(void* ptr)
 {
+    if (nullptr != ptr)
+    {
+        g_pTestClass->m_numAllocatedBlocks -= 1;
+    }
     free(ptr);
 }
 
 char*
 pcTaskGetName(TaskHandle_t xTaskToQuery)
 {
-    assert(nullptr == xTaskToQuery);
+    if (nullptr != xTaskToQuery)
+    {
+        assert(g_pTestClass->m_createdTaskHandle == xTaskToQuery);
+        return const_cast<char*>(g_pTestClass->m_createdTaskName.c_str());
+    }
     if (g_pTestClass->m_taskName == string(""))
     {
         return nullptr;
@@ -45,10 +60,33 @@ pcTaskGetName(TaskHandle_t xTaskToQuery)
 UBaseType_t
 uxTaskPriorityGet(const TaskHandle_t xTask)
 {
-    assert(nullptr == xTask);
+    assert((nullptr == xTask) || (g_pTestClass->m_createdTaskHandle == xTask));
     return g_pTestClass->m_createdTaskPriority;
 }
 
+#if OS_TASK_LOG_CTX_CACHE
+
+void
+vTaskSetThreadLocalStoragePointer(TaskHandle_t xTaskToSet, BaseType_t xIndex, void* pvValue)
+{
+    assert((xIndex >= 0) && (xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS));
+    g_pTestClass->m_tls[xTaskToSet][xIndex] = pvValue;
+}
+
+void*
+pvTaskGetThreadLocalStoragePointer(TaskHandle_t xTaskToQuery, BaseType_t xIndex)
+{
+    assert((xIndex >= 0) && (xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS));
+    const auto iter = g_pTestClass->m_tls.find(xTaskToQuery);
+    if (g_pTestClass->m_tls.end() == iter)
+    {
+        return nullptr;
+    }
+    return iter->second[xIndex];
+}
+
+#endif // OS_TASK_LOG_CTX_CACHE
+
 TaskHandle_t
 xTaskGetCurrentTaskHandle(void)
 {
@@ -75,6 +113,10 @@ xTaskCreate(
     g_pTestClass->m_createdTaskStackDepth = usStackDepth;
     g_pTestClass->m_createdTaskParam      = pvParameters;
     g_pTestClass->m_createdTaskPriority   = uxPriority;
+    if (nullptr != g_pTestClass->m_pOnTaskCreated)
+    {
+        g_pTestClass->m_pOnTaskCreated(*pxCreatedTask);
+    }
     return pdPASS;
 }
 
@@ -89,7 +131,6 @@ xTaskCreateStatic(
     StaticTask_t* const pxTaskBuffer)
 {
     (void)puxStackBuffer;
-    (void)pxTaskBuffer;
     if (nullptr == g_pTestClass->m_createdTaskHandle)
     {
         return nullptr;
@@ -100,6 +141,11 @@ xTaskCreateStatic(
     g_pTestClass->m_createdTaskStackDepth = ulStackDepth;
     g_pTestClass->m_createdTaskParam      = pvParameters;
     g_pTestClass->m_createdTaskPriority   = uxPriority;
+    g_pTestClass->m_pCreatedTaskMem       = pxTaskBuffer;
+    if (nullptr != g_pTestClass->m_pOnTaskCreated)
+    {
+        g_pTestClass->m_pOnTaskCreated(g_pTestClass->m_createdTaskHandle);
+    }
     return g_pTestClass->m_createdTaskHandle;
 }
 
@@ -109,4 +155,53 @@ vTaskDelete(TaskHandle_t xTaskToDelete)
     (void)xTaskToDelete;
 }
 
+#if OS_TASK_REGISTRY
+
+UBaseType_t
+uxTaskGetNumberOfTasks(void)
+{
+    return g_pTestClass->m_taskStatuses.size();
+}
+
+UBaseType_t
+uxTaskGetSystemState(
+    TaskStatus_t* const pxTaskStatusArray,
+    const UBaseType_t   uxArraySize,
+    uint32_t* const     pulTotalRunTime)
+{
+    if (uxArraySize < g_pTestClass->m_taskStatuses.size())
+    {
+        return 0;
+    }
+    std::copy(g_pTestClass->m_taskStatuses.begin(), g_pTestClass->m_taskStatuses.end(), pxTaskStatusArray);
+    *pulTotalRunTime = g_pTestClass->m_totalRunTime;
+    return g_pTestClass->m_taskStatuses.size();
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_delete(os_mutex_t* const ph_mutex)
+{
+    *ph_mutex = nullptr;
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    assert(nullptr != h_mutex);
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    assert(nullptr != h_mutex);
+}
+
+#endif // OS_TASK_REGISTRY
+
 } // extern "C"
@@ -8,6 +8,8 @@
 #ifndef TEST_OS_TASK_HPP
 #define TEST_OS_TASK_HPP
 
+#include <vector>
+#include <map>
 #include "gtest/gtest.h"
 #include "esp_log_wrapper.hpp"
 #include "os_task.h"
@@ -30,11 +32,17 @@ protected:
     {
         esp_log_wrapper_init();
         g_pTestClass = this;
+#if OS_TASK_REGISTRY
+        os_task_registry_init();
+#endif
     }
 
     void
     TearDown() override
     {
+#if OS_TASK_REGISTRY
+        os_task_registry_deinit();
+#endif
         esp_log_wrapper_deinit();
         g_pTestClass = nullptr;
     }
@@ -49,8 +57,15 @@ public:
         , m_createdTaskStackDepth(0)
         , m_createdTaskParam(nullptr)
         , m_createdTaskPriority(0)
+        , m_pCreatedTaskMem(nullptr)
+        , m_pOnTaskCreated(nullptr)
+        , m_numAllocatedBlocks(0)
+#if OS_TASK_REGISTRY
+        , m_totalRunTime(0)
+#endif
         , stack_mem({})
         , task_mem({})
+        , task_finite_mem({})
     {
     }
 
@@ -66,8 +81,20 @@ public:
     configSTACK_DEPTH_TYPE                 m_createdTaskStackDepth;
     void*                                  m_createdTaskParam;
     UBaseType_t                            m_createdTaskPriority;
+    StaticTask_t*                          m_pCreatedTaskMem;
+    void (*m_pOnTaskCreated)(TaskHandle_t h_task); //!< Simulates the task running before xTaskCreate* returns
+    int32_t                                m_numAllocatedBlocks;
+#if OS_TASK_REGISTRY
+    std::vector<TaskStatus_t> m_taskStatuses;
+    uint32_t                  m_totalRunTime;
+#endif
     std::array<os_task_stack_type_t, 2048> stack_mem;
     os_task_static_t                       task_mem;
+    os_task_static_finite_t                task_finite_mem;
+
+#if OS_TASK_LOG_CTX_CACHE
+    std::map<TaskHandle_t, std::array<void*, configNUM_THREAD_LOCAL_STORAGE_POINTERS>> m_tls;
+#endif
 };
 
 #define TEST_CHECK_LOG_RECORD(level_, msg_) ESP_LOG_WRAPPER_TEST_CHECK_LOG_RECORD("os_task", level_, msg_);
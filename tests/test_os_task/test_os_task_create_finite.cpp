@@ -59,5 +59,6 @@ TEST_F(TestOsTask, os_task_create_finite_fail) // NOLINT
         0,
         "Start thread 'my_task_name2' with priority 3, stack size 2048 bytes");
     TEST_CHECK_LOG_RECORD(ESP_LOG_ERROR, "Failed to start thread 'my_task_name2'");
+    ASSERT_EQ(0, this->m_numAllocatedBlocks);
     ASSERT_TRUE(esp_log_wrapper_is_empty());
 }
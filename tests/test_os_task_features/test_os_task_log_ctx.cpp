@@ -0,0 +1,80 @@
+/**
+ * @file test_os_task_log_ctx.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "test_os_task.hpp"
+
+extern "C" {
+
+struct tskTaskControlBlock
+{
+    int stub;
+};
+
+static ATTR_NORETURN void
+task_func(void* p_param)
+{
+    (void)p_param;
+    while (true)
+    {
+    }
+}
+
+} // extern "C"
+
+TEST_F(TestOsTask, os_task_log_ctx_is_not_filled_on_task_creation) // NOLINT
+{
+    struct tskTaskControlBlock tcb1   = {};
+    os_task_handle_t           h_task = nullptr;
+
+    // The log context is filled by the task itself, so it can't race with the running task
+    this->m_createdTaskHandle = &tcb1;
+    ASSERT_TRUE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task));
+    ASSERT_TRUE(this->m_tls.empty());
+}
+
+TEST_F(TestOsTask, os_task_get_name_fills_log_ctx) // NOLINT
+{
+    this->m_taskName.assign("");
+    ASSERT_EQ(string("???"), string(os_task_get_name()));
+    ASSERT_TRUE(this->m_tls.empty());
+
+    this->m_taskName.assign("main");
+    ASSERT_EQ(this->m_taskName.c_str(), os_task_get_name());
+    ASSERT_EQ(this->m_taskName.c_str(), this->m_tls[nullptr][OS_TASK_LOG_CTX_TLS_IDX_NAME]);
+}
+
+TEST_F(TestOsTask, os_task_get_name_with_log_ctx) // NOLINT
+{
+    static const char cached_name[] = "cached";
+    this->m_taskName.assign("main");
+    this->m_tls[nullptr][OS_TASK_LOG_CTX_TLS_IDX_NAME] = const_cast<char*>(cached_name);
+    ASSERT_EQ(&cached_name[0], os_task_get_name());
+}
+
+TEST_F(TestOsTask, os_task_get_priority_is_not_cached) // NOLINT
+{
+    this->m_taskName.assign("main");
+    this->m_createdTaskPriority = 5;
+    ASSERT_EQ(string("main"), string(os_task_get_name()));
+    ASSERT_EQ(5, os_task_get_priority());
+
+    this->m_createdTaskPriority = 7;
+    ASSERT_EQ(7, os_task_get_priority());
+
+    os_task_handle_t h_task = nullptr;
+    ASSERT_FALSE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task));
+    TEST_CHECK_LOG_RECORD_WITH_THREAD(
+        ESP_LOG_INFO,
+        "main",
+        7,
+        "Start thread 'task1' with priority 3, stack size 2048 bytes");
+    TEST_CHECK_LOG_RECORD_WITH_THREAD(ESP_LOG_ERROR, "main", 7, "Failed to start thread 'task1'");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    this->m_createdTaskPriority = 0;
+    ASSERT_EQ(0, os_task_get_priority());
+}
@@ -0,0 +1,315 @@
+/**
+ * @file test_os_task_registry.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "test_os_task.hpp"
+
+extern "C" {
+
+struct tskTaskControlBlock
+{
+    int stub;
+};
+
+static ATTR_NORETURN void
+task_func(void* p_param)
+{
+    (void)p_param;
+    while (true)
+    {
+    }
+}
+
+static void
+on_task_created_and_deleted(TaskHandle_t h_task)
+{
+    // The created task has higher priority and exits before xTaskCreate returns
+    os_task_delete(&h_task);
+}
+
+} // extern "C"
+
+static TaskStatus_t
+make_task_status(TaskHandle_t h_task, const uint16_t stack_high_water_mark, const uint32_t run_time_counter)
+{
+    TaskStatus_t task_status         = {};
+    task_status.xHandle              = h_task;
+    task_status.usStackHighWaterMark = stack_high_water_mark;
+#if configGENERATE_RUN_TIME_STATS
+    task_status.ulRunTimeCounter = run_time_counter;
+#else
+    (void)run_time_counter;
+#endif
+    return task_status;
+}
+
+TEST_F(TestOsTask, os_task_registry_create_and_get_snapshot) // NOLINT
+{
+    struct tskTaskControlBlock tcb1   = {};
+    struct tskTaskControlBlock tcb2   = {};
+    os_task_handle_t           h_task = nullptr;
+
+    this->m_createdTaskHandle = &tcb1;
+    ASSERT_TRUE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task));
+    this->m_createdTaskHandle = &tcb2;
+    ASSERT_TRUE(os_task_create_static(
+        &task_func,
+        "task2",
+        &this->stack_mem[0],
+        this->stack_mem.size(),
+        nullptr,
+        5,
+        &this->task_mem,
+        &h_task));
+    esp_log_wrapper_clear();
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS> arr_of_info = {};
+    ASSERT_EQ(2, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(&tcb1, arr_of_info[0].h_task);
+    ASSERT_EQ(string("task1"), string(arr_of_info[0].task_name));
+    ASSERT_EQ(3, arr_of_info[0].priority);
+    ASSERT_FALSE(arr_of_info[0].is_static);
+    ASSERT_EQ(2048, arr_of_info[0].stack_depth);
+    ASSERT_EQ(2048, arr_of_info[0].stack_min_free);
+    ASSERT_EQ(0, arr_of_info[0].num_samples);
+
+    ASSERT_EQ(&tcb2, arr_of_info[1].h_task);
+    ASSERT_EQ(string("task2"), string(arr_of_info[1].task_name));
+    ASSERT_EQ(5, arr_of_info[1].priority);
+    ASSERT_TRUE(arr_of_info[1].is_static);
+    ASSERT_EQ(this->stack_mem.size(), arr_of_info[1].stack_depth);
+
+    ASSERT_EQ(1, os_task_registry_get_snapshot(arr_of_info.data(), 1));
+    ASSERT_EQ(0, os_task_registry_get_num_overflows());
+}
+
+TEST_F(TestOsTask, os_task_registry_create_failed) // NOLINT
+{
+    os_task_handle_t h_task   = nullptr;
+    this->m_createdTaskHandle = nullptr;
+    ASSERT_FALSE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task));
+    esp_log_wrapper_clear();
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS> arr_of_info = {};
+    ASSERT_EQ(0, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+}
+
+TEST_F(TestOsTask, os_task_registry_create_static_failed) // NOLINT
+{
+    os_task_handle_t h_task   = nullptr;
+    this->m_createdTaskHandle = nullptr;
+    ASSERT_FALSE(os_task_create_static(
+        &task_func,
+        "task1",
+        &this->stack_mem[0],
+        this->stack_mem.size(),
+        nullptr,
+        3,
+        &this->task_mem,
+        &h_task));
+    esp_log_wrapper_clear();
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS> arr_of_info = {};
+    ASSERT_EQ(0, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+}
+
+TEST_F(TestOsTask, os_task_registry_task_deleted_before_create_returns) // NOLINT
+{
+    struct tskTaskControlBlock tcb1   = {};
+    os_task_handle_t           h_task = nullptr;
+
+    this->m_pOnTaskCreated    = &on_task_created_and_deleted;
+    this->m_createdTaskHandle = &tcb1;
+    ASSERT_TRUE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task));
+    esp_log_wrapper_clear();
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS> arr_of_info = {};
+    ASSERT_EQ(0, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+}
+
+TEST_F(TestOsTask, os_task_registry_static_task_deleted_before_create_returns) // NOLINT
+{
+    os_task_handle_t h_task = nullptr;
+
+    this->m_pOnTaskCreated    = &on_task_created_and_deleted;
+    this->m_createdTaskHandle = reinterpret_cast<TaskHandle_t>(&this->task_mem);
+    ASSERT_TRUE(os_task_create_static(
+        &task_func,
+        "task1",
+        &this->stack_mem[0],
+        this->stack_mem.size(),
+        nullptr,
+        3,
+        &this->task_mem,
+        &h_task));
+    esp_log_wrapper_clear();
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS> arr_of_info = {};
+    ASSERT_EQ(0, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+}
+
+TEST_F(TestOsTask, os_task_registry_sample) // NOLINT
+{
+    struct tskTaskControlBlock tcb1   = {};
+    struct tskTaskControlBlock tcb2   = {};
+    os_task_handle_t           h_task = nullptr;
+
+    this->m_createdTaskHandle = &tcb1;
+    ASSERT_TRUE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task));
+    this->m_createdTaskHandle = &tcb2;
+    ASSERT_TRUE(os_task_create(&task_func, "task2", 4096, nullptr, 4, &h_task));
+    esp_log_wrapper_clear();
+
+    this->m_taskStatuses.push_back(make_task_status(&tcb1, 1500, 100));
+    this->m_taskStatuses.push_back(make_task_status(&tcb2, 512, 300));
+    this->m_totalRunTime = 1000;
+    ASSERT_TRUE(os_task_registry_sample());
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS> arr_of_info = {};
+    ASSERT_EQ(2, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(1500, arr_of_info[0].stack_min_free);
+    ASSERT_EQ(512, arr_of_info[1].stack_min_free);
+    ASSERT_EQ(1, arr_of_info[0].num_samples);
+    ASSERT_EQ(1, arr_of_info[1].num_samples);
+#if configGENERATE_RUN_TIME_STATS
+    ASSERT_EQ(100, arr_of_info[0].cpu_usage_permille);
+    ASSERT_EQ(300, arr_of_info[1].cpu_usage_permille);
+#endif
+
+    // task2 was deleted bypassing os_task_delete
+    this->m_taskStatuses.clear();
+    this->m_taskStatuses.push_back(make_task_status(&tcb1, 1400, 600));
+    this->m_totalRunTime = 2000;
+    ASSERT_TRUE(os_task_registry_sample());
+
+    ASSERT_EQ(1, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(&tcb1, arr_of_info[0].h_task);
+    ASSERT_EQ(1400, arr_of_info[0].stack_min_free);
+    ASSERT_EQ(2, arr_of_info[0].num_samples);
+#if configGENERATE_RUN_TIME_STATS
+    ASSERT_EQ(600, arr_of_info[0].run_time_counter);
+    ASSERT_EQ(500, arr_of_info[0].cpu_usage_permille);
+#endif
+}
+
+TEST_F(TestOsTask, os_task_registry_sample_too_many_tasks) // NOLINT
+{
+    struct tskTaskControlBlock tcb1   = {};
+    os_task_handle_t           h_task = nullptr;
+
+    this->m_createdTaskHandle = &tcb1;
+    ASSERT_TRUE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task));
+    esp_log_wrapper_clear();
+
+    std::array<struct tskTaskControlBlock, OS_TASK_REGISTRY_MAX_NUM_TASK_STATUSES + 1> arr_of_tcb = {};
+    for (auto& tcb : arr_of_tcb)
+    {
+        this->m_taskStatuses.push_back(make_task_status(&tcb, 1000, 0));
+    }
+    ASSERT_FALSE(os_task_registry_sample());
+    TEST_CHECK_LOG_RECORD(
+        ESP_LOG_ERROR,
+        string("The number of tasks exceeds OS_TASK_REGISTRY_MAX_NUM_TASK_STATUSES=")
+            + std::to_string(OS_TASK_REGISTRY_MAX_NUM_TASK_STATUSES));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS> arr_of_info = {};
+    ASSERT_EQ(1, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(0, arr_of_info[0].num_samples);
+}
+
+TEST_F(TestOsTask, os_task_registry_delete) // NOLINT
+{
+    struct tskTaskControlBlock tcb1    = {};
+    struct tskTaskControlBlock tcb2    = {};
+    os_task_handle_t           h_task1 = nullptr;
+    os_task_handle_t           h_task2 = nullptr;
+
+    this->m_createdTaskHandle = &tcb1;
+    ASSERT_TRUE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task1));
+    this->m_createdTaskHandle = &tcb2;
+    ASSERT_TRUE(os_task_create(&task_func, "task2", 2048, nullptr, 3, &h_task2));
+    esp_log_wrapper_clear();
+
+    os_task_delete(&h_task1);
+    ASSERT_EQ(nullptr, h_task1);
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS> arr_of_info = {};
+    ASSERT_EQ(1, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(&tcb2, arr_of_info[0].h_task);
+    ASSERT_EQ(string("task2"), string(arr_of_info[0].task_name));
+}
+
+TEST_F(TestOsTask, os_task_registry_overflow) // NOLINT
+{
+    std::array<struct tskTaskControlBlock, OS_TASK_REGISTRY_MAX_NUM_TASKS + 1> arr_of_tcb = {};
+    for (auto& tcb : arr_of_tcb)
+    {
+        os_task_handle_t h_task   = nullptr;
+        this->m_createdTaskHandle = &tcb;
+        ASSERT_TRUE(os_task_create(&task_func, "task", 2048, nullptr, 3, &h_task));
+    }
+    esp_log_wrapper_clear();
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS + 1> arr_of_info = {};
+    ASSERT_EQ(OS_TASK_REGISTRY_MAX_NUM_TASKS, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(1, os_task_registry_get_num_overflows());
+
+    os_task_registry_clear();
+    ASSERT_EQ(0, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_EQ(0, os_task_registry_get_num_overflows());
+}
+
+TEST_F(TestOsTask, os_task_registry_log_dump) // NOLINT
+{
+    struct tskTaskControlBlock tcb1   = {};
+    os_task_handle_t           h_task = nullptr;
+
+    this->m_taskName.assign("main");
+    this->m_createdTaskHandle = &tcb1;
+    ASSERT_TRUE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task));
+    esp_log_wrapper_clear();
+
+    this->m_taskStatuses.push_back(make_task_status(&tcb1, 1536, 125));
+    this->m_totalRunTime = 1000;
+    ASSERT_TRUE(os_task_registry_sample());
+
+    os_task_registry_log_dump();
+    TEST_CHECK_LOG_RECORD_WITH_THREAD(ESP_LOG_INFO, "main", 3, "Num tasks registered: 1, not registered: 0");
+#if configGENERATE_RUN_TIME_STATS
+    TEST_CHECK_LOG_RECORD_WITH_THREAD(
+        ESP_LOG_INFO,
+        "main",
+        3,
+        "[ 0] 'task1': priority 3, stack used 512 of 2048 (min free 1536), CPU 12.5%");
+#else
+    TEST_CHECK_LOG_RECORD_WITH_THREAD(
+        ESP_LOG_INFO,
+        "main",
+        3,
+        "[ 0] 'task1': priority 3, stack used 512 of 2048 (min free 1536), CPU 0.0%");
+#endif
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestOsTask, os_task_registry_not_initialized) // NOLINT
+{
+    os_task_registry_deinit();
+
+    struct tskTaskControlBlock tcb1   = {};
+    os_task_handle_t           h_task = nullptr;
+    this->m_createdTaskHandle         = &tcb1;
+    ASSERT_TRUE(os_task_create(&task_func, "task1", 2048, nullptr, 3, &h_task));
+    esp_log_wrapper_clear();
+
+    std::array<os_task_registry_info_t, OS_TASK_REGISTRY_MAX_NUM_TASKS> arr_of_info = {};
+    ASSERT_EQ(0, os_task_registry_get_snapshot(arr_of_info.data(), arr_of_info.size()));
+    ASSERT_FALSE(os_task_registry_sample());
+
+    os_task_registry_log_dump();
+    TEST_CHECK_LOG_RECORD_WITH_THREAD(ESP_LOG_INFO, "???", 3, "os_task registry is not initialized");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
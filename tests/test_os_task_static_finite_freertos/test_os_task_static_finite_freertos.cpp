@@ -0,0 +1,382 @@
+/**
+ * @file test_os_task_static_finite_freertos.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <string>
+#include <atomic>
+#include <array>
+#include <semaphore.h>
+#include "gtest/gtest.h"
+#include "os_task.h"
+#include "os_malloc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "TQueue.hpp"
+#include "esp_log_wrapper.hpp"
+#include <sys/time.h>
+
+using namespace std;
+
+#define TEST_HELPER_TASK_PRIORITY (tskIDLE_PRIORITY + 3)
+#define TEST_HELPER_STACK_DEPTH   (2048U)
+
+typedef enum MainTaskCmd_Tag
+{
+    MainTaskCmd_Exit,
+    MainTaskCmd_MallocTraceInit,
+    MainTaskCmd_MallocTraceDeinit,
+    MainTaskCmd_MallocTraceGetNumBlocks,
+    MainTaskCmd_RunStaticFinite,
+    MainTaskCmd_RunStaticFiniteNoAlloc,
+    MainTaskCmd_RunStaticFiniteWithConstParamNoAlloc,
+} MainTaskCmd_e;
+
+typedef enum HelperTaskState_Tag
+{
+    HelperTaskState_NotStarted,
+    HelperTaskState_Waiting,
+    HelperTaskState_Finished,
+} HelperTaskState_e;
+
+typedef struct HelperTask_t
+{
+    std::atomic<HelperTaskState_e> state;
+    std::atomic<bool>              flag_release;
+} HelperTask_t;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsTaskStaticFiniteFreertos;
+static TestOsTaskStaticFiniteFreertos* g_pTestClass;
+
+static void*
+freertosStartup(void* arg);
+
+class TestOsTaskStaticFiniteFreertos : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        esp_log_wrapper_init();
+        sem_init(&semaFreeRTOS, 0, 0);
+        pid_test      = pthread_self();
+        const int err = pthread_create(&pid_freertos, nullptr, &freertosStartup, this);
+        assert(0 == err);
+        while (0 != sem_wait(&semaFreeRTOS))
+        {
+        }
+        cmdQueue.push_and_wait(MainTaskCmd_MallocTraceInit);
+    }
+
+    void
+    TearDown() override
+    {
+        cmdQueue.push_and_wait(MainTaskCmd_MallocTraceDeinit);
+        cmdQueue.push_and_wait(MainTaskCmd_Exit);
+        vTaskEndScheduler();
+        void* ret_code = nullptr;
+        pthread_join(pid_freertos, &ret_code);
+        sem_destroy(&semaFreeRTOS);
+        esp_log_wrapper_deinit();
+        g_pTestClass = nullptr;
+    }
+
+public:
+    pthread_t                                                 pid_test;
+    pthread_t                                                 pid_freertos;
+    sem_t                                                     semaFreeRTOS;
+    TQueue<MainTaskCmd_e>                                     cmdQueue;
+    bool                                                      cmd_result;
+    uint32_t                                                  num_blocks;
+    HelperTask_t                                              helper;
+    std::array<os_task_stack_type_t, TEST_HELPER_STACK_DEPTH> stack_mem_static_finite;
+    std::array<os_task_stack_type_t, TEST_HELPER_STACK_DEPTH> stack_mem_no_alloc;
+    std::array<os_task_stack_type_t, TEST_HELPER_STACK_DEPTH> stack_mem_const_param_no_alloc;
+    os_task_static_t                                          task_mem_static_finite;
+    os_task_static_finite_t                                   task_mem_no_alloc;
+    os_task_static_finite_t                                   task_mem_const_param_no_alloc;
+
+    TestOsTaskStaticFiniteFreertos();
+
+    ~TestOsTaskStaticFiniteFreertos() override;
+
+    static bool
+    wait_until_state(const HelperTask_t* const p_task, const HelperTaskState_e state, const uint32_t timeout_ms);
+};
+
+TestOsTaskStaticFiniteFreertos::TestOsTaskStaticFiniteFreertos()
+    : Test()
+    , pid_test(0)
+    , pid_freertos(0)
+    , semaFreeRTOS({})
+    , cmd_result(false)
+    , num_blocks(0)
+    , stack_mem_static_finite({})
+    , stack_mem_no_alloc({})
+    , stack_mem_const_param_no_alloc({})
+    , task_mem_static_finite({})
+    , task_mem_no_alloc({})
+    , task_mem_const_param_no_alloc({})
+{
+    this->helper.state        = HelperTaskState_NotStarted;
+    this->helper.flag_release = false;
+    g_pTestClass              = this;
+}
+
+TestOsTaskStaticFiniteFreertos::~TestOsTaskStaticFiniteFreertos()
+{
+    g_pTestClass = nullptr;
+}
+
+extern "C" {
+
+static struct timespec
+timespec_get_clock_monotonic(void)
+{
+    struct timespec timestamp = {};
+    clock_gettime(CLOCK_MONOTONIC, &timestamp);
+    return timestamp;
+}
+
+static struct timespec
+timespec_diff(const struct timespec* p_t2, const struct timespec* p_t1)
+{
+    struct timespec result = {
+        .tv_sec  = p_t2->tv_sec - p_t1->tv_sec,
+        .tv_nsec = p_t2->tv_nsec - p_t1->tv_nsec,
+    };
+    if (result.tv_nsec < 0)
+    {
+        result.tv_sec -= 1;
+        result.tv_nsec += 1000000000;
+    }
+    return result;
+}
+
+static uint32_t
+timespec_diff_ms(const struct timespec* p_t2, const struct timespec* p_t1)
+{
+    struct timespec diff = timespec_diff(p_t2, p_t1);
+    return diff.tv_sec * 1000 + diff.tv_nsec / 1000000;
+}
+
+void
+tdd_assert_trap(void)
+{
+    assert(0);
+}
+
+static volatile int32_t g_flagDisableCheckIsThreadFreeRTOS;
+
+void
+disableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    ++g_flagDisableCheckIsThreadFreeRTOS;
+}
+
+void
+enableCheckingIfCurThreadIsFreeRTOS(void)
+{
+    --g_flagDisableCheckIsThreadFreeRTOS;
+    assert(g_flagDisableCheckIsThreadFreeRTOS >= 0);
+}
+
+int
+checkIfCurThreadIsFreeRTOS(void)
+{
+    if (nullptr == g_pTestClass)
+    {
+        return false;
+    }
+    if (g_flagDisableCheckIsThreadFreeRTOS)
+    {
+        return true;
+    }
+    const pthread_t cur_thread_pid = pthread_self();
+    if (cur_thread_pid == g_pTestClass->pid_test)
+    {
+        return false;
+    }
+    return true;
+}
+
+} // extern "C"
+
+bool
+TestOsTaskStaticFiniteFreertos::wait_until_state(
+    const HelperTask_t* const p_task,
+    const HelperTaskState_e   state,
+    const uint32_t            timeout_ms)
+{
+    struct timespec t1 = timespec_get_clock_monotonic();
+    struct timespec t2 = t1;
+    while (timespec_diff_ms(&t2, &t1) < timeout_ms)
+    {
+        if (state == p_task->state)
+        {
+            return true;
+        }
+        usleep(1000);
+        t2 = timespec_get_clock_monotonic();
+    }
+    return false;
+}
+
+static void
+helper_wait_until_released(HelperTask_t* const p_helper)
+{
+    p_helper->state = HelperTaskState_Waiting;
+    while (!p_helper->flag_release)
+    {
+        vTaskDelay(1);
+    }
+    p_helper->state = HelperTaskState_Finished;
+}
+
+static void
+helperTaskWithParam(void* p_param)
+{
+    helper_wait_until_released(static_cast<HelperTask_t*>(p_param));
+}
+
+static void
+helperTaskWithConstParam(const void* p_param)
+{
+    helper_wait_until_released(static_cast<HelperTask_t*>(const_cast<void*>(p_param)));
+}
+
+static void
+cmdHandlerTask(void* p_param)
+{
+    auto* pObj     = static_cast<TestOsTaskStaticFiniteFreertos*>(p_param);
+    bool  flagExit = false;
+    sem_post(&pObj->semaFreeRTOS);
+    while (!flagExit)
+    {
+        const MainTaskCmd_e cmd = pObj->cmdQueue.pop();
+        switch (cmd)
+        {
+            case MainTaskCmd_Exit:
+                flagExit = true;
+                break;
+            case MainTaskCmd_MallocTraceInit:
+                os_malloc_trace_init();
+                break;
+            case MainTaskCmd_MallocTraceDeinit:
+                os_malloc_trace_deinit();
+                break;
+            case MainTaskCmd_MallocTraceGetNumBlocks:
+                pObj->num_blocks = os_malloc_trace_get_num_blocks();
+                break;
+            case MainTaskCmd_RunStaticFinite:
+                pObj->cmd_result = os_task_create_static_finite(
+                    &helperTaskWithParam,
+                    "static_finite",
+                    &pObj->stack_mem_static_finite[0],
+                    pObj->stack_mem_static_finite.size(),
+                    &pObj->helper,
+                    TEST_HELPER_TASK_PRIORITY,
+                    &pObj->task_mem_static_finite);
+                break;
+            case MainTaskCmd_RunStaticFiniteNoAlloc:
+                pObj->cmd_result = os_task_create_static_finite_no_alloc(
+                    &helperTaskWithParam,
+                    "no_alloc",
+                    &pObj->stack_mem_no_alloc[0],
+                    pObj->stack_mem_no_alloc.size(),
+                    &pObj->helper,
+                    TEST_HELPER_TASK_PRIORITY,
+                    &pObj->task_mem_no_alloc);
+                break;
+            case MainTaskCmd_RunStaticFiniteWithConstParamNoAlloc:
+                pObj->cmd_result = os_task_create_static_finite_with_const_param_no_alloc(
+                    &helperTaskWithConstParam,
+                    "cparam_no_alloc",
+                    &pObj->stack_mem_const_param_no_alloc[0],
+                    pObj->stack_mem_const_param_no_alloc.size(),
+                    &pObj->helper,
+                    TEST_HELPER_TASK_PRIORITY,
+                    &pObj->task_mem_const_param_no_alloc);
+                break;
+            default:
+                printf("Error: Unknown cmd %d\n", (int)cmd);
+                exit(1);
+                break;
+        }
+        pObj->cmdQueue.notify_handled();
+    }
+    vTaskDelete(nullptr);
+}
+
+static void*
+freertosStartup(void* arg)
+{
+    auto* pObj = static_cast<TestOsTaskStaticFiniteFreertos*>(arg);
+    disableCheckingIfCurThreadIsFreeRTOS();
+    const bool res
+        = xTaskCreate(&cmdHandlerTask, "cmdHandlerTask", configMINIMAL_STACK_SIZE, pObj, tskIDLE_PRIORITY + 1, nullptr);
+    assert(res);
+    vTaskStartScheduler();
+    return nullptr;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+// The helper tasks have a higher priority than cmdHandlerTask, so a command pushed after the helper has signalled
+// HelperTaskState_Finished is handled only when the helper task has returned from its function
+// and the task wrapper has completed the cleanup.
+
+TEST_F(TestOsTaskStaticFiniteFreertos, test_static_finite) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_RunStaticFinite);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->helper, HelperTaskState_Waiting, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_MallocTraceGetNumBlocks);
+    ASSERT_EQ(1, this->num_blocks);
+
+    this->helper.flag_release = true;
+    ASSERT_TRUE(wait_until_state(&this->helper, HelperTaskState_Finished, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_MallocTraceGetNumBlocks);
+    ASSERT_EQ(0, this->num_blocks);
+}
+
+TEST_F(TestOsTaskStaticFiniteFreertos, test_static_finite_no_alloc) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_RunStaticFiniteNoAlloc);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->helper, HelperTaskState_Waiting, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_MallocTraceGetNumBlocks);
+    ASSERT_EQ(0, this->num_blocks);
+
+    this->helper.flag_release = true;
+    ASSERT_TRUE(wait_until_state(&this->helper, HelperTaskState_Finished, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_MallocTraceGetNumBlocks);
+    ASSERT_EQ(0, this->num_blocks);
+}
+
+TEST_F(TestOsTaskStaticFiniteFreertos, test_static_finite_with_const_param_no_alloc) // NOLINT
+{
+    cmdQueue.push_and_wait(MainTaskCmd_RunStaticFiniteWithConstParamNoAlloc);
+    ASSERT_TRUE(this->cmd_result);
+    ASSERT_TRUE(wait_until_state(&this->helper, HelperTaskState_Waiting, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_MallocTraceGetNumBlocks);
+    ASSERT_EQ(0, this->num_blocks);
+
+    this->helper.flag_release = true;
+    ASSERT_TRUE(wait_until_state(&this->helper, HelperTaskState_Finished, 1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_MallocTraceGetNumBlocks);
+    ASSERT_EQ(0, this->num_blocks);
+}
@@ -0,0 +1,326 @@
+/**
+ * @file test_os_time.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <cstring>
+#include <ctime>
+#include <random>
+#include <string>
+#include "gtest/gtest.h"
+#include "os_time.h"
+#include "os_mkgmtime.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsTime : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    TestOsTime();
+
+    ~TestOsTime() override;
+};
+
+TestOsTime::TestOsTime()
+    : Test()
+{
+}
+
+TestOsTime::~TestOsTime() = default;
+
+static struct tm
+get_tm(const int64_t unix_time)
+{
+    struct tm tm_time = {};
+    os_gmtime64_r(unix_time, &tm_time);
+    return tm_time;
+}
+
+static int64_t
+get_unix_time(const struct tm& tm_time)
+{
+    struct tm tm_time_copy = tm_time;
+    int64_t   unix_time    = 0;
+    os_mkgmtime64(&tm_time_copy, &unix_time);
+    return unix_time;
+}
+
+static bool
+is_tm_equal(const struct tm& tm1, const struct tm& tm2)
+{
+    return (tm1.tm_year == tm2.tm_year) && (tm1.tm_mon == tm2.tm_mon) && (tm1.tm_mday == tm2.tm_mday)
+           && (tm1.tm_hour == tm2.tm_hour) && (tm1.tm_min == tm2.tm_min) && (tm1.tm_sec == tm2.tm_sec)
+           && (tm1.tm_wday == tm2.tm_wday) && (tm1.tm_yday == tm2.tm_yday) && (tm1.tm_isdst == tm2.tm_isdst);
+}
+
+static bool
+parse_rfc3339(const string& str, struct tm* const p_tm_time, uint32_t* const p_milliseconds)
+{
+    return os_time_parse_rfc3339(str.c_str(), str.length(), p_tm_time, p_milliseconds);
+}
+
+static bool
+parse_rfc7231(const string& str, struct tm* const p_tm_time)
+{
+    return os_time_parse_rfc7231(str.c_str(), str.length(), p_tm_time);
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsTime, test_names) // NOLINT
+{
+    ASSERT_EQ(string("Feb"), string(os_time_month_name_short(OS_TIME_MONTH_FEB)));
+    ASSERT_EQ(string("February"), string(os_time_month_name_long(OS_TIME_MONTH_FEB)));
+    ASSERT_EQ(string("Th"), string(os_time_wday_name_short(OS_TIME_WDAY_THU)));
+    ASSERT_EQ(string("Thu"), string(os_time_wday_name_mid(OS_TIME_WDAY_THU)));
+    ASSERT_EQ(string("Thursday"), string(os_time_wday_name_long(OS_TIME_WDAY_THU)));
+}
+
+TEST_F(TestOsTime, test_fmt_rfc3339) // NOLINT
+{
+    char            buf[OS_TIME_RFC3339_STR_LEN + 1] = {};
+    const struct tm tm_time                          = get_tm(1709209815);
+    ASSERT_EQ(OS_TIME_RFC3339_STR_LEN, os_time_fmt_rfc3339(&tm_time, buf, sizeof(buf)));
+    ASSERT_EQ(string("2024-02-29T12:30:15Z"), string(buf));
+
+    ASSERT_EQ(0, os_time_fmt_rfc3339(&tm_time, buf, sizeof(buf) - 1));
+
+    struct tm tm_time2 = tm_time;
+    tm_time2.tm_year   = 10000 - 1900;
+    ASSERT_EQ(0, os_time_fmt_rfc3339(&tm_time2, buf, sizeof(buf)));
+    tm_time2.tm_year = -1901;
+    ASSERT_EQ(0, os_time_fmt_rfc3339(&tm_time2, buf, sizeof(buf)));
+    tm_time2         = tm_time;
+    tm_time2.tm_hour = 24;
+    ASSERT_EQ(0, os_time_fmt_rfc3339(&tm_time2, buf, sizeof(buf)));
+    tm_time2        = tm_time;
+    tm_time2.tm_mon = -1;
+    ASSERT_EQ(0, os_time_fmt_rfc3339(&tm_time2, buf, sizeof(buf)));
+
+    const struct tm tm_time3 = get_tm(-62167219200); // 0000-01-01T00:00:00Z
+    ASSERT_EQ(OS_TIME_RFC3339_STR_LEN, os_time_fmt_rfc3339(&tm_time3, buf, sizeof(buf)));
+    ASSERT_EQ(string("0000-01-01T00:00:00Z"), string(buf));
+}
+
+TEST_F(TestOsTime, test_fmt_rfc3339_ms) // NOLINT
+{
+    char            buf[OS_TIME_RFC3339_MS_STR_LEN + 1] = {};
+    const struct tm tm_time                             = get_tm(1709209815);
+    ASSERT_EQ(OS_TIME_RFC3339_MS_STR_LEN, os_time_fmt_rfc3339_ms(&tm_time, 7, buf, sizeof(buf)));
+    ASSERT_EQ(string("2024-02-29T12:30:15.007Z"), string(buf));
+    ASSERT_EQ(OS_TIME_RFC3339_MS_STR_LEN, os_time_fmt_rfc3339_ms(&tm_time, 999, buf, sizeof(buf)));
+    ASSERT_EQ(string("2024-02-29T12:30:15.999Z"), string(buf));
+
+    ASSERT_EQ(0, os_time_fmt_rfc3339_ms(&tm_time, 1000, buf, sizeof(buf)));
+    ASSERT_EQ(0, os_time_fmt_rfc3339_ms(&tm_time, 0, buf, sizeof(buf) - 1));
+}
+
+TEST_F(TestOsTime, test_fmt_rfc7231) // NOLINT
+{
+    char            buf[OS_TIME_RFC7231_STR_LEN + 1] = {};
+    const struct tm tm_time                          = get_tm(784111777);
+    ASSERT_EQ(OS_TIME_RFC7231_STR_LEN, os_time_fmt_rfc7231(&tm_time, buf, sizeof(buf)));
+    ASSERT_EQ(string("Sun, 06 Nov 1994 08:49:37 GMT"), string(buf));
+
+    ASSERT_EQ(0, os_time_fmt_rfc7231(&tm_time, buf, sizeof(buf) - 1));
+
+    struct tm tm_time2 = tm_time;
+    tm_time2.tm_wday   = 7;
+    ASSERT_EQ(0, os_time_fmt_rfc7231(&tm_time2, buf, sizeof(buf)));
+}
+
+TEST_F(TestOsTime, test_parse_rfc3339) // NOLINT
+{
+    struct tm tm_time      = {};
+    uint32_t  milliseconds = 123;
+    ASSERT_TRUE(parse_rfc3339("2024-02-29T12:30:15Z", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(1709209815), tm_time));
+    ASSERT_EQ(0, milliseconds);
+
+    ASSERT_TRUE(parse_rfc3339("2024-02-29t12:30:15.5z", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(1709209815), tm_time));
+    ASSERT_EQ(500, milliseconds);
+
+    ASSERT_TRUE(parse_rfc3339("2024-02-29 12:30:15.123456789Z", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(1709209815), tm_time));
+    ASSERT_EQ(123, milliseconds);
+
+    ASSERT_TRUE(parse_rfc3339("2024-02-29T12:30:15.04Z", &tm_time, nullptr));
+    ASSERT_TRUE(is_tm_equal(get_tm(1709209815), tm_time));
+
+    // The time with the offset is converted to UTC
+    ASSERT_TRUE(parse_rfc3339("2024-02-29T14:30:15+02:00", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(1709209815), tm_time));
+    ASSERT_TRUE(parse_rfc3339("2024-02-29T07:00:15.250-05:30", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(1709209815), tm_time));
+    ASSERT_EQ(250, milliseconds);
+    ASSERT_TRUE(parse_rfc3339("2024-03-01T00:00:00+11:29", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(1709209815 - 15 + 60), tm_time));
+
+    // Leap second
+    ASSERT_TRUE(parse_rfc3339("2016-12-31T23:59:60Z", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(1483228800), tm_time));
+
+    ASSERT_TRUE(parse_rfc3339("0000-01-01T00:00:00Z", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(-62167219200), tm_time));
+    ASSERT_TRUE(parse_rfc3339("0000-02-29T00:00:00Z", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(-62167219200 + 59 * 86400), tm_time));
+    ASSERT_TRUE(parse_rfc3339("9999-12-31T23:59:59Z", &tm_time, &milliseconds));
+    ASSERT_TRUE(is_tm_equal(get_tm(253402300799), tm_time));
+}
+
+TEST_F(TestOsTime, test_parse_rfc3339_invalid) // NOLINT
+{
+    const struct tm tm_time_orig     = get_tm(1);
+    struct tm       tm_time          = tm_time_orig;
+    uint32_t        milliseconds     = 123;
+    const char*     arr_of_invalid[] = {
+        "",
+        "2024-02-29T12:30:15",
+        "2024-02-29T12:30:15z ",
+        "2024-02-29T12:30:15.Z",
+        "2024-02-29T12:30:15.1",
+        "2024-02-29T12:30:15+02",
+        "2024-02-29T12:30:15+02:00:00",
+        "2024-02-29T12:30:15+24:00",
+        "2024-02-29T12:30:15+02:60",
+        "2024-02-29T12:30:15*02:00",
+        "2024-02-29_12:30:15Z",
+        "2024/02/29T12:30:15Z",
+        "2024-02-29T12-30-15Z",
+        "202A-02-29T12:30:15Z",
+        "2024-02-2 T12:30:15Z",
+        "2023-02-29T12:30:15Z",
+        "2024-02-30T12:30:15Z",
+        "2024-04-31T12:30:15Z",
+        "2024-00-01T12:30:15Z",
+        "2024-13-01T12:30:15Z",
+        "2024-01-00T12:30:15Z",
+        "2024-01-01T24:00:00Z",
+        "2024-01-01T12:60:00Z",
+        "2024-01-01T12:00:61Z",
+        "+024-01-01T12:00:00Z",
+    };
+    for (const char* p_str : arr_of_invalid)
+    {
+        ASSERT_FALSE(parse_rfc3339(p_str, &tm_time, &milliseconds)) << p_str;
+        ASSERT_TRUE(is_tm_equal(tm_time_orig, tm_time));
+        ASSERT_EQ(123, milliseconds);
+    }
+    // The string is not required to be null-terminated
+    ASSERT_TRUE(os_time_parse_rfc3339("2024-02-29T12:30:15Z", OS_TIME_RFC3339_STR_LEN, &tm_time, &milliseconds));
+    ASSERT_FALSE(os_time_parse_rfc3339("2024-02-29T12:30:15Z", OS_TIME_RFC3339_STR_LEN - 1, &tm_time, &milliseconds));
+}
+
+TEST_F(TestOsTime, test_parse_rfc7231) // NOLINT
+{
+    struct tm tm_time = {};
+    ASSERT_TRUE(parse_rfc7231("Sun, 06 Nov 1994 08:49:37 GMT", &tm_time));
+    ASSERT_TRUE(is_tm_equal(get_tm(784111777), tm_time));
+
+    // The day of the week is not checked for consistency with the date
+    ASSERT_TRUE(parse_rfc7231("Mon, 06 Nov 1994 08:49:37 GMT", &tm_time));
+    ASSERT_TRUE(is_tm_equal(get_tm(784111777), tm_time));
+}
+
+TEST_F(TestOsTime, test_parse_rfc7231_invalid) // NOLINT
+{
+    const struct tm tm_time_orig     = get_tm(1);
+    struct tm       tm_time          = tm_time_orig;
+    const char*     arr_of_invalid[] = {
+        "",
+        "Sun, 06 Nov 1994 08:49:37 GMT ",
+        "Sun, 06 Nov 1994 08:49:37 UTC",
+        "Sun, 06 Nov 1994 08:49:37 gmt",
+        "Sunday, 06-Nov-94 08:49:37 GMT",
+        "Sun Nov  6 08:49:37 1994",
+        "Abc, 06 Nov 1994 08:49:37 GMT",
+        "sun, 06 Nov 1994 08:49:37 GMT",
+        "Sun, 06 Abc 1994 08:49:37 GMT",
+        "Sun, 06 nov 1994 08:49:37 GMT",
+        "Sun,_06 Nov 1994 08:49:37 GMT",
+        "Sun, 6  Nov 1994 08:49:37 GMT",
+        "Sun, 31 Nov 1994 08:49:37 GMT",
+        "Sun, 06 Nov 1994 24:49:37 GMT",
+        "Sun, 06 Nov 1994 08:60:37 GMT",
+        "Sun, 06 Nov 1994 08:49:61 GMT",
+        "Sun, 06 Nov 1994 08-49-37 GMT",
+    };
+    for (const char* p_str : arr_of_invalid)
+    {
+        ASSERT_FALSE(parse_rfc7231(p_str, &tm_time)) << p_str;
+        ASSERT_TRUE(is_tm_equal(tm_time_orig, tm_time));
+    }
+}
+
+TEST_F(TestOsTime, test_round_trip_compare_with_strftime) // NOLINT
+{
+    std::mt19937_64                        rng(3339);
+    std::uniform_int_distribution<int64_t> dist_time(-62167219200LL, 253402300799LL); // 0000-01-01 .. 9999-12-31
+    std::uniform_int_distribution<int32_t> dist_ms(0, 999);
+    for (uint32_t i = 0; i < 200000; ++i)
+    {
+        const int64_t   unix_time    = dist_time(rng);
+        const uint32_t  milliseconds = (uint32_t)dist_ms(rng);
+        const struct tm tm_time      = get_tm(unix_time);
+
+        char buf_expected[64] = {};
+        char buf[64]          = {};
+        strftime(buf_expected, sizeof(buf_expected), "%Y-%m-%dT%H:%M:%SZ", &tm_time);
+        if (tm_time.tm_year + 1900 < 1000)
+        {
+            // strftime does not add leading zeros to the year
+            snprintf(
+                buf_expected,
+                sizeof(buf_expected),
+                "%04d-%02d-%02dT%02d:%02d:%02dZ",
+                tm_time.tm_year + 1900,
+                tm_time.tm_mon + 1,
+                tm_time.tm_mday,
+                tm_time.tm_hour,
+                tm_time.tm_min,
+                tm_time.tm_sec);
+        }
+        ASSERT_EQ(OS_TIME_RFC3339_STR_LEN, os_time_fmt_rfc3339(&tm_time, buf, sizeof(buf)));
+        ASSERT_EQ(string(buf_expected), string(buf));
+
+        struct tm tm_time2      = {};
+        uint32_t  milliseconds2 = 0;
+        ASSERT_TRUE(parse_rfc3339(buf, &tm_time2, &milliseconds2));
+        ASSERT_TRUE(is_tm_equal(tm_time, tm_time2));
+        ASSERT_EQ(0, milliseconds2);
+
+        ASSERT_EQ(OS_TIME_RFC3339_MS_STR_LEN, os_time_fmt_rfc3339_ms(&tm_time, milliseconds, buf, sizeof(buf)));
+        ASSERT_TRUE(parse_rfc3339(buf, &tm_time2, &milliseconds2));
+        ASSERT_TRUE(is_tm_equal(tm_time, tm_time2));
+        ASSERT_EQ(milliseconds, milliseconds2);
+
+        ASSERT_EQ(OS_TIME_RFC7231_STR_LEN, os_time_fmt_rfc7231(&tm_time, buf, sizeof(buf)));
+        if (tm_time.tm_year + 1900 >= 1000)
+        {
+            strftime(buf_expected, sizeof(buf_expected), "%a, %d %b %Y %H:%M:%S GMT", &tm_time);
+            ASSERT_EQ(string(buf_expected), string(buf));
+        }
+        ASSERT_TRUE(parse_rfc7231(buf, &tm_time2));
+        ASSERT_TRUE(is_tm_equal(tm_time, tm_time2));
+        ASSERT_EQ(unix_time, get_unix_time(tm_time2));
+    }
+}
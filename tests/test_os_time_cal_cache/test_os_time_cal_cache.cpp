@@ -0,0 +1,295 @@
+/**
+ * @file test_os_time_cal_cache.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include <atomic>
+#include <ctime>
+#include <random>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "os_time_cal_cache.h"
+#include "os_mkgmtime.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsTimeCalCache : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        os_time_cal_cache_init(&this->m_cache);
+        os_time_cal_cache_shared_reset();
+    }
+
+    void
+    TearDown() override
+    {
+        os_time_cal_cache_shared_reset();
+    }
+
+public:
+    TestOsTimeCalCache();
+
+    ~TestOsTimeCalCache() override;
+
+    os_time_cal_cache_t m_cache;
+};
+
+TestOsTimeCalCache::TestOsTimeCalCache()
+    : Test()
+    , m_cache {}
+{
+}
+
+TestOsTimeCalCache::~TestOsTimeCalCache() = default;
+
+static struct tm
+init_tm(const int year, const int month, const int mday, const int hour, const int min, const int sec)
+{
+    struct tm tm_time = {};
+    tm_time.tm_year   = year - 1900;
+    tm_time.tm_mon    = month - 1;
+    tm_time.tm_mday   = mday;
+    tm_time.tm_hour   = hour;
+    tm_time.tm_min    = min;
+    tm_time.tm_sec    = sec;
+    return tm_time;
+}
+
+static bool
+is_tm_equal(const struct tm& tm1, const struct tm& tm2)
+{
+    return (tm1.tm_year == tm2.tm_year) && (tm1.tm_mon == tm2.tm_mon) && (tm1.tm_mday == tm2.tm_mday)
+           && (tm1.tm_hour == tm2.tm_hour) && (tm1.tm_min == tm2.tm_min) && (tm1.tm_sec == tm2.tm_sec)
+           && (tm1.tm_wday == tm2.tm_wday) && (tm1.tm_yday == tm2.tm_yday) && (tm1.tm_isdst == tm2.tm_isdst);
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsTimeCalCache, test_init) // NOLINT
+{
+    this->m_cache.is_valid = true;
+    os_time_cal_cache_init(&this->m_cache);
+    ASSERT_FALSE(this->m_cache.is_valid);
+}
+
+TEST_F(TestOsTimeCalCache, test_gmtime_r_refresh_on_day_change) // NOLINT
+{
+    struct tm tm_time = {};
+    // 2024-02-28 23:59:59
+    ASSERT_EQ(&tm_time, os_time_cal_cache_gmtime_r(&this->m_cache, 1709164799, &tm_time));
+    ASSERT_TRUE(this->m_cache.is_valid);
+    ASSERT_EQ(1709078400, this->m_cache.day_start);
+    ASSERT_EQ(124, tm_time.tm_year);
+    ASSERT_EQ(1, tm_time.tm_mon);
+    ASSERT_EQ(28, tm_time.tm_mday);
+    ASSERT_EQ(23, tm_time.tm_hour);
+    ASSERT_EQ(59, tm_time.tm_min);
+    ASSERT_EQ(59, tm_time.tm_sec);
+    ASSERT_EQ(3, tm_time.tm_wday);
+    ASSERT_EQ(58, tm_time.tm_yday);
+
+    // 2024-02-28 00:00:00 - the same day
+    ASSERT_EQ(&tm_time, os_time_cal_cache_gmtime_r(&this->m_cache, 1709078400, &tm_time));
+    ASSERT_EQ(1709078400, this->m_cache.day_start);
+    ASSERT_EQ(28, tm_time.tm_mday);
+    ASSERT_EQ(0, tm_time.tm_hour);
+    ASSERT_EQ(0, tm_time.tm_min);
+    ASSERT_EQ(0, tm_time.tm_sec);
+
+    // 2024-02-29 00:00:00 - the leap day
+    ASSERT_EQ(&tm_time, os_time_cal_cache_gmtime_r(&this->m_cache, 1709164800, &tm_time));
+    ASSERT_EQ(1709164800, this->m_cache.day_start);
+    ASSERT_EQ(1, tm_time.tm_mon);
+    ASSERT_EQ(29, tm_time.tm_mday);
+    ASSERT_EQ(0, tm_time.tm_hour);
+    ASSERT_EQ(4, tm_time.tm_wday);
+    ASSERT_EQ(59, tm_time.tm_yday);
+
+    // 1969-12-31 23:59:59
+    ASSERT_EQ(&tm_time, os_time_cal_cache_gmtime_r(&this->m_cache, -1, &tm_time));
+    ASSERT_EQ(-86400, this->m_cache.day_start);
+    ASSERT_EQ(69, tm_time.tm_year);
+    ASSERT_EQ(11, tm_time.tm_mon);
+    ASSERT_EQ(31, tm_time.tm_mday);
+    ASSERT_EQ(23, tm_time.tm_hour);
+    ASSERT_EQ(3, tm_time.tm_wday);
+}
+
+TEST_F(TestOsTimeCalCache, test_gmtime_r_every_second_compare_with_gmtime_r) // NOLINT
+{
+    // from 2023-12-30 00:00:00 to 2024-01-02 00:00:00
+    const time_t time_start = 1703894400;
+    const time_t time_end   = 1704153600;
+    for (time_t unix_time = time_start; unix_time < time_end; ++unix_time)
+    {
+        struct tm tm_time1 = {};
+        struct tm tm_time2 = {};
+        ASSERT_NE(nullptr, gmtime_r(&unix_time, &tm_time1));
+        ASSERT_EQ(&tm_time2, os_time_cal_cache_gmtime_r(&this->m_cache, unix_time, &tm_time2));
+        ASSERT_TRUE(is_tm_equal(tm_time1, tm_time2));
+    }
+}
+
+TEST_F(TestOsTimeCalCache, test_gmtime_r_random_compare_with_gmtime_r) // NOLINT
+{
+    std::mt19937                          rng(1970);
+    std::uniform_int_distribution<time_t> dist_time(0, INT32_MAX);
+    std::uniform_int_distribution<time_t> dist_offset(-100000, 100000);
+    time_t                                unix_time = 0;
+    for (uint32_t i = 0; i < 1000000; ++i)
+    {
+        unix_time = (0 == (i % 100)) ? dist_time(rng) : (unix_time + dist_offset(rng));
+        struct tm tm_time1 = {};
+        struct tm tm_time2 = {};
+        ASSERT_NE(nullptr, gmtime_r(&unix_time, &tm_time1));
+        ASSERT_EQ(&tm_time2, os_time_cal_cache_gmtime_r(&this->m_cache, unix_time, &tm_time2));
+        ASSERT_TRUE(is_tm_equal(tm_time1, tm_time2));
+    }
+}
+
+TEST_F(TestOsTimeCalCache, test_mkgmtime) // NOLINT
+{
+    struct tm tm_time = init_tm(2024, 2, 29, 12, 30, 15);
+    ASSERT_EQ(1709209815, os_time_cal_cache_mkgmtime(&this->m_cache, &tm_time));
+    ASSERT_TRUE(this->m_cache.is_valid);
+    ASSERT_EQ(1709164800, this->m_cache.day_start);
+    ASSERT_EQ(4, tm_time.tm_wday);
+    ASSERT_EQ(59, tm_time.tm_yday);
+
+    // The same day, the result is taken from the cache
+    tm_time = init_tm(2024, 2, 29, 23, 59, 59);
+    ASSERT_EQ(1709251199, os_time_cal_cache_mkgmtime(&this->m_cache, &tm_time));
+    ASSERT_EQ(4, tm_time.tm_wday);
+    ASSERT_EQ(59, tm_time.tm_yday);
+    ASSERT_EQ(1709164800, this->m_cache.day_start);
+
+    // The same day, but the time is not normalized
+    tm_time = init_tm(2024, 2, 29, 23, 59, 60);
+    ASSERT_EQ(1709251200, os_time_cal_cache_mkgmtime(&this->m_cache, &tm_time));
+    ASSERT_EQ(2, tm_time.tm_mon);
+    ASSERT_EQ(1, tm_time.tm_mday);
+    ASSERT_EQ(0, tm_time.tm_hour);
+    ASSERT_EQ(0, tm_time.tm_min);
+    ASSERT_EQ(0, tm_time.tm_sec);
+    ASSERT_EQ(5, tm_time.tm_wday);
+    ASSERT_EQ(60, tm_time.tm_yday);
+    ASSERT_EQ(1709251200, this->m_cache.day_start);
+
+    // 40 October is changed into 9 November
+    tm_time = init_tm(2021, 10, 40, 0, 0, 0);
+    ASSERT_EQ(1636416000, os_time_cal_cache_mkgmtime(&this->m_cache, &tm_time));
+    ASSERT_EQ(10, tm_time.tm_mon);
+    ASSERT_EQ(9, tm_time.tm_mday);
+}
+
+TEST_F(TestOsTimeCalCache, test_mkgmtime_out_of_range) // NOLINT
+{
+    struct tm tm_time = {};
+    // 2038-01-19 03:14:07
+    ASSERT_EQ(&tm_time, os_time_cal_cache_gmtime_r(&this->m_cache, INT32_MAX, &tm_time));
+    ASSERT_EQ(INT32_MAX, os_time_cal_cache_mkgmtime(&this->m_cache, &tm_time));
+
+    tm_time = init_tm(2038, 1, 19, 3, 14, 8);
+    ASSERT_EQ(-1, os_time_cal_cache_mkgmtime(&this->m_cache, &tm_time));
+
+    ASSERT_EQ(&tm_time, os_time_cal_cache_gmtime_r(&this->m_cache, -1, &tm_time));
+    tm_time = init_tm(1969, 12, 31, 23, 59, 59);
+    ASSERT_EQ(-1, os_time_cal_cache_mkgmtime(&this->m_cache, &tm_time));
+}
+
+TEST_F(TestOsTimeCalCache, test_mkgmtime_every_minute_compare_with_os_mkgmtime) // NOLINT
+{
+    for (int mday = 27; mday <= 31; ++mday)
+    {
+        for (int hour = 0; hour < 24; ++hour)
+        {
+            for (int min = 0; min < 60; ++min)
+            {
+                struct tm tm_time1 = init_tm(2023, 12, mday, hour, min, min % 60);
+                struct tm tm_time2 = tm_time1;
+                ASSERT_EQ(os_mkgmtime(&tm_time1), os_time_cal_cache_mkgmtime(&this->m_cache, &tm_time2));
+                ASSERT_TRUE(is_tm_equal(tm_time1, tm_time2));
+            }
+        }
+    }
+}
+
+TEST_F(TestOsTimeCalCache, test_shared) // NOLINT
+{
+    struct tm tm_time = {};
+    ASSERT_EQ(&tm_time, os_time_cal_cache_shared_gmtime_r(1709164799, &tm_time));
+    ASSERT_EQ(28, tm_time.tm_mday);
+    ASSERT_EQ(23, tm_time.tm_hour);
+
+    ASSERT_EQ(&tm_time, os_time_cal_cache_shared_gmtime_r(1709078400, &tm_time));
+    ASSERT_EQ(28, tm_time.tm_mday);
+    ASSERT_EQ(0, tm_time.tm_hour);
+
+    tm_time = init_tm(2024, 2, 28, 1, 2, 3);
+    ASSERT_EQ(1709082123, os_time_cal_cache_shared_mkgmtime(&tm_time));
+    ASSERT_EQ(3, tm_time.tm_wday);
+    ASSERT_EQ(58, tm_time.tm_yday);
+
+    tm_time = init_tm(2024, 2, 28, 1, 2, -3);
+    ASSERT_EQ(1709082117, os_time_cal_cache_shared_mkgmtime(&tm_time));
+    ASSERT_EQ(1, tm_time.tm_min);
+    ASSERT_EQ(57, tm_time.tm_sec);
+
+    os_time_cal_cache_shared_reset();
+    ASSERT_EQ(&tm_time, os_time_cal_cache_shared_gmtime_r(0, &tm_time));
+    ASSERT_EQ(70, tm_time.tm_year);
+    ASSERT_EQ(0, tm_time.tm_mon);
+    ASSERT_EQ(1, tm_time.tm_mday);
+    ASSERT_EQ(4, tm_time.tm_wday);
+}
+
+TEST_F(TestOsTimeCalCache, test_shared_multithreaded) // NOLINT
+{
+    const uint32_t      num_threads = 4;
+    std::atomic<bool>   is_failed(false);
+    std::vector<thread> threads;
+    for (uint32_t thread_idx = 0; thread_idx < num_threads; ++thread_idx)
+    {
+        threads.emplace_back([thread_idx, &is_failed]() {
+            std::mt19937                          rng(thread_idx);
+            std::uniform_int_distribution<time_t> dist_day(0, 2);
+            std::uniform_int_distribution<time_t> dist_secs(0, 86399);
+            for (uint32_t i = 0; (i < 200000) && (!is_failed.load()); ++i)
+            {
+                // Each thread switches between 3 days, so the global cache is refreshed all the time
+                const time_t unix_time = 1700006400 + dist_day(rng) * 86400 + dist_secs(rng);
+                struct tm    tm_time1  = {};
+                struct tm    tm_time2  = {};
+                gmtime_r(&unix_time, &tm_time1);
+                if ((&tm_time2 != os_time_cal_cache_shared_gmtime_r(unix_time, &tm_time2))
+                    || (!is_tm_equal(tm_time1, tm_time2)))
+                {
+                    is_failed.store(true);
+                }
+                struct tm tm_time3 = tm_time1;
+                tm_time3.tm_wday   = 0;
+                tm_time3.tm_yday   = 0;
+                if ((unix_time != os_time_cal_cache_shared_mkgmtime(&tm_time3)) || (!is_tm_equal(tm_time1, tm_time3)))
+                {
+                    is_failed.store(true);
+                }
+            }
+        });
+    }
+    for (auto& thr : threads)
+    {
+        thr.join();
+    }
+    ASSERT_FALSE(is_failed.load());
+}
@@ -0,0 +1,214 @@
+/**
+ * @file test_os_time_mono.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "gtest/gtest.h"
+#include "os_time_mono.h"
+#include "os_wrapper_types.h"
+#include "freertos/task.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestOsTimeMono;
+static TestOsTimeMono* g_pTestClass;
+
+class TestOsTimeMono : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass              = this;
+        this->m_numOverflows      = 0;
+        this->m_tickCount         = 0;
+        this->m_cntSetTimeOutCall = 0;
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestOsTimeMono();
+
+    ~TestOsTimeMono() override;
+
+    BaseType_t m_numOverflows;
+    TickType_t m_tickCount;
+    uint32_t   m_cntSetTimeOutCall;
+
+    /**
+     * @brief Advance the simulated tick counter, the number of overflows is incremented on wrap-around.
+     */
+    void
+    advanceTicks(const uint32_t num_ticks)
+    {
+        const TickType_t prev_tick_count = this->m_tickCount;
+        this->m_tickCount += num_ticks;
+        if (this->m_tickCount < prev_tick_count)
+        {
+            this->m_numOverflows += 1;
+        }
+    }
+};
+
+TestOsTimeMono::TestOsTimeMono()
+    : Test()
+    , m_numOverflows(0)
+    , m_tickCount(0)
+    , m_cntSetTimeOutCall(0)
+{
+}
+
+TestOsTimeMono::~TestOsTimeMono() = default;
+
+extern "C" {
+
+void
+vTaskSetTimeOutState(TimeOut_t* const pxTimeOut)
+{
+    g_pTestClass->m_cntSetTimeOutCall += 1;
+    pxTimeOut->xOverflowCount  = g_pTestClass->m_numOverflows;
+    pxTimeOut->xTimeOnEntering = g_pTestClass->m_tickCount;
+}
+
+} // extern "C"
+
+#define TICK_WRAP_PERIOD ((uint64_t)1U << (sizeof(TickType_t) * 8U))
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestOsTimeMono, test_tick64_make) // NOLINT
+{
+    ASSERT_EQ(5U, os_time_mono_tick64_make(0, 5));
+    ASSERT_EQ(TICK_WRAP_PERIOD, os_time_mono_tick64_make(1, 0));
+    ASSERT_EQ(3 * TICK_WRAP_PERIOD - 1U, os_time_mono_tick64_make(2, (TickType_t)(TICK_WRAP_PERIOD - 1U)));
+}
+
+TEST_F(TestOsTimeMono, test_tick64_extend) // NOLINT
+{
+    const os_time_mono_tick64_t ref_tick64 = TICK_WRAP_PERIOD + 0x10U;
+    ASSERT_EQ(ref_tick64, os_time_mono_tick64_extend(ref_tick64, 0x10U));
+    ASSERT_EQ(TICK_WRAP_PERIOD + 0x05U, os_time_mono_tick64_extend(ref_tick64, 0x05U));
+    ASSERT_EQ(TICK_WRAP_PERIOD - 0x10U, os_time_mono_tick64_extend(ref_tick64, (TickType_t)(TICK_WRAP_PERIOD - 0x10U)));
+    ASSERT_EQ(0x11U, os_time_mono_tick64_extend(ref_tick64, 0x11U));
+
+    // The tick from the first wrap period which is later than the reference tick
+    ASSERT_EQ(200U, os_time_mono_tick64_extend(100U, 200U));
+    ASSERT_EQ(50U, os_time_mono_tick64_extend(100U, 50U));
+}
+
+TEST_F(TestOsTimeMono, test_tick64_elapsed) // NOLINT
+{
+    ASSERT_EQ(0x20U, os_time_mono_tick64_elapsed(TICK_WRAP_PERIOD - 0x10U, TICK_WRAP_PERIOD + 0x10U));
+    ASSERT_EQ(0U, os_time_mono_tick64_elapsed(TICK_WRAP_PERIOD + 0x10U, TICK_WRAP_PERIOD - 0x10U));
+    ASSERT_EQ(0U, os_time_mono_tick64_elapsed(5, 5));
+}
+
+TEST_F(TestOsTimeMono, test_conv) // NOLINT
+{
+    const uint64_t us_per_tick = 1000000U / configTICK_RATE_HZ;
+    ASSERT_EQ(us_per_tick, os_time_mono_conv_ticks_to_us(1));
+    ASSERT_EQ(1000000U, os_time_mono_conv_ticks_to_us(configTICK_RATE_HZ));
+    ASSERT_EQ(1000U, os_time_mono_conv_ticks_to_ms(configTICK_RATE_HZ));
+    ASSERT_EQ((uint64_t)configTICK_RATE_HZ, os_time_mono_conv_us_to_ticks(1000000U));
+    ASSERT_EQ(0U, os_time_mono_conv_us_to_ticks(us_per_tick - 1U));
+    ASSERT_EQ(1U, os_time_mono_conv_us_to_ticks(us_per_tick));
+
+    // No overflow after the wrap-around of TickType_t
+    ASSERT_EQ(TICK_WRAP_PERIOD * us_per_tick, os_time_mono_conv_ticks_to_us(TICK_WRAP_PERIOD));
+    ASSERT_EQ(TICK_WRAP_PERIOD * 3, os_time_mono_conv_us_to_ticks(os_time_mono_conv_ticks_to_us(TICK_WRAP_PERIOD * 3)));
+}
+
+TEST_F(TestOsTimeMono, test_delta_ms_to_ticks) // NOLINT
+{
+    ASSERT_EQ(0U, OS_DELTA_MS_TO_TICKS(0));
+    ASSERT_EQ((os_delta_ticks_t)configTICK_RATE_HZ, OS_DELTA_MS_TO_TICKS(1000));
+    ASSERT_EQ((os_delta_ticks_t)((configTICK_RATE_HZ * 3U) / 2U), OS_DELTA_MS_TO_TICKS(1500));
+    // The result is rounded down
+    ASSERT_EQ(0U, OS_DELTA_MS_TO_TICKS((1000U / configTICK_RATE_HZ) - 1U));
+
+    // pdMS_TO_TICKS overflows with 32-bit intermediate product for 2 hours at 1000 Hz
+    const uint32_t delay_ms = 2U * 60U * 60U * 1000U;
+    ASSERT_EQ((os_delta_ticks_t)((uint64_t)delay_ms * configTICK_RATE_HZ / 1000U), OS_DELTA_MS_TO_TICKS(delay_ms));
+
+    // It is a constant expression
+    static_assert(OS_DELTA_MS_TO_TICKS(1000) == configTICK_RATE_HZ, "OS_DELTA_MS_TO_TICKS");
+}
+
+TEST_F(TestOsTimeMono, test_delta_ticks_from_ms) // NOLINT
+{
+    ASSERT_EQ(0U, os_delta_ticks_from_ms(0));
+    ASSERT_EQ((os_delta_ticks_t)configTICK_RATE_HZ, os_delta_ticks_from_ms(1000));
+    // The result is rounded up, so a non-zero delay is never converted to zero ticks
+    ASSERT_EQ(1U, os_delta_ticks_from_ms(1));
+    ASSERT_EQ((os_delta_ticks_t)configTICK_RATE_HZ + 1U, os_delta_ticks_from_ms(1001));
+
+    // The result is saturated (at 1000 Hz and lower tick rates it fits in 32-bit ticks without saturation)
+    const uint64_t max_ticks = (((uint64_t)UINT32_MAX * configTICK_RATE_HZ) + 999U) / 1000U;
+    ASSERT_EQ(
+        (max_ticks > OS_DELTA_TICKS_MAX) ? OS_DELTA_TICKS_MAX : (os_delta_ticks_t)max_ticks,
+        os_delta_ticks_from_ms(UINT32_MAX));
+}
+
+TEST_F(TestOsTimeMono, test_delta_ticks_from_us) // NOLINT
+{
+    ASSERT_EQ(0U, os_delta_ticks_from_us(0));
+    ASSERT_EQ((os_delta_ticks_t)configTICK_RATE_HZ, os_delta_ticks_from_us(1000000));
+    // The result is rounded up, so a non-zero delay is never converted to zero ticks
+    ASSERT_EQ(1U, os_delta_ticks_from_us(1));
+    ASSERT_EQ((os_delta_ticks_t)configTICK_RATE_HZ + 1U, os_delta_ticks_from_us(1000001));
+
+    // The result is saturated
+    ASSERT_EQ(OS_DELTA_TICKS_MAX, os_delta_ticks_from_us(TICK_WRAP_PERIOD * 1000000U));
+    ASSERT_EQ(OS_DELTA_TICKS_MAX, os_delta_ticks_from_us(UINT64_MAX));
+}
+
+TEST_F(TestOsTimeMono, test_get_tick64_wrap_around) // NOLINT
+{
+    this->m_tickCount = (TickType_t)(TICK_WRAP_PERIOD - 0x10U);
+    const os_time_mono_tick64_t tick64_before_wrap = os_time_mono_get_tick64();
+    ASSERT_EQ(TICK_WRAP_PERIOD - 0x10U, tick64_before_wrap);
+    ASSERT_EQ(1, this->m_cntSetTimeOutCall);
+
+    this->advanceTicks(0x20U);
+    ASSERT_EQ(0x10U, this->m_tickCount);
+    const os_time_mono_tick64_t tick64_after_wrap = os_time_mono_get_tick64();
+    ASSERT_EQ(TICK_WRAP_PERIOD + 0x10U, tick64_after_wrap);
+    ASSERT_EQ(0x20U, os_time_mono_tick64_elapsed(tick64_before_wrap, tick64_after_wrap));
+
+    // The 32-bit timestamp saved before the wrap-around is extended correctly
+    ASSERT_EQ(tick64_before_wrap, os_time_mono_tick64_extend(tick64_after_wrap, (TickType_t)tick64_before_wrap));
+}
+
+TEST_F(TestOsTimeMono, test_get_tick64_long_run) // NOLINT
+{
+    // Simulate several wrap-arounds of the tick counter (about 49 days each at 1000 Hz) with uneven steps,
+    // the 64-bit tick counter and the microsecond clock must grow exactly by the number of ticks.
+    const uint32_t        step_ticks  = 0x0FFFFFFFU;
+    os_time_mono_tick64_t prev_tick64 = os_time_mono_get_tick64();
+    uint64_t              prev_us     = os_time_mono_get_us();
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        const uint32_t num_ticks = step_ticks + i;
+        this->advanceTicks(num_ticks);
+        const os_time_mono_tick64_t tick64 = os_time_mono_get_tick64();
+        const uint64_t              cur_us = os_time_mono_get_us();
+        ASSERT_EQ(num_ticks, os_time_mono_tick64_elapsed(prev_tick64, tick64));
+        ASSERT_EQ(os_time_mono_conv_ticks_to_us(num_ticks), cur_us - prev_us);
+        prev_tick64 = tick64;
+        prev_us     = cur_us;
+    }
+    ASSERT_GE(this->m_numOverflows, 6);
+    ASSERT_EQ((uint64_t)this->m_numOverflows, prev_tick64 >> (sizeof(TickType_t) * 8U));
+}
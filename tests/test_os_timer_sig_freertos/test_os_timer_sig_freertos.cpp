@@ -11,6 +11,7 @@
 #include "gtest/gtest.h"
 #include "os_timer_sig.h"
 #include "os_task.h"
+#include "os_time_mono.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "TQueue.hpp"
@@ -31,6 +32,10 @@ typedef enum MainTaskCmd_Tag
     MainTaskCmd_TimerSigPeriodicStop,
     MainTaskCmd_TimerSigPeriodicDelete,
     MainTaskCmd_TimerSigPeriodicSimulate,
+    MainTaskCmd_TimerSigPeriodicRelaunchAfterWrap,
+    MainTaskCmd_TimerSigPeriodicRelaunchHugePeriod,
+    MainTaskCmd_TimerSigPeriodicRelaunchHugePeriodFromCurMoment,
+    MainTaskCmd_SetTick64BeforeWrap,
     MainTaskCmd_TimerSigOneShotCreate,
     MainTaskCmd_TimerSigOneShotCreateStatic,
     MainTaskCmd_TimerSigOneShotStart,
@@ -125,8 +130,28 @@ TestOsTimerSigFreertos::~TestOsTimerSigFreertos()
     g_pTestClass = nullptr;
 }
 
+/**
+ * @brief The offset which is added to the monotonic tick counter seen by os_timer_sig
+ *        (os_time_mono_get_tick64 is wrapped with the linker option --wrap).
+ */
+static volatile os_time_mono_tick64_t g_tick64_offset;
+
+/**
+ * @brief The number of ticks in one wrap-around period of the 32-bit tick counter.
+ */
+#define TEST_TICK64_WRAP ((os_time_mono_tick64_t)1 << 32U)
+
 extern "C" {
 
+os_time_mono_tick64_t
+__real_os_time_mono_get_tick64(void);
+
+os_time_mono_tick64_t
+__wrap_os_time_mono_get_tick64(void)
+{
+    return __real_os_time_mono_get_tick64() + g_tick64_offset;
+}
+
 static struct timespec
 timespec_get_clock_monotonic(void)
 {
@@ -383,6 +408,26 @@ cmdHandlerTask(void* p_param)
             case MainTaskCmd_TimerSigPeriodicSimulate:
                 os_timer_sig_periodic_simulate(pObj->p_timer_sig_periodic);
                 break;
+            case MainTaskCmd_TimerSigPeriodicRelaunchAfterWrap:
+                // The timer was triggered 50 ticks before the wrap-around of the 32-bit tick counter
+                os_timer_sig_periodic_update_timestamp_when_timer_was_triggered(
+                    pObj->p_timer_sig_periodic,
+                    (TickType_t)(TEST_TICK64_WRAP - pdMS_TO_TICKS(50)));
+                os_timer_sig_periodic_relaunch(pObj->p_timer_sig_periodic, false);
+                break;
+            case MainTaskCmd_TimerSigPeriodicRelaunchHugePeriod:
+                // os_delta_ticks_from_ms saturates to OS_DELTA_TICKS_MAX, which does not fit in int32_t
+                os_timer_sig_periodic_set_period_ms(pObj->p_timer_sig_periodic, UINT32_MAX);
+                os_timer_sig_periodic_relaunch(pObj->p_timer_sig_periodic, false);
+                break;
+            case MainTaskCmd_TimerSigPeriodicRelaunchHugePeriodFromCurMoment:
+                os_timer_sig_periodic_set_period(pObj->p_timer_sig_periodic, OS_DELTA_TICKS_MAX);
+                os_timer_sig_periodic_relaunch(pObj->p_timer_sig_periodic, true);
+                break;
+            case MainTaskCmd_SetTick64BeforeWrap:
+                g_tick64_offset = 0;
+                g_tick64_offset = (TEST_TICK64_WRAP - pdMS_TO_TICKS(150)) - os_time_mono_get_tick64();
+                break;
             case MainTaskCmd_TimerSigOneShotCreate:
                 pObj->p_timer_sig_one_shot = os_timer_sig_one_shot_create(
                     "timer_one_shot",
@@ -701,4 +746,75 @@ TEST_F(TestOsTimerSigFreertos, test1) // NOLINT
     cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicDelete);
     ASSERT_EQ(nullptr, this->p_timer_sig_periodic);
 #endif
+
+#if 1
+    //
+    // Test os_timer_sig_periodic_relaunch with the period which spans the wrap-around of the tick counter
+    //
+
+    this->counter0 = 0;
+    this->counter1 = 0;
+    cmdQueue.push_and_wait(MainTaskCmd_SetTick64BeforeWrap);
+    // cur tick: WRAP-150
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicCreate);
+    ASSERT_NE(nullptr, this->p_timer_sig_periodic);
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicStart);
+    // cur tick: WRAP-150, next timer at WRAP-50
+    sleep_ms(120);
+    // cur tick: WRAP-30
+    ASSERT_EQ(1, this->counter1);
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicStop);
+    sleep_ms(50);
+    // cur tick: WRAP+20
+    ASSERT_EQ(1, this->counter1);
+    disableCheckingIfCurThreadIsFreeRTOS();
+    const os_time_mono_tick64_t tick64_after_wrap = os_time_mono_get_tick64();
+    enableCheckingIfCurThreadIsFreeRTOS();
+    ASSERT_GE(tick64_after_wrap, TEST_TICK64_WRAP);
+
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicRelaunchAfterWrap);
+    // cur tick: WRAP+20, the last trigger at WRAP-50, next timer at WRAP+50 (not immediately and not after the period)
+    ASSERT_TRUE(os_timer_sig_periodic_is_active(this->p_timer_sig_periodic));
+    sleep_ms(10);
+    // cur tick: WRAP+30
+    ASSERT_EQ(1, this->counter1);
+    sleep_ms(40);
+    // cur tick: WRAP+70, next timer at WRAP+150
+    ASSERT_EQ(2, this->counter1);
+    sleep_ms(100);
+    // cur tick: WRAP+170, next timer at WRAP+250
+    ASSERT_EQ(3, this->counter1);
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicStop);
+
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicDelete);
+    ASSERT_EQ(nullptr, this->p_timer_sig_periodic);
+#endif
+
+#if 1
+    //
+    // Test os_timer_sig_periodic_relaunch with a huge period (the timer must not fire immediately)
+    //
+
+    this->counter0 = 0;
+    this->counter1 = 0;
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicCreate);
+    ASSERT_NE(nullptr, this->p_timer_sig_periodic);
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicStart);
+    sleep_ms(50);
+    ASSERT_EQ(0, this->counter1);
+
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicRelaunchHugePeriod);
+    ASSERT_TRUE(os_timer_sig_periodic_is_active(this->p_timer_sig_periodic));
+    sleep_ms(200);
+    ASSERT_EQ(0, this->counter1);
+
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicRelaunchHugePeriodFromCurMoment);
+    ASSERT_TRUE(os_timer_sig_periodic_is_active(this->p_timer_sig_periodic));
+    sleep_ms(200);
+    ASSERT_EQ(0, this->counter1);
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicStop);
+
+    cmdQueue.push_and_wait(MainTaskCmd_TimerSigPeriodicDelete);
+    ASSERT_EQ(nullptr, this->p_timer_sig_periodic);
+#endif
 }
@@ -93,3 +93,93 @@ TEST_F(TestTimeUnits, test_time_units_conv_ms_to_us_max) // NOLINT
 {
     ASSERT_EQ(0xFFFFFFFFLLU * 1000U, time_units_conv_ms_to_us(0xFFFFFFFFU));
 }
+
+TEST_F(TestTimeUnits, test_time_units_conv_scale) // NOLINT
+{
+    ASSERT_EQ(1000, time_units_conv_scale(1, 1, 1000));
+    ASSERT_EQ(1, time_units_conv_scale(1999, 1000, 1));
+    ASSERT_EQ(2, time_units_conv_scale_ceil(1001, 1000, 1));
+    ASSERT_EQ(1, time_units_conv_scale_ceil(1000, 1000, 1));
+    ASSERT_EQ(0, time_units_conv_scale_ceil(0, 1000, 1));
+    // Rates which are not multiples of each other
+    ASSERT_EQ(1022, time_units_conv_scale(999, 1000, 1024));
+    ASSERT_EQ(1023, time_units_conv_scale_ceil(999, 1000, 1024));
+    ASSERT_EQ(1024, time_units_conv_scale_ceil(1000, 1000, 1024));
+    ASSERT_EQ(1000, time_units_conv_scale_ceil(1024, 1024, 1000));
+    // No overflow of the intermediate product
+    ASSERT_EQ(UINT64_MAX / 1024U * 1000U, time_units_conv_scale(UINT64_MAX / 1024U * 1024U, 1024, 1000));
+    ASSERT_EQ(UINT64_MAX / 1000000U * 300U, time_units_conv_scale(UINT64_MAX / 1000000U * 1000000U, 1000000, 300));
+}
+
+TEST_F(TestTimeUnits, test_time_units_conv_no_overflow) // NOLINT
+{
+    ASSERT_EQ(0xFFFFFFFFLLU * 1000000U, time_units_conv_seconds_to_us(0xFFFFFFFFU));
+    ASSERT_EQ(4294967, time_units_conv_ms_to_seconds(0xFFFFFFFFU));
+    ASSERT_EQ(0xFFFFFFFFLLU * 1000U, time_units_conv_us_to_ms(0xFFFFFFFFLLU * 1000000U));
+    ASSERT_EQ(0xFFFFFFFFLLU, time_units_conv_us_to_seconds(0xFFFFFFFFLLU * 1000000U + 999999U));
+}
+
+TEST_F(TestTimeUnits, test_time_units_conv_ticks) // NOLINT
+{
+    ASSERT_EQ(100, time_units_conv_seconds_to_ticks(1, 100));
+    ASSERT_EQ(0, time_units_conv_ms_to_ticks(9, 100));
+    ASSERT_EQ(1, time_units_conv_ms_to_ticks_ceil(9, 100));
+    ASSERT_EQ(1, time_units_conv_ms_to_ticks(10, 100));
+    ASSERT_EQ(1, time_units_conv_ms_to_ticks_ceil(10, 100));
+    ASSERT_EQ(0, time_units_conv_us_to_ticks(999, 1000));
+    ASSERT_EQ(1, time_units_conv_us_to_ticks_ceil(1, 1000));
+    ASSERT_EQ(2, time_units_conv_ticks_to_seconds(299, 100));
+    ASSERT_EQ(2990, time_units_conv_ticks_to_ms(299, 100));
+    ASSERT_EQ(2990000, time_units_conv_ticks_to_us(299, 100));
+    ASSERT_EQ(1000000, time_units_conv_ticks_to_us(1024, 1024));
+
+    // pdMS_TO_TICKS overflows here with 32-bit TickType_t at 1000 Hz
+    ASSERT_EQ(0xFFFFFFFFLLU, time_units_conv_ms_to_ticks(0xFFFFFFFFU, 1000));
+    ASSERT_EQ(0xFFFFFFFFLLU * 10U, time_units_conv_ms_to_ticks(0xFFFFFFFFU, 10000));
+}
+
+TEST_F(TestTimeUnits, test_time_units_conv_sat) // NOLINT
+{
+    ASSERT_EQ(4294967000, time_units_conv_seconds_to_ms_sat(0xFFFFFFFFU / 1000U));
+    ASSERT_EQ(0xFFFFFFFFU, time_units_conv_seconds_to_ms_sat(0xFFFFFFFFU / 1000U + 1));
+    ASSERT_EQ(0xFFFFFFFFU, time_units_conv_us_to_ms_sat(0xFFFFFFFFLLU * 1000U + 999U));
+    ASSERT_EQ(0xFFFFFFFFU, time_units_conv_us_to_ms_sat(0xFFFFFFFFLLU * 1000U + 1000U));
+    ASSERT_EQ(0xFFFFFFFFU, time_units_conv_seconds_to_ticks_sat(0xFFFFFFFFU / 1000U + 1, 1000));
+    ASSERT_EQ(0xFFFFFFFFU, time_units_conv_ms_to_ticks_sat(0xFFFFFFFFU, 10000));
+    ASSERT_EQ(0xFFFFFFFEU, time_units_conv_ms_to_ticks_sat(0xFFFFFFFEU, 1000));
+    ASSERT_EQ(0xFFFFFFFFU, time_units_conv_us_to_ticks_sat(UINT64_MAX, 1000));
+    ASSERT_EQ(0xFFFFFFFFU, time_units_conv_ticks_to_ms_sat(0x100000000LLU, 1000));
+    ASSERT_EQ(1000U, time_units_conv_ticks_to_ms_sat(100, 100));
+}
+
+TEST_F(TestTimeUnits, test_time_units_conv_checked) // NOLINT
+{
+    uint32_t val = 123;
+    ASSERT_TRUE(time_units_conv_seconds_to_ms_checked(0xFFFFFFFFU / 1000U, &val));
+    ASSERT_EQ(4294967000, val);
+    val = 123;
+    ASSERT_FALSE(time_units_conv_seconds_to_ms_checked(0xFFFFFFFFU / 1000U + 1, &val));
+    ASSERT_EQ(123, val);
+
+    ASSERT_TRUE(time_units_conv_us_to_ms_checked(0xFFFFFFFFLLU * 1000U + 999U, &val));
+    ASSERT_EQ(0xFFFFFFFFU, val);
+    val = 123;
+    ASSERT_FALSE(time_units_conv_us_to_ms_checked(0xFFFFFFFFLLU * 1000U + 1000U, &val));
+    ASSERT_EQ(123, val);
+
+    ASSERT_TRUE(time_units_conv_ms_to_ticks_checked(0xFFFFFFFFU, 1000, &val));
+    ASSERT_EQ(0xFFFFFFFFU, val);
+    val = 123;
+    ASSERT_FALSE(time_units_conv_ms_to_ticks_checked(0xFFFFFFFFU, 1001, &val));
+    ASSERT_EQ(123, val);
+
+    ASSERT_TRUE(time_units_conv_us_to_ticks_checked(1000000, 100, &val));
+    ASSERT_EQ(100, val);
+    ASSERT_FALSE(time_units_conv_us_to_ticks_checked(UINT64_MAX, 100, &val));
+    ASSERT_EQ(100, val);
+
+    ASSERT_TRUE(time_units_conv_ticks_to_ms_checked(100, 1000, &val));
+    ASSERT_EQ(100, val);
+    ASSERT_FALSE(time_units_conv_ticks_to_ms_checked(0x100000000LLU, 1000, &val));
+    ASSERT_EQ(100, val);
+}